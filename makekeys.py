@@ -6,18 +6,120 @@ pattern = re.compile(r'^#define\s+XKB_KEY_(?P<name>\w+)\s+(?P<value>0x[0-9a-fA-F
 matches = [pattern.match(line) for line in open(sys.argv[1])]
 entries = [(m.group("name"), int(m.group("value"), 16)) for m in matches if m]
 
+# Must match keysym_name_hash() in src/keysym.c.
+def name_hash(seed, name):
+    h = (seed ^ 0x811c9dc5) & 0xffffffff
+    for c in bytearray(name, 'ascii'):
+        h = ((h ^ c) * 0x01000193) & 0xffffffff
+    return h
+
+# Build a minimal perfect hash of keys, by hash and displace: the keys are
+# put into buckets by their hash with seed 0, and for each bucket, biggest
+# first, we look for a seed which puts all of its keys into free slots.
+# Buckets of a single key are put directly into the slots left, which is
+# recorded as a negative seed.
+def perfect_hash(keys):
+    size = len(keys)
+    num_buckets = max(1, size // 2)
+    buckets = [[] for _ in range(num_buckets)]
+    for i, key in enumerate(keys):
+        buckets[name_hash(0, key) % num_buckets].append(i)
+
+    displace = [0] * num_buckets
+    slots = [None] * size
+    order = sorted(range(num_buckets), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if len(buckets[b]) <= 1:
+            break
+        seed = 1
+        while True:
+            taken = [name_hash(seed, keys[i]) % size for i in buckets[b]]
+            if len(set(taken)) == len(taken) and \
+               all(slots[s] is None for s in taken):
+                break
+            seed += 1
+        displace[b] = seed
+        for i, s in zip(buckets[b], taken):
+            slots[s] = i
+
+    free = (s for s in range(size) if slots[s] is None)
+    for b in order:
+        if len(buckets[b]) != 1:
+            continue
+        s = next(free)
+        displace[b] = -s - 1
+        slots[s] = buckets[b][0]
+
+    return displace, slots
+
+def print_table(ctype, name, values):
+    print('static const {ctype} {name}[] = {{'.format(ctype=ctype, name=name))
+    for i in range(0, len(values), 8):
+        print('    ' + ' '.join('{},'.format(v) for v in values[i:i + 8]))
+    print('};\n')
+
+# The tables hold offsets into a single string pool rather than pointers,
+# so that they need no relocations and can be shared between processes.
 print('''struct name_keysym {
-    const char *name;
     xkb_keysym_t keysym;
+    /* Offset of the name in keysym_names. */
+    uint16_t offset;
 };\n''')
 
+print('#define KEYSYM_NAME_MAX_LEN {}\n'.format(max(len(e[0]) for e in entries)))
+
+by_name = sorted(entries, key=lambda e: e[0].lower())
+
+# All the names, one after the other, in the order of name_to_keysym. Offset
+# 0 is an empty name, so that it can mean "no name" in the tables below.
+offsets = {}
+pool_size = 1
+print('static const char keysym_names[] =')
+print('    "\\0"')
+for (name, _) in by_name:
+    offsets[name] = pool_size
+    pool_size += len(name) + 1
+    print('    "{name}\\0"'.format(name=name))
+print(';\n')
+assert pool_size <= 0x10000
+
 print('static const struct name_keysym name_to_keysym[] = {');
-for (name, _) in sorted(entries, key=lambda e: e[0].lower()):
-    print('    {{ "{name}", XKB_KEY_{name} }},'.format(name=name))
+for (name, _) in by_name:
+    print('    {{ XKB_KEY_{name}, {offset} }},'.format(name=name, offset=offsets[name]))
 print('};\n')
 
-# *.sort() is stable so we always get the first keysym for duplicate
-print('static const struct name_keysym keysym_to_name[] = {');
-for (name, _) in (next(g[1]) for g in itertools.groupby(sorted(entries, key=lambda e: e[1]), key=lambda e: e[1])):
-    print('    {{ "{name}", XKB_KEY_{name} }},'.format(name=name))
+# Exact names, mapped to their entry in name_to_keysym.
+displace, slots = perfect_hash([e[0] for e in by_name])
+print_table('int32_t', 'name_to_keysym_displace', displace)
+print_table('uint16_t', 'name_to_keysym_index', slots)
+
+# Case-folded names, mapped to the first of their entries in name_to_keysym;
+# the others follow it.
+folded, first = [], []
+for i, e in enumerate(by_name):
+    if not folded or folded[-1] != e[0].lower():
+        folded.append(e[0].lower())
+        first.append(i)
+displace, slots = perfect_hash(folded)
+print_table('int32_t', 'name_to_keysym_icase_displace', displace)
+print_table('uint16_t', 'name_to_keysym_icase_index',
+            [first[s] for s in slots])
+
+# The name of each keysym, by pages of 256 keysyms. When a keysym has
+# several names, the first one is used; *.sort() is stable so we always get
+# the first keysym for duplicate.
+first_names = [next(g[1]) for g in itertools.groupby(sorted(entries, key=lambda e: e[1]), key=lambda e: e[1])]
+pages = sorted(set(keysym >> 8 for (_, keysym) in first_names))
+leaves = [[0] * 256 for _ in pages]
+for (name, keysym) in first_names:
+    leaves[pages.index(keysym >> 8)][keysym & 0xff] = offsets[name]
+
+print_table('uint32_t', 'keysym_name_pages',
+            ['0x{:x}'.format(page) for page in pages])
+print('static const uint16_t keysym_name_leaves[][256] = {')
+for leaf in leaves:
+    print('    {')
+    for i in range(0, 256, 16):
+        print('        ' + ' '.join('{},'.format(v) for v in leaf[i:i + 16]))
+    print('    },')
 print('};')
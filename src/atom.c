@@ -70,6 +70,10 @@
  *
  ********************************************************/
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "utils.h"
 #include "atom.h"
 
@@ -83,8 +87,31 @@ struct atom_node {
 struct atom_table {
     struct atom_node *root;
     darray(struct atom_node *) table;
+#ifdef HAVE_PTHREAD
+    /* Taken around every access while the table is shared. */
+    pthread_mutex_t mutex;
+    bool shared;
+#endif
 };
 
+static inline void
+table_lock(struct atom_table *table)
+{
+#ifdef HAVE_PTHREAD
+    if (table->shared)
+        pthread_mutex_lock(&table->mutex);
+#endif
+}
+
+static inline void
+table_unlock(struct atom_table *table)
+{
+#ifdef HAVE_PTHREAD
+    if (table->shared)
+        pthread_mutex_unlock(&table->mutex);
+#endif
+}
+
 struct atom_table *
 atom_table_new(void)
 {
@@ -98,9 +125,28 @@ atom_table_new(void)
     darray_growalloc(table->table, 100);
     darray_append(table->table, NULL);
 
+#ifdef HAVE_PTHREAD
+    if (pthread_mutex_init(&table->mutex, NULL) != 0) {
+        darray_free(table->table);
+        free(table);
+        return NULL;
+    }
+#endif
+
     return table;
 }
 
+bool
+atom_table_set_shared(struct atom_table *table, bool shared)
+{
+#ifdef HAVE_PTHREAD
+    table->shared = shared;
+    return true;
+#else
+    return !shared;
+#endif
+}
+
 static void
 free_atom(struct atom_node *patom)
 {
@@ -121,17 +167,24 @@ atom_table_free(struct atom_table *table)
 
     free_atom(table->root);
     darray_free(table->table);
+#ifdef HAVE_PTHREAD
+    pthread_mutex_destroy(&table->mutex);
+#endif
     free(table);
 }
 
 const char *
 atom_text(struct atom_table *table, xkb_atom_t atom)
 {
-    if (atom >= darray_size(table->table) ||
-        darray_item(table->table, atom) == NULL)
-        return NULL;
+    const char *string = NULL;
+
+    table_lock(table);
+    if (atom < darray_size(table->table) &&
+        darray_item(table->table, atom) != NULL)
+        string = darray_item(table->table, atom)->string;
+    table_unlock(table);
 
-    return darray_item(table->table, atom)->string;
+    return string;
 }
 
 char *
@@ -187,14 +240,17 @@ atom_lookup(struct atom_table *table, const char *string, size_t len)
 {
     struct atom_node **nodep;
     unsigned int fingerprint;
+    xkb_atom_t atom = XKB_ATOM_NONE;
 
     if (!string)
         return XKB_ATOM_NONE;
 
-    if (!find_node_pointer(table, string, len, &nodep, &fingerprint))
-        return XKB_ATOM_NONE;
+    table_lock(table);
+    if (find_node_pointer(table, string, len, &nodep, &fingerprint))
+        atom = (*nodep)->atom;
+    table_unlock(table);
 
-    return (*nodep)->atom;
+    return atom;
 }
 
 /*
@@ -202,17 +258,13 @@ atom_lookup(struct atom_table *table, const char *string, size_t len)
  * dynamically allocated, NUL-terminated, not be free'd by the caller
  * and not be used afterwards. Use to avoid some redundant allocations.
  */
-xkb_atom_t
-atom_intern(struct atom_table *table, const char *string, size_t len,
-            bool steal)
+static xkb_atom_t
+intern(struct atom_table *table, const char *string, size_t len, bool steal)
 {
     struct atom_node **nodep;
     struct atom_node *node;
     unsigned int fingerprint;
 
-    if (!string || len == 0)
-        return XKB_ATOM_NONE;
-
     if (find_node_pointer(table, string, len, &nodep, &fingerprint)) {
         if (steal)
             free(UNCONSTIFY(string));
@@ -242,3 +294,19 @@ atom_intern(struct atom_table *table, const char *string, size_t len,
 
     return node->atom;
 }
+
+xkb_atom_t
+atom_intern(struct atom_table *table, const char *string, size_t len,
+            bool steal)
+{
+    xkb_atom_t atom;
+
+    if (!string || len == 0)
+        return XKB_ATOM_NONE;
+
+    table_lock(table);
+    atom = intern(table, string, len, steal);
+    table_unlock(table);
+
+    return atom;
+}
@@ -36,6 +36,13 @@ atom_table_new(void);
 void
 atom_table_free(struct atom_table *table);
 
+/*
+ * While a table is shared, it may be used by several threads at once.
+ * Returns false if threads are not supported.
+ */
+bool
+atom_table_set_shared(struct atom_table *table, bool shared);
+
 xkb_atom_t
 atom_lookup(struct atom_table *table, const char *string, size_t len);
 
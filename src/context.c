@@ -51,11 +51,29 @@ struct xkb_context {
 
     struct atom_table *atom_table;
 
+    /* Statistics of the keymap currently being compiled, if wanted. */
+    uint64_t *compile_stats;
+
+    struct xkb_rules_cache *rules_cache;
+
+    /* Where the messages of a worker context go. */
+    darray_log_message *log_list;
+
+    /* The files being parsed ahead of a parallel compilation, if any. */
+    struct include_prefetch *include_prefetch;
+    /* Overrides the number of online CPUs, if not 0. */
+    unsigned int num_cpus;
+
+    /* Keymaps created from names, if enabled. */
+    struct xkb_keymap_cache *keymap_cache;
+    unsigned int keymap_cache_size;
+
     /* Buffer for the *Text() functions. */
     char text_buffer[2048];
     size_t text_next;
 
     unsigned int use_environment_names : 1;
+    unsigned int is_worker : 1;
 };
 
 /**
@@ -87,6 +105,7 @@ xkb_context_include_path_append(struct xkb_context *ctx, const char *path)
 #endif
 
     darray_append(ctx->includes, tmp);
+    xkb_context_invalidate_keymap_cache(ctx);
     return 1;
 
 err:
@@ -134,6 +153,8 @@ xkb_context_include_path_clear(struct xkb_context *ctx)
     darray_foreach(path, ctx->failed_includes)
         free(*path);
     darray_free(ctx->failed_includes);
+
+    xkb_context_invalidate_keymap_cache(ctx);
 }
 
 /**
@@ -201,10 +222,16 @@ xkb_context_ref(struct xkb_context *ctx)
 XKB_EXPORT void
 xkb_context_unref(struct xkb_context *ctx)
 {
-    if (!ctx || --ctx->refcnt > 0)
+    if (!ctx)
+        return;
+
+    if (--ctx->refcnt > 0) {
+        xkb_context_collect_keymap_cache(ctx);
         return;
+    }
 
     xkb_context_include_path_clear(ctx);
+    xkb_rules_cache_free(ctx->rules_cache);
     atom_table_free(ctx->atom_table);
     free(ctx);
 }
@@ -328,6 +355,82 @@ xkb_context_new(enum xkb_context_flags flags)
     return ctx;
 }
 
+/* Workers only log to their log list. */
+ATTR_PRINTF(3, 0) static void
+worker_log_fn(struct xkb_context *ctx, enum xkb_log_level level,
+              const char *fmt, va_list args)
+{
+}
+
+struct xkb_context *
+xkb_context_new_worker(struct xkb_context *parent)
+{
+    struct xkb_context *ctx = calloc(1, sizeof(*ctx));
+
+    if (!ctx)
+        return NULL;
+
+    ctx->refcnt = 1;
+    ctx->log_fn = worker_log_fn;
+    ctx->log_level = parent->log_level;
+    ctx->log_verbosity = parent->log_verbosity;
+    ctx->names_dflt = parent->names_dflt;
+    ctx->includes = parent->includes;
+    ctx->failed_includes = parent->failed_includes;
+    ctx->atom_table = parent->atom_table;
+    ctx->rules_cache = parent->rules_cache;
+    ctx->num_cpus = parent->num_cpus;
+    ctx->use_environment_names = parent->use_environment_names;
+    ctx->is_worker = true;
+
+    return ctx;
+}
+
+void
+xkb_context_free_worker(struct xkb_context *ctx)
+{
+    /* Everything else belongs to the parent. */
+    free(ctx);
+}
+
+bool
+xkb_context_is_worker(struct xkb_context *ctx)
+{
+    return ctx->is_worker;
+}
+
+void
+xkb_context_set_log_list(struct xkb_context *ctx, darray_log_message *log)
+{
+    ctx->log_list = log;
+}
+
+void
+xkb_context_flush_log(struct xkb_context *ctx, darray_log_message *log)
+{
+    struct xkb_log_message *msg;
+
+    darray_foreach(msg, *log)
+        xkb_log(ctx, msg->level, "%s", msg->text);
+    xkb_log_list_free(log);
+}
+
+void
+xkb_log_list_free(darray_log_message *log)
+{
+    struct xkb_log_message *msg;
+
+    darray_foreach(msg, *log)
+        free(msg->text);
+    darray_free(*log);
+}
+
+bool
+xkb_context_set_shared(struct xkb_context *ctx, bool shared)
+{
+    return atom_table_set_shared(ctx->atom_table, shared);
+}
+
 xkb_atom_t
 xkb_atom_lookup(struct xkb_context *ctx, const char *string)
 {
@@ -337,12 +440,18 @@ xkb_atom_lookup(struct xkb_context *ctx, const char *string)
 xkb_atom_t
 xkb_atom_intern(struct xkb_context *ctx, const char *string, size_t len)
 {
+    if (ctx->compile_stats)
+        ctx->compile_stats[XKB_COMPILE_STAT_ATOMS_INTERNED]++;
+
     return atom_intern(ctx->atom_table, string, len, false);
 }
 
 xkb_atom_t
 xkb_atom_steal(struct xkb_context *ctx, char *string)
 {
+    if (ctx->compile_stats)
+        ctx->compile_stats[XKB_COMPILE_STAT_ATOMS_INTERNED]++;
+
     return atom_intern(ctx->atom_table, string, strlen(string), true);
 }
 
@@ -363,9 +472,16 @@ xkb_log(struct xkb_context *ctx, enum xkb_log_level level,
         const char *fmt, ...)
 {
     va_list args;
+    struct xkb_log_message msg;
 
     va_start(args, fmt);
-    ctx->log_fn(ctx, level, fmt, args);
+    if (!ctx->log_list) {
+        ctx->log_fn(ctx, level, fmt, args);
+    }
+    else if (vasprintf(&msg.text, fmt, args) >= 0) {
+        msg.level = level;
+        darray_append(*ctx->log_list, msg);
+    }
     va_end(args);
 }
 
@@ -433,6 +549,134 @@ xkb_context_get_buffer(struct xkb_context *ctx, size_t size)
     return rtrn;
 }
 
+void
+xkb_context_set_compile_stats(struct xkb_context *ctx, uint64_t *stats)
+{
+    ctx->compile_stats = stats;
+}
+
+bool
+xkb_context_collects_stats(struct xkb_context *ctx)
+{
+    return ctx->compile_stats != NULL;
+}
+
+void
+xkb_context_stat_add(struct xkb_context *ctx, enum xkb_compile_stat stat,
+                     uint64_t n)
+{
+    if (ctx->compile_stats)
+        ctx->compile_stats[stat] += n;
+}
+
+uint64_t
+xkb_context_stat_timer_start(struct xkb_context *ctx)
+{
+    return ctx->compile_stats ? time_now_ns() : 0;
+}
+
+void
+xkb_context_stat_timer_stop(struct xkb_context *ctx,
+                            enum xkb_compile_stat stat, uint64_t start)
+{
+    if (ctx->compile_stats)
+        ctx->compile_stats[stat] += time_now_ns() - start;
+}
+
+struct include_prefetch *
+xkb_context_get_include_prefetch(struct xkb_context *ctx)
+{
+    return ctx->include_prefetch;
+}
+
+void
+xkb_context_set_include_prefetch(struct xkb_context *ctx,
+                                 struct include_prefetch *prefetch)
+{
+    ctx->include_prefetch = prefetch;
+}
+
+unsigned int
+xkb_context_get_num_cpus(struct xkb_context *ctx)
+{
+    long num_cpus;
+
+    if (ctx->num_cpus > 0)
+        return ctx->num_cpus;
+
+    num_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return num_cpus > 0 ? num_cpus : 1;
+}
+
+void
+xkb_context_set_num_cpus(struct xkb_context *ctx, unsigned int num_cpus)
+{
+    ctx->num_cpus = num_cpus;
+}
+
+struct xkb_rules_cache *
+xkb_context_get_rules_cache(struct xkb_context *ctx)
+{
+    return ctx->rules_cache;
+}
+
+void
+xkb_context_set_rules_cache(struct xkb_context *ctx,
+                            struct xkb_rules_cache *cache)
+{
+    ctx->rules_cache = cache;
+}
+
+struct xkb_keymap_cache *
+xkb_context_get_keymap_cache(struct xkb_context *ctx)
+{
+    return ctx->keymap_cache;
+}
+
+void
+xkb_context_set_keymap_cache(struct xkb_context *ctx,
+                             struct xkb_keymap_cache *cache)
+{
+    ctx->keymap_cache = cache;
+}
+
+unsigned int
+xkb_context_get_keymap_cache_size(struct xkb_context *ctx)
+{
+    return ctx->keymap_cache_size;
+}
+
+XKB_EXPORT void
+xkb_context_set_keymap_cache_size(struct xkb_context *ctx, unsigned int size)
+{
+    ctx->keymap_cache_size = size;
+    xkb_keymap_cache_trim(ctx->keymap_cache, size);
+}
+
+XKB_EXPORT void
+xkb_context_invalidate_keymap_cache(struct xkb_context *ctx)
+{
+    struct xkb_keymap_cache *cache = ctx->keymap_cache;
+
+    /* Freeing the keymaps calls back into the context. */
+    ctx->keymap_cache = NULL;
+    xkb_keymap_cache_free(cache);
+}
+
+void
+xkb_context_collect_keymap_cache(struct xkb_context *ctx)
+{
+    if (!ctx->keymap_cache ||
+        (unsigned int) ctx->refcnt !=
+        xkb_keymap_cache_num_unused(ctx->keymap_cache))
+        return;
+
+    /* Hold on to the context while the keymaps release it. */
+    ctx->refcnt++;
+    xkb_context_invalidate_keymap_cache(ctx);
+    xkb_context_unref(ctx);
+}
+
 const char *
 xkb_context_get_default_rules(struct xkb_context *ctx)
 {
@@ -490,3 +734,22 @@ xkb_context_get_default_options(struct xkb_context *ctx)
 
     return env ? env : DEFAULT_XKB_OPTIONS;
 }
+
+void
+xkb_context_sanitize_rule_names(struct xkb_context *ctx,
+                                struct xkb_rule_names *rmlvo)
+{
+    if (isempty(rmlvo->rules))
+        rmlvo->rules = xkb_context_get_default_rules(ctx);
+    if (isempty(rmlvo->model))
+        rmlvo->model = xkb_context_get_default_model(ctx);
+    /* Layout and variant are tied together, so don't try to use one from
+     * the caller and one from the environment. */
+    if (isempty(rmlvo->layout)) {
+        rmlvo->layout = xkb_context_get_default_layout(ctx);
+        rmlvo->variant = xkb_context_get_default_variant(ctx);
+    }
+    /* Options can be empty, so respect that if passed in. */
+    if (rmlvo->options == NULL)
+        rmlvo->options = xkb_context_get_default_options(ctx);
+}
@@ -66,6 +66,156 @@ xkb_atom_text(struct xkb_context *ctx, xkb_atom_t atom);
 char *
 xkb_context_get_buffer(struct xkb_context *ctx, size_t size);
 
+/*
+ * A worker context is used by a thread working on behalf of @parent, e.g.
+ * to parse files during a parallel compilation.  It shares the include
+ * paths, the rules cache and the atom table of @parent, which must outlive
+ * it, but has its own text buffer and statistics, and does not add to the
+ * rules cache.  The atom table must be shared, see xkb_context_set_shared(),
+ * while workers use it.
+ *
+ * A worker context only logs to its log list, see xkb_context_set_log_list().
+ */
+struct xkb_context *
+xkb_context_new_worker(struct xkb_context *parent);
+
+void
+xkb_context_free_worker(struct xkb_context *ctx);
+
+bool
+xkb_context_is_worker(struct xkb_context *ctx);
+
+struct xkb_log_message {
+    enum xkb_log_level level;
+    char *text;
+};
+
+typedef darray(struct xkb_log_message) darray_log_message;
+
+/*
+ * While @log is set, the messages logged on @ctx are kept in it rather
+ * than passed to the log function, so that they can be passed on later
+ * and in order with xkb_context_flush_log().  Set it back to NULL to stop.
+ */
+void
+xkb_context_set_log_list(struct xkb_context *ctx, darray_log_message *log);
+
+/* Logs the messages of @log on @ctx, and frees them. */
+void
+xkb_context_flush_log(struct xkb_context *ctx, darray_log_message *log);
+
+void
+xkb_log_list_free(darray_log_message *log);
+
+/*
+ * Allows the atom table of @ctx to be used by several threads at once.
+ * Returns false if threads are not supported.
+ */
+bool
+xkb_context_set_shared(struct xkb_context *ctx, bool shared);
+
+/*
+ * Compile statistics. While a keymap is being compiled with the
+ * XKB_MAP_COMPILE_STATS flag, its statistics array is set on the context,
+ * and the functions below update it; otherwise they do nothing.
+ */
+void
+xkb_context_set_compile_stats(struct xkb_context *ctx, uint64_t *stats);
+
+bool
+xkb_context_collects_stats(struct xkb_context *ctx);
+
+void
+xkb_context_stat_add(struct xkb_context *ctx, enum xkb_compile_stat stat,
+                     uint64_t n);
+
+/* Returns a start time to pass to xkb_context_stat_timer_stop(). */
+uint64_t
+xkb_context_stat_timer_start(struct xkb_context *ctx);
+
+/* Adds the time passed since @start to @stat. */
+void
+xkb_context_stat_timer_stop(struct xkb_context *ctx,
+                            enum xkb_compile_stat stat, uint64_t start);
+
+/*
+ * The rules files parsed by xkbcomp/rules.c are kept in the context, so
+ * that they are only parsed once; the cache is implemented there.
+ */
+struct xkb_rules_cache;
+
+struct xkb_rules_cache *
+xkb_context_get_rules_cache(struct xkb_context *ctx);
+
+void
+xkb_context_set_rules_cache(struct xkb_context *ctx,
+                            struct xkb_rules_cache *cache);
+
+void
+xkb_rules_cache_free(struct xkb_rules_cache *cache);
+
+/*
+ * The included files parsed ahead of a parallel compilation are kept in
+ * the context while it runs, for ProcessIncludeFile(); the prefetch is
+ * implemented in xkbcomp/include.c.
+ */
+struct include_prefetch;
+
+struct include_prefetch *
+xkb_context_get_include_prefetch(struct xkb_context *ctx);
+
+void
+xkb_context_set_include_prefetch(struct xkb_context *ctx,
+                                 struct include_prefetch *prefetch);
+
+/*
+ * The number of CPUs parallel compilations plan their workers for: the
+ * number of online CPUs, unless set otherwise, e.g. by the tests, so that
+ * the workers run on machines with a single CPU too.  Setting 0 goes back
+ * to the number of online CPUs.
+ */
+unsigned int
+xkb_context_get_num_cpus(struct xkb_context *ctx);
+
+void
+xkb_context_set_num_cpus(struct xkb_context *ctx, unsigned int num_cpus);
+
+/*
+ * The keymaps created from names are kept in the context if the user
+ * asked for it; the cache is implemented in keymap.c.
+ *
+ * The cached keymaps hold references on the context, like all keymaps.
+ * So that the context can still be freed, it drops the cache once the
+ * cache holds the only references on it, which the context and the
+ * keymaps check with xkb_context_collect_keymap_cache() whenever they
+ * lose a reference.
+ */
+struct xkb_keymap_cache;
+
+struct xkb_keymap_cache *
+xkb_context_get_keymap_cache(struct xkb_context *ctx);
+
+void
+xkb_context_set_keymap_cache(struct xkb_context *ctx,
+                             struct xkb_keymap_cache *cache);
+
+unsigned int
+xkb_context_get_keymap_cache_size(struct xkb_context *ctx);
+
+void
+xkb_context_collect_keymap_cache(struct xkb_context *ctx);
+
+/* Evicts the least recently used keymaps beyond @size. */
+void
+xkb_keymap_cache_trim(struct xkb_keymap_cache *cache, unsigned int size);
+
+/* Returns the number of cached keymaps not referenced outside the cache. */
+unsigned int
+xkb_keymap_cache_num_unused(struct xkb_keymap_cache *cache);
+
+void
+xkb_keymap_cache_free(struct xkb_keymap_cache *cache);
+
 ATTR_PRINTF(3, 4) void
 xkb_log(struct xkb_context *ctx, enum xkb_log_level level,
         const char *fmt, ...);
@@ -95,6 +245,11 @@ xkb_context_get_default_variant(struct xkb_context *ctx);
 const char *
 xkb_context_get_default_options(struct xkb_context *ctx);
 
+/* Replaces the unset fields of @rmlvo with the defaults of @ctx. */
+void
+xkb_context_sanitize_rule_names(struct xkb_context *ctx,
+                                struct xkb_rule_names *rmlvo);
+
 /*
  * The format is not part of the argument list in order to avoid the
  * "ISO C99 requires rest arguments to be used" warning when only the
@@ -0,0 +1,203 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * A small open-addressing hash map from 32 bit keys (atoms, keysyms,
+ * keycodes) to 32 bit values. It is meant to index darrays by some key,
+ * so the values are usually item indexes; indexes, unlike pointers, stay
+ * valid when the darray is reallocated.
+ *
+ * SYNOPSIS
+ *
+ *     struct hashmap map;
+ *     hashmap_init(&map);
+ *     hashmap_free(&map);
+ *
+ *     bool hashmap_lookup(struct hashmap *map, uint32_t key,
+ *                         uint32_t *value_out);
+ *     bool hashmap_insert(struct hashmap *map, uint32_t key, uint32_t value);
+ *     void hashmap_remove(struct hashmap *map, uint32_t key);
+ *     void hashmap_clear(struct hashmap *map);
+ *
+ * hashmap_insert() replaces the value if the key is already in the map, and
+ * only fails if it cannot allocate memory.
+ */
+
+struct hashmap_entry {
+    uint32_t key;
+    /* The value plus one; zero marks an empty slot. */
+    uint32_t value1;
+};
+
+struct hashmap {
+    struct hashmap_entry *entries;
+    /* Always zero or a power of two. */
+    uint32_t alloc;
+    uint32_t size;
+};
+
+static inline void
+hashmap_init(struct hashmap *map)
+{
+    map->entries = NULL;
+    map->alloc = 0;
+    map->size = 0;
+}
+
+static inline void
+hashmap_free(struct hashmap *map)
+{
+    free(map->entries);
+    hashmap_init(map);
+}
+
+static inline void
+hashmap_clear(struct hashmap *map)
+{
+    if (map->entries)
+        memset(map->entries, 0, map->alloc * sizeof(*map->entries));
+    map->size = 0;
+}
+
+static inline uint32_t
+hashmap_slot(const struct hashmap *map, uint32_t key)
+{
+    /* Mix the high bits in; keysyms often differ only there. */
+    key ^= key >> 16;
+    key *= UINT32_C(0x45d9f3b);
+    key ^= key >> 16;
+    return key & (map->alloc - 1);
+}
+
+static inline bool
+hashmap_lookup(const struct hashmap *map, uint32_t key, uint32_t *value_out)
+{
+    uint32_t i;
+
+    if (map->size == 0)
+        return false;
+
+    for (i = hashmap_slot(map, key);
+         map->entries[i].value1 != 0;
+         i = (i + 1) & (map->alloc - 1)) {
+        if (map->entries[i].key == key) {
+            *value_out = map->entries[i].value1 - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static inline bool
+hashmap_insert(struct hashmap *map, uint32_t key, uint32_t value);
+
+static inline bool
+hashmap_grow(struct hashmap *map)
+{
+    struct hashmap old = *map;
+    uint32_t i;
+
+    map->alloc = (old.alloc ? old.alloc * 2 : 16);
+    map->size = 0;
+    map->entries = calloc(map->alloc, sizeof(*map->entries));
+    if (!map->entries) {
+        *map = old;
+        return false;
+    }
+
+    for (i = 0; i < old.alloc; i++)
+        if (old.entries[i].value1 != 0)
+            hashmap_insert(map, old.entries[i].key,
+                           old.entries[i].value1 - 1);
+
+    free(old.entries);
+    return true;
+}
+
+static inline bool
+hashmap_insert(struct hashmap *map, uint32_t key, uint32_t value)
+{
+    uint32_t i;
+
+    /* Keep the load factor under 3/4. */
+    if ((map->size + 1) * 4 > map->alloc * 3)
+        if (!hashmap_grow(map))
+            return false;
+
+    for (i = hashmap_slot(map, key);
+         map->entries[i].value1 != 0;
+         i = (i + 1) & (map->alloc - 1)) {
+        if (map->entries[i].key == key) {
+            map->entries[i].value1 = value + 1;
+            return true;
+        }
+    }
+
+    map->entries[i].key = key;
+    map->entries[i].value1 = value + 1;
+    map->size++;
+    return true;
+}
+
+static inline void
+hashmap_remove(struct hashmap *map, uint32_t key)
+{
+    uint32_t i, j, home;
+    const uint32_t mask = map->alloc - 1;
+
+    if (map->size == 0)
+        return;
+
+    for (i = hashmap_slot(map, key);
+         map->entries[i].value1 != 0;
+         i = (i + 1) & mask)
+        if (map->entries[i].key == key)
+            break;
+
+    if (map->entries[i].value1 == 0)
+        return;
+
+    /*
+     * Shift back the following entries of the probe sequence, so that
+     * lookups do not stop at the hole we leave.
+     */
+    for (j = (i + 1) & mask; map->entries[j].value1 != 0; j = (j + 1) & mask) {
+        home = hashmap_slot(map, map->entries[j].key);
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            map->entries[i] = map->entries[j];
+            i = j;
+        }
+    }
+
+    map->entries[i].value1 = 0;
+    map->size--;
+}
+
+#endif /* HASHMAP_H */
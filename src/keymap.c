@@ -50,6 +50,16 @@
  *
  * ********************************************************/
 
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#ifdef HAVE_MEMFD_CREATE
+#include <sys/mman.h>
+#endif
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 #include "keymap.h"
 #include "text.h"
 
@@ -89,28 +99,43 @@ xkb_keymap_new(struct xkb_context *ctx,
 
     keymap->format = format;
     keymap->flags = flags;
+    keymap->fd = -1;
 
     update_builtin_keymap_fields(keymap);
 
     return keymap;
 }
 
-XKB_EXPORT struct xkb_keymap *
-xkb_keymap_ref(struct xkb_keymap *keymap)
+/*
+ * Start collecting the compile statistics of @keymap on its context, if
+ * they were asked for. Returns the start time to pass to
+ * keymap_stats_end().
+ */
+static uint64_t
+keymap_stats_begin(struct xkb_keymap *keymap)
 {
-    keymap->refcnt++;
-    return keymap;
+    if (!(keymap->flags & XKB_MAP_COMPILE_STATS))
+        return 0;
+
+    xkb_context_set_compile_stats(keymap->ctx, keymap->compile_stats);
+    return xkb_context_stat_timer_start(keymap->ctx);
 }
 
-XKB_EXPORT void
-xkb_keymap_unref(struct xkb_keymap *keymap)
+static void
+keymap_stats_end(struct xkb_keymap *keymap, uint64_t start)
+{
+    xkb_context_stat_timer_stop(keymap->ctx, XKB_COMPILE_STAT_TIME_TOTAL,
+                                start);
+    xkb_context_set_compile_stats(keymap->ctx, NULL);
+}
+
+/* Free everything the keymap owns, except the context and the memfd. */
+static void
+free_keymap_contents(struct xkb_keymap *keymap)
 {
     unsigned int i, j;
     struct xkb_key *key;
 
-    if (!keymap || --keymap->refcnt > 0)
-        return;
-
     if (keymap->keys) {
         xkb_foreach_key(key, keymap) {
             if (key->groups) {
@@ -143,6 +168,59 @@ xkb_keymap_unref(struct xkb_keymap *keymap)
     free(keymap->symbols_section_name);
     free(keymap->types_section_name);
     free(keymap->compat_section_name);
+}
+
+void
+keymap_clear(struct xkb_keymap *keymap)
+{
+    free_keymap_contents(keymap);
+
+    keymap->enabled_ctrls = 0;
+    keymap->min_key_code = 0;
+    keymap->max_key_code = 0;
+    keymap->keys = NULL;
+    keymap->num_key_aliases = 0;
+    keymap->key_aliases = NULL;
+    keymap->types = NULL;
+    keymap->num_types = 0;
+    keymap->num_sym_interprets = 0;
+    keymap->sym_interprets = NULL;
+    darray_init(keymap->mods);
+    keymap->num_groups = 0;
+    keymap->num_group_names = 0;
+    keymap->group_names = NULL;
+    darray_init(keymap->leds);
+    keymap->keycodes_section_name = NULL;
+    keymap->symbols_section_name = NULL;
+    keymap->types_section_name = NULL;
+    keymap->compat_section_name = NULL;
+
+    update_builtin_keymap_fields(keymap);
+}
+
+XKB_EXPORT struct xkb_keymap *
+xkb_keymap_ref(struct xkb_keymap *keymap)
+{
+    keymap->refcnt++;
+    return keymap;
+}
+
+XKB_EXPORT void
+xkb_keymap_unref(struct xkb_keymap *keymap)
+{
+    if (!keymap)
+        return;
+
+    if (--keymap->refcnt > 0) {
+        /* Maybe only the keymap cache is left holding it. */
+        if (keymap->refcnt == 1)
+            xkb_context_collect_keymap_cache(keymap->ctx);
+        return;
+    }
+
+    free_keymap_contents(keymap);
+    if (keymap->fd >= 0)
+        close(keymap->fd);
     xkb_context_unref(keymap->ctx);
     free(keymap);
 }
@@ -160,6 +238,220 @@ get_keymap_format_ops(enum xkb_keymap_format format)
     return keymap_format_ops[format];
 }
 
+/*
+ * The keymap cache, see xkb_context_set_keymap_cache_size(). The keys
+ * are opaque strings, which may contain NUL bytes: the names, or the
+ * whole keymap text. They are compared by hash first, and then in full,
+ * so that a hash collision can never return the wrong keymap. The
+ * entries are kept in order of use, most recent first; the caches are
+ * small, so moving them around is cheap.
+ */
+enum keymap_cache_source {
+    KEYMAP_CACHE_FROM_NAMES,
+    KEYMAP_CACHE_FROM_BUFFER,
+};
+
+struct keymap_cache_entry {
+    enum keymap_cache_source source;
+    uint64_t hash;
+    char *key;
+    size_t key_len;
+    struct xkb_keymap *keymap;
+};
+
+struct xkb_keymap_cache {
+    darray(struct keymap_cache_entry) entries;
+};
+
+void
+xkb_keymap_cache_trim(struct xkb_keymap_cache *cache, unsigned int size)
+{
+    struct keymap_cache_entry entry;
+
+    if (!cache)
+        return;
+
+    while (darray_size(cache->entries) > size) {
+        entry = darray_pop(cache->entries);
+        free(entry.key);
+        xkb_keymap_unref(entry.keymap);
+    }
+}
+
+unsigned int
+xkb_keymap_cache_num_unused(struct xkb_keymap_cache *cache)
+{
+    struct keymap_cache_entry *entry;
+    unsigned int num_unused = 0;
+
+    darray_foreach(entry, cache->entries)
+        if (entry->keymap->refcnt == 1)
+            num_unused++;
+
+    return num_unused;
+}
+
+void
+xkb_keymap_cache_free(struct xkb_keymap_cache *cache)
+{
+    if (!cache)
+        return;
+
+    xkb_keymap_cache_trim(cache, 0);
+    darray_free(cache->entries);
+    free(cache);
+}
+
+/* 64 bit FNV-1a. */
+static uint64_t
+keymap_cache_hash(const char *key, size_t key_len)
+{
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    size_t i;
+
+    for (i = 0; i < key_len; i++) {
+        hash ^= (unsigned char) key[i];
+        hash *= UINT64_C(0x100000001b3);
+    }
+
+    return hash;
+}
+
+/* Returns the index of the entry, or -1 if there is none. */
+static int
+keymap_cache_find(struct xkb_context *ctx, enum keymap_cache_source source,
+                  enum xkb_keymap_format format, uint64_t hash,
+                  const char *key, size_t key_len)
+{
+    struct xkb_keymap_cache *cache = xkb_context_get_keymap_cache(ctx);
+    struct keymap_cache_entry *entry;
+    unsigned int i;
+
+    if (!cache)
+        return -1;
+
+    for (i = 0; i < darray_size(cache->entries); i++) {
+        entry = &darray_item(cache->entries, i);
+        if (entry->source == source && entry->keymap->format == format &&
+            entry->hash == hash && entry->key_len == key_len &&
+            memcmp(entry->key, key, key_len) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+static struct xkb_keymap *
+keymap_cache_lookup(struct xkb_context *ctx, enum keymap_cache_source source,
+                    enum xkb_keymap_format format, uint64_t hash,
+                    const char *key, size_t key_len)
+{
+    struct xkb_keymap_cache *cache = xkb_context_get_keymap_cache(ctx);
+    struct keymap_cache_entry entry;
+    int i;
+
+    i = keymap_cache_find(ctx, source, format, hash, key, key_len);
+    if (i < 0)
+        return NULL;
+
+    entry = darray_item(cache->entries, i);
+    memmove(&darray_item(cache->entries, 1), &darray_item(cache->entries, 0),
+            i * sizeof(entry));
+    darray_item(cache->entries, 0) = entry;
+
+    return xkb_keymap_ref(entry.keymap);
+}
+
+static void
+keymap_cache_add(struct xkb_context *ctx, enum keymap_cache_source source,
+                 uint64_t hash, const char *key, size_t key_len,
+                 struct xkb_keymap *keymap)
+{
+    struct xkb_keymap_cache *cache = xkb_context_get_keymap_cache(ctx);
+    unsigned int size = xkb_context_get_keymap_cache_size(ctx);
+    struct keymap_cache_entry entry;
+
+    if (size == 0)
+        return;
+
+    if (!cache) {
+        cache = calloc(1, sizeof(*cache));
+        if (!cache)
+            return;
+        xkb_context_set_keymap_cache(ctx, cache);
+    }
+
+    entry.key = malloc(key_len);
+    if (!entry.key)
+        return;
+    memcpy(entry.key, key, key_len);
+    entry.source = source;
+    entry.hash = hash;
+    entry.key_len = key_len;
+    entry.keymap = xkb_keymap_ref(keymap);
+
+    /* Make room first, so that the new entry is not the one evicted. */
+    xkb_keymap_cache_trim(cache, size - 1);
+    darray_prepend(cache->entries, entry);
+}
+
+/*
+ * Builds the cache key of the names, which must have the defaults
+ * applied already.
+ */
+static char *
+keymap_cache_key_from_names(const struct xkb_rule_names *rmlvo,
+                            size_t *key_len_out)
+{
+    const char *names[] = {
+        rmlvo->rules, rmlvo->model, rmlvo->layout, rmlvo->variant,
+        rmlvo->options,
+    };
+    size_t lens[ARRAY_SIZE(names)], key_len = 0;
+    unsigned int i;
+    char *key, *p;
+
+    for (i = 0; i < ARRAY_SIZE(names); i++) {
+        lens[i] = names[i] ? strlen(names[i]) : 0;
+        key_len += lens[i] + 1;
+    }
+
+    key = malloc(key_len);
+    if (!key)
+        return NULL;
+
+    /* Unset names are the same as empty ones, in the rules. */
+    p = key;
+    for (i = 0; i < ARRAY_SIZE(names); i++) {
+        if (lens[i] > 0)
+            memcpy(p, names[i], lens[i]);
+        p[lens[i]] = '\0';
+        p += lens[i] + 1;
+    }
+
+    *key_len_out = key_len;
+    return key;
+}
+
+static struct xkb_keymap *
+keymap_cache_lookup_names(struct xkb_context *ctx,
+                          const struct xkb_rule_names *rmlvo,
+                          enum xkb_keymap_format format, uint64_t hash,
+                          const char *key, size_t key_len)
+{
+    struct xkb_keymap *keymap;
+
+    keymap = keymap_cache_lookup(ctx, KEYMAP_CACHE_FROM_NAMES, format,
+                                 hash, key, key_len);
+    if (keymap)
+        log_dbg(ctx, "Using cached keymap for rules '%s', model '%s', "
+                "layout '%s', variant '%s', options '%s'\n",
+                rmlvo->rules, rmlvo->model, rmlvo->layout,
+                strnull(rmlvo->variant), strnull(rmlvo->options));
+
+    return keymap;
+}
+
 XKB_EXPORT struct xkb_keymap *
 xkb_keymap_new_from_names(struct xkb_context *ctx,
                           const struct xkb_rule_names *rmlvo_in,
@@ -167,6 +459,10 @@ xkb_keymap_new_from_names(struct xkb_context *ctx,
 {
     struct xkb_keymap *keymap;
     struct xkb_rule_names rmlvo;
+    char *key = NULL;
+    size_t key_len = 0;
+    uint64_t hash = 0, start;
+    bool ok;
     const enum xkb_keymap_format format = XKB_KEYMAP_FORMAT_TEXT_V1;
     const struct xkb_keymap_format_ops *ops;
 
@@ -176,7 +472,8 @@ xkb_keymap_new_from_names(struct xkb_context *ctx,
         return NULL;
     }
 
-    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER)) {
+    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER | XKB_MAP_COMPILE_STATS |
+                  XKB_MAP_COMPILE_PARALLEL)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
         return NULL;
     }
@@ -186,32 +483,426 @@ xkb_keymap_new_from_names(struct xkb_context *ctx,
     else
         memset(&rmlvo, 0, sizeof(rmlvo));
 
-    if (isempty(rmlvo.rules))
-        rmlvo.rules = xkb_context_get_default_rules(ctx);
-    if (isempty(rmlvo.model))
-        rmlvo.model = xkb_context_get_default_model(ctx);
-    /* Layout and variant are tied together, so don't try to use one from
-     * the caller and one from the environment. */
-    if (isempty(rmlvo.layout)) {
-        rmlvo.layout = xkb_context_get_default_layout(ctx);
-        rmlvo.variant = xkb_context_get_default_variant(ctx);
+    xkb_context_sanitize_rule_names(ctx, &rmlvo);
+
+    /* Keymaps with statistics describe their own compilation. */
+    if (!(flags & XKB_MAP_COMPILE_STATS) &&
+        xkb_context_get_keymap_cache_size(ctx) > 0)
+        key = keymap_cache_key_from_names(&rmlvo, &key_len);
+
+    if (key) {
+        hash = keymap_cache_hash(key, key_len);
+        keymap = keymap_cache_lookup_names(ctx, &rmlvo, format, hash,
+                                           key, key_len);
+        if (keymap) {
+            free(key);
+            return keymap;
+        }
     }
-    /* Options can be empty, so respect that if passed in. */
-    if (rmlvo.options == NULL)
-        rmlvo.options = xkb_context_get_default_options(ctx);
 
     keymap = xkb_keymap_new(ctx, format, flags);
     if (!keymap)
-        return NULL;
+        goto out;
+
+    start = keymap_stats_begin(keymap);
+    ok = ops->keymap_new_from_names(keymap, &rmlvo);
+    keymap_stats_end(keymap, start);
+    if (!ok) {
+        xkb_keymap_unref(keymap);
+        keymap = NULL;
+        goto out;
+    }
+
+    if (key)
+        keymap_cache_add(ctx, KEYMAP_CACHE_FROM_NAMES, hash, key, key_len,
+                         keymap);
+
+out:
+    free(key);
+    return keymap;
+}
+
+#ifdef HAVE_PTHREAD
+
+/*
+ * Batch compilation. The main thread applies the defaults to the names,
+ * creates the keymaps and loads the rules files; then workers compile
+ * the keymaps in worker contexts, which share the include paths, the
+ * rules cache and the atom table, while the main thread takes the
+ * results in order, passing on their log messages and adding them to
+ * the keymap cache, so that the end result is the same as compiling the
+ * keymaps one after the other.
+ *
+ * A keymap which would be found in the keymap cache, as it is already
+ * there or is the same as an earlier one of the batch, is not compiled
+ * by the workers; it is looked up when its turn comes, and compiled
+ * then, after the workers are done, if it is not found after all.
+ */
+struct batch_item {
+    struct xkb_rule_names rmlvo;
+    char *key;
+    size_t key_len;
+    uint64_t hash;
+    /* The keymap compiled by the workers, if any. */
+    struct xkb_keymap *keymap;
+    bool ok;
+    bool done;
+    darray_log_message log;
+};
+
+struct batch_worker {
+    struct keymap_batch *batch;
+    struct xkb_context *ctx;
+    pthread_t thread;
+};
+
+struct keymap_batch {
+    struct xkb_context *ctx;
+    const struct xkb_keymap_format_ops *ops;
+
+    /* Protects next and the items' ok and done. */
+    pthread_mutex_t mutex;
+    /* Signalled when an item is done. */
+    pthread_cond_t cond;
+
+    struct batch_item *items;
+    size_t num_items;
+    /* The first item not taken by a worker yet. */
+    size_t next;
+
+    struct batch_worker *workers;
+    unsigned int num_workers;
+};
+
+static void *
+batch_worker_run(void *data)
+{
+    struct batch_worker *worker = data;
+    struct keymap_batch *batch = worker->batch;
+    struct batch_item *item;
+    struct xkb_keymap *keymap;
+    uint64_t start;
+    bool ok;
+
+    pthread_mutex_lock(&batch->mutex);
+    for (;;) {
+        while (batch->next < batch->num_items &&
+               !batch->items[batch->next].keymap)
+            batch->next++;
+        if (batch->next >= batch->num_items)
+            break;
+
+        item = &batch->items[batch->next++];
+        pthread_mutex_unlock(&batch->mutex);
+
+        /* The keymap is compiled on the worker context. */
+        keymap = item->keymap;
+        keymap->ctx = worker->ctx;
+        xkb_context_set_log_list(worker->ctx, &item->log);
+        start = keymap_stats_begin(keymap);
+        ok = batch->ops->keymap_new_from_names(keymap, &item->rmlvo);
+        keymap_stats_end(keymap, start);
+        xkb_context_set_log_list(worker->ctx, NULL);
+        keymap->ctx = batch->ctx;
+
+        pthread_mutex_lock(&batch->mutex);
+        item->ok = ok;
+        item->done = true;
+        pthread_cond_broadcast(&batch->cond);
+    }
+    pthread_mutex_unlock(&batch->mutex);
+
+    return NULL;
+}
+
+static void
+batch_stop_workers(struct keymap_batch *batch)
+{
+    for (unsigned int i = 0; i < batch->num_workers; i++) {
+        pthread_join(batch->workers[i].thread, NULL);
+        xkb_context_free_worker(batch->workers[i].ctx);
+    }
+
+    if (batch->workers)
+        xkb_context_set_shared(batch->ctx, false);
+
+    free(batch->workers);
+    batch->workers = NULL;
+    batch->num_workers = 0;
+}
+
+static bool
+batch_start_workers(struct keymap_batch *batch, unsigned int num_workers)
+{
+    struct batch_worker *worker;
 
-    if (!ops->keymap_new_from_names(keymap, &rmlvo)) {
+    batch->workers = calloc(num_workers, sizeof(*batch->workers));
+    if (!batch->workers)
+        return false;
+
+    if (!xkb_context_set_shared(batch->ctx, true)) {
+        free(batch->workers);
+        batch->workers = NULL;
+        return false;
+    }
+
+    while (batch->num_workers < num_workers) {
+        worker = &batch->workers[batch->num_workers];
+        worker->batch = batch;
+        worker->ctx = xkb_context_new_worker(batch->ctx);
+        if (!worker->ctx)
+            break;
+
+        if (pthread_create(&worker->thread, NULL, batch_worker_run,
+                           worker) != 0) {
+            xkb_context_free_worker(worker->ctx);
+            break;
+        }
+
+        batch->num_workers++;
+    }
+
+    if (batch->num_workers == 0) {
+        batch_stop_workers(batch);
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ * Sets up the items of the batch, and returns the number of keymaps for
+ * the workers to compile.
+ */
+static size_t
+batch_init_items(struct keymap_batch *batch,
+                 const struct xkb_rule_names *names,
+                 enum xkb_keymap_format format,
+                 enum xkb_keymap_compile_flags flags)
+{
+    struct xkb_context *ctx = batch->ctx;
+    struct batch_item *item, *other;
+    size_t num_compiled = 0;
+
+    for (size_t i = 0; i < batch->num_items; i++) {
+        item = &batch->items[i];
+        item->rmlvo = names[i];
+        xkb_context_sanitize_rule_names(ctx, &item->rmlvo);
+
+        if (!(flags & XKB_MAP_COMPILE_STATS) &&
+            xkb_context_get_keymap_cache_size(ctx) > 0)
+            item->key = keymap_cache_key_from_names(&item->rmlvo,
+                                                    &item->key_len);
+
+        if (item->key) {
+            item->hash = keymap_cache_hash(item->key, item->key_len);
+            if (keymap_cache_find(ctx, KEYMAP_CACHE_FROM_NAMES, format,
+                                  item->hash, item->key,
+                                  item->key_len) >= 0)
+                continue;
+
+            for (other = batch->items; other < item; other++)
+                if (other->key && other->hash == item->hash &&
+                    other->key_len == item->key_len &&
+                    memcmp(other->key, item->key, item->key_len) == 0)
+                    break;
+            if (other < item)
+                continue;
+        }
+
+        item->keymap = xkb_keymap_new(ctx, format, flags);
+        if (item->keymap)
+            num_compiled++;
+    }
+
+    return num_compiled;
+}
+
+/*
+ * Loads the rules files of the keymaps to compile, so that the workers
+ * find them in the cache. If a file cannot be loaded, its messages are
+ * dropped, as each keymap which uses it will fail and log them again.
+ */
+static void
+batch_prepare_names(struct keymap_batch *batch)
+{
+    struct xkb_context *ctx = batch->ctx;
+    struct batch_item *item, *other;
+    darray_log_message log = darray_new();
+
+    for (item = batch->items; item < batch->items + batch->num_items; item++) {
+        if (!item->keymap)
+            continue;
+
+        for (other = batch->items; other < item; other++)
+            if (other->keymap &&
+                streq_null(other->rmlvo.rules, item->rmlvo.rules))
+                break;
+        if (other < item)
+            continue;
+
+        xkb_context_set_log_list(ctx, &log);
+        if (batch->ops->keymap_prepare_names(ctx, &item->rmlvo)) {
+            xkb_context_set_log_list(ctx, NULL);
+            xkb_context_flush_log(ctx, &log);
+        }
+        else {
+            xkb_context_set_log_list(ctx, NULL);
+            xkb_log_list_free(&log);
+        }
+    }
+}
+
+static struct xkb_keymap *
+batch_take_item(struct keymap_batch *batch, struct batch_item *item,
+                enum xkb_keymap_format format,
+                enum xkb_keymap_compile_flags flags)
+{
+    struct xkb_context *ctx = batch->ctx;
+    struct xkb_keymap *keymap;
+
+    if (!item->keymap) {
+        if (item->key) {
+            keymap = keymap_cache_lookup_names(ctx, &item->rmlvo, format,
+                                               item->hash, item->key,
+                                               item->key_len);
+            if (keymap)
+                return keymap;
+        }
+
+        /* The workers could otherwise race with us on the context. */
+        batch_stop_workers(batch);
+        return xkb_keymap_new_from_names(ctx, &item->rmlvo, flags);
+    }
+
+    pthread_mutex_lock(&batch->mutex);
+    while (!item->done)
+        pthread_cond_wait(&batch->cond, &batch->mutex);
+    pthread_mutex_unlock(&batch->mutex);
+
+    xkb_context_flush_log(ctx, &item->log);
+
+    keymap = item->keymap;
+    item->keymap = NULL;
+    if (!item->ok) {
         xkb_keymap_unref(keymap);
         return NULL;
     }
 
+    if (item->key)
+        keymap_cache_add(ctx, KEYMAP_CACHE_FROM_NAMES, item->hash,
+                         item->key, item->key_len, keymap);
     return keymap;
 }
 
+static bool
+keymap_new_from_names_batch(struct xkb_context *ctx,
+                            const struct xkb_keymap_format_ops *ops,
+                            const struct xkb_rule_names *names,
+                            size_t num_names, struct xkb_keymap **keymaps,
+                            enum xkb_keymap_format format,
+                            enum xkb_keymap_compile_flags flags)
+{
+    struct keymap_batch batch = {
+        .ctx = ctx,
+        .ops = ops,
+        .num_items = num_names,
+    };
+    unsigned int num_cpus = xkb_context_get_num_cpus(ctx);
+    size_t num_compiled;
+    bool ok = false;
+
+    if (num_cpus < 2 || num_names < 2 || !ops->keymap_prepare_names)
+        return false;
+
+    batch.items = calloc(num_names, sizeof(*batch.items));
+    if (!batch.items)
+        return false;
+
+    pthread_mutex_init(&batch.mutex, NULL);
+    pthread_cond_init(&batch.cond, NULL);
+
+    num_compiled = batch_init_items(&batch, names, format, flags);
+    if (num_compiled < 2)
+        goto out;
+
+    batch_prepare_names(&batch);
+
+    if (!batch_start_workers(&batch, MIN((size_t) num_cpus, num_compiled)))
+        goto out;
+
+    for (size_t i = 0; i < num_names; i++)
+        keymaps[i] = batch_take_item(&batch, &batch.items[i], format, flags);
+    ok = true;
+
+    batch_stop_workers(&batch);
+out:
+    for (size_t i = 0; i < num_names; i++) {
+        xkb_keymap_unref(batch.items[i].keymap);
+        free(batch.items[i].key);
+    }
+    free(batch.items);
+    pthread_cond_destroy(&batch.cond);
+    pthread_mutex_destroy(&batch.mutex);
+    return ok;
+}
+
+#else /* HAVE_PTHREAD */
+
+static bool
+keymap_new_from_names_batch(struct xkb_context *ctx,
+                            const struct xkb_keymap_format_ops *ops,
+                            const struct xkb_rule_names *names,
+                            size_t num_names, struct xkb_keymap **keymaps,
+                            enum xkb_keymap_format format,
+                            enum xkb_keymap_compile_flags flags)
+{
+    return false;
+}
+
+#endif /* HAVE_PTHREAD */
+
+XKB_EXPORT int
+xkb_keymap_new_from_names_batch(struct xkb_context *ctx,
+                                const struct xkb_rule_names *names,
+                                size_t num_names,
+                                struct xkb_keymap **keymaps,
+                                enum xkb_keymap_compile_flags flags)
+{
+    const enum xkb_keymap_format format = XKB_KEYMAP_FORMAT_TEXT_V1;
+    const struct xkb_keymap_format_ops *ops;
+    int num_keymaps = 0;
+
+    for (size_t i = 0; i < num_names; i++)
+        keymaps[i] = NULL;
+
+    ops = get_keymap_format_ops(format);
+    if (!ops || !ops->keymap_new_from_names) {
+        log_err_func(ctx, "unsupported keymap format: %d\n", format);
+        return 0;
+    }
+
+    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER | XKB_MAP_COMPILE_STATS |
+                  XKB_MAP_COMPILE_PARALLEL)) {
+        log_err_func(ctx, "unrecognized flags: %#x\n", flags);
+        return 0;
+    }
+
+    /* The keymaps are already compiled in parallel. */
+    flags &= ~XKB_MAP_COMPILE_PARALLEL;
+
+    if (!keymap_new_from_names_batch(ctx, ops, names, num_names, keymaps,
+                                     format, flags))
+        for (size_t i = 0; i < num_names; i++)
+            keymaps[i] = xkb_keymap_new_from_names(ctx, &names[i], flags);
+
+    for (size_t i = 0; i < num_names; i++)
+        if (keymaps[i])
+            num_keymaps++;
+
+    return num_keymaps;
+}
+
 XKB_EXPORT struct xkb_keymap *
 xkb_keymap_new_from_string(struct xkb_context *ctx,
                            const char *string,
@@ -229,6 +920,8 @@ xkb_keymap_new_from_buffer(struct xkb_context *ctx,
 {
     struct xkb_keymap *keymap;
     const struct xkb_keymap_format_ops *ops;
+    uint64_t hash = 0, start;
+    bool ok, cache;
 
     ops = get_keymap_format_ops(format);
     if (!ops || !ops->keymap_new_from_string) {
@@ -236,7 +929,8 @@ xkb_keymap_new_from_buffer(struct xkb_context *ctx,
         return NULL;
     }
 
-    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER)) {
+    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER | XKB_MAP_COMPILE_STATS |
+                  XKB_MAP_COMPILE_PARALLEL)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
         return NULL;
     }
@@ -246,15 +940,38 @@ xkb_keymap_new_from_buffer(struct xkb_context *ctx,
         return NULL;
     }
 
+    /* Keymaps with statistics describe their own compilation. */
+    cache = (!(flags & XKB_MAP_COMPILE_STATS) &&
+             xkb_context_get_keymap_cache_size(ctx) > 0);
+    if (cache) {
+        size_t key_len = (length == SIZE_MAX ? strlen(buffer) : length);
+
+        hash = keymap_cache_hash(buffer, key_len);
+        keymap = keymap_cache_lookup(ctx, KEYMAP_CACHE_FROM_BUFFER, format,
+                                     hash, buffer, key_len);
+        if (keymap) {
+            log_dbg(ctx, "Using cached keymap for identical keymap text\n");
+            return keymap;
+        }
+        length = key_len;
+    }
+
     keymap = xkb_keymap_new(ctx, format, flags);
     if (!keymap)
         return NULL;
 
-    if (!ops->keymap_new_from_string(keymap, buffer, length)) {
+    start = keymap_stats_begin(keymap);
+    ok = ops->keymap_new_from_string(keymap, buffer, length);
+    keymap_stats_end(keymap, start);
+    if (!ok) {
         xkb_keymap_unref(keymap);
         return NULL;
     }
 
+    if (cache)
+        keymap_cache_add(ctx, KEYMAP_CACHE_FROM_BUFFER, hash, buffer, length,
+                         keymap);
+
     return keymap;
 }
 
@@ -266,6 +983,8 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
 {
     struct xkb_keymap *keymap;
     const struct xkb_keymap_format_ops *ops;
+    uint64_t start;
+    bool ok;
 
     ops = get_keymap_format_ops(format);
     if (!ops || !ops->keymap_new_from_file) {
@@ -273,7 +992,8 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
         return NULL;
     }
 
-    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER)) {
+    if (flags & ~(XKB_MAP_COMPILE_PLACEHOLDER | XKB_MAP_COMPILE_STATS |
+                  XKB_MAP_COMPILE_PARALLEL)) {
         log_err_func(ctx, "unrecognized flags: %#x\n", flags);
         return NULL;
     }
@@ -287,7 +1007,10 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
     if (!keymap)
         return NULL;
 
-    if (!ops->keymap_new_from_file(keymap, file)) {
+    start = keymap_stats_begin(keymap);
+    ok = ops->keymap_new_from_file(keymap, file);
+    keymap_stats_end(keymap, start);
+    if (!ok) {
         xkb_keymap_unref(keymap);
         return NULL;
     }
@@ -295,22 +1018,204 @@ xkb_keymap_new_from_file(struct xkb_context *ctx,
     return keymap;
 }
 
+/* Get the ops for serializing keymap in format, or log why not. */
+static const struct xkb_keymap_format_ops *
+get_serialize_ops(struct xkb_keymap *keymap, enum xkb_keymap_format *format,
+                  enum xkb_keymap_serialize_flags flags)
+{
+    const struct xkb_keymap_format_ops *ops;
+
+    if (*format == XKB_KEYMAP_USE_ORIGINAL_FORMAT)
+        *format = keymap->format;
+
+    ops = get_keymap_format_ops(*format);
+    if (!ops || !ops->keymap_write) {
+        log_err_func(keymap->ctx, "unsupported keymap format: %d\n", *format);
+        return NULL;
+    }
+
+    if (flags & ~(XKB_KEYMAP_SERIALIZE_MINIFY)) {
+        log_err_func(keymap->ctx, "unrecognized flags: %#x\n", flags);
+        return NULL;
+    }
+
+    return ops;
+}
+
+XKB_EXPORT char *
+xkb_keymap_get_as_string_flags(struct xkb_keymap *keymap,
+                               enum xkb_keymap_format format,
+                               enum xkb_keymap_serialize_flags flags)
+{
+    const struct xkb_keymap_format_ops *ops;
+
+    ops = get_serialize_ops(keymap, &format, flags);
+    if (!ops)
+        return NULL;
+
+    return ops->keymap_get_as_string(keymap, flags);
+}
+
 XKB_EXPORT char *
 xkb_keymap_get_as_string(struct xkb_keymap *keymap,
                          enum xkb_keymap_format format)
+{
+    return xkb_keymap_get_as_string_flags(keymap, format,
+                                          XKB_KEYMAP_SERIALIZE_NO_FLAGS);
+}
+
+XKB_EXPORT int
+xkb_keymap_write(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                 enum xkb_keymap_serialize_flags flags,
+                 xkb_keymap_write_t write_fn, void *data)
 {
     const struct xkb_keymap_format_ops *ops;
 
+    ops = get_serialize_ops(keymap, &format, flags);
+    if (!ops)
+        return 0;
+
+    return ops->keymap_write(keymap, flags, write_fn, data);
+}
+
+struct fd_sink {
+    int fd;
+    /* The errno of the failed write, or 0. */
+    int error;
+};
+
+static int
+write_to_fd(void *data, const char *buf, size_t size)
+{
+    struct fd_sink *sink = data;
+
+    while (size > 0) {
+        ssize_t written = write(sink->fd, buf, size);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            sink->error = errno;
+            return 0;
+        }
+        buf += written;
+        size -= written;
+    }
+
+    return 1;
+}
+
+XKB_EXPORT int
+xkb_keymap_write_to_fd(struct xkb_keymap *keymap,
+                       enum xkb_keymap_format format,
+                       enum xkb_keymap_serialize_flags flags, int fd)
+{
+    struct fd_sink sink = { .fd = fd, .error = 0 };
+
+    if (!xkb_keymap_write(keymap, format, flags, write_to_fd, &sink)) {
+        if (sink.error)
+            log_err_func(keymap->ctx, "failed to write keymap to fd %d: %s\n",
+                         fd, strerror(sink.error));
+        else
+            log_err_func(keymap->ctx, "failed to write keymap to fd %d\n",
+                         fd);
+        return 0;
+    }
+
+    return 1;
+}
+
+#ifdef HAVE_MEMFD_CREATE
+/* Serialize the keymap, NUL-terminated, into a new sealed memfd. */
+static int
+keymap_to_memfd(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                enum xkb_keymap_serialize_flags flags, size_t *size_out)
+{
+    int fd;
+    off_t size;
+    struct fd_sink sink;
+
+    fd = memfd_create("xkb-keymap", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0) {
+        log_err_func(keymap->ctx, "failed to create memfd: %s\n",
+                     strerror(errno));
+        return -1;
+    }
+
+    sink.fd = fd;
+    sink.error = 0;
+    if (!xkb_keymap_write_to_fd(keymap, format, flags, fd) ||
+        !write_to_fd(&sink, "", 1))
+        goto err;
+
+    size = lseek(fd, 0, SEEK_CUR);
+    if (size < 0 || lseek(fd, 0, SEEK_SET) < 0)
+        goto err;
+
+    if (fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE |
+                               F_SEAL_SEAL) < 0) {
+        log_err_func(keymap->ctx, "failed to seal memfd: %s\n",
+                     strerror(errno));
+        goto err;
+    }
+
+    *size_out = size;
+    return fd;
+
+err:
+    close(fd);
+    return -1;
+}
+#endif
+
+XKB_EXPORT int
+xkb_keymap_get_as_fd(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                     enum xkb_keymap_serialize_flags flags, size_t *size_out)
+{
+#ifdef HAVE_MEMFD_CREATE
+    int fd;
+    size_t size;
+
     if (format == XKB_KEYMAP_USE_ORIGINAL_FORMAT)
         format = keymap->format;
 
-    ops = get_keymap_format_ops(format);
-    if (!ops || !ops->keymap_get_as_string) {
-        log_err_func(keymap->ctx, "unsupported keymap format: %d\n", format);
-        return NULL;
+    if (keymap->fd < 0 || keymap->fd_format != format ||
+        keymap->fd_flags != flags) {
+        fd = keymap_to_memfd(keymap, format, flags, &size);
+        if (fd < 0)
+            return -1;
+
+        if (keymap->fd >= 0)
+            close(keymap->fd);
+        keymap->fd = fd;
+        keymap->fd_format = format;
+        keymap->fd_flags = flags;
+        keymap->fd_size = size;
     }
 
-    return ops->keymap_get_as_string(keymap);
+    fd = fcntl(keymap->fd, F_DUPFD_CLOEXEC, 0);
+    if (fd < 0) {
+        log_err_func(keymap->ctx, "failed to duplicate keymap fd: %s\n",
+                     strerror(errno));
+        return -1;
+    }
+
+    if (size_out)
+        *size_out = keymap->fd_size;
+    return fd;
+#else
+    log_err_func(keymap->ctx, "memfd is not supported on this system\n");
+    return -1;
+#endif
+}
+
+XKB_EXPORT uint64_t
+xkb_keymap_get_compile_stat(struct xkb_keymap *keymap,
+                            enum xkb_compile_stat stat)
+{
+    if ((int) stat < 0 || stat >= _XKB_COMPILE_STAT_NUM_ENTRIES)
+        return 0;
+
+    return keymap->compile_stats[stat];
 }
 
 /**
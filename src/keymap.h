@@ -391,6 +391,18 @@ struct xkb_keymap {
     char *symbols_section_name;
     char *types_section_name;
     char *compat_section_name;
+
+    /* Only collected with XKB_MAP_COMPILE_STATS. */
+    uint64_t compile_stats[_XKB_COMPILE_STAT_NUM_ENTRIES];
+
+    /*
+     * The sealed memfd which xkb_keymap_get_as_fd() serialized the keymap
+     * to, or -1 if it was not called yet.
+     */
+    int fd;
+    enum xkb_keymap_format fd_format;
+    enum xkb_keymap_serialize_flags fd_flags;
+    size_t fd_size;
 };
 
 #define xkb_foreach_key(iter, keymap) \
@@ -418,6 +430,13 @@ XkbKeyByName(struct xkb_keymap *keymap, xkb_atom_t name, bool use_aliases);
 xkb_atom_t
 XkbResolveKeyAlias(struct xkb_keymap *keymap, xkb_atom_t name);
 
+/*
+ * Free everything compiled into the keymap, and bring it back to the
+ * state of a new keymap, so that it can be compiled into again.
+ */
+void
+keymap_clear(struct xkb_keymap *keymap);
+
 xkb_layout_index_t
 wrap_group_into_range(int32_t group,
                       xkb_layout_index_t num_groups,
@@ -427,10 +446,20 @@ wrap_group_into_range(int32_t group,
 struct xkb_keymap_format_ops {
     bool (*keymap_new_from_names)(struct xkb_keymap *keymap,
                                   const struct xkb_rule_names *names);
+    /*
+     * Loads what keymap_new_from_names needs for @names into the caches
+     * of @ctx, before worker contexts of it compile from @names.
+     */
+    bool (*keymap_prepare_names)(struct xkb_context *ctx,
+                                 const struct xkb_rule_names *names);
     bool (*keymap_new_from_string)(struct xkb_keymap *keymap,
                                    const char *string, size_t length);
     bool (*keymap_new_from_file)(struct xkb_keymap *keymap, FILE *file);
-    char *(*keymap_get_as_string)(struct xkb_keymap *keymap);
+    char *(*keymap_get_as_string)(struct xkb_keymap *keymap,
+                                  enum xkb_keymap_serialize_flags flags);
+    bool (*keymap_write)(struct xkb_keymap *keymap,
+                         enum xkb_keymap_serialize_flags flags,
+                         xkb_keymap_write_t sink, void *sink_data);
 };
 
 extern const struct xkb_keymap_format_ops text_v1_keymap_format_ops;
@@ -59,4 +59,19 @@ xkb_keysym_is_upper(xkb_keysym_t keysym);
 bool
 xkb_keysym_is_keypad(xkb_keysym_t keysym);
 
+/*
+ * The name of the keysym, as xkb_keysym_get_name() would write it, or NULL
+ * if it has no name of its own.
+ */
+const char *
+xkb_keysym_name(xkb_keysym_t keysym);
+
+/*
+ * Like xkb_keysym_from_name(), but for the first len characters of name,
+ * which need not be NUL-terminated.
+ */
+xkb_keysym_t
+xkb_keysym_from_name_len(const char *name, size_t len,
+                         enum xkb_keysym_flags flags);
+
 #endif
@@ -0,0 +1,1290 @@
+/* This file is autogenerated from Makefile.am; please do not commit directly. */
+
+struct case_mapping {
+    int16_t lower;
+    int16_t upper;
+};
+
+/* The index in case_mapping_leaves of each page of 256 code points. */
+static const uint8_t ucs_case_pages[] = {
+    1, 2, 3, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8,
+    0, 9, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11,
+    0, 0, 0, 0, 12,
+};
+
+/* The same for the legacy keysyms; page 0 is Latin-1, as in Unicode. */
+static const uint8_t legacy_case_pages[] = {
+    1, 13, 14, 15, 0, 0, 16, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 18,
+};
+
+static const struct case_mapping case_mapping_leaves[][256] = {
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 743 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 121 },
+    },
+    {
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { -199, 0 }, { 0, -232 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 0, 0 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 0, 0 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { -121, 0 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 0, -300 },
+        { 0, 0 }, { 210, 0 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 206, 0 }, { 1, 0 },
+        { 0, -1 }, { 205, 0 }, { 205, 0 }, { 1, 0 },
+        { 0, -1 }, { 0, 0 }, { 79, 0 }, { 202, 0 },
+        { 203, 0 }, { 1, 0 }, { 0, -1 }, { 205, 0 },
+        { 207, 0 }, { 0, 97 }, { 211, 0 }, { 209, 0 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 211, 0 }, { 213, 0 }, { 0, 130 }, { 214, 0 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 218, 0 }, { 1, 0 },
+        { 0, -1 }, { 218, 0 }, { 0, 0 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { 218, 0 }, { 1, 0 },
+        { 0, -1 }, { 217, 0 }, { 217, 0 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 219, 0 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 56 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 2, 0 }, { 1, -1 }, { 0, -2 }, { 2, 0 },
+        { 1, -1 }, { 0, -2 }, { 2, 0 }, { 1, -1 },
+        { 0, -2 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 0, -79 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 0, 0 }, { 2, 0 }, { 1, -1 }, { 0, -2 },
+        { 1, 0 }, { 0, -1 }, { -97, 0 }, { -56, 0 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+    },
+    {
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { -130, 0 }, { 0, 0 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, -210 },
+        { 0, -206 }, { 0, 0 }, { 0, -205 }, { 0, -205 },
+        { 0, 0 }, { 0, -202 }, { 0, 0 }, { 0, -203 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, -205 }, { 0, 0 }, { 0, 0 }, { 0, -207 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, -209 }, { 0, -211 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, -211 },
+        { 0, 0 }, { 0, 0 }, { 0, -213 }, { 0, 0 },
+        { 0, 0 }, { 0, -214 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, -218 }, { 0, 0 }, { 0, 0 }, { 0, -218 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, -218 }, { 0, 0 }, { 0, -217 }, { 0, -217 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, -219 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 84 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 38, 0 }, { 0, 0 },
+        { 37, 0 }, { 37, 0 }, { 37, 0 }, { 0, 0 },
+        { 64, 0 }, { 0, 0 }, { 63, 0 }, { 63, 0 },
+        { 0, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 0, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 0, -38 }, { 0, -37 }, { 0, -37 }, { 0, -37 },
+        { 0, 0 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -31 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -64 }, { 0, -63 }, { 0, -63 }, { 0, 0 },
+        { 0, -62 }, { 0, -57 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -47 }, { 0, -54 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 0, -86 }, { 0, -80 }, { 0, 7 }, { 0, 0 },
+        { -60, 0 }, { 0, -96 }, { 0, 0 }, { 1, 0 },
+        { 0, -1 }, { -7, 0 }, { 1, 0 }, { 0, -1 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 80, 0 }, { 80, 0 }, { 80, 0 }, { 80, 0 },
+        { 80, 0 }, { 80, 0 }, { 80, 0 }, { 80, 0 },
+        { 80, 0 }, { 80, 0 }, { 80, 0 }, { 80, 0 },
+        { 80, 0 }, { 80, 0 }, { 80, 0 }, { 80, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -80 }, { 0, -80 }, { 0, -80 }, { 0, -80 },
+        { 0, -80 }, { 0, -80 }, { 0, -80 }, { 0, -80 },
+        { 0, -80 }, { 0, -80 }, { 0, -80 }, { 0, -80 },
+        { 0, -80 }, { 0, -80 }, { 0, -80 }, { 0, -80 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 0, 0 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 1, 0 },
+        { 0, -1 }, { 1, 0 }, { 0, -1 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 48, 0 },
+        { 48, 0 }, { 48, 0 }, { 48, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, -48 },
+        { 0, -48 }, { 0, -48 }, { 0, -48 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, -59 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 1, 0 }, { 0, -1 },
+        { 1, 0 }, { 0, -1 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 0 }, { 0, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 0 }, { 0, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 8 }, { 0, 0 }, { 0, 8 },
+        { 0, 0 }, { 0, 8 }, { 0, 0 }, { 0, 8 },
+        { 0, 0 }, { -8, 0 }, { 0, 0 }, { -8, 0 },
+        { 0, 0 }, { -8, 0 }, { 0, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 74 }, { 0, 74 }, { 0, 86 }, { 0, 86 },
+        { 0, 86 }, { 0, 86 }, { 0, 100 }, { 0, 100 },
+        { 0, 128 }, { 0, 128 }, { 0, 112 }, { 0, 112 },
+        { 0, 126 }, { 0, 126 }, { 0, 0 }, { 0, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { 0, 8 }, { 0, 8 }, { 0, 8 }, { 0, 8 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { -8, 0 }, { -8, 0 }, { -8, 0 }, { -8, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 0 }, { 0, 9 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { -8, 0 }, { -8, 0 }, { -74, 0 }, { -74, 0 },
+        { -9, 0 }, { 0, 0 }, { 0, -7205 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 9 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { -86, 0 }, { -86, 0 }, { -86, 0 }, { -86, 0 },
+        { -9, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { -8, 0 }, { -8, 0 }, { -100, 0 }, { -100, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 8 }, { 0, 8 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 7 }, { 0, 0 }, { 0, 0 },
+        { -8, 0 }, { -8, 0 }, { -112, 0 }, { -112, 0 },
+        { -7, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 9 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { -128, 0 }, { -128, 0 }, { -126, 0 }, { -126, 0 },
+        { -9, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { -7517, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { -8383, 0 }, { -8262, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 26, 0 }, { 26, 0 },
+        { 26, 0 }, { 26, 0 }, { 26, 0 }, { 26, 0 },
+        { 26, 0 }, { 26, 0 }, { 26, 0 }, { 26, 0 },
+        { 26, 0 }, { 26, 0 }, { 26, 0 }, { 26, 0 },
+        { 26, 0 }, { 26, 0 }, { 26, 0 }, { 26, 0 },
+        { 26, 0 }, { 26, 0 }, { 26, 0 }, { 26, 0 },
+        { 26, 0 }, { 26, 0 }, { 26, 0 }, { 26, 0 },
+        { 0, -26 }, { 0, -26 }, { 0, -26 }, { 0, -26 },
+        { 0, -26 }, { 0, -26 }, { 0, -26 }, { 0, -26 },
+        { 0, -26 }, { 0, -26 }, { 0, -26 }, { 0, -26 },
+        { 0, -26 }, { 0, -26 }, { 0, -26 }, { 0, -26 },
+        { 0, -26 }, { 0, -26 }, { 0, -26 }, { 0, -26 },
+        { 0, -26 }, { 0, -26 }, { 0, -26 }, { 0, -26 },
+        { 0, -26 }, { 0, -26 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 40, 0 }, { 40, 0 }, { 40, 0 }, { 40, 0 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, -40 }, { 0, -40 }, { 0, -40 }, { 0, -40 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 16, 0 }, { 0, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 0, 0 },
+        { 0, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 0, 0 }, { 16, 0 }, { 16, 0 },
+        { 0, 0 }, { 0, -16 }, { 0, 0 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, 0 },
+        { 0, 0 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, 0 }, { 0, -16 }, { 0, -16 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 16, 0 },
+        { 16, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, -16 },
+        { 0, -16 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 2, 0 }, { 0, 0 }, { 0, -2 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 0, 0 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 16 }, { 0, 16 }, { 0, 16 },
+        { 0, 16 }, { 0, 16 }, { 0, 16 }, { 0, 16 },
+        { 0, 16 }, { 0, 16 }, { 0, 16 }, { 0, 16 },
+        { 0, 16 }, { 0, 16 }, { 0, 16 }, { 0, 16 },
+        { 0, 0 }, { -16, 0 }, { -16, 0 }, { -16, 0 },
+        { -16, 0 }, { -16, 0 }, { -16, 0 }, { -16, 0 },
+        { -16, 0 }, { -16, 0 }, { -16, 0 }, { -16, 0 },
+        { -16, 0 }, { -16, 0 }, { -16, 0 }, { -16, 0 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { 0, 32 }, { 0, 32 }, { 0, 32 }, { 0, 32 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+        { -32, 0 }, { -32, 0 }, { -32, 0 }, { -32, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 16, 0 }, { 16, 0 }, { 16, 0 }, { 16, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -16 }, { 0, -16 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, 0 }, { 0, -16 },
+        { 0, -16 }, { 0, -16 }, { 0, 0 }, { 0, -16 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 32, 0 }, { 32, 0 },
+        { 32, 0 }, { 32, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, 0 },
+        { 0, -32 }, { 0, -32 }, { 0, -32 }, { 0, -32 },
+        { 0, -32 }, { 0, -32 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+    {
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 1, 0 }, { 0, -1 }, { -4799, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+        { 0, 0 }, { 0, 0 }, { 0, 0 }, { 0, 0 },
+    },
+};
@@ -1,4683 +1,6373 @@
 /* This file is autogenerated from Makefile.am; please do not commit directly. */
 
 struct name_keysym {
-    const char *name;
     xkb_keysym_t keysym;
+    /* Offset of the name in keysym_names. */
+    uint16_t offset;
 };
 
+#define KEYSYM_NAME_MAX_LEN 27
+
+static const char keysym_names[] =
+    "\0"
+    "0\0"
+    "1\0"
+    "2\0"
+    "3\0"
+    "3270_AltCursor\0"
+    "3270_Attn\0"
+    "3270_BackTab\0"
+    "3270_ChangeScreen\0"
+    "3270_Copy\0"
+    "3270_CursorBlink\0"
+    "3270_CursorSelect\0"
+    "3270_DeleteWord\0"
+    "3270_Duplicate\0"
+    "3270_Enter\0"
+    "3270_EraseEOF\0"
+    "3270_EraseInput\0"
+    "3270_ExSelect\0"
+    "3270_FieldMark\0"
+    "3270_Ident\0"
+    "3270_Jump\0"
+    "3270_KeyClick\0"
+    "3270_Left2\0"
+    "3270_PA1\0"
+    "3270_PA2\0"
+    "3270_PA3\0"
+    "3270_Play\0"
+    "3270_PrintScreen\0"
+    "3270_Quit\0"
+    "3270_Record\0"
+    "3270_Reset\0"
+    "3270_Right2\0"
+    "3270_Rule\0"
+    "3270_Setup\0"
+    "3270_Test\0"
+    "4\0"
+    "5\0"
+    "6\0"
+    "7\0"
+    "8\0"
+    "9\0"
+    "A\0"
+    "a\0"
+    "Aacute\0"
+    "aacute\0"
+    "Abelowdot\0"
+    "abelowdot\0"
+    "abovedot\0"
+    "Abreve\0"
+    "abreve\0"
+    "Abreveacute\0"
+    "abreveacute\0"
+    "Abrevebelowdot\0"
+    "abrevebelowdot\0"
+    "Abrevegrave\0"
+    "abrevegrave\0"
+    "Abrevehook\0"
+    "abrevehook\0"
+    "Abrevetilde\0"
+    "abrevetilde\0"
+    "AccessX_Enable\0"
+    "AccessX_Feedback_Enable\0"
+    "Acircumflex\0"
+    "acircumflex\0"
+    "Acircumflexacute\0"
+    "acircumflexacute\0"
+    "Acircumflexbelowdot\0"
+    "acircumflexbelowdot\0"
+    "Acircumflexgrave\0"
+    "acircumflexgrave\0"
+    "Acircumflexhook\0"
+    "acircumflexhook\0"
+    "Acircumflextilde\0"
+    "acircumflextilde\0"
+    "acute\0"
+    "Adiaeresis\0"
+    "adiaeresis\0"
+    "AE\0"
+    "ae\0"
+    "Agrave\0"
+    "agrave\0"
+    "Ahook\0"
+    "ahook\0"
+    "Alt_L\0"
+    "Alt_R\0"
+    "Amacron\0"
+    "amacron\0"
+    "ampersand\0"
+    "Aogonek\0"
+    "aogonek\0"
+    "apostrophe\0"
+    "approxeq\0"
+    "approximate\0"
+    "Arabic_0\0"
+    "Arabic_1\0"
+    "Arabic_2\0"
+    "Arabic_3\0"
+    "Arabic_4\0"
+    "Arabic_5\0"
+    "Arabic_6\0"
+    "Arabic_7\0"
+    "Arabic_8\0"
+    "Arabic_9\0"
+    "Arabic_ain\0"
+    "Arabic_alef\0"
+    "Arabic_alefmaksura\0"
+    "Arabic_beh\0"
+    "Arabic_comma\0"
+    "Arabic_dad\0"
+    "Arabic_dal\0"
+    "Arabic_damma\0"
+    "Arabic_dammatan\0"
+    "Arabic_ddal\0"
+    "Arabic_farsi_yeh\0"
+    "Arabic_fatha\0"
+    "Arabic_fathatan\0"
+    "Arabic_feh\0"
+    "Arabic_fullstop\0"
+    "Arabic_gaf\0"
+    "Arabic_ghain\0"
+    "Arabic_ha\0"
+    "Arabic_hah\0"
+    "Arabic_hamza\0"
+    "Arabic_hamza_above\0"
+    "Arabic_hamza_below\0"
+    "Arabic_hamzaonalef\0"
+    "Arabic_hamzaonwaw\0"
+    "Arabic_hamzaonyeh\0"
+    "Arabic_hamzaunderalef\0"
+    "Arabic_heh\0"
+    "Arabic_heh_doachashmee\0"
+    "Arabic_heh_goal\0"
+    "Arabic_jeem\0"
+    "Arabic_jeh\0"
+    "Arabic_kaf\0"
+    "Arabic_kasra\0"
+    "Arabic_kasratan\0"
+    "Arabic_keheh\0"
+    "Arabic_khah\0"
+    "Arabic_lam\0"
+    "Arabic_madda_above\0"
+    "Arabic_maddaonalef\0"
+    "Arabic_meem\0"
+    "Arabic_noon\0"
+    "Arabic_noon_ghunna\0"
+    "Arabic_peh\0"
+    "Arabic_percent\0"
+    "Arabic_qaf\0"
+    "Arabic_question_mark\0"
+    "Arabic_ra\0"
+    "Arabic_rreh\0"
+    "Arabic_sad\0"
+    "Arabic_seen\0"
+    "Arabic_semicolon\0"
+    "Arabic_shadda\0"
+    "Arabic_sheen\0"
+    "Arabic_sukun\0"
+    "Arabic_superscript_alef\0"
+    "Arabic_switch\0"
+    "Arabic_tah\0"
+    "Arabic_tatweel\0"
+    "Arabic_tcheh\0"
+    "Arabic_teh\0"
+    "Arabic_tehmarbuta\0"
+    "Arabic_thal\0"
+    "Arabic_theh\0"
+    "Arabic_tteh\0"
+    "Arabic_veh\0"
+    "Arabic_waw\0"
+    "Arabic_yeh\0"
+    "Arabic_yeh_baree\0"
+    "Arabic_zah\0"
+    "Arabic_zain\0"
+    "Aring\0"
+    "aring\0"
+    "Armenian_accent\0"
+    "Armenian_amanak\0"
+    "Armenian_apostrophe\0"
+    "Armenian_AT\0"
+    "Armenian_at\0"
+    "Armenian_AYB\0"
+    "Armenian_ayb\0"
+    "Armenian_BEN\0"
+    "Armenian_ben\0"
+    "Armenian_but\0"
+    "Armenian_CHA\0"
+    "Armenian_cha\0"
+    "Armenian_DA\0"
+    "Armenian_da\0"
+    "Armenian_DZA\0"
+    "Armenian_dza\0"
+    "Armenian_E\0"
+    "Armenian_e\0"
+    "Armenian_exclam\0"
+    "Armenian_FE\0"
+    "Armenian_fe\0"
+    "Armenian_full_stop\0"
+    "Armenian_GHAT\0"
+    "Armenian_ghat\0"
+    "Armenian_GIM\0"
+    "Armenian_gim\0"
+    "Armenian_HI\0"
+    "Armenian_hi\0"
+    "Armenian_HO\0"
+    "Armenian_ho\0"
+    "Armenian_hyphen\0"
+    "Armenian_INI\0"
+    "Armenian_ini\0"
+    "Armenian_JE\0"
+    "Armenian_je\0"
+    "Armenian_KE\0"
+    "Armenian_ke\0"
+    "Armenian_KEN\0"
+    "Armenian_ken\0"
+    "Armenian_KHE\0"
+    "Armenian_khe\0"
+    "Armenian_ligature_ew\0"
+    "Armenian_LYUN\0"
+    "Armenian_lyun\0"
+    "Armenian_MEN\0"
+    "Armenian_men\0"
+    "Armenian_NU\0"
+    "Armenian_nu\0"
+    "Armenian_O\0"
+    "Armenian_o\0"
+    "Armenian_paruyk\0"
+    "Armenian_PE\0"
+    "Armenian_pe\0"
+    "Armenian_PYUR\0"
+    "Armenian_pyur\0"
+    "Armenian_question\0"
+    "Armenian_RA\0"
+    "Armenian_ra\0"
+    "Armenian_RE\0"
+    "Armenian_re\0"
+    "Armenian_SE\0"
+    "Armenian_se\0"
+    "Armenian_separation_mark\0"
+    "Armenian_SHA\0"
+    "Armenian_sha\0"
+    "Armenian_shesht\0"
+    "Armenian_TCHE\0"
+    "Armenian_tche\0"
+    "Armenian_TO\0"
+    "Armenian_to\0"
+    "Armenian_TSA\0"
+    "Armenian_tsa\0"
+    "Armenian_TSO\0"
+    "Armenian_tso\0"
+    "Armenian_TYUN\0"
+    "Armenian_tyun\0"
+    "Armenian_verjaket\0"
+    "Armenian_VEV\0"
+    "Armenian_vev\0"
+    "Armenian_VO\0"
+    "Armenian_vo\0"
+    "Armenian_VYUN\0"
+    "Armenian_vyun\0"
+    "Armenian_YECH\0"
+    "Armenian_yech\0"
+    "Armenian_yentamna\0"
+    "Armenian_ZA\0"
+    "Armenian_za\0"
+    "Armenian_ZHE\0"
+    "Armenian_zhe\0"
+    "asciicircum\0"
+    "asciitilde\0"
+    "asterisk\0"
+    "at\0"
+    "Atilde\0"
+    "atilde\0"
+    "AudibleBell_Enable\0"
+    "B\0"
+    "b\0"
+    "Babovedot\0"
+    "babovedot\0"
+    "backslash\0"
+    "BackSpace\0"
+    "BackTab\0"
+    "ballotcross\0"
+    "bar\0"
+    "because\0"
+    "Begin\0"
+    "blank\0"
+    "block\0"
+    "botintegral\0"
+    "botleftparens\0"
+    "botleftsqbracket\0"
+    "botleftsummation\0"
+    "botrightparens\0"
+    "botrightsqbracket\0"
+    "botrightsummation\0"
+    "bott\0"
+    "botvertsummationconnector\0"
+    "BounceKeys_Enable\0"
+    "braceleft\0"
+    "braceright\0"
+    "bracketleft\0"
+    "bracketright\0"
+    "braille_blank\0"
+    "braille_dot_1\0"
+    "braille_dot_10\0"
+    "braille_dot_2\0"
+    "braille_dot_3\0"
+    "braille_dot_4\0"
+    "braille_dot_5\0"
+    "braille_dot_6\0"
+    "braille_dot_7\0"
+    "braille_dot_8\0"
+    "braille_dot_9\0"
+    "braille_dots_1\0"
+    "braille_dots_12\0"
+    "braille_dots_123\0"
+    "braille_dots_1234\0"
+    "braille_dots_12345\0"
+    "braille_dots_123456\0"
+    "braille_dots_1234567\0"
+    "braille_dots_12345678\0"
+    "braille_dots_1234568\0"
+    "braille_dots_123457\0"
+    "braille_dots_1234578\0"
+    "braille_dots_123458\0"
+    "braille_dots_12346\0"
+    "braille_dots_123467\0"
+    "braille_dots_1234678\0"
+    "braille_dots_123468\0"
+    "braille_dots_12347\0"
+    "braille_dots_123478\0"
+    "braille_dots_12348\0"
+    "braille_dots_1235\0"
+    "braille_dots_12356\0"
+    "braille_dots_123567\0"
+    "braille_dots_1235678\0"
+    "braille_dots_123568\0"
+    "braille_dots_12357\0"
+    "braille_dots_123578\0"
+    "braille_dots_12358\0"
+    "braille_dots_1236\0"
+    "braille_dots_12367\0"
+    "braille_dots_123678\0"
+    "braille_dots_12368\0"
+    "braille_dots_1237\0"
+    "braille_dots_12378\0"
+    "braille_dots_1238\0"
+    "braille_dots_124\0"
+    "braille_dots_1245\0"
+    "braille_dots_12456\0"
+    "braille_dots_124567\0"
+    "braille_dots_1245678\0"
+    "braille_dots_124568\0"
+    "braille_dots_12457\0"
+    "braille_dots_124578\0"
+    "braille_dots_12458\0"
+    "braille_dots_1246\0"
+    "braille_dots_12467\0"
+    "braille_dots_124678\0"
+    "braille_dots_12468\0"
+    "braille_dots_1247\0"
+    "braille_dots_12478\0"
+    "braille_dots_1248\0"
+    "braille_dots_125\0"
+    "braille_dots_1256\0"
+    "braille_dots_12567\0"
+    "braille_dots_125678\0"
+    "braille_dots_12568\0"
+    "braille_dots_1257\0"
+    "braille_dots_12578\0"
+    "braille_dots_1258\0"
+    "braille_dots_126\0"
+    "braille_dots_1267\0"
+    "braille_dots_12678\0"
+    "braille_dots_1268\0"
+    "braille_dots_127\0"
+    "braille_dots_1278\0"
+    "braille_dots_128\0"
+    "braille_dots_13\0"
+    "braille_dots_134\0"
+    "braille_dots_1345\0"
+    "braille_dots_13456\0"
+    "braille_dots_134567\0"
+    "braille_dots_1345678\0"
+    "braille_dots_134568\0"
+    "braille_dots_13457\0"
+    "braille_dots_134578\0"
+    "braille_dots_13458\0"
+    "braille_dots_1346\0"
+    "braille_dots_13467\0"
+    "braille_dots_134678\0"
+    "braille_dots_13468\0"
+    "braille_dots_1347\0"
+    "braille_dots_13478\0"
+    "braille_dots_1348\0"
+    "braille_dots_135\0"
+    "braille_dots_1356\0"
+    "braille_dots_13567\0"
+    "braille_dots_135678\0"
+    "braille_dots_13568\0"
+    "braille_dots_1357\0"
+    "braille_dots_13578\0"
+    "braille_dots_1358\0"
+    "braille_dots_136\0"
+    "braille_dots_1367\0"
+    "braille_dots_13678\0"
+    "braille_dots_1368\0"
+    "braille_dots_137\0"
+    "braille_dots_1378\0"
+    "braille_dots_138\0"
+    "braille_dots_14\0"
+    "braille_dots_145\0"
+    "braille_dots_1456\0"
+    "braille_dots_14567\0"
+    "braille_dots_145678\0"
+    "braille_dots_14568\0"
+    "braille_dots_1457\0"
+    "braille_dots_14578\0"
+    "braille_dots_1458\0"
+    "braille_dots_146\0"
+    "braille_dots_1467\0"
+    "braille_dots_14678\0"
+    "braille_dots_1468\0"
+    "braille_dots_147\0"
+    "braille_dots_1478\0"
+    "braille_dots_148\0"
+    "braille_dots_15\0"
+    "braille_dots_156\0"
+    "braille_dots_1567\0"
+    "braille_dots_15678\0"
+    "braille_dots_1568\0"
+    "braille_dots_157\0"
+    "braille_dots_1578\0"
+    "braille_dots_158\0"
+    "braille_dots_16\0"
+    "braille_dots_167\0"
+    "braille_dots_1678\0"
+    "braille_dots_168\0"
+    "braille_dots_17\0"
+    "braille_dots_178\0"
+    "braille_dots_18\0"
+    "braille_dots_2\0"
+    "braille_dots_23\0"
+    "braille_dots_234\0"
+    "braille_dots_2345\0"
+    "braille_dots_23456\0"
+    "braille_dots_234567\0"
+    "braille_dots_2345678\0"
+    "braille_dots_234568\0"
+    "braille_dots_23457\0"
+    "braille_dots_234578\0"
+    "braille_dots_23458\0"
+    "braille_dots_2346\0"
+    "braille_dots_23467\0"
+    "braille_dots_234678\0"
+    "braille_dots_23468\0"
+    "braille_dots_2347\0"
+    "braille_dots_23478\0"
+    "braille_dots_2348\0"
+    "braille_dots_235\0"
+    "braille_dots_2356\0"
+    "braille_dots_23567\0"
+    "braille_dots_235678\0"
+    "braille_dots_23568\0"
+    "braille_dots_2357\0"
+    "braille_dots_23578\0"
+    "braille_dots_2358\0"
+    "braille_dots_236\0"
+    "braille_dots_2367\0"
+    "braille_dots_23678\0"
+    "braille_dots_2368\0"
+    "braille_dots_237\0"
+    "braille_dots_2378\0"
+    "braille_dots_238\0"
+    "braille_dots_24\0"
+    "braille_dots_245\0"
+    "braille_dots_2456\0"
+    "braille_dots_24567\0"
+    "braille_dots_245678\0"
+    "braille_dots_24568\0"
+    "braille_dots_2457\0"
+    "braille_dots_24578\0"
+    "braille_dots_2458\0"
+    "braille_dots_246\0"
+    "braille_dots_2467\0"
+    "braille_dots_24678\0"
+    "braille_dots_2468\0"
+    "braille_dots_247\0"
+    "braille_dots_2478\0"
+    "braille_dots_248\0"
+    "braille_dots_25\0"
+    "braille_dots_256\0"
+    "braille_dots_2567\0"
+    "braille_dots_25678\0"
+    "braille_dots_2568\0"
+    "braille_dots_257\0"
+    "braille_dots_2578\0"
+    "braille_dots_258\0"
+    "braille_dots_26\0"
+    "braille_dots_267\0"
+    "braille_dots_2678\0"
+    "braille_dots_268\0"
+    "braille_dots_27\0"
+    "braille_dots_278\0"
+    "braille_dots_28\0"
+    "braille_dots_3\0"
+    "braille_dots_34\0"
+    "braille_dots_345\0"
+    "braille_dots_3456\0"
+    "braille_dots_34567\0"
+    "braille_dots_345678\0"
+    "braille_dots_34568\0"
+    "braille_dots_3457\0"
+    "braille_dots_34578\0"
+    "braille_dots_3458\0"
+    "braille_dots_346\0"
+    "braille_dots_3467\0"
+    "braille_dots_34678\0"
+    "braille_dots_3468\0"
+    "braille_dots_347\0"
+    "braille_dots_3478\0"
+    "braille_dots_348\0"
+    "braille_dots_35\0"
+    "braille_dots_356\0"
+    "braille_dots_3567\0"
+    "braille_dots_35678\0"
+    "braille_dots_3568\0"
+    "braille_dots_357\0"
+    "braille_dots_3578\0"
+    "braille_dots_358\0"
+    "braille_dots_36\0"
+    "braille_dots_367\0"
+    "braille_dots_3678\0"
+    "braille_dots_368\0"
+    "braille_dots_37\0"
+    "braille_dots_378\0"
+    "braille_dots_38\0"
+    "braille_dots_4\0"
+    "braille_dots_45\0"
+    "braille_dots_456\0"
+    "braille_dots_4567\0"
+    "braille_dots_45678\0"
+    "braille_dots_4568\0"
+    "braille_dots_457\0"
+    "braille_dots_4578\0"
+    "braille_dots_458\0"
+    "braille_dots_46\0"
+    "braille_dots_467\0"
+    "braille_dots_4678\0"
+    "braille_dots_468\0"
+    "braille_dots_47\0"
+    "braille_dots_478\0"
+    "braille_dots_48\0"
+    "braille_dots_5\0"
+    "braille_dots_56\0"
+    "braille_dots_567\0"
+    "braille_dots_5678\0"
+    "braille_dots_568\0"
+    "braille_dots_57\0"
+    "braille_dots_578\0"
+    "braille_dots_58\0"
+    "braille_dots_6\0"
+    "braille_dots_67\0"
+    "braille_dots_678\0"
+    "braille_dots_68\0"
+    "braille_dots_7\0"
+    "braille_dots_78\0"
+    "braille_dots_8\0"
+    "Break\0"
+    "breve\0"
+    "brokenbar\0"
+    "Byelorussian_shortu\0"
+    "Byelorussian_SHORTU\0"
+    "C\0"
+    "c\0"
+    "c_h\0"
+    "C_h\0"
+    "C_H\0"
+    "Cabovedot\0"
+    "cabovedot\0"
+    "Cacute\0"
+    "cacute\0"
+    "Cancel\0"
+    "Caps_Lock\0"
+    "careof\0"
+    "caret\0"
+    "caron\0"
+    "Ccaron\0"
+    "ccaron\0"
+    "Ccedilla\0"
+    "ccedilla\0"
+    "Ccircumflex\0"
+    "ccircumflex\0"
+    "cedilla\0"
+    "cent\0"
+    "ch\0"
+    "Ch\0"
+    "CH\0"
+    "checkerboard\0"
+    "checkmark\0"
+    "circle\0"
+    "Clear\0"
+    "ClearLine\0"
+    "club\0"
+    "Codeinput\0"
+    "colon\0"
+    "ColonSign\0"
+    "comma\0"
+    "containsas\0"
+    "Control_L\0"
+    "Control_R\0"
+    "copyright\0"
+    "cr\0"
+    "crossinglines\0"
+    "CruzeiroSign\0"
+    "cuberoot\0"
+    "currency\0"
+    "cursor\0"
+    "Cyrillic_a\0"
+    "Cyrillic_A\0"
+    "Cyrillic_be\0"
+    "Cyrillic_BE\0"
+    "Cyrillic_che\0"
+    "Cyrillic_CHE\0"
+    "Cyrillic_CHE_descender\0"
+    "Cyrillic_che_descender\0"
+    "Cyrillic_CHE_vertstroke\0"
+    "Cyrillic_che_vertstroke\0"
+    "Cyrillic_de\0"
+    "Cyrillic_DE\0"
+    "Cyrillic_dzhe\0"
+    "Cyrillic_DZHE\0"
+    "Cyrillic_e\0"
+    "Cyrillic_E\0"
+    "Cyrillic_ef\0"
+    "Cyrillic_EF\0"
+    "Cyrillic_el\0"
+    "Cyrillic_EL\0"
+    "Cyrillic_em\0"
+    "Cyrillic_EM\0"
+    "Cyrillic_en\0"
+    "Cyrillic_EN\0"
+    "Cyrillic_EN_descender\0"
+    "Cyrillic_en_descender\0"
+    "Cyrillic_er\0"
+    "Cyrillic_ER\0"
+    "Cyrillic_es\0"
+    "Cyrillic_ES\0"
+    "Cyrillic_ghe\0"
+    "Cyrillic_GHE\0"
+    "Cyrillic_GHE_bar\0"
+    "Cyrillic_ghe_bar\0"
+    "Cyrillic_ha\0"
+    "Cyrillic_HA\0"
+    "Cyrillic_HA_descender\0"
+    "Cyrillic_ha_descender\0"
+    "Cyrillic_hardsign\0"
+    "Cyrillic_HARDSIGN\0"
+    "Cyrillic_i\0"
+    "Cyrillic_I\0"
+    "Cyrillic_I_macron\0"
+    "Cyrillic_i_macron\0"
+    "Cyrillic_ie\0"
+    "Cyrillic_IE\0"
+    "Cyrillic_io\0"
+    "Cyrillic_IO\0"
+    "Cyrillic_je\0"
+    "Cyrillic_JE\0"
+    "Cyrillic_ka\0"
+    "Cyrillic_KA\0"
+    "Cyrillic_KA_descender\0"
+    "Cyrillic_ka_descender\0"
+    "Cyrillic_KA_vertstroke\0"
+    "Cyrillic_ka_vertstroke\0"
+    "Cyrillic_lje\0"
+    "Cyrillic_LJE\0"
+    "Cyrillic_nje\0"
+    "Cyrillic_NJE\0"
+    "Cyrillic_o\0"
+    "Cyrillic_O\0"
+    "Cyrillic_O_bar\0"
+    "Cyrillic_o_bar\0"
+    "Cyrillic_pe\0"
+    "Cyrillic_PE\0"
+    "Cyrillic_SCHWA\0"
+    "Cyrillic_schwa\0"
+    "Cyrillic_sha\0"
+    "Cyrillic_SHA\0"
+    "Cyrillic_shcha\0"
+    "Cyrillic_SHCHA\0"
+    "Cyrillic_SHHA\0"
+    "Cyrillic_shha\0"
+    "Cyrillic_shorti\0"
+    "Cyrillic_SHORTI\0"
+    "Cyrillic_softsign\0"
+    "Cyrillic_SOFTSIGN\0"
+    "Cyrillic_te\0"
+    "Cyrillic_TE\0"
+    "Cyrillic_tse\0"
+    "Cyrillic_TSE\0"
+    "Cyrillic_u\0"
+    "Cyrillic_U\0"
+    "Cyrillic_U_macron\0"
+    "Cyrillic_u_macron\0"
+    "Cyrillic_U_straight\0"
+    "Cyrillic_u_straight\0"
+    "Cyrillic_U_straight_bar\0"
+    "Cyrillic_u_straight_bar\0"
+    "Cyrillic_ve\0"
+    "Cyrillic_VE\0"
+    "Cyrillic_ya\0"
+    "Cyrillic_YA\0"
+    "Cyrillic_yeru\0"
+    "Cyrillic_YERU\0"
+    "Cyrillic_yu\0"
+    "Cyrillic_YU\0"
+    "Cyrillic_ze\0"
+    "Cyrillic_ZE\0"
+    "Cyrillic_zhe\0"
+    "Cyrillic_ZHE\0"
+    "Cyrillic_ZHE_descender\0"
+    "Cyrillic_zhe_descender\0"
+    "D\0"
+    "d\0"
+    "Dabovedot\0"
+    "dabovedot\0"
+    "Dacute_accent\0"
+    "dagger\0"
+    "Dcaron\0"
+    "dcaron\0"
+    "Dcedilla_accent\0"
+    "Dcircumflex_accent\0"
+    "Ddiaeresis\0"
+    "dead_a\0"
+    "dead_A\0"
+    "dead_abovecomma\0"
+    "dead_abovedot\0"
+    "dead_abovereversedcomma\0"
+    "dead_abovering\0"
+    "dead_acute\0"
+    "dead_belowbreve\0"
+    "dead_belowcircumflex\0"
+    "dead_belowcomma\0"
+    "dead_belowdiaeresis\0"
+    "dead_belowdot\0"
+    "dead_belowmacron\0"
+    "dead_belowring\0"
+    "dead_belowtilde\0"
+    "dead_breve\0"
+    "dead_capital_schwa\0"
+    "dead_caron\0"
+    "dead_cedilla\0"
+    "dead_circumflex\0"
+    "dead_currency\0"
+    "dead_dasia\0"
+    "dead_diaeresis\0"
+    "dead_doubleacute\0"
+    "dead_doublegrave\0"
+    "dead_e\0"
+    "dead_E\0"
+    "dead_grave\0"
+    "dead_greek\0"
+    "dead_hook\0"
+    "dead_horn\0"
+    "dead_i\0"
+    "dead_I\0"
+    "dead_invertedbreve\0"
+    "dead_iota\0"
+    "dead_macron\0"
+    "dead_o\0"
+    "dead_O\0"
+    "dead_ogonek\0"
+    "dead_perispomeni\0"
+    "dead_psili\0"
+    "dead_semivoiced_sound\0"
+    "dead_small_schwa\0"
+    "dead_stroke\0"
+    "dead_tilde\0"
+    "dead_u\0"
+    "dead_U\0"
+    "dead_voiced_sound\0"
+    "decimalpoint\0"
+    "degree\0"
+    "Delete\0"
+    "DeleteChar\0"
+    "DeleteLine\0"
+    "Dgrave_accent\0"
+    "diaeresis\0"
+    "diamond\0"
+    "digitspace\0"
+    "dintegral\0"
+    "division\0"
+    "dollar\0"
+    "DongSign\0"
+    "doubbaselinedot\0"
+    "doubleacute\0"
+    "doubledagger\0"
+    "doublelowquotemark\0"
+    "Down\0"
+    "downarrow\0"
+    "downcaret\0"
+    "downshoe\0"
+    "downstile\0"
+    "downtack\0"
+    "DRemove\0"
+    "Dring_accent\0"
+    "Dstroke\0"
+    "dstroke\0"
+    "Dtilde\0"
+    "E\0"
+    "e\0"
+    "Eabovedot\0"
+    "eabovedot\0"
+    "Eacute\0"
+    "eacute\0"
+    "Ebelowdot\0"
+    "ebelowdot\0"
+    "Ecaron\0"
+    "ecaron\0"
+    "Ecircumflex\0"
+    "ecircumflex\0"
+    "Ecircumflexacute\0"
+    "ecircumflexacute\0"
+    "Ecircumflexbelowdot\0"
+    "ecircumflexbelowdot\0"
+    "Ecircumflexgrave\0"
+    "ecircumflexgrave\0"
+    "Ecircumflexhook\0"
+    "ecircumflexhook\0"
+    "Ecircumflextilde\0"
+    "ecircumflextilde\0"
+    "EcuSign\0"
+    "Ediaeresis\0"
+    "ediaeresis\0"
+    "Egrave\0"
+    "egrave\0"
+    "Ehook\0"
+    "ehook\0"
+    "eightsubscript\0"
+    "eightsuperior\0"
+    "Eisu_Shift\0"
+    "Eisu_toggle\0"
+    "elementof\0"
+    "ellipsis\0"
+    "em3space\0"
+    "em4space\0"
+    "Emacron\0"
+    "emacron\0"
+    "emdash\0"
+    "emfilledcircle\0"
+    "emfilledrect\0"
+    "emopencircle\0"
+    "emopenrectangle\0"
+    "emptyset\0"
+    "emspace\0"
+    "End\0"
+    "endash\0"
+    "enfilledcircbullet\0"
+    "enfilledsqbullet\0"
+    "ENG\0"
+    "eng\0"
+    "enopencircbullet\0"
+    "enopensquarebullet\0"
+    "enspace\0"
+    "Eogonek\0"
+    "eogonek\0"
+    "equal\0"
+    "Escape\0"
+    "ETH\0"
+    "Eth\0"
+    "eth\0"
+    "Etilde\0"
+    "etilde\0"
+    "EuroSign\0"
+    "exclam\0"
+    "exclamdown\0"
+    "Execute\0"
+    "Ext16bit_L\0"
+    "Ext16bit_R\0"
+    "EZH\0"
+    "ezh\0"
+    "F\0"
+    "f\0"
+    "F1\0"
+    "F10\0"
+    "F11\0"
+    "F12\0"
+    "F13\0"
+    "F14\0"
+    "F15\0"
+    "F16\0"
+    "F17\0"
+    "F18\0"
+    "F19\0"
+    "F2\0"
+    "F20\0"
+    "F21\0"
+    "F22\0"
+    "F23\0"
+    "F24\0"
+    "F25\0"
+    "F26\0"
+    "F27\0"
+    "F28\0"
+    "F29\0"
+    "F3\0"
+    "F30\0"
+    "F31\0"
+    "F32\0"
+    "F33\0"
+    "F34\0"
+    "F35\0"
+    "F4\0"
+    "F5\0"
+    "F6\0"
+    "F7\0"
+    "F8\0"
+    "F9\0"
+    "Fabovedot\0"
+    "fabovedot\0"
+    "Farsi_0\0"
+    "Farsi_1\0"
+    "Farsi_2\0"
+    "Farsi_3\0"
+    "Farsi_4\0"
+    "Farsi_5\0"
+    "Farsi_6\0"
+    "Farsi_7\0"
+    "Farsi_8\0"
+    "Farsi_9\0"
+    "Farsi_yeh\0"
+    "femalesymbol\0"
+    "ff\0"
+    "FFrancSign\0"
+    "figdash\0"
+    "filledlefttribullet\0"
+    "filledrectbullet\0"
+    "filledrighttribullet\0"
+    "filledtribulletdown\0"
+    "filledtribulletup\0"
+    "Find\0"
+    "First_Virtual_Screen\0"
+    "fiveeighths\0"
+    "fivesixths\0"
+    "fivesubscript\0"
+    "fivesuperior\0"
+    "fourfifths\0"
+    "foursubscript\0"
+    "foursuperior\0"
+    "fourthroot\0"
+    "function\0"
+    "G\0"
+    "g\0"
+    "Gabovedot\0"
+    "gabovedot\0"
+    "Gbreve\0"
+    "gbreve\0"
+    "Gcaron\0"
+    "gcaron\0"
+    "Gcedilla\0"
+    "gcedilla\0"
+    "Gcircumflex\0"
+    "gcircumflex\0"
+    "Georgian_an\0"
+    "Georgian_ban\0"
+    "Georgian_can\0"
+    "Georgian_char\0"
+    "Georgian_chin\0"
+    "Georgian_cil\0"
+    "Georgian_don\0"
+    "Georgian_en\0"
+    "Georgian_fi\0"
+    "Georgian_gan\0"
+    "Georgian_ghan\0"
+    "Georgian_hae\0"
+    "Georgian_har\0"
+    "Georgian_he\0"
+    "Georgian_hie\0"
+    "Georgian_hoe\0"
+    "Georgian_in\0"
+    "Georgian_jhan\0"
+    "Georgian_jil\0"
+    "Georgian_kan\0"
+    "Georgian_khar\0"
+    "Georgian_las\0"
+    "Georgian_man\0"
+    "Georgian_nar\0"
+    "Georgian_on\0"
+    "Georgian_par\0"
+    "Georgian_phar\0"
+    "Georgian_qar\0"
+    "Georgian_rae\0"
+    "Georgian_san\0"
+    "Georgian_shin\0"
+    "Georgian_tan\0"
+    "Georgian_tar\0"
+    "Georgian_un\0"
+    "Georgian_vin\0"
+    "Georgian_we\0"
+    "Georgian_xan\0"
+    "Georgian_zen\0"
+    "Georgian_zhar\0"
+    "grave\0"
+    "greater\0"
+    "greaterthanequal\0"
+    "Greek_accentdieresis\0"
+    "Greek_ALPHA\0"
+    "Greek_alpha\0"
+    "Greek_ALPHAaccent\0"
+    "Greek_alphaaccent\0"
+    "Greek_BETA\0"
+    "Greek_beta\0"
+    "Greek_CHI\0"
+    "Greek_chi\0"
+    "Greek_DELTA\0"
+    "Greek_delta\0"
+    "Greek_EPSILON\0"
+    "Greek_epsilon\0"
+    "Greek_EPSILONaccent\0"
+    "Greek_epsilonaccent\0"
+    "Greek_ETA\0"
+    "Greek_eta\0"
+    "Greek_ETAaccent\0"
+    "Greek_etaaccent\0"
+    "Greek_finalsmallsigma\0"
+    "Greek_GAMMA\0"
+    "Greek_gamma\0"
+    "Greek_horizbar\0"
+    "Greek_IOTA\0"
+    "Greek_iota\0"
+    "Greek_IOTAaccent\0"
+    "Greek_iotaaccent\0"
+    "Greek_iotaaccentdieresis\0"
+    "Greek_IOTAdiaeresis\0"
+    "Greek_IOTAdieresis\0"
+    "Greek_iotadieresis\0"
+    "Greek_KAPPA\0"
+    "Greek_kappa\0"
+    "Greek_LAMBDA\0"
+    "Greek_lambda\0"
+    "Greek_LAMDA\0"
+    "Greek_lamda\0"
+    "Greek_MU\0"
+    "Greek_mu\0"
+    "Greek_NU\0"
+    "Greek_nu\0"
+    "Greek_OMEGA\0"
+    "Greek_omega\0"
+    "Greek_OMEGAaccent\0"
+    "Greek_omegaaccent\0"
+    "Greek_OMICRON\0"
+    "Greek_omicron\0"
+    "Greek_OMICRONaccent\0"
+    "Greek_omicronaccent\0"
+    "Greek_PHI\0"
+    "Greek_phi\0"
+    "Greek_PI\0"
+    "Greek_pi\0"
+    "Greek_PSI\0"
+    "Greek_psi\0"
+    "Greek_RHO\0"
+    "Greek_rho\0"
+    "Greek_SIGMA\0"
+    "Greek_sigma\0"
+    "Greek_switch\0"
+    "Greek_TAU\0"
+    "Greek_tau\0"
+    "Greek_THETA\0"
+    "Greek_theta\0"
+    "Greek_UPSILON\0"
+    "Greek_upsilon\0"
+    "Greek_UPSILONaccent\0"
+    "Greek_upsilonaccent\0"
+    "Greek_upsilonaccentdieresis\0"
+    "Greek_UPSILONdieresis\0"
+    "Greek_upsilondieresis\0"
+    "Greek_XI\0"
+    "Greek_xi\0"
+    "Greek_ZETA\0"
+    "Greek_zeta\0"
+    "guilder\0"
+    "guillemotleft\0"
+    "guillemotright\0"
+    "H\0"
+    "h\0"
+    "hairspace\0"
+    "Hangul\0"
+    "Hangul_A\0"
+    "Hangul_AE\0"
+    "Hangul_AraeA\0"
+    "Hangul_AraeAE\0"
+    "Hangul_Banja\0"
+    "Hangul_Cieuc\0"
+    "Hangul_Codeinput\0"
+    "Hangul_Dikeud\0"
+    "Hangul_E\0"
+    "Hangul_End\0"
+    "Hangul_EO\0"
+    "Hangul_EU\0"
+    "Hangul_Hanja\0"
+    "Hangul_Hieuh\0"
+    "Hangul_I\0"
+    "Hangul_Ieung\0"
+    "Hangul_J_Cieuc\0"
+    "Hangul_J_Dikeud\0"
+    "Hangul_J_Hieuh\0"
+    "Hangul_J_Ieung\0"
+    "Hangul_J_Jieuj\0"
+    "Hangul_J_Khieuq\0"
+    "Hangul_J_Kiyeog\0"
+    "Hangul_J_KiyeogSios\0"
+    "Hangul_J_KkogjiDalrinIeung\0"
+    "Hangul_J_Mieum\0"
+    "Hangul_J_Nieun\0"
+    "Hangul_J_NieunHieuh\0"
+    "Hangul_J_NieunJieuj\0"
+    "Hangul_J_PanSios\0"
+    "Hangul_J_Phieuf\0"
+    "Hangul_J_Pieub\0"
+    "Hangul_J_PieubSios\0"
+    "Hangul_J_Rieul\0"
+    "Hangul_J_RieulHieuh\0"
+    "Hangul_J_RieulKiyeog\0"
+    "Hangul_J_RieulMieum\0"
+    "Hangul_J_RieulPhieuf\0"
+    "Hangul_J_RieulPieub\0"
+    "Hangul_J_RieulSios\0"
+    "Hangul_J_RieulTieut\0"
+    "Hangul_J_Sios\0"
+    "Hangul_J_SsangKiyeog\0"
+    "Hangul_J_SsangSios\0"
+    "Hangul_J_Tieut\0"
+    "Hangul_J_YeorinHieuh\0"
+    "Hangul_Jamo\0"
+    "Hangul_Jeonja\0"
+    "Hangul_Jieuj\0"
+    "Hangul_Khieuq\0"
+    "Hangul_Kiyeog\0"
+    "Hangul_KiyeogSios\0"
+    "Hangul_KkogjiDalrinIeung\0"
+    "Hangul_Mieum\0"
+    "Hangul_MultipleCandidate\0"
+    "Hangul_Nieun\0"
+    "Hangul_NieunHieuh\0"
+    "Hangul_NieunJieuj\0"
+    "Hangul_O\0"
+    "Hangul_OE\0"
+    "Hangul_PanSios\0"
+    "Hangul_Phieuf\0"
+    "Hangul_Pieub\0"
+    "Hangul_PieubSios\0"
+    "Hangul_PostHanja\0"
+    "Hangul_PreHanja\0"
+    "Hangul_PreviousCandidate\0"
+    "Hangul_Rieul\0"
+    "Hangul_RieulHieuh\0"
+    "Hangul_RieulKiyeog\0"
+    "Hangul_RieulMieum\0"
+    "Hangul_RieulPhieuf\0"
+    "Hangul_RieulPieub\0"
+    "Hangul_RieulSios\0"
+    "Hangul_RieulTieut\0"
+    "Hangul_RieulYeorinHieuh\0"
+    "Hangul_Romaja\0"
+    "Hangul_SingleCandidate\0"
+    "Hangul_Sios\0"
+    "Hangul_Special\0"
+    "Hangul_SsangDikeud\0"
+    "Hangul_SsangJieuj\0"
+    "Hangul_SsangKiyeog\0"
+    "Hangul_SsangPieub\0"
+    "Hangul_SsangSios\0"
+    "Hangul_Start\0"
+    "Hangul_SunkyeongeumMieum\0"
+    "Hangul_SunkyeongeumPhieuf\0"
+    "Hangul_SunkyeongeumPieub\0"
+    "Hangul_switch\0"
+    "Hangul_Tieut\0"
+    "Hangul_U\0"
+    "Hangul_WA\0"
+    "Hangul_WAE\0"
+    "Hangul_WE\0"
+    "Hangul_WEO\0"
+    "Hangul_WI\0"
+    "Hangul_YA\0"
+    "Hangul_YAE\0"
+    "Hangul_YE\0"
+    "Hangul_YEO\0"
+    "Hangul_YeorinHieuh\0"
+    "Hangul_YI\0"
+    "Hangul_YO\0"
+    "Hangul_YU\0"
+    "Hankaku\0"
+    "Hcircumflex\0"
+    "hcircumflex\0"
+    "heart\0"
+    "hebrew_aleph\0"
+    "hebrew_ayin\0"
+    "hebrew_bet\0"
+    "hebrew_beth\0"
+    "hebrew_chet\0"
+    "hebrew_dalet\0"
+    "hebrew_daleth\0"
+    "hebrew_doublelowline\0"
+    "hebrew_finalkaph\0"
+    "hebrew_finalmem\0"
+    "hebrew_finalnun\0"
+    "hebrew_finalpe\0"
+    "hebrew_finalzade\0"
+    "hebrew_finalzadi\0"
+    "hebrew_gimel\0"
+    "hebrew_gimmel\0"
+    "hebrew_he\0"
+    "hebrew_het\0"
+    "hebrew_kaph\0"
+    "hebrew_kuf\0"
+    "hebrew_lamed\0"
+    "hebrew_mem\0"
+    "hebrew_nun\0"
+    "hebrew_pe\0"
+    "hebrew_qoph\0"
+    "hebrew_resh\0"
+    "hebrew_samech\0"
+    "hebrew_samekh\0"
+    "hebrew_shin\0"
+    "Hebrew_switch\0"
+    "hebrew_taf\0"
+    "hebrew_taw\0"
+    "hebrew_tet\0"
+    "hebrew_teth\0"
+    "hebrew_waw\0"
+    "hebrew_yod\0"
+    "hebrew_zade\0"
+    "hebrew_zadi\0"
+    "hebrew_zain\0"
+    "hebrew_zayin\0"
+    "Help\0"
+    "Henkan\0"
+    "Henkan_Mode\0"
+    "hexagram\0"
+    "Hiragana\0"
+    "Hiragana_Katakana\0"
+    "Home\0"
+    "horizconnector\0"
+    "horizlinescan1\0"
+    "horizlinescan3\0"
+    "horizlinescan5\0"
+    "horizlinescan7\0"
+    "horizlinescan9\0"
+    "hpBackTab\0"
+    "hpblock\0"
+    "hpClearLine\0"
+    "hpDeleteChar\0"
+    "hpDeleteLine\0"
+    "hpguilder\0"
+    "hpInsertChar\0"
+    "hpInsertLine\0"
+    "hpIO\0"
+    "hpKP_BackTab\0"
+    "hplira\0"
+    "hplongminus\0"
+    "hpModelock1\0"
+    "hpModelock2\0"
+    "hpmute_acute\0"
+    "hpmute_asciicircum\0"
+    "hpmute_asciitilde\0"
+    "hpmute_diaeresis\0"
+    "hpmute_grave\0"
+    "hpReset\0"
+    "hpSystem\0"
+    "hpUser\0"
+    "hpYdiaeresis\0"
+    "Hstroke\0"
+    "hstroke\0"
+    "ht\0"
+    "Hyper_L\0"
+    "Hyper_R\0"
+    "hyphen\0"
+    "I\0"
+    "i\0"
+    "Iabovedot\0"
+    "Iacute\0"
+    "iacute\0"
+    "Ibelowdot\0"
+    "ibelowdot\0"
+    "Ibreve\0"
+    "ibreve\0"
+    "Icircumflex\0"
+    "icircumflex\0"
+    "identical\0"
+    "Idiaeresis\0"
+    "idiaeresis\0"
+    "idotless\0"
+    "ifonlyif\0"
+    "Igrave\0"
+    "igrave\0"
+    "Ihook\0"
+    "ihook\0"
+    "Imacron\0"
+    "imacron\0"
+    "implies\0"
+    "includedin\0"
+    "includes\0"
+    "infinity\0"
+    "Insert\0"
+    "InsertChar\0"
+    "InsertLine\0"
+    "integral\0"
+    "intersection\0"
+    "IO\0"
+    "Iogonek\0"
+    "iogonek\0"
+    "ISO_Center_Object\0"
+    "ISO_Continuous_Underline\0"
+    "ISO_Discontinuous_Underline\0"
+    "ISO_Emphasize\0"
+    "ISO_Enter\0"
+    "ISO_Fast_Cursor_Down\0"
+    "ISO_Fast_Cursor_Left\0"
+    "ISO_Fast_Cursor_Right\0"
+    "ISO_Fast_Cursor_Up\0"
+    "ISO_First_Group\0"
+    "ISO_First_Group_Lock\0"
+    "ISO_Group_Latch\0"
+    "ISO_Group_Lock\0"
+    "ISO_Group_Shift\0"
+    "ISO_Last_Group\0"
+    "ISO_Last_Group_Lock\0"
+    "ISO_Left_Tab\0"
+    "ISO_Level2_Latch\0"
+    "ISO_Level3_Latch\0"
+    "ISO_Level3_Lock\0"
+    "ISO_Level3_Shift\0"
+    "ISO_Level5_Latch\0"
+    "ISO_Level5_Lock\0"
+    "ISO_Level5_Shift\0"
+    "ISO_Lock\0"
+    "ISO_Move_Line_Down\0"
+    "ISO_Move_Line_Up\0"
+    "ISO_Next_Group\0"
+    "ISO_Next_Group_Lock\0"
+    "ISO_Partial_Line_Down\0"
+    "ISO_Partial_Line_Up\0"
+    "ISO_Partial_Space_Left\0"
+    "ISO_Partial_Space_Right\0"
+    "ISO_Prev_Group\0"
+    "ISO_Prev_Group_Lock\0"
+    "ISO_Release_Both_Margins\0"
+    "ISO_Release_Margin_Left\0"
+    "ISO_Release_Margin_Right\0"
+    "ISO_Set_Margin_Left\0"
+    "ISO_Set_Margin_Right\0"
+    "Itilde\0"
+    "itilde\0"
+    "J\0"
+    "j\0"
+    "Jcircumflex\0"
+    "jcircumflex\0"
+    "jot\0"
+    "K\0"
+    "k\0"
+    "kana_a\0"
+    "kana_A\0"
+    "kana_CHI\0"
+    "kana_closingbracket\0"
+    "kana_comma\0"
+    "kana_conjunctive\0"
+    "kana_e\0"
+    "kana_E\0"
+    "kana_FU\0"
+    "kana_fullstop\0"
+    "kana_HA\0"
+    "kana_HE\0"
+    "kana_HI\0"
+    "kana_HO\0"
+    "kana_HU\0"
+    "kana_i\0"
+    "kana_I\0"
+    "kana_KA\0"
+    "kana_KE\0"
+    "kana_KI\0"
+    "kana_KO\0"
+    "kana_KU\0"
+    "Kana_Lock\0"
+    "kana_MA\0"
+    "kana_ME\0"
+    "kana_MI\0"
+    "kana_middledot\0"
+    "kana_MO\0"
+    "kana_MU\0"
+    "kana_N\0"
+    "kana_NA\0"
+    "kana_NE\0"
+    "kana_NI\0"
+    "kana_NO\0"
+    "kana_NU\0"
+    "kana_o\0"
+    "kana_O\0"
+    "kana_openingbracket\0"
+    "kana_RA\0"
+    "kana_RE\0"
+    "kana_RI\0"
+    "kana_RO\0"
+    "kana_RU\0"
+    "kana_SA\0"
+    "kana_SE\0"
+    "kana_SHI\0"
+    "Kana_Shift\0"
+    "kana_SO\0"
+    "kana_SU\0"
+    "kana_switch\0"
+    "kana_TA\0"
+    "kana_TE\0"
+    "kana_TI\0"
+    "kana_TO\0"
+    "kana_tsu\0"
+    "kana_TSU\0"
+    "kana_tu\0"
+    "kana_TU\0"
+    "kana_u\0"
+    "kana_U\0"
+    "kana_WA\0"
+    "kana_WO\0"
+    "kana_ya\0"
+    "kana_YA\0"
+    "kana_yo\0"
+    "kana_YO\0"
+    "kana_yu\0"
+    "kana_YU\0"
+    "Kanji\0"
+    "Kanji_Bangou\0"
+    "kappa\0"
+    "Katakana\0"
+    "Kcedilla\0"
+    "kcedilla\0"
+    "Korean_Won\0"
+    "KP_0\0"
+    "KP_1\0"
+    "KP_2\0"
+    "KP_3\0"
+    "KP_4\0"
+    "KP_5\0"
+    "KP_6\0"
+    "KP_7\0"
+    "KP_8\0"
+    "KP_9\0"
+    "KP_Add\0"
+    "KP_BackTab\0"
+    "KP_Begin\0"
+    "KP_Decimal\0"
+    "KP_Delete\0"
+    "KP_Divide\0"
+    "KP_Down\0"
+    "KP_End\0"
+    "KP_Enter\0"
+    "KP_Equal\0"
+    "KP_F1\0"
+    "KP_F2\0"
+    "KP_F3\0"
+    "KP_F4\0"
+    "KP_Home\0"
+    "KP_Insert\0"
+    "KP_Left\0"
+    "KP_Multiply\0"
+    "KP_Next\0"
+    "KP_Page_Down\0"
+    "KP_Page_Up\0"
+    "KP_Prior\0"
+    "KP_Right\0"
+    "KP_Separator\0"
+    "KP_Space\0"
+    "KP_Subtract\0"
+    "KP_Tab\0"
+    "KP_Up\0"
+    "kra\0"
+    "L\0"
+    "l\0"
+    "L1\0"
+    "L10\0"
+    "L2\0"
+    "L3\0"
+    "L4\0"
+    "L5\0"
+    "L6\0"
+    "L7\0"
+    "L8\0"
+    "L9\0"
+    "Lacute\0"
+    "lacute\0"
+    "Last_Virtual_Screen\0"
+    "latincross\0"
+    "Lbelowdot\0"
+    "lbelowdot\0"
+    "Lcaron\0"
+    "lcaron\0"
+    "Lcedilla\0"
+    "lcedilla\0"
+    "Left\0"
+    "leftanglebracket\0"
+    "leftarrow\0"
+    "leftcaret\0"
+    "leftdoublequotemark\0"
+    "leftmiddlecurlybrace\0"
+    "leftopentriangle\0"
+    "leftpointer\0"
+    "leftradical\0"
+    "leftshoe\0"
+    "leftsinglequotemark\0"
+    "leftt\0"
+    "lefttack\0"
+    "less\0"
+    "lessthanequal\0"
+    "lf\0"
+    "Linefeed\0"
+    "lira\0"
+    "LiraSign\0"
+    "logicaland\0"
+    "logicalor\0"
+    "longminus\0"
+    "lowleftcorner\0"
+    "lowrightcorner\0"
+    "Lstroke\0"
+    "lstroke\0"
+    "M\0"
+    "m\0"
+    "Mabovedot\0"
+    "mabovedot\0"
+    "Macedonia_dse\0"
+    "Macedonia_DSE\0"
+    "Macedonia_gje\0"
+    "Macedonia_GJE\0"
+    "Macedonia_kje\0"
+    "Macedonia_KJE\0"
+    "macron\0"
+    "Mae_Koho\0"
+    "malesymbol\0"
+    "maltesecross\0"
+    "marker\0"
+    "masculine\0"
+    "Massyo\0"
+    "Menu\0"
+    "Meta_L\0"
+    "Meta_R\0"
+    "MillSign\0"
+    "minus\0"
+    "minutes\0"
+    "Mode_switch\0"
+    "MouseKeys_Accel_Enable\0"
+    "MouseKeys_Enable\0"
+    "mu\0"
+    "Muhenkan\0"
+    "Multi_key\0"
+    "MultipleCandidate\0"
+    "multiply\0"
+    "musicalflat\0"
+    "musicalsharp\0"
+    "mute_acute\0"
+    "mute_asciicircum\0"
+    "mute_asciitilde\0"
+    "mute_diaeresis\0"
+    "mute_grave\0"
+    "N\0"
+    "n\0"
+    "nabla\0"
+    "Nacute\0"
+    "nacute\0"
+    "NairaSign\0"
+    "Ncaron\0"
+    "ncaron\0"
+    "Ncedilla\0"
+    "ncedilla\0"
+    "NewSheqelSign\0"
+    "Next\0"
+    "Next_Virtual_Screen\0"
+    "ninesubscript\0"
+    "ninesuperior\0"
+    "nl\0"
+    "nobreakspace\0"
+    "NoSymbol\0"
+    "notapproxeq\0"
+    "notelementof\0"
+    "notequal\0"
+    "notidentical\0"
+    "notsign\0"
+    "Ntilde\0"
+    "ntilde\0"
+    "Num_Lock\0"
+    "numbersign\0"
+    "numerosign\0"
+    "O\0"
+    "o\0"
+    "Oacute\0"
+    "oacute\0"
+    "Obarred\0"
+    "obarred\0"
+    "Obelowdot\0"
+    "obelowdot\0"
+    "Ocaron\0"
+    "ocaron\0"
+    "Ocircumflex\0"
+    "ocircumflex\0"
+    "Ocircumflexacute\0"
+    "ocircumflexacute\0"
+    "Ocircumflexbelowdot\0"
+    "ocircumflexbelowdot\0"
+    "Ocircumflexgrave\0"
+    "ocircumflexgrave\0"
+    "Ocircumflexhook\0"
+    "ocircumflexhook\0"
+    "Ocircumflextilde\0"
+    "ocircumflextilde\0"
+    "Odiaeresis\0"
+    "odiaeresis\0"
+    "Odoubleacute\0"
+    "odoubleacute\0"
+    "OE\0"
+    "oe\0"
+    "ogonek\0"
+    "Ograve\0"
+    "ograve\0"
+    "Ohook\0"
+    "ohook\0"
+    "Ohorn\0"
+    "ohorn\0"
+    "Ohornacute\0"
+    "ohornacute\0"
+    "Ohornbelowdot\0"
+    "ohornbelowdot\0"
+    "Ohorngrave\0"
+    "ohorngrave\0"
+    "Ohornhook\0"
+    "ohornhook\0"
+    "Ohorntilde\0"
+    "ohorntilde\0"
+    "Omacron\0"
+    "omacron\0"
+    "oneeighth\0"
+    "onefifth\0"
+    "onehalf\0"
+    "onequarter\0"
+    "onesixth\0"
+    "onesubscript\0"
+    "onesuperior\0"
+    "onethird\0"
+    "Ooblique\0"
+    "ooblique\0"
+    "openrectbullet\0"
+    "openstar\0"
+    "opentribulletdown\0"
+    "opentribulletup\0"
+    "ordfeminine\0"
+    "osfActivate\0"
+    "osfAddMode\0"
+    "osfBackSpace\0"
+    "osfBackTab\0"
+    "osfBeginData\0"
+    "osfBeginLine\0"
+    "osfCancel\0"
+    "osfClear\0"
+    "osfCopy\0"
+    "osfCut\0"
+    "osfDelete\0"
+    "osfDeselectAll\0"
+    "osfDown\0"
+    "osfEndData\0"
+    "osfEndLine\0"
+    "osfEscape\0"
+    "osfExtend\0"
+    "osfHelp\0"
+    "osfInsert\0"
+    "osfLeft\0"
+    "osfMenu\0"
+    "osfMenuBar\0"
+    "osfNextField\0"
+    "osfNextMenu\0"
+    "osfPageDown\0"
+    "osfPageLeft\0"
+    "osfPageRight\0"
+    "osfPageUp\0"
+    "osfPaste\0"
+    "osfPrevField\0"
+    "osfPrevMenu\0"
+    "osfPrimaryPaste\0"
+    "osfQuickPaste\0"
+    "osfReselect\0"
+    "osfRestore\0"
+    "osfRight\0"
+    "osfSelect\0"
+    "osfSelectAll\0"
+    "osfUndo\0"
+    "osfUp\0"
+    "Oslash\0"
+    "oslash\0"
+    "Otilde\0"
+    "otilde\0"
+    "overbar\0"
+    "Overlay1_Enable\0"
+    "Overlay2_Enable\0"
+    "overline\0"
+    "P\0"
+    "p\0"
+    "Pabovedot\0"
+    "pabovedot\0"
+    "Page_Down\0"
+    "Page_Up\0"
+    "paragraph\0"
+    "parenleft\0"
+    "parenright\0"
+    "partdifferential\0"
+    "partialderivative\0"
+    "Pause\0"
+    "percent\0"
+    "period\0"
+    "periodcentered\0"
+    "permille\0"
+    "PesetaSign\0"
+    "phonographcopyright\0"
+    "plus\0"
+    "plusminus\0"
+    "Pointer_Accelerate\0"
+    "Pointer_Button1\0"
+    "Pointer_Button2\0"
+    "Pointer_Button3\0"
+    "Pointer_Button4\0"
+    "Pointer_Button5\0"
+    "Pointer_Button_Dflt\0"
+    "Pointer_DblClick1\0"
+    "Pointer_DblClick2\0"
+    "Pointer_DblClick3\0"
+    "Pointer_DblClick4\0"
+    "Pointer_DblClick5\0"
+    "Pointer_DblClick_Dflt\0"
+    "Pointer_DfltBtnNext\0"
+    "Pointer_DfltBtnPrev\0"
+    "Pointer_Down\0"
+    "Pointer_DownLeft\0"
+    "Pointer_DownRight\0"
+    "Pointer_Drag1\0"
+    "Pointer_Drag2\0"
+    "Pointer_Drag3\0"
+    "Pointer_Drag4\0"
+    "Pointer_Drag5\0"
+    "Pointer_Drag_Dflt\0"
+    "Pointer_EnableKeys\0"
+    "Pointer_Left\0"
+    "Pointer_Right\0"
+    "Pointer_Up\0"
+    "Pointer_UpLeft\0"
+    "Pointer_UpRight\0"
+    "prescription\0"
+    "Prev_Virtual_Screen\0"
+    "PreviousCandidate\0"
+    "Print\0"
+    "Prior\0"
+    "prolongedsound\0"
+    "punctspace\0"
+    "Q\0"
+    "q\0"
+    "quad\0"
+    "question\0"
+    "questiondown\0"
+    "quotedbl\0"
+    "quoteleft\0"
+    "quoteright\0"
+    "R\0"
+    "r\0"
+    "R1\0"
+    "R10\0"
+    "R11\0"
+    "R12\0"
+    "R13\0"
+    "R14\0"
+    "R15\0"
+    "R2\0"
+    "R3\0"
+    "R4\0"
+    "R5\0"
+    "R6\0"
+    "R7\0"
+    "R8\0"
+    "R9\0"
+    "Racute\0"
+    "racute\0"
+    "radical\0"
+    "Rcaron\0"
+    "rcaron\0"
+    "Rcedilla\0"
+    "rcedilla\0"
+    "Redo\0"
+    "registered\0"
+    "RepeatKeys_Enable\0"
+    "Reset\0"
+    "Return\0"
+    "Right\0"
+    "rightanglebracket\0"
+    "rightarrow\0"
+    "rightcaret\0"
+    "rightdoublequotemark\0"
+    "rightmiddlecurlybrace\0"
+    "rightmiddlesummation\0"
+    "rightopentriangle\0"
+    "rightpointer\0"
+    "rightshoe\0"
+    "rightsinglequotemark\0"
+    "rightt\0"
+    "righttack\0"
+    "Romaji\0"
+    "RupeeSign\0"
+    "S\0"
+    "s\0"
+    "Sabovedot\0"
+    "sabovedot\0"
+    "Sacute\0"
+    "sacute\0"
+    "Scaron\0"
+    "scaron\0"
+    "Scedilla\0"
+    "scedilla\0"
+    "SCHWA\0"
+    "schwa\0"
+    "Scircumflex\0"
+    "scircumflex\0"
+    "script_switch\0"
+    "Scroll_Lock\0"
+    "seconds\0"
+    "section\0"
+    "Select\0"
+    "semicolon\0"
+    "semivoicedsound\0"
+    "Serbian_dje\0"
+    "Serbian_DJE\0"
+    "Serbian_dze\0"
+    "Serbian_DZE\0"
+    "Serbian_je\0"
+    "Serbian_JE\0"
+    "Serbian_lje\0"
+    "Serbian_LJE\0"
+    "Serbian_nje\0"
+    "Serbian_NJE\0"
+    "Serbian_tshe\0"
+    "Serbian_TSHE\0"
+    "seveneighths\0"
+    "sevensubscript\0"
+    "sevensuperior\0"
+    "Shift_L\0"
+    "Shift_Lock\0"
+    "Shift_R\0"
+    "signaturemark\0"
+    "signifblank\0"
+    "similarequal\0"
+    "SingleCandidate\0"
+    "singlelowquotemark\0"
+    "Sinh_a\0"
+    "Sinh_aa\0"
+    "Sinh_aa2\0"
+    "Sinh_ae\0"
+    "Sinh_ae2\0"
+    "Sinh_aee\0"
+    "Sinh_aee2\0"
+    "Sinh_ai\0"
+    "Sinh_ai2\0"
+    "Sinh_al\0"
+    "Sinh_au\0"
+    "Sinh_au2\0"
+    "Sinh_ba\0"
+    "Sinh_bha\0"
+    "Sinh_ca\0"
+    "Sinh_cha\0"
+    "Sinh_dda\0"
+    "Sinh_ddha\0"
+    "Sinh_dha\0"
+    "Sinh_dhha\0"
+    "Sinh_e\0"
+    "Sinh_e2\0"
+    "Sinh_ee\0"
+    "Sinh_ee2\0"
+    "Sinh_fa\0"
+    "Sinh_ga\0"
+    "Sinh_gha\0"
+    "Sinh_h2\0"
+    "Sinh_ha\0"
+    "Sinh_i\0"
+    "Sinh_i2\0"
+    "Sinh_ii\0"
+    "Sinh_ii2\0"
+    "Sinh_ja\0"
+    "Sinh_jha\0"
+    "Sinh_jnya\0"
+    "Sinh_ka\0"
+    "Sinh_kha\0"
+    "Sinh_kunddaliya\0"
+    "Sinh_la\0"
+    "Sinh_lla\0"
+    "Sinh_lu\0"
+    "Sinh_lu2\0"
+    "Sinh_luu\0"
+    "Sinh_luu2\0"
+    "Sinh_ma\0"
+    "Sinh_mba\0"
+    "Sinh_na\0"
+    "Sinh_ndda\0"
+    "Sinh_ndha\0"
+    "Sinh_ng\0"
+    "Sinh_ng2\0"
+    "Sinh_nga\0"
+    "Sinh_nja\0"
+    "Sinh_nna\0"
+    "Sinh_nya\0"
+    "Sinh_o\0"
+    "Sinh_o2\0"
+    "Sinh_oo\0"
+    "Sinh_oo2\0"
+    "Sinh_pa\0"
+    "Sinh_pha\0"
+    "Sinh_ra\0"
+    "Sinh_ri\0"
+    "Sinh_rii\0"
+    "Sinh_ru2\0"
+    "Sinh_ruu2\0"
+    "Sinh_sa\0"
+    "Sinh_sha\0"
+    "Sinh_ssha\0"
+    "Sinh_tha\0"
+    "Sinh_thha\0"
+    "Sinh_tta\0"
+    "Sinh_ttha\0"
+    "Sinh_u\0"
+    "Sinh_u2\0"
+    "Sinh_uu\0"
+    "Sinh_uu2\0"
+    "Sinh_va\0"
+    "Sinh_ya\0"
+    "sixsubscript\0"
+    "sixsuperior\0"
+    "slash\0"
+    "SlowKeys_Enable\0"
+    "soliddiamond\0"
+    "space\0"
+    "squareroot\0"
+    "ssharp\0"
+    "sterling\0"
+    "StickyKeys_Enable\0"
+    "stricteq\0"
+    "SunAgain\0"
+    "SunAltGraph\0"
+    "SunAudioLowerVolume\0"
+    "SunAudioMute\0"
+    "SunAudioRaiseVolume\0"
+    "SunCompose\0"
+    "SunCopy\0"
+    "SunCut\0"
+    "SunF36\0"
+    "SunF37\0"
+    "SunFA_Acute\0"
+    "SunFA_Cedilla\0"
+    "SunFA_Circum\0"
+    "SunFA_Diaeresis\0"
+    "SunFA_Grave\0"
+    "SunFA_Tilde\0"
+    "SunFind\0"
+    "SunFront\0"
+    "SunOpen\0"
+    "SunPageDown\0"
+    "SunPageUp\0"
+    "SunPaste\0"
+    "SunPowerSwitch\0"
+    "SunPowerSwitchShift\0"
+    "SunPrint_Screen\0"
+    "SunProps\0"
+    "SunStop\0"
+    "SunSys_Req\0"
+    "SunUndo\0"
+    "SunVideoDegauss\0"
+    "SunVideoLowerBrightness\0"
+    "SunVideoRaiseBrightness\0"
+    "Super_L\0"
+    "Super_R\0"
+    "Sys_Req\0"
+    "System\0"
+    "T\0"
+    "t\0"
+    "Tab\0"
+    "Tabovedot\0"
+    "tabovedot\0"
+    "Tcaron\0"
+    "tcaron\0"
+    "Tcedilla\0"
+    "tcedilla\0"
+    "telephone\0"
+    "telephonerecorder\0"
+    "Terminate_Server\0"
+    "Thai_baht\0"
+    "Thai_bobaimai\0"
+    "Thai_chochan\0"
+    "Thai_chochang\0"
+    "Thai_choching\0"
+    "Thai_chochoe\0"
+    "Thai_dochada\0"
+    "Thai_dodek\0"
+    "Thai_fofa\0"
+    "Thai_fofan\0"
+    "Thai_hohip\0"
+    "Thai_honokhuk\0"
+    "Thai_khokhai\0"
+    "Thai_khokhon\0"
+    "Thai_khokhuat\0"
+    "Thai_khokhwai\0"
+    "Thai_khorakhang\0"
+    "Thai_kokai\0"
+    "Thai_lakkhangyao\0"
+    "Thai_lekchet\0"
+    "Thai_lekha\0"
+    "Thai_lekhok\0"
+    "Thai_lekkao\0"
+    "Thai_leknung\0"
+    "Thai_lekpaet\0"
+    "Thai_leksam\0"
+    "Thai_leksi\0"
+    "Thai_leksong\0"
+    "Thai_leksun\0"
+    "Thai_lochula\0"
+    "Thai_loling\0"
+    "Thai_lu\0"
+    "Thai_maichattawa\0"
+    "Thai_maiek\0"
+    "Thai_maihanakat\0"
+    "Thai_maihanakat_maitho\0"
+    "Thai_maitaikhu\0"
+    "Thai_maitho\0"
+    "Thai_maitri\0"
+    "Thai_maiyamok\0"
+    "Thai_moma\0"
+    "Thai_ngongu\0"
+    "Thai_nikhahit\0"
+    "Thai_nonen\0"
+    "Thai_nonu\0"
+    "Thai_oang\0"
+    "Thai_paiyannoi\0"
+    "Thai_phinthu\0"
+    "Thai_phophan\0"
+    "Thai_phophung\0"
+    "Thai_phosamphao\0"
+    "Thai_popla\0"
+    "Thai_rorua\0"
+    "Thai_ru\0"
+    "Thai_saraa\0"
+    "Thai_saraaa\0"
+    "Thai_saraae\0"
+    "Thai_saraaimaimalai\0"
+    "Thai_saraaimaimuan\0"
+    "Thai_saraam\0"
+    "Thai_sarae\0"
+    "Thai_sarai\0"
+    "Thai_saraii\0"
+    "Thai_sarao\0"
+    "Thai_sarau\0"
+    "Thai_saraue\0"
+    "Thai_sarauee\0"
+    "Thai_sarauu\0"
+    "Thai_sorusi\0"
+    "Thai_sosala\0"
+    "Thai_soso\0"
+    "Thai_sosua\0"
+    "Thai_thanthakhat\0"
+    "Thai_thonangmontho\0"
+    "Thai_thophuthao\0"
+    "Thai_thothahan\0"
+    "Thai_thothan\0"
+    "Thai_thothong\0"
+    "Thai_thothung\0"
+    "Thai_topatak\0"
+    "Thai_totao\0"
+    "Thai_wowaen\0"
+    "Thai_yoyak\0"
+    "Thai_yoying\0"
+    "therefore\0"
+    "thinspace\0"
+    "THORN\0"
+    "Thorn\0"
+    "thorn\0"
+    "threeeighths\0"
+    "threefifths\0"
+    "threequarters\0"
+    "threesubscript\0"
+    "threesuperior\0"
+    "tintegral\0"
+    "topintegral\0"
+    "topleftparens\0"
+    "topleftradical\0"
+    "topleftsqbracket\0"
+    "topleftsummation\0"
+    "toprightparens\0"
+    "toprightsqbracket\0"
+    "toprightsummation\0"
+    "topt\0"
+    "topvertsummationconnector\0"
+    "Touroku\0"
+    "trademark\0"
+    "trademarkincircle\0"
+    "Tslash\0"
+    "tslash\0"
+    "twofifths\0"
+    "twosubscript\0"
+    "twosuperior\0"
+    "twothirds\0"
+    "U\0"
+    "u\0"
+    "Uacute\0"
+    "uacute\0"
+    "Ubelowdot\0"
+    "ubelowdot\0"
+    "Ubreve\0"
+    "ubreve\0"
+    "Ucircumflex\0"
+    "ucircumflex\0"
+    "Udiaeresis\0"
+    "udiaeresis\0"
+    "Udoubleacute\0"
+    "udoubleacute\0"
+    "Ugrave\0"
+    "ugrave\0"
+    "Uhook\0"
+    "uhook\0"
+    "Uhorn\0"
+    "uhorn\0"
+    "Uhornacute\0"
+    "uhornacute\0"
+    "Uhornbelowdot\0"
+    "uhornbelowdot\0"
+    "Uhorngrave\0"
+    "uhorngrave\0"
+    "Uhornhook\0"
+    "uhornhook\0"
+    "Uhorntilde\0"
+    "uhorntilde\0"
+    "Ukrainian_ghe_with_upturn\0"
+    "Ukrainian_GHE_WITH_UPTURN\0"
+    "Ukrainian_i\0"
+    "Ukrainian_I\0"
+    "Ukrainian_ie\0"
+    "Ukrainian_IE\0"
+    "Ukrainian_yi\0"
+    "Ukrainian_YI\0"
+    "Ukranian_i\0"
+    "Ukranian_I\0"
+    "Ukranian_je\0"
+    "Ukranian_JE\0"
+    "Ukranian_yi\0"
+    "Ukranian_YI\0"
+    "Umacron\0"
+    "umacron\0"
+    "underbar\0"
+    "underscore\0"
+    "Undo\0"
+    "union\0"
+    "Uogonek\0"
+    "uogonek\0"
+    "Up\0"
+    "uparrow\0"
+    "upcaret\0"
+    "upleftcorner\0"
+    "uprightcorner\0"
+    "upshoe\0"
+    "upstile\0"
+    "uptack\0"
+    "Uring\0"
+    "uring\0"
+    "User\0"
+    "Utilde\0"
+    "utilde\0"
+    "V\0"
+    "v\0"
+    "variation\0"
+    "vertbar\0"
+    "vertconnector\0"
+    "voicedsound\0"
+    "VoidSymbol\0"
+    "vt\0"
+    "W\0"
+    "w\0"
+    "Wacute\0"
+    "wacute\0"
+    "Wcircumflex\0"
+    "wcircumflex\0"
+    "Wdiaeresis\0"
+    "wdiaeresis\0"
+    "Wgrave\0"
+    "wgrave\0"
+    "WonSign\0"
+    "X\0"
+    "x\0"
+    "Xabovedot\0"
+    "xabovedot\0"
+    "XF86AddFavorite\0"
+    "XF86ApplicationLeft\0"
+    "XF86ApplicationRight\0"
+    "XF86AudioCycleTrack\0"
+    "XF86AudioForward\0"
+    "XF86AudioLowerVolume\0"
+    "XF86AudioMedia\0"
+    "XF86AudioMicMute\0"
+    "XF86AudioMute\0"
+    "XF86AudioNext\0"
+    "XF86AudioPause\0"
+    "XF86AudioPlay\0"
+    "XF86AudioPrev\0"
+    "XF86AudioRaiseVolume\0"
+    "XF86AudioRandomPlay\0"
+    "XF86AudioRecord\0"
+    "XF86AudioRepeat\0"
+    "XF86AudioRewind\0"
+    "XF86AudioStop\0"
+    "XF86Away\0"
+    "XF86Back\0"
+    "XF86BackForward\0"
+    "XF86Battery\0"
+    "XF86Blue\0"
+    "XF86Bluetooth\0"
+    "XF86Book\0"
+    "XF86BrightnessAdjust\0"
+    "XF86Calculater\0"
+    "XF86Calculator\0"
+    "XF86Calendar\0"
+    "XF86CD\0"
+    "XF86Clear\0"
+    "XF86ClearGrab\0"
+    "XF86Close\0"
+    "XF86Community\0"
+    "XF86ContrastAdjust\0"
+    "XF86Copy\0"
+    "XF86Cut\0"
+    "XF86CycleAngle\0"
+    "XF86Display\0"
+    "XF86Documents\0"
+    "XF86DOS\0"
+    "XF86Eject\0"
+    "XF86Excel\0"
+    "XF86Explorer\0"
+    "XF86Favorites\0"
+    "XF86Finance\0"
+    "XF86Forward\0"
+    "XF86FrameBack\0"
+    "XF86FrameForward\0"
+    "XF86Game\0"
+    "XF86Go\0"
+    "XF86Green\0"
+    "XF86Hibernate\0"
+    "XF86History\0"
+    "XF86HomePage\0"
+    "XF86HotLinks\0"
+    "XF86iTouch\0"
+    "XF86KbdBrightnessDown\0"
+    "XF86KbdBrightnessUp\0"
+    "XF86KbdLightOnOff\0"
+    "XF86Launch0\0"
+    "XF86Launch1\0"
+    "XF86Launch2\0"
+    "XF86Launch3\0"
+    "XF86Launch4\0"
+    "XF86Launch5\0"
+    "XF86Launch6\0"
+    "XF86Launch7\0"
+    "XF86Launch8\0"
+    "XF86Launch9\0"
+    "XF86LaunchA\0"
+    "XF86LaunchB\0"
+    "XF86LaunchC\0"
+    "XF86LaunchD\0"
+    "XF86LaunchE\0"
+    "XF86LaunchF\0"
+    "XF86LightBulb\0"
+    "XF86LogGrabInfo\0"
+    "XF86LogOff\0"
+    "XF86LogWindowTree\0"
+    "XF86Mail\0"
+    "XF86MailForward\0"
+    "XF86Market\0"
+    "XF86Meeting\0"
+    "XF86Memo\0"
+    "XF86MenuKB\0"
+    "XF86MenuPB\0"
+    "XF86Messenger\0"
+    "XF86ModeLock\0"
+    "XF86MonBrightnessDown\0"
+    "XF86MonBrightnessUp\0"
+    "XF86Music\0"
+    "XF86MyComputer\0"
+    "XF86MySites\0"
+    "XF86New\0"
+    "XF86News\0"
+    "XF86Next_VMode\0"
+    "XF86OfficeHome\0"
+    "XF86Open\0"
+    "XF86OpenURL\0"
+    "XF86Option\0"
+    "XF86Paste\0"
+    "XF86Phone\0"
+    "XF86Pictures\0"
+    "XF86PowerDown\0"
+    "XF86PowerOff\0"
+    "XF86Prev_VMode\0"
+    "XF86Q\0"
+    "XF86Red\0"
+    "XF86Refresh\0"
+    "XF86Reload\0"
+    "XF86Reply\0"
+    "XF86RockerDown\0"
+    "XF86RockerEnter\0"
+    "XF86RockerUp\0"
+    "XF86RotateWindows\0"
+    "XF86RotationKB\0"
+    "XF86RotationPB\0"
+    "XF86Save\0"
+    "XF86ScreenSaver\0"
+    "XF86ScrollClick\0"
+    "XF86ScrollDown\0"
+    "XF86ScrollUp\0"
+    "XF86Search\0"
+    "XF86Select\0"
+    "XF86Send\0"
+    "XF86Shop\0"
+    "XF86Sleep\0"
+    "XF86Spell\0"
+    "XF86SplitScreen\0"
+    "XF86Standby\0"
+    "XF86Start\0"
+    "XF86Stop\0"
+    "XF86Subtitle\0"
+    "XF86Support\0"
+    "XF86Suspend\0"
+    "XF86Switch_VT_1\0"
+    "XF86Switch_VT_10\0"
+    "XF86Switch_VT_11\0"
+    "XF86Switch_VT_12\0"
+    "XF86Switch_VT_2\0"
+    "XF86Switch_VT_3\0"
+    "XF86Switch_VT_4\0"
+    "XF86Switch_VT_5\0"
+    "XF86Switch_VT_6\0"
+    "XF86Switch_VT_7\0"
+    "XF86Switch_VT_8\0"
+    "XF86Switch_VT_9\0"
+    "XF86TaskPane\0"
+    "XF86Terminal\0"
+    "XF86Time\0"
+    "XF86ToDoList\0"
+    "XF86Tools\0"
+    "XF86TopMenu\0"
+    "XF86TouchpadOff\0"
+    "XF86TouchpadOn\0"
+    "XF86TouchpadToggle\0"
+    "XF86Travel\0"
+    "XF86Ungrab\0"
+    "XF86User1KB\0"
+    "XF86User2KB\0"
+    "XF86UserPB\0"
+    "XF86UWB\0"
+    "XF86VendorHome\0"
+    "XF86Video\0"
+    "XF86View\0"
+    "XF86WakeUp\0"
+    "XF86WebCam\0"
+    "XF86WheelButton\0"
+    "XF86WLAN\0"
+    "XF86Word\0"
+    "XF86WWW\0"
+    "XF86Xfer\0"
+    "XF86Yellow\0"
+    "XF86ZoomIn\0"
+    "XF86ZoomOut\0"
+    "Y\0"
+    "y\0"
+    "Yacute\0"
+    "yacute\0"
+    "Ybelowdot\0"
+    "ybelowdot\0"
+    "Ycircumflex\0"
+    "ycircumflex\0"
+    "ydiaeresis\0"
+    "Ydiaeresis\0"
+    "yen\0"
+    "Ygrave\0"
+    "ygrave\0"
+    "Yhook\0"
+    "yhook\0"
+    "Ytilde\0"
+    "ytilde\0"
+    "Z\0"
+    "z\0"
+    "Zabovedot\0"
+    "zabovedot\0"
+    "Zacute\0"
+    "zacute\0"
+    "Zcaron\0"
+    "zcaron\0"
+    "Zen_Koho\0"
+    "Zenkaku\0"
+    "Zenkaku_Hankaku\0"
+    "zerosubscript\0"
+    "zerosuperior\0"
+    "Zstroke\0"
+    "zstroke\0"
+;
+
 static const struct name_keysym name_to_keysym[] = {
-    { "0", XKB_KEY_0 },
-    { "1", XKB_KEY_1 },
-    { "2", XKB_KEY_2 },
-    { "3", XKB_KEY_3 },
-    { "3270_AltCursor", XKB_KEY_3270_AltCursor },
-    { "3270_Attn", XKB_KEY_3270_Attn },
-    { "3270_BackTab", XKB_KEY_3270_BackTab },
-    { "3270_ChangeScreen", XKB_KEY_3270_ChangeScreen },
-    { "3270_Copy", XKB_KEY_3270_Copy },
-    { "3270_CursorBlink", XKB_KEY_3270_CursorBlink },
-    { "3270_CursorSelect", XKB_KEY_3270_CursorSelect },
-    { "3270_DeleteWord", XKB_KEY_3270_DeleteWord },
-    { "3270_Duplicate", XKB_KEY_3270_Duplicate },
-    { "3270_Enter", XKB_KEY_3270_Enter },
-    { "3270_EraseEOF", XKB_KEY_3270_EraseEOF },
-    { "3270_EraseInput", XKB_KEY_3270_EraseInput },
-    { "3270_ExSelect", XKB_KEY_3270_ExSelect },
-    { "3270_FieldMark", XKB_KEY_3270_FieldMark },
-    { "3270_Ident", XKB_KEY_3270_Ident },
-    { "3270_Jump", XKB_KEY_3270_Jump },
-    { "3270_KeyClick", XKB_KEY_3270_KeyClick },
-    { "3270_Left2", XKB_KEY_3270_Left2 },
-    { "3270_PA1", XKB_KEY_3270_PA1 },
-    { "3270_PA2", XKB_KEY_3270_PA2 },
-    { "3270_PA3", XKB_KEY_3270_PA3 },
-    { "3270_Play", XKB_KEY_3270_Play },
-    { "3270_PrintScreen", XKB_KEY_3270_PrintScreen },
-    { "3270_Quit", XKB_KEY_3270_Quit },
-    { "3270_Record", XKB_KEY_3270_Record },
-    { "3270_Reset", XKB_KEY_3270_Reset },
-    { "3270_Right2", XKB_KEY_3270_Right2 },
-    { "3270_Rule", XKB_KEY_3270_Rule },
-    { "3270_Setup", XKB_KEY_3270_Setup },
-    { "3270_Test", XKB_KEY_3270_Test },
-    { "4", XKB_KEY_4 },
-    { "5", XKB_KEY_5 },
-    { "6", XKB_KEY_6 },
-    { "7", XKB_KEY_7 },
-    { "8", XKB_KEY_8 },
-    { "9", XKB_KEY_9 },
-    { "A", XKB_KEY_A },
-    { "a", XKB_KEY_a },
-    { "Aacute", XKB_KEY_Aacute },
-    { "aacute", XKB_KEY_aacute },
-    { "Abelowdot", XKB_KEY_Abelowdot },
-    { "abelowdot", XKB_KEY_abelowdot },
-    { "abovedot", XKB_KEY_abovedot },
-    { "Abreve", XKB_KEY_Abreve },
-    { "abreve", XKB_KEY_abreve },
-    { "Abreveacute", XKB_KEY_Abreveacute },
-    { "abreveacute", XKB_KEY_abreveacute },
-    { "Abrevebelowdot", XKB_KEY_Abrevebelowdot },
-    { "abrevebelowdot", XKB_KEY_abrevebelowdot },
-    { "Abrevegrave", XKB_KEY_Abrevegrave },
-    { "abrevegrave", XKB_KEY_abrevegrave },
-    { "Abrevehook", XKB_KEY_Abrevehook },
-    { "abrevehook", XKB_KEY_abrevehook },
-    { "Abrevetilde", XKB_KEY_Abrevetilde },
-    { "abrevetilde", XKB_KEY_abrevetilde },
-    { "AccessX_Enable", XKB_KEY_AccessX_Enable },
-    { "AccessX_Feedback_Enable", XKB_KEY_AccessX_Feedback_Enable },
-    { "Acircumflex", XKB_KEY_Acircumflex },
-    { "acircumflex", XKB_KEY_acircumflex },
-    { "Acircumflexacute", XKB_KEY_Acircumflexacute },
-    { "acircumflexacute", XKB_KEY_acircumflexacute },
-    { "Acircumflexbelowdot", XKB_KEY_Acircumflexbelowdot },
-    { "acircumflexbelowdot", XKB_KEY_acircumflexbelowdot },
-    { "Acircumflexgrave", XKB_KEY_Acircumflexgrave },
-    { "acircumflexgrave", XKB_KEY_acircumflexgrave },
-    { "Acircumflexhook", XKB_KEY_Acircumflexhook },
-    { "acircumflexhook", XKB_KEY_acircumflexhook },
-    { "Acircumflextilde", XKB_KEY_Acircumflextilde },
-    { "acircumflextilde", XKB_KEY_acircumflextilde },
-    { "acute", XKB_KEY_acute },
-    { "Adiaeresis", XKB_KEY_Adiaeresis },
-    { "adiaeresis", XKB_KEY_adiaeresis },
-    { "AE", XKB_KEY_AE },
-    { "ae", XKB_KEY_ae },
-    { "Agrave", XKB_KEY_Agrave },
-    { "agrave", XKB_KEY_agrave },
-    { "Ahook", XKB_KEY_Ahook },
-    { "ahook", XKB_KEY_ahook },
-    { "Alt_L", XKB_KEY_Alt_L },
-    { "Alt_R", XKB_KEY_Alt_R },
-    { "Amacron", XKB_KEY_Amacron },
-    { "amacron", XKB_KEY_amacron },
-    { "ampersand", XKB_KEY_ampersand },
-    { "Aogonek", XKB_KEY_Aogonek },
-    { "aogonek", XKB_KEY_aogonek },
-    { "apostrophe", XKB_KEY_apostrophe },
-    { "approxeq", XKB_KEY_approxeq },
-    { "approximate", XKB_KEY_approximate },
-    { "Arabic_0", XKB_KEY_Arabic_0 },
-    { "Arabic_1", XKB_KEY_Arabic_1 },
-    { "Arabic_2", XKB_KEY_Arabic_2 },
-    { "Arabic_3", XKB_KEY_Arabic_3 },
-    { "Arabic_4", XKB_KEY_Arabic_4 },
-    { "Arabic_5", XKB_KEY_Arabic_5 },
-    { "Arabic_6", XKB_KEY_Arabic_6 },
-    { "Arabic_7", XKB_KEY_Arabic_7 },
-    { "Arabic_8", XKB_KEY_Arabic_8 },
-    { "Arabic_9", XKB_KEY_Arabic_9 },
-    { "Arabic_ain", XKB_KEY_Arabic_ain },
-    { "Arabic_alef", XKB_KEY_Arabic_alef },
-    { "Arabic_alefmaksura", XKB_KEY_Arabic_alefmaksura },
-    { "Arabic_beh", XKB_KEY_Arabic_beh },
-    { "Arabic_comma", XKB_KEY_Arabic_comma },
-    { "Arabic_dad", XKB_KEY_Arabic_dad },
-    { "Arabic_dal", XKB_KEY_Arabic_dal },
-    { "Arabic_damma", XKB_KEY_Arabic_damma },
-    { "Arabic_dammatan", XKB_KEY_Arabic_dammatan },
-    { "Arabic_ddal", XKB_KEY_Arabic_ddal },
-    { "Arabic_farsi_yeh", XKB_KEY_Arabic_farsi_yeh },
-    { "Arabic_fatha", XKB_KEY_Arabic_fatha },
-    { "Arabic_fathatan", XKB_KEY_Arabic_fathatan },
-    { "Arabic_feh", XKB_KEY_Arabic_feh },
-    { "Arabic_fullstop", XKB_KEY_Arabic_fullstop },
-    { "Arabic_gaf", XKB_KEY_Arabic_gaf },
-    { "Arabic_ghain", XKB_KEY_Arabic_ghain },
-    { "Arabic_ha", XKB_KEY_Arabic_ha },
-    { "Arabic_hah", XKB_KEY_Arabic_hah },
-    { "Arabic_hamza", XKB_KEY_Arabic_hamza },
-    { "Arabic_hamza_above", XKB_KEY_Arabic_hamza_above },
-    { "Arabic_hamza_below", XKB_KEY_Arabic_hamza_below },
-    { "Arabic_hamzaonalef", XKB_KEY_Arabic_hamzaonalef },
-    { "Arabic_hamzaonwaw", XKB_KEY_Arabic_hamzaonwaw },
-    { "Arabic_hamzaonyeh", XKB_KEY_Arabic_hamzaonyeh },
-    { "Arabic_hamzaunderalef", XKB_KEY_Arabic_hamzaunderalef },
-    { "Arabic_heh", XKB_KEY_Arabic_heh },
-    { "Arabic_heh_doachashmee", XKB_KEY_Arabic_heh_doachashmee },
-    { "Arabic_heh_goal", XKB_KEY_Arabic_heh_goal },
-    { "Arabic_jeem", XKB_KEY_Arabic_jeem },
-    { "Arabic_jeh", XKB_KEY_Arabic_jeh },
-    { "Arabic_kaf", XKB_KEY_Arabic_kaf },
-    { "Arabic_kasra", XKB_KEY_Arabic_kasra },
-    { "Arabic_kasratan", XKB_KEY_Arabic_kasratan },
-    { "Arabic_keheh", XKB_KEY_Arabic_keheh },
-    { "Arabic_khah", XKB_KEY_Arabic_khah },
-    { "Arabic_lam", XKB_KEY_Arabic_lam },
-    { "Arabic_madda_above", XKB_KEY_Arabic_madda_above },
-    { "Arabic_maddaonalef", XKB_KEY_Arabic_maddaonalef },
-    { "Arabic_meem", XKB_KEY_Arabic_meem },
-    { "Arabic_noon", XKB_KEY_Arabic_noon },
-    { "Arabic_noon_ghunna", XKB_KEY_Arabic_noon_ghunna },
-    { "Arabic_peh", XKB_KEY_Arabic_peh },
-    { "Arabic_percent", XKB_KEY_Arabic_percent },
-    { "Arabic_qaf", XKB_KEY_Arabic_qaf },
-    { "Arabic_question_mark", XKB_KEY_Arabic_question_mark },
-    { "Arabic_ra", XKB_KEY_Arabic_ra },
-    { "Arabic_rreh", XKB_KEY_Arabic_rreh },
-    { "Arabic_sad", XKB_KEY_Arabic_sad },
-    { "Arabic_seen", XKB_KEY_Arabic_seen },
-    { "Arabic_semicolon", XKB_KEY_Arabic_semicolon },
-    { "Arabic_shadda", XKB_KEY_Arabic_shadda },
-    { "Arabic_sheen", XKB_KEY_Arabic_sheen },
-    { "Arabic_sukun", XKB_KEY_Arabic_sukun },
-    { "Arabic_superscript_alef", XKB_KEY_Arabic_superscript_alef },
-    { "Arabic_switch", XKB_KEY_Arabic_switch },
-    { "Arabic_tah", XKB_KEY_Arabic_tah },
-    { "Arabic_tatweel", XKB_KEY_Arabic_tatweel },
-    { "Arabic_tcheh", XKB_KEY_Arabic_tcheh },
-    { "Arabic_teh", XKB_KEY_Arabic_teh },
-    { "Arabic_tehmarbuta", XKB_KEY_Arabic_tehmarbuta },
-    { "Arabic_thal", XKB_KEY_Arabic_thal },
-    { "Arabic_theh", XKB_KEY_Arabic_theh },
-    { "Arabic_tteh", XKB_KEY_Arabic_tteh },
-    { "Arabic_veh", XKB_KEY_Arabic_veh },
-    { "Arabic_waw", XKB_KEY_Arabic_waw },
-    { "Arabic_yeh", XKB_KEY_Arabic_yeh },
-    { "Arabic_yeh_baree", XKB_KEY_Arabic_yeh_baree },
-    { "Arabic_zah", XKB_KEY_Arabic_zah },
-    { "Arabic_zain", XKB_KEY_Arabic_zain },
-    { "Aring", XKB_KEY_Aring },
-    { "aring", XKB_KEY_aring },
-    { "Armenian_accent", XKB_KEY_Armenian_accent },
-    { "Armenian_amanak", XKB_KEY_Armenian_amanak },
-    { "Armenian_apostrophe", XKB_KEY_Armenian_apostrophe },
-    { "Armenian_AT", XKB_KEY_Armenian_AT },
-    { "Armenian_at", XKB_KEY_Armenian_at },
-    { "Armenian_AYB", XKB_KEY_Armenian_AYB },
-    { "Armenian_ayb", XKB_KEY_Armenian_ayb },
-    { "Armenian_BEN", XKB_KEY_Armenian_BEN },
-    { "Armenian_ben", XKB_KEY_Armenian_ben },
-    { "Armenian_but", XKB_KEY_Armenian_but },
-    { "Armenian_CHA", XKB_KEY_Armenian_CHA },
-    { "Armenian_cha", XKB_KEY_Armenian_cha },
-    { "Armenian_DA", XKB_KEY_Armenian_DA },
-    { "Armenian_da", XKB_KEY_Armenian_da },
-    { "Armenian_DZA", XKB_KEY_Armenian_DZA },
-    { "Armenian_dza", XKB_KEY_Armenian_dza },
-    { "Armenian_E", XKB_KEY_Armenian_E },
-    { "Armenian_e", XKB_KEY_Armenian_e },
-    { "Armenian_exclam", XKB_KEY_Armenian_exclam },
-    { "Armenian_FE", XKB_KEY_Armenian_FE },
-    { "Armenian_fe", XKB_KEY_Armenian_fe },
-    { "Armenian_full_stop", XKB_KEY_Armenian_full_stop },
-    { "Armenian_GHAT", XKB_KEY_Armenian_GHAT },
-    { "Armenian_ghat", XKB_KEY_Armenian_ghat },
-    { "Armenian_GIM", XKB_KEY_Armenian_GIM },
-    { "Armenian_gim", XKB_KEY_Armenian_gim },
-    { "Armenian_HI", XKB_KEY_Armenian_HI },
-    { "Armenian_hi", XKB_KEY_Armenian_hi },
-    { "Armenian_HO", XKB_KEY_Armenian_HO },
-    { "Armenian_ho", XKB_KEY_Armenian_ho },
-    { "Armenian_hyphen", XKB_KEY_Armenian_hyphen },
-    { "Armenian_INI", XKB_KEY_Armenian_INI },
-    { "Armenian_ini", XKB_KEY_Armenian_ini },
-    { "Armenian_JE", XKB_KEY_Armenian_JE },
-    { "Armenian_je", XKB_KEY_Armenian_je },
-    { "Armenian_KE", XKB_KEY_Armenian_KE },
-    { "Armenian_ke", XKB_KEY_Armenian_ke },
-    { "Armenian_KEN", XKB_KEY_Armenian_KEN },
-    { "Armenian_ken", XKB_KEY_Armenian_ken },
-    { "Armenian_KHE", XKB_KEY_Armenian_KHE },
-    { "Armenian_khe", XKB_KEY_Armenian_khe },
-    { "Armenian_ligature_ew", XKB_KEY_Armenian_ligature_ew },
-    { "Armenian_LYUN", XKB_KEY_Armenian_LYUN },
-    { "Armenian_lyun", XKB_KEY_Armenian_lyun },
-    { "Armenian_MEN", XKB_KEY_Armenian_MEN },
-    { "Armenian_men", XKB_KEY_Armenian_men },
-    { "Armenian_NU", XKB_KEY_Armenian_NU },
-    { "Armenian_nu", XKB_KEY_Armenian_nu },
-    { "Armenian_O", XKB_KEY_Armenian_O },
-    { "Armenian_o", XKB_KEY_Armenian_o },
-    { "Armenian_paruyk", XKB_KEY_Armenian_paruyk },
-    { "Armenian_PE", XKB_KEY_Armenian_PE },
-    { "Armenian_pe", XKB_KEY_Armenian_pe },
-    { "Armenian_PYUR", XKB_KEY_Armenian_PYUR },
-    { "Armenian_pyur", XKB_KEY_Armenian_pyur },
-    { "Armenian_question", XKB_KEY_Armenian_question },
-    { "Armenian_RA", XKB_KEY_Armenian_RA },
-    { "Armenian_ra", XKB_KEY_Armenian_ra },
-    { "Armenian_RE", XKB_KEY_Armenian_RE },
-    { "Armenian_re", XKB_KEY_Armenian_re },
-    { "Armenian_SE", XKB_KEY_Armenian_SE },
-    { "Armenian_se", XKB_KEY_Armenian_se },
-    { "Armenian_separation_mark", XKB_KEY_Armenian_separation_mark },
-    { "Armenian_SHA", XKB_KEY_Armenian_SHA },
-    { "Armenian_sha", XKB_KEY_Armenian_sha },
-    { "Armenian_shesht", XKB_KEY_Armenian_shesht },
-    { "Armenian_TCHE", XKB_KEY_Armenian_TCHE },
-    { "Armenian_tche", XKB_KEY_Armenian_tche },
-    { "Armenian_TO", XKB_KEY_Armenian_TO },
-    { "Armenian_to", XKB_KEY_Armenian_to },
-    { "Armenian_TSA", XKB_KEY_Armenian_TSA },
-    { "Armenian_tsa", XKB_KEY_Armenian_tsa },
-    { "Armenian_TSO", XKB_KEY_Armenian_TSO },
-    { "Armenian_tso", XKB_KEY_Armenian_tso },
-    { "Armenian_TYUN", XKB_KEY_Armenian_TYUN },
-    { "Armenian_tyun", XKB_KEY_Armenian_tyun },
-    { "Armenian_verjaket", XKB_KEY_Armenian_verjaket },
-    { "Armenian_VEV", XKB_KEY_Armenian_VEV },
-    { "Armenian_vev", XKB_KEY_Armenian_vev },
-    { "Armenian_VO", XKB_KEY_Armenian_VO },
-    { "Armenian_vo", XKB_KEY_Armenian_vo },
-    { "Armenian_VYUN", XKB_KEY_Armenian_VYUN },
-    { "Armenian_vyun", XKB_KEY_Armenian_vyun },
-    { "Armenian_YECH", XKB_KEY_Armenian_YECH },
-    { "Armenian_yech", XKB_KEY_Armenian_yech },
-    { "Armenian_yentamna", XKB_KEY_Armenian_yentamna },
-    { "Armenian_ZA", XKB_KEY_Armenian_ZA },
-    { "Armenian_za", XKB_KEY_Armenian_za },
-    { "Armenian_ZHE", XKB_KEY_Armenian_ZHE },
-    { "Armenian_zhe", XKB_KEY_Armenian_zhe },
-    { "asciicircum", XKB_KEY_asciicircum },
-    { "asciitilde", XKB_KEY_asciitilde },
-    { "asterisk", XKB_KEY_asterisk },
-    { "at", XKB_KEY_at },
-    { "Atilde", XKB_KEY_Atilde },
-    { "atilde", XKB_KEY_atilde },
-    { "AudibleBell_Enable", XKB_KEY_AudibleBell_Enable },
-    { "B", XKB_KEY_B },
-    { "b", XKB_KEY_b },
-    { "Babovedot", XKB_KEY_Babovedot },
-    { "babovedot", XKB_KEY_babovedot },
-    { "backslash", XKB_KEY_backslash },
-    { "BackSpace", XKB_KEY_BackSpace },
-    { "BackTab", XKB_KEY_BackTab },
-    { "ballotcross", XKB_KEY_ballotcross },
-    { "bar", XKB_KEY_bar },
-    { "because", XKB_KEY_because },
-    { "Begin", XKB_KEY_Begin },
-    { "blank", XKB_KEY_blank },
-    { "block", XKB_KEY_block },
-    { "botintegral", XKB_KEY_botintegral },
-    { "botleftparens", XKB_KEY_botleftparens },
-    { "botleftsqbracket", XKB_KEY_botleftsqbracket },
-    { "botleftsummation", XKB_KEY_botleftsummation },
-    { "botrightparens", XKB_KEY_botrightparens },
-    { "botrightsqbracket", XKB_KEY_botrightsqbracket },
-    { "botrightsummation", XKB_KEY_botrightsummation },
-    { "bott", XKB_KEY_bott },
-    { "botvertsummationconnector", XKB_KEY_botvertsummationconnector },
-    { "BounceKeys_Enable", XKB_KEY_BounceKeys_Enable },
-    { "braceleft", XKB_KEY_braceleft },
-    { "braceright", XKB_KEY_braceright },
-    { "bracketleft", XKB_KEY_bracketleft },
-    { "bracketright", XKB_KEY_bracketright },
-    { "braille_blank", XKB_KEY_braille_blank },
-    { "braille_dot_1", XKB_KEY_braille_dot_1 },
-    { "braille_dot_10", XKB_KEY_braille_dot_10 },
-    { "braille_dot_2", XKB_KEY_braille_dot_2 },
-    { "braille_dot_3", XKB_KEY_braille_dot_3 },
-    { "braille_dot_4", XKB_KEY_braille_dot_4 },
-    { "braille_dot_5", XKB_KEY_braille_dot_5 },
-    { "braille_dot_6", XKB_KEY_braille_dot_6 },
-    { "braille_dot_7", XKB_KEY_braille_dot_7 },
-    { "braille_dot_8", XKB_KEY_braille_dot_8 },
-    { "braille_dot_9", XKB_KEY_braille_dot_9 },
-    { "braille_dots_1", XKB_KEY_braille_dots_1 },
-    { "braille_dots_12", XKB_KEY_braille_dots_12 },
-    { "braille_dots_123", XKB_KEY_braille_dots_123 },
-    { "braille_dots_1234", XKB_KEY_braille_dots_1234 },
-    { "braille_dots_12345", XKB_KEY_braille_dots_12345 },
-    { "braille_dots_123456", XKB_KEY_braille_dots_123456 },
-    { "braille_dots_1234567", XKB_KEY_braille_dots_1234567 },
-    { "braille_dots_12345678", XKB_KEY_braille_dots_12345678 },
-    { "braille_dots_1234568", XKB_KEY_braille_dots_1234568 },
-    { "braille_dots_123457", XKB_KEY_braille_dots_123457 },
-    { "braille_dots_1234578", XKB_KEY_braille_dots_1234578 },
-    { "braille_dots_123458", XKB_KEY_braille_dots_123458 },
-    { "braille_dots_12346", XKB_KEY_braille_dots_12346 },
-    { "braille_dots_123467", XKB_KEY_braille_dots_123467 },
-    { "braille_dots_1234678", XKB_KEY_braille_dots_1234678 },
-    { "braille_dots_123468", XKB_KEY_braille_dots_123468 },
-    { "braille_dots_12347", XKB_KEY_braille_dots_12347 },
-    { "braille_dots_123478", XKB_KEY_braille_dots_123478 },
-    { "braille_dots_12348", XKB_KEY_braille_dots_12348 },
-    { "braille_dots_1235", XKB_KEY_braille_dots_1235 },
-    { "braille_dots_12356", XKB_KEY_braille_dots_12356 },
-    { "braille_dots_123567", XKB_KEY_braille_dots_123567 },
-    { "braille_dots_1235678", XKB_KEY_braille_dots_1235678 },
-    { "braille_dots_123568", XKB_KEY_braille_dots_123568 },
-    { "braille_dots_12357", XKB_KEY_braille_dots_12357 },
-    { "braille_dots_123578", XKB_KEY_braille_dots_123578 },
-    { "braille_dots_12358", XKB_KEY_braille_dots_12358 },
-    { "braille_dots_1236", XKB_KEY_braille_dots_1236 },
-    { "braille_dots_12367", XKB_KEY_braille_dots_12367 },
-    { "braille_dots_123678", XKB_KEY_braille_dots_123678 },
-    { "braille_dots_12368", XKB_KEY_braille_dots_12368 },
-    { "braille_dots_1237", XKB_KEY_braille_dots_1237 },
-    { "braille_dots_12378", XKB_KEY_braille_dots_12378 },
-    { "braille_dots_1238", XKB_KEY_braille_dots_1238 },
-    { "braille_dots_124", XKB_KEY_braille_dots_124 },
-    { "braille_dots_1245", XKB_KEY_braille_dots_1245 },
-    { "braille_dots_12456", XKB_KEY_braille_dots_12456 },
-    { "braille_dots_124567", XKB_KEY_braille_dots_124567 },
-    { "braille_dots_1245678", XKB_KEY_braille_dots_1245678 },
-    { "braille_dots_124568", XKB_KEY_braille_dots_124568 },
-    { "braille_dots_12457", XKB_KEY_braille_dots_12457 },
-    { "braille_dots_124578", XKB_KEY_braille_dots_124578 },
-    { "braille_dots_12458", XKB_KEY_braille_dots_12458 },
-    { "braille_dots_1246", XKB_KEY_braille_dots_1246 },
-    { "braille_dots_12467", XKB_KEY_braille_dots_12467 },
-    { "braille_dots_124678", XKB_KEY_braille_dots_124678 },
-    { "braille_dots_12468", XKB_KEY_braille_dots_12468 },
-    { "braille_dots_1247", XKB_KEY_braille_dots_1247 },
-    { "braille_dots_12478", XKB_KEY_braille_dots_12478 },
-    { "braille_dots_1248", XKB_KEY_braille_dots_1248 },
-    { "braille_dots_125", XKB_KEY_braille_dots_125 },
-    { "braille_dots_1256", XKB_KEY_braille_dots_1256 },
-    { "braille_dots_12567", XKB_KEY_braille_dots_12567 },
-    { "braille_dots_125678", XKB_KEY_braille_dots_125678 },
-    { "braille_dots_12568", XKB_KEY_braille_dots_12568 },
-    { "braille_dots_1257", XKB_KEY_braille_dots_1257 },
-    { "braille_dots_12578", XKB_KEY_braille_dots_12578 },
-    { "braille_dots_1258", XKB_KEY_braille_dots_1258 },
-    { "braille_dots_126", XKB_KEY_braille_dots_126 },
-    { "braille_dots_1267", XKB_KEY_braille_dots_1267 },
-    { "braille_dots_12678", XKB_KEY_braille_dots_12678 },
-    { "braille_dots_1268", XKB_KEY_braille_dots_1268 },
-    { "braille_dots_127", XKB_KEY_braille_dots_127 },
-    { "braille_dots_1278", XKB_KEY_braille_dots_1278 },
-    { "braille_dots_128", XKB_KEY_braille_dots_128 },
-    { "braille_dots_13", XKB_KEY_braille_dots_13 },
-    { "braille_dots_134", XKB_KEY_braille_dots_134 },
-    { "braille_dots_1345", XKB_KEY_braille_dots_1345 },
-    { "braille_dots_13456", XKB_KEY_braille_dots_13456 },
-    { "braille_dots_134567", XKB_KEY_braille_dots_134567 },
-    { "braille_dots_1345678", XKB_KEY_braille_dots_1345678 },
-    { "braille_dots_134568", XKB_KEY_braille_dots_134568 },
-    { "braille_dots_13457", XKB_KEY_braille_dots_13457 },
-    { "braille_dots_134578", XKB_KEY_braille_dots_134578 },
-    { "braille_dots_13458", XKB_KEY_braille_dots_13458 },
-    { "braille_dots_1346", XKB_KEY_braille_dots_1346 },
-    { "braille_dots_13467", XKB_KEY_braille_dots_13467 },
-    { "braille_dots_134678", XKB_KEY_braille_dots_134678 },
-    { "braille_dots_13468", XKB_KEY_braille_dots_13468 },
-    { "braille_dots_1347", XKB_KEY_braille_dots_1347 },
-    { "braille_dots_13478", XKB_KEY_braille_dots_13478 },
-    { "braille_dots_1348", XKB_KEY_braille_dots_1348 },
-    { "braille_dots_135", XKB_KEY_braille_dots_135 },
-    { "braille_dots_1356", XKB_KEY_braille_dots_1356 },
-    { "braille_dots_13567", XKB_KEY_braille_dots_13567 },
-    { "braille_dots_135678", XKB_KEY_braille_dots_135678 },
-    { "braille_dots_13568", XKB_KEY_braille_dots_13568 },
-    { "braille_dots_1357", XKB_KEY_braille_dots_1357 },
-    { "braille_dots_13578", XKB_KEY_braille_dots_13578 },
-    { "braille_dots_1358", XKB_KEY_braille_dots_1358 },
-    { "braille_dots_136", XKB_KEY_braille_dots_136 },
-    { "braille_dots_1367", XKB_KEY_braille_dots_1367 },
-    { "braille_dots_13678", XKB_KEY_braille_dots_13678 },
-    { "braille_dots_1368", XKB_KEY_braille_dots_1368 },
-    { "braille_dots_137", XKB_KEY_braille_dots_137 },
-    { "braille_dots_1378", XKB_KEY_braille_dots_1378 },
-    { "braille_dots_138", XKB_KEY_braille_dots_138 },
-    { "braille_dots_14", XKB_KEY_braille_dots_14 },
-    { "braille_dots_145", XKB_KEY_braille_dots_145 },
-    { "braille_dots_1456", XKB_KEY_braille_dots_1456 },
-    { "braille_dots_14567", XKB_KEY_braille_dots_14567 },
-    { "braille_dots_145678", XKB_KEY_braille_dots_145678 },
-    { "braille_dots_14568", XKB_KEY_braille_dots_14568 },
-    { "braille_dots_1457", XKB_KEY_braille_dots_1457 },
-    { "braille_dots_14578", XKB_KEY_braille_dots_14578 },
-    { "braille_dots_1458", XKB_KEY_braille_dots_1458 },
-    { "braille_dots_146", XKB_KEY_braille_dots_146 },
-    { "braille_dots_1467", XKB_KEY_braille_dots_1467 },
-    { "braille_dots_14678", XKB_KEY_braille_dots_14678 },
-    { "braille_dots_1468", XKB_KEY_braille_dots_1468 },
-    { "braille_dots_147", XKB_KEY_braille_dots_147 },
-    { "braille_dots_1478", XKB_KEY_braille_dots_1478 },
-    { "braille_dots_148", XKB_KEY_braille_dots_148 },
-    { "braille_dots_15", XKB_KEY_braille_dots_15 },
-    { "braille_dots_156", XKB_KEY_braille_dots_156 },
-    { "braille_dots_1567", XKB_KEY_braille_dots_1567 },
-    { "braille_dots_15678", XKB_KEY_braille_dots_15678 },
-    { "braille_dots_1568", XKB_KEY_braille_dots_1568 },
-    { "braille_dots_157", XKB_KEY_braille_dots_157 },
-    { "braille_dots_1578", XKB_KEY_braille_dots_1578 },
-    { "braille_dots_158", XKB_KEY_braille_dots_158 },
-    { "braille_dots_16", XKB_KEY_braille_dots_16 },
-    { "braille_dots_167", XKB_KEY_braille_dots_167 },
-    { "braille_dots_1678", XKB_KEY_braille_dots_1678 },
-    { "braille_dots_168", XKB_KEY_braille_dots_168 },
-    { "braille_dots_17", XKB_KEY_braille_dots_17 },
-    { "braille_dots_178", XKB_KEY_braille_dots_178 },
-    { "braille_dots_18", XKB_KEY_braille_dots_18 },
-    { "braille_dots_2", XKB_KEY_braille_dots_2 },
-    { "braille_dots_23", XKB_KEY_braille_dots_23 },
-    { "braille_dots_234", XKB_KEY_braille_dots_234 },
-    { "braille_dots_2345", XKB_KEY_braille_dots_2345 },
-    { "braille_dots_23456", XKB_KEY_braille_dots_23456 },
-    { "braille_dots_234567", XKB_KEY_braille_dots_234567 },
-    { "braille_dots_2345678", XKB_KEY_braille_dots_2345678 },
-    { "braille_dots_234568", XKB_KEY_braille_dots_234568 },
-    { "braille_dots_23457", XKB_KEY_braille_dots_23457 },
-    { "braille_dots_234578", XKB_KEY_braille_dots_234578 },
-    { "braille_dots_23458", XKB_KEY_braille_dots_23458 },
-    { "braille_dots_2346", XKB_KEY_braille_dots_2346 },
-    { "braille_dots_23467", XKB_KEY_braille_dots_23467 },
-    { "braille_dots_234678", XKB_KEY_braille_dots_234678 },
-    { "braille_dots_23468", XKB_KEY_braille_dots_23468 },
-    { "braille_dots_2347", XKB_KEY_braille_dots_2347 },
-    { "braille_dots_23478", XKB_KEY_braille_dots_23478 },
-    { "braille_dots_2348", XKB_KEY_braille_dots_2348 },
-    { "braille_dots_235", XKB_KEY_braille_dots_235 },
-    { "braille_dots_2356", XKB_KEY_braille_dots_2356 },
-    { "braille_dots_23567", XKB_KEY_braille_dots_23567 },
-    { "braille_dots_235678", XKB_KEY_braille_dots_235678 },
-    { "braille_dots_23568", XKB_KEY_braille_dots_23568 },
-    { "braille_dots_2357", XKB_KEY_braille_dots_2357 },
-    { "braille_dots_23578", XKB_KEY_braille_dots_23578 },
-    { "braille_dots_2358", XKB_KEY_braille_dots_2358 },
-    { "braille_dots_236", XKB_KEY_braille_dots_236 },
-    { "braille_dots_2367", XKB_KEY_braille_dots_2367 },
-    { "braille_dots_23678", XKB_KEY_braille_dots_23678 },
-    { "braille_dots_2368", XKB_KEY_braille_dots_2368 },
-    { "braille_dots_237", XKB_KEY_braille_dots_237 },
-    { "braille_dots_2378", XKB_KEY_braille_dots_2378 },
-    { "braille_dots_238", XKB_KEY_braille_dots_238 },
-    { "braille_dots_24", XKB_KEY_braille_dots_24 },
-    { "braille_dots_245", XKB_KEY_braille_dots_245 },
-    { "braille_dots_2456", XKB_KEY_braille_dots_2456 },
-    { "braille_dots_24567", XKB_KEY_braille_dots_24567 },
-    { "braille_dots_245678", XKB_KEY_braille_dots_245678 },
-    { "braille_dots_24568", XKB_KEY_braille_dots_24568 },
-    { "braille_dots_2457", XKB_KEY_braille_dots_2457 },
-    { "braille_dots_24578", XKB_KEY_braille_dots_24578 },
-    { "braille_dots_2458", XKB_KEY_braille_dots_2458 },
-    { "braille_dots_246", XKB_KEY_braille_dots_246 },
-    { "braille_dots_2467", XKB_KEY_braille_dots_2467 },
-    { "braille_dots_24678", XKB_KEY_braille_dots_24678 },
-    { "braille_dots_2468", XKB_KEY_braille_dots_2468 },
-    { "braille_dots_247", XKB_KEY_braille_dots_247 },
-    { "braille_dots_2478", XKB_KEY_braille_dots_2478 },
-    { "braille_dots_248", XKB_KEY_braille_dots_248 },
-    { "braille_dots_25", XKB_KEY_braille_dots_25 },
-    { "braille_dots_256", XKB_KEY_braille_dots_256 },
-    { "braille_dots_2567", XKB_KEY_braille_dots_2567 },
-    { "braille_dots_25678", XKB_KEY_braille_dots_25678 },
-    { "braille_dots_2568", XKB_KEY_braille_dots_2568 },
-    { "braille_dots_257", XKB_KEY_braille_dots_257 },
-    { "braille_dots_2578", XKB_KEY_braille_dots_2578 },
-    { "braille_dots_258", XKB_KEY_braille_dots_258 },
-    { "braille_dots_26", XKB_KEY_braille_dots_26 },
-    { "braille_dots_267", XKB_KEY_braille_dots_267 },
-    { "braille_dots_2678", XKB_KEY_braille_dots_2678 },
-    { "braille_dots_268", XKB_KEY_braille_dots_268 },
-    { "braille_dots_27", XKB_KEY_braille_dots_27 },
-    { "braille_dots_278", XKB_KEY_braille_dots_278 },
-    { "braille_dots_28", XKB_KEY_braille_dots_28 },
-    { "braille_dots_3", XKB_KEY_braille_dots_3 },
-    { "braille_dots_34", XKB_KEY_braille_dots_34 },
-    { "braille_dots_345", XKB_KEY_braille_dots_345 },
-    { "braille_dots_3456", XKB_KEY_braille_dots_3456 },
-    { "braille_dots_34567", XKB_KEY_braille_dots_34567 },
-    { "braille_dots_345678", XKB_KEY_braille_dots_345678 },
-    { "braille_dots_34568", XKB_KEY_braille_dots_34568 },
-    { "braille_dots_3457", XKB_KEY_braille_dots_3457 },
-    { "braille_dots_34578", XKB_KEY_braille_dots_34578 },
-    { "braille_dots_3458", XKB_KEY_braille_dots_3458 },
-    { "braille_dots_346", XKB_KEY_braille_dots_346 },
-    { "braille_dots_3467", XKB_KEY_braille_dots_3467 },
-    { "braille_dots_34678", XKB_KEY_braille_dots_34678 },
-    { "braille_dots_3468", XKB_KEY_braille_dots_3468 },
-    { "braille_dots_347", XKB_KEY_braille_dots_347 },
-    { "braille_dots_3478", XKB_KEY_braille_dots_3478 },
-    { "braille_dots_348", XKB_KEY_braille_dots_348 },
-    { "braille_dots_35", XKB_KEY_braille_dots_35 },
-    { "braille_dots_356", XKB_KEY_braille_dots_356 },
-    { "braille_dots_3567", XKB_KEY_braille_dots_3567 },
-    { "braille_dots_35678", XKB_KEY_braille_dots_35678 },
-    { "braille_dots_3568", XKB_KEY_braille_dots_3568 },
-    { "braille_dots_357", XKB_KEY_braille_dots_357 },
-    { "braille_dots_3578", XKB_KEY_braille_dots_3578 },
-    { "braille_dots_358", XKB_KEY_braille_dots_358 },
-    { "braille_dots_36", XKB_KEY_braille_dots_36 },
-    { "braille_dots_367", XKB_KEY_braille_dots_367 },
-    { "braille_dots_3678", XKB_KEY_braille_dots_3678 },
-    { "braille_dots_368", XKB_KEY_braille_dots_368 },
-    { "braille_dots_37", XKB_KEY_braille_dots_37 },
-    { "braille_dots_378", XKB_KEY_braille_dots_378 },
-    { "braille_dots_38", XKB_KEY_braille_dots_38 },
-    { "braille_dots_4", XKB_KEY_braille_dots_4 },
-    { "braille_dots_45", XKB_KEY_braille_dots_45 },
-    { "braille_dots_456", XKB_KEY_braille_dots_456 },
-    { "braille_dots_4567", XKB_KEY_braille_dots_4567 },
-    { "braille_dots_45678", XKB_KEY_braille_dots_45678 },
-    { "braille_dots_4568", XKB_KEY_braille_dots_4568 },
-    { "braille_dots_457", XKB_KEY_braille_dots_457 },
-    { "braille_dots_4578", XKB_KEY_braille_dots_4578 },
-    { "braille_dots_458", XKB_KEY_braille_dots_458 },
-    { "braille_dots_46", XKB_KEY_braille_dots_46 },
-    { "braille_dots_467", XKB_KEY_braille_dots_467 },
-    { "braille_dots_4678", XKB_KEY_braille_dots_4678 },
-    { "braille_dots_468", XKB_KEY_braille_dots_468 },
-    { "braille_dots_47", XKB_KEY_braille_dots_47 },
-    { "braille_dots_478", XKB_KEY_braille_dots_478 },
-    { "braille_dots_48", XKB_KEY_braille_dots_48 },
-    { "braille_dots_5", XKB_KEY_braille_dots_5 },
-    { "braille_dots_56", XKB_KEY_braille_dots_56 },
-    { "braille_dots_567", XKB_KEY_braille_dots_567 },
-    { "braille_dots_5678", XKB_KEY_braille_dots_5678 },
-    { "braille_dots_568", XKB_KEY_braille_dots_568 },
-    { "braille_dots_57", XKB_KEY_braille_dots_57 },
-    { "braille_dots_578", XKB_KEY_braille_dots_578 },
-    { "braille_dots_58", XKB_KEY_braille_dots_58 },
-    { "braille_dots_6", XKB_KEY_braille_dots_6 },
-    { "braille_dots_67", XKB_KEY_braille_dots_67 },
-    { "braille_dots_678", XKB_KEY_braille_dots_678 },
-    { "braille_dots_68", XKB_KEY_braille_dots_68 },
-    { "braille_dots_7", XKB_KEY_braille_dots_7 },
-    { "braille_dots_78", XKB_KEY_braille_dots_78 },
-    { "braille_dots_8", XKB_KEY_braille_dots_8 },
-    { "Break", XKB_KEY_Break },
-    { "breve", XKB_KEY_breve },
-    { "brokenbar", XKB_KEY_brokenbar },
-    { "Byelorussian_shortu", XKB_KEY_Byelorussian_shortu },
-    { "Byelorussian_SHORTU", XKB_KEY_Byelorussian_SHORTU },
-    { "C", XKB_KEY_C },
-    { "c", XKB_KEY_c },
-    { "c_h", XKB_KEY_c_h },
-    { "C_h", XKB_KEY_C_h },
-    { "C_H", XKB_KEY_C_H },
-    { "Cabovedot", XKB_KEY_Cabovedot },
-    { "cabovedot", XKB_KEY_cabovedot },
-    { "Cacute", XKB_KEY_Cacute },
-    { "cacute", XKB_KEY_cacute },
-    { "Cancel", XKB_KEY_Cancel },
-    { "Caps_Lock", XKB_KEY_Caps_Lock },
-    { "careof", XKB_KEY_careof },
-    { "caret", XKB_KEY_caret },
-    { "caron", XKB_KEY_caron },
-    { "Ccaron", XKB_KEY_Ccaron },
-    { "ccaron", XKB_KEY_ccaron },
-    { "Ccedilla", XKB_KEY_Ccedilla },
-    { "ccedilla", XKB_KEY_ccedilla },
-    { "Ccircumflex", XKB_KEY_Ccircumflex },
-    { "ccircumflex", XKB_KEY_ccircumflex },
-    { "cedilla", XKB_KEY_cedilla },
-    { "cent", XKB_KEY_cent },
-    { "ch", XKB_KEY_ch },
-    { "Ch", XKB_KEY_Ch },
-    { "CH", XKB_KEY_CH },
-    { "checkerboard", XKB_KEY_checkerboard },
-    { "checkmark", XKB_KEY_checkmark },
-    { "circle", XKB_KEY_circle },
-    { "Clear", XKB_KEY_Clear },
-    { "ClearLine", XKB_KEY_ClearLine },
-    { "club", XKB_KEY_club },
-    { "Codeinput", XKB_KEY_Codeinput },
-    { "colon", XKB_KEY_colon },
-    { "ColonSign", XKB_KEY_ColonSign },
-    { "comma", XKB_KEY_comma },
-    { "containsas", XKB_KEY_containsas },
-    { "Control_L", XKB_KEY_Control_L },
-    { "Control_R", XKB_KEY_Control_R },
-    { "copyright", XKB_KEY_copyright },
-    { "cr", XKB_KEY_cr },
-    { "crossinglines", XKB_KEY_crossinglines },
-    { "CruzeiroSign", XKB_KEY_CruzeiroSign },
-    { "cuberoot", XKB_KEY_cuberoot },
-    { "currency", XKB_KEY_currency },
-    { "cursor", XKB_KEY_cursor },
-    { "Cyrillic_a", XKB_KEY_Cyrillic_a },
-    { "Cyrillic_A", XKB_KEY_Cyrillic_A },
-    { "Cyrillic_be", XKB_KEY_Cyrillic_be },
-    { "Cyrillic_BE", XKB_KEY_Cyrillic_BE },
-    { "Cyrillic_che", XKB_KEY_Cyrillic_che },
-    { "Cyrillic_CHE", XKB_KEY_Cyrillic_CHE },
-    { "Cyrillic_CHE_descender", XKB_KEY_Cyrillic_CHE_descender },
-    { "Cyrillic_che_descender", XKB_KEY_Cyrillic_che_descender },
-    { "Cyrillic_CHE_vertstroke", XKB_KEY_Cyrillic_CHE_vertstroke },
-    { "Cyrillic_che_vertstroke", XKB_KEY_Cyrillic_che_vertstroke },
-    { "Cyrillic_de", XKB_KEY_Cyrillic_de },
-    { "Cyrillic_DE", XKB_KEY_Cyrillic_DE },
-    { "Cyrillic_dzhe", XKB_KEY_Cyrillic_dzhe },
-    { "Cyrillic_DZHE", XKB_KEY_Cyrillic_DZHE },
-    { "Cyrillic_e", XKB_KEY_Cyrillic_e },
-    { "Cyrillic_E", XKB_KEY_Cyrillic_E },
-    { "Cyrillic_ef", XKB_KEY_Cyrillic_ef },
-    { "Cyrillic_EF", XKB_KEY_Cyrillic_EF },
-    { "Cyrillic_el", XKB_KEY_Cyrillic_el },
-    { "Cyrillic_EL", XKB_KEY_Cyrillic_EL },
-    { "Cyrillic_em", XKB_KEY_Cyrillic_em },
-    { "Cyrillic_EM", XKB_KEY_Cyrillic_EM },
-    { "Cyrillic_en", XKB_KEY_Cyrillic_en },
-    { "Cyrillic_EN", XKB_KEY_Cyrillic_EN },
-    { "Cyrillic_EN_descender", XKB_KEY_Cyrillic_EN_descender },
-    { "Cyrillic_en_descender", XKB_KEY_Cyrillic_en_descender },
-    { "Cyrillic_er", XKB_KEY_Cyrillic_er },
-    { "Cyrillic_ER", XKB_KEY_Cyrillic_ER },
-    { "Cyrillic_es", XKB_KEY_Cyrillic_es },
-    { "Cyrillic_ES", XKB_KEY_Cyrillic_ES },
-    { "Cyrillic_ghe", XKB_KEY_Cyrillic_ghe },
-    { "Cyrillic_GHE", XKB_KEY_Cyrillic_GHE },
-    { "Cyrillic_GHE_bar", XKB_KEY_Cyrillic_GHE_bar },
-    { "Cyrillic_ghe_bar", XKB_KEY_Cyrillic_ghe_bar },
-    { "Cyrillic_ha", XKB_KEY_Cyrillic_ha },
-    { "Cyrillic_HA", XKB_KEY_Cyrillic_HA },
-    { "Cyrillic_HA_descender", XKB_KEY_Cyrillic_HA_descender },
-    { "Cyrillic_ha_descender", XKB_KEY_Cyrillic_ha_descender },
-    { "Cyrillic_hardsign", XKB_KEY_Cyrillic_hardsign },
-    { "Cyrillic_HARDSIGN", XKB_KEY_Cyrillic_HARDSIGN },
-    { "Cyrillic_i", XKB_KEY_Cyrillic_i },
-    { "Cyrillic_I", XKB_KEY_Cyrillic_I },
-    { "Cyrillic_I_macron", XKB_KEY_Cyrillic_I_macron },
-    { "Cyrillic_i_macron", XKB_KEY_Cyrillic_i_macron },
-    { "Cyrillic_ie", XKB_KEY_Cyrillic_ie },
-    { "Cyrillic_IE", XKB_KEY_Cyrillic_IE },
-    { "Cyrillic_io", XKB_KEY_Cyrillic_io },
-    { "Cyrillic_IO", XKB_KEY_Cyrillic_IO },
-    { "Cyrillic_je", XKB_KEY_Cyrillic_je },
-    { "Cyrillic_JE", XKB_KEY_Cyrillic_JE },
-    { "Cyrillic_ka", XKB_KEY_Cyrillic_ka },
-    { "Cyrillic_KA", XKB_KEY_Cyrillic_KA },
-    { "Cyrillic_KA_descender", XKB_KEY_Cyrillic_KA_descender },
-    { "Cyrillic_ka_descender", XKB_KEY_Cyrillic_ka_descender },
-    { "Cyrillic_KA_vertstroke", XKB_KEY_Cyrillic_KA_vertstroke },
-    { "Cyrillic_ka_vertstroke", XKB_KEY_Cyrillic_ka_vertstroke },
-    { "Cyrillic_lje", XKB_KEY_Cyrillic_lje },
-    { "Cyrillic_LJE", XKB_KEY_Cyrillic_LJE },
-    { "Cyrillic_nje", XKB_KEY_Cyrillic_nje },
-    { "Cyrillic_NJE", XKB_KEY_Cyrillic_NJE },
-    { "Cyrillic_o", XKB_KEY_Cyrillic_o },
-    { "Cyrillic_O", XKB_KEY_Cyrillic_O },
-    { "Cyrillic_O_bar", XKB_KEY_Cyrillic_O_bar },
-    { "Cyrillic_o_bar", XKB_KEY_Cyrillic_o_bar },
-    { "Cyrillic_pe", XKB_KEY_Cyrillic_pe },
-    { "Cyrillic_PE", XKB_KEY_Cyrillic_PE },
-    { "Cyrillic_SCHWA", XKB_KEY_Cyrillic_SCHWA },
-    { "Cyrillic_schwa", XKB_KEY_Cyrillic_schwa },
-    { "Cyrillic_sha", XKB_KEY_Cyrillic_sha },
-    { "Cyrillic_SHA", XKB_KEY_Cyrillic_SHA },
-    { "Cyrillic_shcha", XKB_KEY_Cyrillic_shcha },
-    { "Cyrillic_SHCHA", XKB_KEY_Cyrillic_SHCHA },
-    { "Cyrillic_SHHA", XKB_KEY_Cyrillic_SHHA },
-    { "Cyrillic_shha", XKB_KEY_Cyrillic_shha },
-    { "Cyrillic_shorti", XKB_KEY_Cyrillic_shorti },
-    { "Cyrillic_SHORTI", XKB_KEY_Cyrillic_SHORTI },
-    { "Cyrillic_softsign", XKB_KEY_Cyrillic_softsign },
-    { "Cyrillic_SOFTSIGN", XKB_KEY_Cyrillic_SOFTSIGN },
-    { "Cyrillic_te", XKB_KEY_Cyrillic_te },
-    { "Cyrillic_TE", XKB_KEY_Cyrillic_TE },
-    { "Cyrillic_tse", XKB_KEY_Cyrillic_tse },
-    { "Cyrillic_TSE", XKB_KEY_Cyrillic_TSE },
-    { "Cyrillic_u", XKB_KEY_Cyrillic_u },
-    { "Cyrillic_U", XKB_KEY_Cyrillic_U },
-    { "Cyrillic_U_macron", XKB_KEY_Cyrillic_U_macron },
-    { "Cyrillic_u_macron", XKB_KEY_Cyrillic_u_macron },
-    { "Cyrillic_U_straight", XKB_KEY_Cyrillic_U_straight },
-    { "Cyrillic_u_straight", XKB_KEY_Cyrillic_u_straight },
-    { "Cyrillic_U_straight_bar", XKB_KEY_Cyrillic_U_straight_bar },
-    { "Cyrillic_u_straight_bar", XKB_KEY_Cyrillic_u_straight_bar },
-    { "Cyrillic_ve", XKB_KEY_Cyrillic_ve },
-    { "Cyrillic_VE", XKB_KEY_Cyrillic_VE },
-    { "Cyrillic_ya", XKB_KEY_Cyrillic_ya },
-    { "Cyrillic_YA", XKB_KEY_Cyrillic_YA },
-    { "Cyrillic_yeru", XKB_KEY_Cyrillic_yeru },
-    { "Cyrillic_YERU", XKB_KEY_Cyrillic_YERU },
-    { "Cyrillic_yu", XKB_KEY_Cyrillic_yu },
-    { "Cyrillic_YU", XKB_KEY_Cyrillic_YU },
-    { "Cyrillic_ze", XKB_KEY_Cyrillic_ze },
-    { "Cyrillic_ZE", XKB_KEY_Cyrillic_ZE },
-    { "Cyrillic_zhe", XKB_KEY_Cyrillic_zhe },
-    { "Cyrillic_ZHE", XKB_KEY_Cyrillic_ZHE },
-    { "Cyrillic_ZHE_descender", XKB_KEY_Cyrillic_ZHE_descender },
-    { "Cyrillic_zhe_descender", XKB_KEY_Cyrillic_zhe_descender },
-    { "D", XKB_KEY_D },
-    { "d", XKB_KEY_d },
-    { "Dabovedot", XKB_KEY_Dabovedot },
-    { "dabovedot", XKB_KEY_dabovedot },
-    { "Dacute_accent", XKB_KEY_Dacute_accent },
-    { "dagger", XKB_KEY_dagger },
-    { "Dcaron", XKB_KEY_Dcaron },
-    { "dcaron", XKB_KEY_dcaron },
-    { "Dcedilla_accent", XKB_KEY_Dcedilla_accent },
-    { "Dcircumflex_accent", XKB_KEY_Dcircumflex_accent },
-    { "Ddiaeresis", XKB_KEY_Ddiaeresis },
-    { "dead_a", XKB_KEY_dead_a },
-    { "dead_A", XKB_KEY_dead_A },
-    { "dead_abovecomma", XKB_KEY_dead_abovecomma },
-    { "dead_abovedot", XKB_KEY_dead_abovedot },
-    { "dead_abovereversedcomma", XKB_KEY_dead_abovereversedcomma },
-    { "dead_abovering", XKB_KEY_dead_abovering },
-    { "dead_acute", XKB_KEY_dead_acute },
-    { "dead_belowbreve", XKB_KEY_dead_belowbreve },
-    { "dead_belowcircumflex", XKB_KEY_dead_belowcircumflex },
-    { "dead_belowcomma", XKB_KEY_dead_belowcomma },
-    { "dead_belowdiaeresis", XKB_KEY_dead_belowdiaeresis },
-    { "dead_belowdot", XKB_KEY_dead_belowdot },
-    { "dead_belowmacron", XKB_KEY_dead_belowmacron },
-    { "dead_belowring", XKB_KEY_dead_belowring },
-    { "dead_belowtilde", XKB_KEY_dead_belowtilde },
-    { "dead_breve", XKB_KEY_dead_breve },
-    { "dead_capital_schwa", XKB_KEY_dead_capital_schwa },
-    { "dead_caron", XKB_KEY_dead_caron },
-    { "dead_cedilla", XKB_KEY_dead_cedilla },
-    { "dead_circumflex", XKB_KEY_dead_circumflex },
-    { "dead_currency", XKB_KEY_dead_currency },
-    { "dead_dasia", XKB_KEY_dead_dasia },
-    { "dead_diaeresis", XKB_KEY_dead_diaeresis },
-    { "dead_doubleacute", XKB_KEY_dead_doubleacute },
-    { "dead_doublegrave", XKB_KEY_dead_doublegrave },
-    { "dead_e", XKB_KEY_dead_e },
-    { "dead_E", XKB_KEY_dead_E },
-    { "dead_grave", XKB_KEY_dead_grave },
-    { "dead_greek", XKB_KEY_dead_greek },
-    { "dead_hook", XKB_KEY_dead_hook },
-    { "dead_horn", XKB_KEY_dead_horn },
-    { "dead_i", XKB_KEY_dead_i },
-    { "dead_I", XKB_KEY_dead_I },
-    { "dead_invertedbreve", XKB_KEY_dead_invertedbreve },
-    { "dead_iota", XKB_KEY_dead_iota },
-    { "dead_macron", XKB_KEY_dead_macron },
-    { "dead_o", XKB_KEY_dead_o },
-    { "dead_O", XKB_KEY_dead_O },
-    { "dead_ogonek", XKB_KEY_dead_ogonek },
-    { "dead_perispomeni", XKB_KEY_dead_perispomeni },
-    { "dead_psili", XKB_KEY_dead_psili },
-    { "dead_semivoiced_sound", XKB_KEY_dead_semivoiced_sound },
-    { "dead_small_schwa", XKB_KEY_dead_small_schwa },
-    { "dead_stroke", XKB_KEY_dead_stroke },
-    { "dead_tilde", XKB_KEY_dead_tilde },
-    { "dead_u", XKB_KEY_dead_u },
-    { "dead_U", XKB_KEY_dead_U },
-    { "dead_voiced_sound", XKB_KEY_dead_voiced_sound },
-    { "decimalpoint", XKB_KEY_decimalpoint },
-    { "degree", XKB_KEY_degree },
-    { "Delete", XKB_KEY_Delete },
-    { "DeleteChar", XKB_KEY_DeleteChar },
-    { "DeleteLine", XKB_KEY_DeleteLine },
-    { "Dgrave_accent", XKB_KEY_Dgrave_accent },
-    { "diaeresis", XKB_KEY_diaeresis },
-    { "diamond", XKB_KEY_diamond },
-    { "digitspace", XKB_KEY_digitspace },
-    { "dintegral", XKB_KEY_dintegral },
-    { "division", XKB_KEY_division },
-    { "dollar", XKB_KEY_dollar },
-    { "DongSign", XKB_KEY_DongSign },
-    { "doubbaselinedot", XKB_KEY_doubbaselinedot },
-    { "doubleacute", XKB_KEY_doubleacute },
-    { "doubledagger", XKB_KEY_doubledagger },
-    { "doublelowquotemark", XKB_KEY_doublelowquotemark },
-    { "Down", XKB_KEY_Down },
-    { "downarrow", XKB_KEY_downarrow },
-    { "downcaret", XKB_KEY_downcaret },
-    { "downshoe", XKB_KEY_downshoe },
-    { "downstile", XKB_KEY_downstile },
-    { "downtack", XKB_KEY_downtack },
-    { "DRemove", XKB_KEY_DRemove },
-    { "Dring_accent", XKB_KEY_Dring_accent },
-    { "Dstroke", XKB_KEY_Dstroke },
-    { "dstroke", XKB_KEY_dstroke },
-    { "Dtilde", XKB_KEY_Dtilde },
-    { "E", XKB_KEY_E },
-    { "e", XKB_KEY_e },
-    { "Eabovedot", XKB_KEY_Eabovedot },
-    { "eabovedot", XKB_KEY_eabovedot },
-    { "Eacute", XKB_KEY_Eacute },
-    { "eacute", XKB_KEY_eacute },
-    { "Ebelowdot", XKB_KEY_Ebelowdot },
-    { "ebelowdot", XKB_KEY_ebelowdot },
-    { "Ecaron", XKB_KEY_Ecaron },
-    { "ecaron", XKB_KEY_ecaron },
-    { "Ecircumflex", XKB_KEY_Ecircumflex },
-    { "ecircumflex", XKB_KEY_ecircumflex },
-    { "Ecircumflexacute", XKB_KEY_Ecircumflexacute },
-    { "ecircumflexacute", XKB_KEY_ecircumflexacute },
-    { "Ecircumflexbelowdot", XKB_KEY_Ecircumflexbelowdot },
-    { "ecircumflexbelowdot", XKB_KEY_ecircumflexbelowdot },
-    { "Ecircumflexgrave", XKB_KEY_Ecircumflexgrave },
-    { "ecircumflexgrave", XKB_KEY_ecircumflexgrave },
-    { "Ecircumflexhook", XKB_KEY_Ecircumflexhook },
-    { "ecircumflexhook", XKB_KEY_ecircumflexhook },
-    { "Ecircumflextilde", XKB_KEY_Ecircumflextilde },
-    { "ecircumflextilde", XKB_KEY_ecircumflextilde },
-    { "EcuSign", XKB_KEY_EcuSign },
-    { "Ediaeresis", XKB_KEY_Ediaeresis },
-    { "ediaeresis", XKB_KEY_ediaeresis },
-    { "Egrave", XKB_KEY_Egrave },
-    { "egrave", XKB_KEY_egrave },
-    { "Ehook", XKB_KEY_Ehook },
-    { "ehook", XKB_KEY_ehook },
-    { "eightsubscript", XKB_KEY_eightsubscript },
-    { "eightsuperior", XKB_KEY_eightsuperior },
-    { "Eisu_Shift", XKB_KEY_Eisu_Shift },
-    { "Eisu_toggle", XKB_KEY_Eisu_toggle },
-    { "elementof", XKB_KEY_elementof },
-    { "ellipsis", XKB_KEY_ellipsis },
-    { "em3space", XKB_KEY_em3space },
-    { "em4space", XKB_KEY_em4space },
-    { "Emacron", XKB_KEY_Emacron },
-    { "emacron", XKB_KEY_emacron },
-    { "emdash", XKB_KEY_emdash },
-    { "emfilledcircle", XKB_KEY_emfilledcircle },
-    { "emfilledrect", XKB_KEY_emfilledrect },
-    { "emopencircle", XKB_KEY_emopencircle },
-    { "emopenrectangle", XKB_KEY_emopenrectangle },
-    { "emptyset", XKB_KEY_emptyset },
-    { "emspace", XKB_KEY_emspace },
-    { "End", XKB_KEY_End },
-    { "endash", XKB_KEY_endash },
-    { "enfilledcircbullet", XKB_KEY_enfilledcircbullet },
-    { "enfilledsqbullet", XKB_KEY_enfilledsqbullet },
-    { "ENG", XKB_KEY_ENG },
-    { "eng", XKB_KEY_eng },
-    { "enopencircbullet", XKB_KEY_enopencircbullet },
-    { "enopensquarebullet", XKB_KEY_enopensquarebullet },
-    { "enspace", XKB_KEY_enspace },
-    { "Eogonek", XKB_KEY_Eogonek },
-    { "eogonek", XKB_KEY_eogonek },
-    { "equal", XKB_KEY_equal },
-    { "Escape", XKB_KEY_Escape },
-    { "ETH", XKB_KEY_ETH },
-    { "Eth", XKB_KEY_Eth },
-    { "eth", XKB_KEY_eth },
-    { "Etilde", XKB_KEY_Etilde },
-    { "etilde", XKB_KEY_etilde },
-    { "EuroSign", XKB_KEY_EuroSign },
-    { "exclam", XKB_KEY_exclam },
-    { "exclamdown", XKB_KEY_exclamdown },
-    { "Execute", XKB_KEY_Execute },
-    { "Ext16bit_L", XKB_KEY_Ext16bit_L },
-    { "Ext16bit_R", XKB_KEY_Ext16bit_R },
-    { "EZH", XKB_KEY_EZH },
-    { "ezh", XKB_KEY_ezh },
-    { "F", XKB_KEY_F },
-    { "f", XKB_KEY_f },
-    { "F1", XKB_KEY_F1 },
-    { "F10", XKB_KEY_F10 },
-    { "F11", XKB_KEY_F11 },
-    { "F12", XKB_KEY_F12 },
-    { "F13", XKB_KEY_F13 },
-    { "F14", XKB_KEY_F14 },
-    { "F15", XKB_KEY_F15 },
-    { "F16", XKB_KEY_F16 },
-    { "F17", XKB_KEY_F17 },
-    { "F18", XKB_KEY_F18 },
-    { "F19", XKB_KEY_F19 },
-    { "F2", XKB_KEY_F2 },
-    { "F20", XKB_KEY_F20 },
-    { "F21", XKB_KEY_F21 },
-    { "F22", XKB_KEY_F22 },
-    { "F23", XKB_KEY_F23 },
-    { "F24", XKB_KEY_F24 },
-    { "F25", XKB_KEY_F25 },
-    { "F26", XKB_KEY_F26 },
-    { "F27", XKB_KEY_F27 },
-    { "F28", XKB_KEY_F28 },
-    { "F29", XKB_KEY_F29 },
-    { "F3", XKB_KEY_F3 },
-    { "F30", XKB_KEY_F30 },
-    { "F31", XKB_KEY_F31 },
-    { "F32", XKB_KEY_F32 },
-    { "F33", XKB_KEY_F33 },
-    { "F34", XKB_KEY_F34 },
-    { "F35", XKB_KEY_F35 },
-    { "F4", XKB_KEY_F4 },
-    { "F5", XKB_KEY_F5 },
-    { "F6", XKB_KEY_F6 },
-    { "F7", XKB_KEY_F7 },
-    { "F8", XKB_KEY_F8 },
-    { "F9", XKB_KEY_F9 },
-    { "Fabovedot", XKB_KEY_Fabovedot },
-    { "fabovedot", XKB_KEY_fabovedot },
-    { "Farsi_0", XKB_KEY_Farsi_0 },
-    { "Farsi_1", XKB_KEY_Farsi_1 },
-    { "Farsi_2", XKB_KEY_Farsi_2 },
-    { "Farsi_3", XKB_KEY_Farsi_3 },
-    { "Farsi_4", XKB_KEY_Farsi_4 },
-    { "Farsi_5", XKB_KEY_Farsi_5 },
-    { "Farsi_6", XKB_KEY_Farsi_6 },
-    { "Farsi_7", XKB_KEY_Farsi_7 },
-    { "Farsi_8", XKB_KEY_Farsi_8 },
-    { "Farsi_9", XKB_KEY_Farsi_9 },
-    { "Farsi_yeh", XKB_KEY_Farsi_yeh },
-    { "femalesymbol", XKB_KEY_femalesymbol },
-    { "ff", XKB_KEY_ff },
-    { "FFrancSign", XKB_KEY_FFrancSign },
-    { "figdash", XKB_KEY_figdash },
-    { "filledlefttribullet", XKB_KEY_filledlefttribullet },
-    { "filledrectbullet", XKB_KEY_filledrectbullet },
-    { "filledrighttribullet", XKB_KEY_filledrighttribullet },
-    { "filledtribulletdown", XKB_KEY_filledtribulletdown },
-    { "filledtribulletup", XKB_KEY_filledtribulletup },
-    { "Find", XKB_KEY_Find },
-    { "First_Virtual_Screen", XKB_KEY_First_Virtual_Screen },
-    { "fiveeighths", XKB_KEY_fiveeighths },
-    { "fivesixths", XKB_KEY_fivesixths },
-    { "fivesubscript", XKB_KEY_fivesubscript },
-    { "fivesuperior", XKB_KEY_fivesuperior },
-    { "fourfifths", XKB_KEY_fourfifths },
-    { "foursubscript", XKB_KEY_foursubscript },
-    { "foursuperior", XKB_KEY_foursuperior },
-    { "fourthroot", XKB_KEY_fourthroot },
-    { "function", XKB_KEY_function },
-    { "G", XKB_KEY_G },
-    { "g", XKB_KEY_g },
-    { "Gabovedot", XKB_KEY_Gabovedot },
-    { "gabovedot", XKB_KEY_gabovedot },
-    { "Gbreve", XKB_KEY_Gbreve },
-    { "gbreve", XKB_KEY_gbreve },
-    { "Gcaron", XKB_KEY_Gcaron },
-    { "gcaron", XKB_KEY_gcaron },
-    { "Gcedilla", XKB_KEY_Gcedilla },
-    { "gcedilla", XKB_KEY_gcedilla },
-    { "Gcircumflex", XKB_KEY_Gcircumflex },
-    { "gcircumflex", XKB_KEY_gcircumflex },
-    { "Georgian_an", XKB_KEY_Georgian_an },
-    { "Georgian_ban", XKB_KEY_Georgian_ban },
-    { "Georgian_can", XKB_KEY_Georgian_can },
-    { "Georgian_char", XKB_KEY_Georgian_char },
-    { "Georgian_chin", XKB_KEY_Georgian_chin },
-    { "Georgian_cil", XKB_KEY_Georgian_cil },
-    { "Georgian_don", XKB_KEY_Georgian_don },
-    { "Georgian_en", XKB_KEY_Georgian_en },
-    { "Georgian_fi", XKB_KEY_Georgian_fi },
-    { "Georgian_gan", XKB_KEY_Georgian_gan },
-    { "Georgian_ghan", XKB_KEY_Georgian_ghan },
-    { "Georgian_hae", XKB_KEY_Georgian_hae },
-    { "Georgian_har", XKB_KEY_Georgian_har },
-    { "Georgian_he", XKB_KEY_Georgian_he },
-    { "Georgian_hie", XKB_KEY_Georgian_hie },
-    { "Georgian_hoe", XKB_KEY_Georgian_hoe },
-    { "Georgian_in", XKB_KEY_Georgian_in },
-    { "Georgian_jhan", XKB_KEY_Georgian_jhan },
-    { "Georgian_jil", XKB_KEY_Georgian_jil },
-    { "Georgian_kan", XKB_KEY_Georgian_kan },
-    { "Georgian_khar", XKB_KEY_Georgian_khar },
-    { "Georgian_las", XKB_KEY_Georgian_las },
-    { "Georgian_man", XKB_KEY_Georgian_man },
-    { "Georgian_nar", XKB_KEY_Georgian_nar },
-    { "Georgian_on", XKB_KEY_Georgian_on },
-    { "Georgian_par", XKB_KEY_Georgian_par },
-    { "Georgian_phar", XKB_KEY_Georgian_phar },
-    { "Georgian_qar", XKB_KEY_Georgian_qar },
-    { "Georgian_rae", XKB_KEY_Georgian_rae },
-    { "Georgian_san", XKB_KEY_Georgian_san },
-    { "Georgian_shin", XKB_KEY_Georgian_shin },
-    { "Georgian_tan", XKB_KEY_Georgian_tan },
-    { "Georgian_tar", XKB_KEY_Georgian_tar },
-    { "Georgian_un", XKB_KEY_Georgian_un },
-    { "Georgian_vin", XKB_KEY_Georgian_vin },
-    { "Georgian_we", XKB_KEY_Georgian_we },
-    { "Georgian_xan", XKB_KEY_Georgian_xan },
-    { "Georgian_zen", XKB_KEY_Georgian_zen },
-    { "Georgian_zhar", XKB_KEY_Georgian_zhar },
-    { "grave", XKB_KEY_grave },
-    { "greater", XKB_KEY_greater },
-    { "greaterthanequal", XKB_KEY_greaterthanequal },
-    { "Greek_accentdieresis", XKB_KEY_Greek_accentdieresis },
-    { "Greek_ALPHA", XKB_KEY_Greek_ALPHA },
-    { "Greek_alpha", XKB_KEY_Greek_alpha },
-    { "Greek_ALPHAaccent", XKB_KEY_Greek_ALPHAaccent },
-    { "Greek_alphaaccent", XKB_KEY_Greek_alphaaccent },
-    { "Greek_BETA", XKB_KEY_Greek_BETA },
-    { "Greek_beta", XKB_KEY_Greek_beta },
-    { "Greek_CHI", XKB_KEY_Greek_CHI },
-    { "Greek_chi", XKB_KEY_Greek_chi },
-    { "Greek_DELTA", XKB_KEY_Greek_DELTA },
-    { "Greek_delta", XKB_KEY_Greek_delta },
-    { "Greek_EPSILON", XKB_KEY_Greek_EPSILON },
-    { "Greek_epsilon", XKB_KEY_Greek_epsilon },
-    { "Greek_EPSILONaccent", XKB_KEY_Greek_EPSILONaccent },
-    { "Greek_epsilonaccent", XKB_KEY_Greek_epsilonaccent },
-    { "Greek_ETA", XKB_KEY_Greek_ETA },
-    { "Greek_eta", XKB_KEY_Greek_eta },
-    { "Greek_ETAaccent", XKB_KEY_Greek_ETAaccent },
-    { "Greek_etaaccent", XKB_KEY_Greek_etaaccent },
-    { "Greek_finalsmallsigma", XKB_KEY_Greek_finalsmallsigma },
-    { "Greek_GAMMA", XKB_KEY_Greek_GAMMA },
-    { "Greek_gamma", XKB_KEY_Greek_gamma },
-    { "Greek_horizbar", XKB_KEY_Greek_horizbar },
-    { "Greek_IOTA", XKB_KEY_Greek_IOTA },
-    { "Greek_iota", XKB_KEY_Greek_iota },
-    { "Greek_IOTAaccent", XKB_KEY_Greek_IOTAaccent },
-    { "Greek_iotaaccent", XKB_KEY_Greek_iotaaccent },
-    { "Greek_iotaaccentdieresis", XKB_KEY_Greek_iotaaccentdieresis },
-    { "Greek_IOTAdiaeresis", XKB_KEY_Greek_IOTAdiaeresis },
-    { "Greek_IOTAdieresis", XKB_KEY_Greek_IOTAdieresis },
-    { "Greek_iotadieresis", XKB_KEY_Greek_iotadieresis },
-    { "Greek_KAPPA", XKB_KEY_Greek_KAPPA },
-    { "Greek_kappa", XKB_KEY_Greek_kappa },
-    { "Greek_LAMBDA", XKB_KEY_Greek_LAMBDA },
-    { "Greek_lambda", XKB_KEY_Greek_lambda },
-    { "Greek_LAMDA", XKB_KEY_Greek_LAMDA },
-    { "Greek_lamda", XKB_KEY_Greek_lamda },
-    { "Greek_MU", XKB_KEY_Greek_MU },
-    { "Greek_mu", XKB_KEY_Greek_mu },
-    { "Greek_NU", XKB_KEY_Greek_NU },
-    { "Greek_nu", XKB_KEY_Greek_nu },
-    { "Greek_OMEGA", XKB_KEY_Greek_OMEGA },
-    { "Greek_omega", XKB_KEY_Greek_omega },
-    { "Greek_OMEGAaccent", XKB_KEY_Greek_OMEGAaccent },
-    { "Greek_omegaaccent", XKB_KEY_Greek_omegaaccent },
-    { "Greek_OMICRON", XKB_KEY_Greek_OMICRON },
-    { "Greek_omicron", XKB_KEY_Greek_omicron },
-    { "Greek_OMICRONaccent", XKB_KEY_Greek_OMICRONaccent },
-    { "Greek_omicronaccent", XKB_KEY_Greek_omicronaccent },
-    { "Greek_PHI", XKB_KEY_Greek_PHI },
-    { "Greek_phi", XKB_KEY_Greek_phi },
-    { "Greek_PI", XKB_KEY_Greek_PI },
-    { "Greek_pi", XKB_KEY_Greek_pi },
-    { "Greek_PSI", XKB_KEY_Greek_PSI },
-    { "Greek_psi", XKB_KEY_Greek_psi },
-    { "Greek_RHO", XKB_KEY_Greek_RHO },
-    { "Greek_rho", XKB_KEY_Greek_rho },
-    { "Greek_SIGMA", XKB_KEY_Greek_SIGMA },
-    { "Greek_sigma", XKB_KEY_Greek_sigma },
-    { "Greek_switch", XKB_KEY_Greek_switch },
-    { "Greek_TAU", XKB_KEY_Greek_TAU },
-    { "Greek_tau", XKB_KEY_Greek_tau },
-    { "Greek_THETA", XKB_KEY_Greek_THETA },
-    { "Greek_theta", XKB_KEY_Greek_theta },
-    { "Greek_UPSILON", XKB_KEY_Greek_UPSILON },
-    { "Greek_upsilon", XKB_KEY_Greek_upsilon },
-    { "Greek_UPSILONaccent", XKB_KEY_Greek_UPSILONaccent },
-    { "Greek_upsilonaccent", XKB_KEY_Greek_upsilonaccent },
-    { "Greek_upsilonaccentdieresis", XKB_KEY_Greek_upsilonaccentdieresis },
-    { "Greek_UPSILONdieresis", XKB_KEY_Greek_UPSILONdieresis },
-    { "Greek_upsilondieresis", XKB_KEY_Greek_upsilondieresis },
-    { "Greek_XI", XKB_KEY_Greek_XI },
-    { "Greek_xi", XKB_KEY_Greek_xi },
-    { "Greek_ZETA", XKB_KEY_Greek_ZETA },
-    { "Greek_zeta", XKB_KEY_Greek_zeta },
-    { "guilder", XKB_KEY_guilder },
-    { "guillemotleft", XKB_KEY_guillemotleft },
-    { "guillemotright", XKB_KEY_guillemotright },
-    { "H", XKB_KEY_H },
-    { "h", XKB_KEY_h },
-    { "hairspace", XKB_KEY_hairspace },
-    { "Hangul", XKB_KEY_Hangul },
-    { "Hangul_A", XKB_KEY_Hangul_A },
-    { "Hangul_AE", XKB_KEY_Hangul_AE },
-    { "Hangul_AraeA", XKB_KEY_Hangul_AraeA },
-    { "Hangul_AraeAE", XKB_KEY_Hangul_AraeAE },
-    { "Hangul_Banja", XKB_KEY_Hangul_Banja },
-    { "Hangul_Cieuc", XKB_KEY_Hangul_Cieuc },
-    { "Hangul_Codeinput", XKB_KEY_Hangul_Codeinput },
-    { "Hangul_Dikeud", XKB_KEY_Hangul_Dikeud },
-    { "Hangul_E", XKB_KEY_Hangul_E },
-    { "Hangul_End", XKB_KEY_Hangul_End },
-    { "Hangul_EO", XKB_KEY_Hangul_EO },
-    { "Hangul_EU", XKB_KEY_Hangul_EU },
-    { "Hangul_Hanja", XKB_KEY_Hangul_Hanja },
-    { "Hangul_Hieuh", XKB_KEY_Hangul_Hieuh },
-    { "Hangul_I", XKB_KEY_Hangul_I },
-    { "Hangul_Ieung", XKB_KEY_Hangul_Ieung },
-    { "Hangul_J_Cieuc", XKB_KEY_Hangul_J_Cieuc },
-    { "Hangul_J_Dikeud", XKB_KEY_Hangul_J_Dikeud },
-    { "Hangul_J_Hieuh", XKB_KEY_Hangul_J_Hieuh },
-    { "Hangul_J_Ieung", XKB_KEY_Hangul_J_Ieung },
-    { "Hangul_J_Jieuj", XKB_KEY_Hangul_J_Jieuj },
-    { "Hangul_J_Khieuq", XKB_KEY_Hangul_J_Khieuq },
-    { "Hangul_J_Kiyeog", XKB_KEY_Hangul_J_Kiyeog },
-    { "Hangul_J_KiyeogSios", XKB_KEY_Hangul_J_KiyeogSios },
-    { "Hangul_J_KkogjiDalrinIeung", XKB_KEY_Hangul_J_KkogjiDalrinIeung },
-    { "Hangul_J_Mieum", XKB_KEY_Hangul_J_Mieum },
-    { "Hangul_J_Nieun", XKB_KEY_Hangul_J_Nieun },
-    { "Hangul_J_NieunHieuh", XKB_KEY_Hangul_J_NieunHieuh },
-    { "Hangul_J_NieunJieuj", XKB_KEY_Hangul_J_NieunJieuj },
-    { "Hangul_J_PanSios", XKB_KEY_Hangul_J_PanSios },
-    { "Hangul_J_Phieuf", XKB_KEY_Hangul_J_Phieuf },
-    { "Hangul_J_Pieub", XKB_KEY_Hangul_J_Pieub },
-    { "Hangul_J_PieubSios", XKB_KEY_Hangul_J_PieubSios },
-    { "Hangul_J_Rieul", XKB_KEY_Hangul_J_Rieul },
-    { "Hangul_J_RieulHieuh", XKB_KEY_Hangul_J_RieulHieuh },
-    { "Hangul_J_RieulKiyeog", XKB_KEY_Hangul_J_RieulKiyeog },
-    { "Hangul_J_RieulMieum", XKB_KEY_Hangul_J_RieulMieum },
-    { "Hangul_J_RieulPhieuf", XKB_KEY_Hangul_J_RieulPhieuf },
-    { "Hangul_J_RieulPieub", XKB_KEY_Hangul_J_RieulPieub },
-    { "Hangul_J_RieulSios", XKB_KEY_Hangul_J_RieulSios },
-    { "Hangul_J_RieulTieut", XKB_KEY_Hangul_J_RieulTieut },
-    { "Hangul_J_Sios", XKB_KEY_Hangul_J_Sios },
-    { "Hangul_J_SsangKiyeog", XKB_KEY_Hangul_J_SsangKiyeog },
-    { "Hangul_J_SsangSios", XKB_KEY_Hangul_J_SsangSios },
-    { "Hangul_J_Tieut", XKB_KEY_Hangul_J_Tieut },
-    { "Hangul_J_YeorinHieuh", XKB_KEY_Hangul_J_YeorinHieuh },
-    { "Hangul_Jamo", XKB_KEY_Hangul_Jamo },
-    { "Hangul_Jeonja", XKB_KEY_Hangul_Jeonja },
-    { "Hangul_Jieuj", XKB_KEY_Hangul_Jieuj },
-    { "Hangul_Khieuq", XKB_KEY_Hangul_Khieuq },
-    { "Hangul_Kiyeog", XKB_KEY_Hangul_Kiyeog },
-    { "Hangul_KiyeogSios", XKB_KEY_Hangul_KiyeogSios },
-    { "Hangul_KkogjiDalrinIeung", XKB_KEY_Hangul_KkogjiDalrinIeung },
-    { "Hangul_Mieum", XKB_KEY_Hangul_Mieum },
-    { "Hangul_MultipleCandidate", XKB_KEY_Hangul_MultipleCandidate },
-    { "Hangul_Nieun", XKB_KEY_Hangul_Nieun },
-    { "Hangul_NieunHieuh", XKB_KEY_Hangul_NieunHieuh },
-    { "Hangul_NieunJieuj", XKB_KEY_Hangul_NieunJieuj },
-    { "Hangul_O", XKB_KEY_Hangul_O },
-    { "Hangul_OE", XKB_KEY_Hangul_OE },
-    { "Hangul_PanSios", XKB_KEY_Hangul_PanSios },
-    { "Hangul_Phieuf", XKB_KEY_Hangul_Phieuf },
-    { "Hangul_Pieub", XKB_KEY_Hangul_Pieub },
-    { "Hangul_PieubSios", XKB_KEY_Hangul_PieubSios },
-    { "Hangul_PostHanja", XKB_KEY_Hangul_PostHanja },
-    { "Hangul_PreHanja", XKB_KEY_Hangul_PreHanja },
-    { "Hangul_PreviousCandidate", XKB_KEY_Hangul_PreviousCandidate },
-    { "Hangul_Rieul", XKB_KEY_Hangul_Rieul },
-    { "Hangul_RieulHieuh", XKB_KEY_Hangul_RieulHieuh },
-    { "Hangul_RieulKiyeog", XKB_KEY_Hangul_RieulKiyeog },
-    { "Hangul_RieulMieum", XKB_KEY_Hangul_RieulMieum },
-    { "Hangul_RieulPhieuf", XKB_KEY_Hangul_RieulPhieuf },
-    { "Hangul_RieulPieub", XKB_KEY_Hangul_RieulPieub },
-    { "Hangul_RieulSios", XKB_KEY_Hangul_RieulSios },
-    { "Hangul_RieulTieut", XKB_KEY_Hangul_RieulTieut },
-    { "Hangul_RieulYeorinHieuh", XKB_KEY_Hangul_RieulYeorinHieuh },
-    { "Hangul_Romaja", XKB_KEY_Hangul_Romaja },
-    { "Hangul_SingleCandidate", XKB_KEY_Hangul_SingleCandidate },
-    { "Hangul_Sios", XKB_KEY_Hangul_Sios },
-    { "Hangul_Special", XKB_KEY_Hangul_Special },
-    { "Hangul_SsangDikeud", XKB_KEY_Hangul_SsangDikeud },
-    { "Hangul_SsangJieuj", XKB_KEY_Hangul_SsangJieuj },
-    { "Hangul_SsangKiyeog", XKB_KEY_Hangul_SsangKiyeog },
-    { "Hangul_SsangPieub", XKB_KEY_Hangul_SsangPieub },
-    { "Hangul_SsangSios", XKB_KEY_Hangul_SsangSios },
-    { "Hangul_Start", XKB_KEY_Hangul_Start },
-    { "Hangul_SunkyeongeumMieum", XKB_KEY_Hangul_SunkyeongeumMieum },
-    { "Hangul_SunkyeongeumPhieuf", XKB_KEY_Hangul_SunkyeongeumPhieuf },
-    { "Hangul_SunkyeongeumPieub", XKB_KEY_Hangul_SunkyeongeumPieub },
-    { "Hangul_switch", XKB_KEY_Hangul_switch },
-    { "Hangul_Tieut", XKB_KEY_Hangul_Tieut },
-    { "Hangul_U", XKB_KEY_Hangul_U },
-    { "Hangul_WA", XKB_KEY_Hangul_WA },
-    { "Hangul_WAE", XKB_KEY_Hangul_WAE },
-    { "Hangul_WE", XKB_KEY_Hangul_WE },
-    { "Hangul_WEO", XKB_KEY_Hangul_WEO },
-    { "Hangul_WI", XKB_KEY_Hangul_WI },
-    { "Hangul_YA", XKB_KEY_Hangul_YA },
-    { "Hangul_YAE", XKB_KEY_Hangul_YAE },
-    { "Hangul_YE", XKB_KEY_Hangul_YE },
-    { "Hangul_YEO", XKB_KEY_Hangul_YEO },
-    { "Hangul_YeorinHieuh", XKB_KEY_Hangul_YeorinHieuh },
-    { "Hangul_YI", XKB_KEY_Hangul_YI },
-    { "Hangul_YO", XKB_KEY_Hangul_YO },
-    { "Hangul_YU", XKB_KEY_Hangul_YU },
-    { "Hankaku", XKB_KEY_Hankaku },
-    { "Hcircumflex", XKB_KEY_Hcircumflex },
-    { "hcircumflex", XKB_KEY_hcircumflex },
-    { "heart", XKB_KEY_heart },
-    { "hebrew_aleph", XKB_KEY_hebrew_aleph },
-    { "hebrew_ayin", XKB_KEY_hebrew_ayin },
-    { "hebrew_bet", XKB_KEY_hebrew_bet },
-    { "hebrew_beth", XKB_KEY_hebrew_beth },
-    { "hebrew_chet", XKB_KEY_hebrew_chet },
-    { "hebrew_dalet", XKB_KEY_hebrew_dalet },
-    { "hebrew_daleth", XKB_KEY_hebrew_daleth },
-    { "hebrew_doublelowline", XKB_KEY_hebrew_doublelowline },
-    { "hebrew_finalkaph", XKB_KEY_hebrew_finalkaph },
-    { "hebrew_finalmem", XKB_KEY_hebrew_finalmem },
-    { "hebrew_finalnun", XKB_KEY_hebrew_finalnun },
-    { "hebrew_finalpe", XKB_KEY_hebrew_finalpe },
-    { "hebrew_finalzade", XKB_KEY_hebrew_finalzade },
-    { "hebrew_finalzadi", XKB_KEY_hebrew_finalzadi },
-    { "hebrew_gimel", XKB_KEY_hebrew_gimel },
-    { "hebrew_gimmel", XKB_KEY_hebrew_gimmel },
-    { "hebrew_he", XKB_KEY_hebrew_he },
-    { "hebrew_het", XKB_KEY_hebrew_het },
-    { "hebrew_kaph", XKB_KEY_hebrew_kaph },
-    { "hebrew_kuf", XKB_KEY_hebrew_kuf },
-    { "hebrew_lamed", XKB_KEY_hebrew_lamed },
-    { "hebrew_mem", XKB_KEY_hebrew_mem },
-    { "hebrew_nun", XKB_KEY_hebrew_nun },
-    { "hebrew_pe", XKB_KEY_hebrew_pe },
-    { "hebrew_qoph", XKB_KEY_hebrew_qoph },
-    { "hebrew_resh", XKB_KEY_hebrew_resh },
-    { "hebrew_samech", XKB_KEY_hebrew_samech },
-    { "hebrew_samekh", XKB_KEY_hebrew_samekh },
-    { "hebrew_shin", XKB_KEY_hebrew_shin },
-    { "Hebrew_switch", XKB_KEY_Hebrew_switch },
-    { "hebrew_taf", XKB_KEY_hebrew_taf },
-    { "hebrew_taw", XKB_KEY_hebrew_taw },
-    { "hebrew_tet", XKB_KEY_hebrew_tet },
-    { "hebrew_teth", XKB_KEY_hebrew_teth },
-    { "hebrew_waw", XKB_KEY_hebrew_waw },
-    { "hebrew_yod", XKB_KEY_hebrew_yod },
-    { "hebrew_zade", XKB_KEY_hebrew_zade },
-    { "hebrew_zadi", XKB_KEY_hebrew_zadi },
-    { "hebrew_zain", XKB_KEY_hebrew_zain },
-    { "hebrew_zayin", XKB_KEY_hebrew_zayin },
-    { "Help", XKB_KEY_Help },
-    { "Henkan", XKB_KEY_Henkan },
-    { "Henkan_Mode", XKB_KEY_Henkan_Mode },
-    { "hexagram", XKB_KEY_hexagram },
-    { "Hiragana", XKB_KEY_Hiragana },
-    { "Hiragana_Katakana", XKB_KEY_Hiragana_Katakana },
-    { "Home", XKB_KEY_Home },
-    { "horizconnector", XKB_KEY_horizconnector },
-    { "horizlinescan1", XKB_KEY_horizlinescan1 },
-    { "horizlinescan3", XKB_KEY_horizlinescan3 },
-    { "horizlinescan5", XKB_KEY_horizlinescan5 },
-    { "horizlinescan7", XKB_KEY_horizlinescan7 },
-    { "horizlinescan9", XKB_KEY_horizlinescan9 },
-    { "hpBackTab", XKB_KEY_hpBackTab },
-    { "hpblock", XKB_KEY_hpblock },
-    { "hpClearLine", XKB_KEY_hpClearLine },
-    { "hpDeleteChar", XKB_KEY_hpDeleteChar },
-    { "hpDeleteLine", XKB_KEY_hpDeleteLine },
-    { "hpguilder", XKB_KEY_hpguilder },
-    { "hpInsertChar", XKB_KEY_hpInsertChar },
-    { "hpInsertLine", XKB_KEY_hpInsertLine },
-    { "hpIO", XKB_KEY_hpIO },
-    { "hpKP_BackTab", XKB_KEY_hpKP_BackTab },
-    { "hplira", XKB_KEY_hplira },
-    { "hplongminus", XKB_KEY_hplongminus },
-    { "hpModelock1", XKB_KEY_hpModelock1 },
-    { "hpModelock2", XKB_KEY_hpModelock2 },
-    { "hpmute_acute", XKB_KEY_hpmute_acute },
-    { "hpmute_asciicircum", XKB_KEY_hpmute_asciicircum },
-    { "hpmute_asciitilde", XKB_KEY_hpmute_asciitilde },
-    { "hpmute_diaeresis", XKB_KEY_hpmute_diaeresis },
-    { "hpmute_grave", XKB_KEY_hpmute_grave },
-    { "hpReset", XKB_KEY_hpReset },
-    { "hpSystem", XKB_KEY_hpSystem },
-    { "hpUser", XKB_KEY_hpUser },
-    { "hpYdiaeresis", XKB_KEY_hpYdiaeresis },
-    { "Hstroke", XKB_KEY_Hstroke },
-    { "hstroke", XKB_KEY_hstroke },
-    { "ht", XKB_KEY_ht },
-    { "Hyper_L", XKB_KEY_Hyper_L },
-    { "Hyper_R", XKB_KEY_Hyper_R },
-    { "hyphen", XKB_KEY_hyphen },
-    { "I", XKB_KEY_I },
-    { "i", XKB_KEY_i },
-    { "Iabovedot", XKB_KEY_Iabovedot },
-    { "Iacute", XKB_KEY_Iacute },
-    { "iacute", XKB_KEY_iacute },
-    { "Ibelowdot", XKB_KEY_Ibelowdot },
-    { "ibelowdot", XKB_KEY_ibelowdot },
-    { "Ibreve", XKB_KEY_Ibreve },
-    { "ibreve", XKB_KEY_ibreve },
-    { "Icircumflex", XKB_KEY_Icircumflex },
-    { "icircumflex", XKB_KEY_icircumflex },
-    { "identical", XKB_KEY_identical },
-    { "Idiaeresis", XKB_KEY_Idiaeresis },
-    { "idiaeresis", XKB_KEY_idiaeresis },
-    { "idotless", XKB_KEY_idotless },
-    { "ifonlyif", XKB_KEY_ifonlyif },
-    { "Igrave", XKB_KEY_Igrave },
-    { "igrave", XKB_KEY_igrave },
-    { "Ihook", XKB_KEY_Ihook },
-    { "ihook", XKB_KEY_ihook },
-    { "Imacron", XKB_KEY_Imacron },
-    { "imacron", XKB_KEY_imacron },
-    { "implies", XKB_KEY_implies },
-    { "includedin", XKB_KEY_includedin },
-    { "includes", XKB_KEY_includes },
-    { "infinity", XKB_KEY_infinity },
-    { "Insert", XKB_KEY_Insert },
-    { "InsertChar", XKB_KEY_InsertChar },
-    { "InsertLine", XKB_KEY_InsertLine },
-    { "integral", XKB_KEY_integral },
-    { "intersection", XKB_KEY_intersection },
-    { "IO", XKB_KEY_IO },
-    { "Iogonek", XKB_KEY_Iogonek },
-    { "iogonek", XKB_KEY_iogonek },
-    { "ISO_Center_Object", XKB_KEY_ISO_Center_Object },
-    { "ISO_Continuous_Underline", XKB_KEY_ISO_Continuous_Underline },
-    { "ISO_Discontinuous_Underline", XKB_KEY_ISO_Discontinuous_Underline },
-    { "ISO_Emphasize", XKB_KEY_ISO_Emphasize },
-    { "ISO_Enter", XKB_KEY_ISO_Enter },
-    { "ISO_Fast_Cursor_Down", XKB_KEY_ISO_Fast_Cursor_Down },
-    { "ISO_Fast_Cursor_Left", XKB_KEY_ISO_Fast_Cursor_Left },
-    { "ISO_Fast_Cursor_Right", XKB_KEY_ISO_Fast_Cursor_Right },
-    { "ISO_Fast_Cursor_Up", XKB_KEY_ISO_Fast_Cursor_Up },
-    { "ISO_First_Group", XKB_KEY_ISO_First_Group },
-    { "ISO_First_Group_Lock", XKB_KEY_ISO_First_Group_Lock },
-    { "ISO_Group_Latch", XKB_KEY_ISO_Group_Latch },
-    { "ISO_Group_Lock", XKB_KEY_ISO_Group_Lock },
-    { "ISO_Group_Shift", XKB_KEY_ISO_Group_Shift },
-    { "ISO_Last_Group", XKB_KEY_ISO_Last_Group },
-    { "ISO_Last_Group_Lock", XKB_KEY_ISO_Last_Group_Lock },
-    { "ISO_Left_Tab", XKB_KEY_ISO_Left_Tab },
-    { "ISO_Level2_Latch", XKB_KEY_ISO_Level2_Latch },
-    { "ISO_Level3_Latch", XKB_KEY_ISO_Level3_Latch },
-    { "ISO_Level3_Lock", XKB_KEY_ISO_Level3_Lock },
-    { "ISO_Level3_Shift", XKB_KEY_ISO_Level3_Shift },
-    { "ISO_Level5_Latch", XKB_KEY_ISO_Level5_Latch },
-    { "ISO_Level5_Lock", XKB_KEY_ISO_Level5_Lock },
-    { "ISO_Level5_Shift", XKB_KEY_ISO_Level5_Shift },
-    { "ISO_Lock", XKB_KEY_ISO_Lock },
-    { "ISO_Move_Line_Down", XKB_KEY_ISO_Move_Line_Down },
-    { "ISO_Move_Line_Up", XKB_KEY_ISO_Move_Line_Up },
-    { "ISO_Next_Group", XKB_KEY_ISO_Next_Group },
-    { "ISO_Next_Group_Lock", XKB_KEY_ISO_Next_Group_Lock },
-    { "ISO_Partial_Line_Down", XKB_KEY_ISO_Partial_Line_Down },
-    { "ISO_Partial_Line_Up", XKB_KEY_ISO_Partial_Line_Up },
-    { "ISO_Partial_Space_Left", XKB_KEY_ISO_Partial_Space_Left },
-    { "ISO_Partial_Space_Right", XKB_KEY_ISO_Partial_Space_Right },
-    { "ISO_Prev_Group", XKB_KEY_ISO_Prev_Group },
-    { "ISO_Prev_Group_Lock", XKB_KEY_ISO_Prev_Group_Lock },
-    { "ISO_Release_Both_Margins", XKB_KEY_ISO_Release_Both_Margins },
-    { "ISO_Release_Margin_Left", XKB_KEY_ISO_Release_Margin_Left },
-    { "ISO_Release_Margin_Right", XKB_KEY_ISO_Release_Margin_Right },
-    { "ISO_Set_Margin_Left", XKB_KEY_ISO_Set_Margin_Left },
-    { "ISO_Set_Margin_Right", XKB_KEY_ISO_Set_Margin_Right },
-    { "Itilde", XKB_KEY_Itilde },
-    { "itilde", XKB_KEY_itilde },
-    { "J", XKB_KEY_J },
-    { "j", XKB_KEY_j },
-    { "Jcircumflex", XKB_KEY_Jcircumflex },
-    { "jcircumflex", XKB_KEY_jcircumflex },
-    { "jot", XKB_KEY_jot },
-    { "K", XKB_KEY_K },
-    { "k", XKB_KEY_k },
-    { "kana_a", XKB_KEY_kana_a },
-    { "kana_A", XKB_KEY_kana_A },
-    { "kana_CHI", XKB_KEY_kana_CHI },
-    { "kana_closingbracket", XKB_KEY_kana_closingbracket },
-    { "kana_comma", XKB_KEY_kana_comma },
-    { "kana_conjunctive", XKB_KEY_kana_conjunctive },
-    { "kana_e", XKB_KEY_kana_e },
-    { "kana_E", XKB_KEY_kana_E },
-    { "kana_FU", XKB_KEY_kana_FU },
-    { "kana_fullstop", XKB_KEY_kana_fullstop },
-    { "kana_HA", XKB_KEY_kana_HA },
-    { "kana_HE", XKB_KEY_kana_HE },
-    { "kana_HI", XKB_KEY_kana_HI },
-    { "kana_HO", XKB_KEY_kana_HO },
-    { "kana_HU", XKB_KEY_kana_HU },
-    { "kana_i", XKB_KEY_kana_i },
-    { "kana_I", XKB_KEY_kana_I },
-    { "kana_KA", XKB_KEY_kana_KA },
-    { "kana_KE", XKB_KEY_kana_KE },
-    { "kana_KI", XKB_KEY_kana_KI },
-    { "kana_KO", XKB_KEY_kana_KO },
-    { "kana_KU", XKB_KEY_kana_KU },
-    { "Kana_Lock", XKB_KEY_Kana_Lock },
-    { "kana_MA", XKB_KEY_kana_MA },
-    { "kana_ME", XKB_KEY_kana_ME },
-    { "kana_MI", XKB_KEY_kana_MI },
-    { "kana_middledot", XKB_KEY_kana_middledot },
-    { "kana_MO", XKB_KEY_kana_MO },
-    { "kana_MU", XKB_KEY_kana_MU },
-    { "kana_N", XKB_KEY_kana_N },
-    { "kana_NA", XKB_KEY_kana_NA },
-    { "kana_NE", XKB_KEY_kana_NE },
-    { "kana_NI", XKB_KEY_kana_NI },
-    { "kana_NO", XKB_KEY_kana_NO },
-    { "kana_NU", XKB_KEY_kana_NU },
-    { "kana_o", XKB_KEY_kana_o },
-    { "kana_O", XKB_KEY_kana_O },
-    { "kana_openingbracket", XKB_KEY_kana_openingbracket },
-    { "kana_RA", XKB_KEY_kana_RA },
-    { "kana_RE", XKB_KEY_kana_RE },
-    { "kana_RI", XKB_KEY_kana_RI },
-    { "kana_RO", XKB_KEY_kana_RO },
-    { "kana_RU", XKB_KEY_kana_RU },
-    { "kana_SA", XKB_KEY_kana_SA },
-    { "kana_SE", XKB_KEY_kana_SE },
-    { "kana_SHI", XKB_KEY_kana_SHI },
-    { "Kana_Shift", XKB_KEY_Kana_Shift },
-    { "kana_SO", XKB_KEY_kana_SO },
-    { "kana_SU", XKB_KEY_kana_SU },
-    { "kana_switch", XKB_KEY_kana_switch },
-    { "kana_TA", XKB_KEY_kana_TA },
-    { "kana_TE", XKB_KEY_kana_TE },
-    { "kana_TI", XKB_KEY_kana_TI },
-    { "kana_TO", XKB_KEY_kana_TO },
-    { "kana_tsu", XKB_KEY_kana_tsu },
-    { "kana_TSU", XKB_KEY_kana_TSU },
-    { "kana_tu", XKB_KEY_kana_tu },
-    { "kana_TU", XKB_KEY_kana_TU },
-    { "kana_u", XKB_KEY_kana_u },
-    { "kana_U", XKB_KEY_kana_U },
-    { "kana_WA", XKB_KEY_kana_WA },
-    { "kana_WO", XKB_KEY_kana_WO },
-    { "kana_ya", XKB_KEY_kana_ya },
-    { "kana_YA", XKB_KEY_kana_YA },
-    { "kana_yo", XKB_KEY_kana_yo },
-    { "kana_YO", XKB_KEY_kana_YO },
-    { "kana_yu", XKB_KEY_kana_yu },
-    { "kana_YU", XKB_KEY_kana_YU },
-    { "Kanji", XKB_KEY_Kanji },
-    { "Kanji_Bangou", XKB_KEY_Kanji_Bangou },
-    { "kappa", XKB_KEY_kappa },
-    { "Katakana", XKB_KEY_Katakana },
-    { "Kcedilla", XKB_KEY_Kcedilla },
-    { "kcedilla", XKB_KEY_kcedilla },
-    { "Korean_Won", XKB_KEY_Korean_Won },
-    { "KP_0", XKB_KEY_KP_0 },
-    { "KP_1", XKB_KEY_KP_1 },
-    { "KP_2", XKB_KEY_KP_2 },
-    { "KP_3", XKB_KEY_KP_3 },
-    { "KP_4", XKB_KEY_KP_4 },
-    { "KP_5", XKB_KEY_KP_5 },
-    { "KP_6", XKB_KEY_KP_6 },
-    { "KP_7", XKB_KEY_KP_7 },
-    { "KP_8", XKB_KEY_KP_8 },
-    { "KP_9", XKB_KEY_KP_9 },
-    { "KP_Add", XKB_KEY_KP_Add },
-    { "KP_BackTab", XKB_KEY_KP_BackTab },
-    { "KP_Begin", XKB_KEY_KP_Begin },
-    { "KP_Decimal", XKB_KEY_KP_Decimal },
-    { "KP_Delete", XKB_KEY_KP_Delete },
-    { "KP_Divide", XKB_KEY_KP_Divide },
-    { "KP_Down", XKB_KEY_KP_Down },
-    { "KP_End", XKB_KEY_KP_End },
-    { "KP_Enter", XKB_KEY_KP_Enter },
-    { "KP_Equal", XKB_KEY_KP_Equal },
-    { "KP_F1", XKB_KEY_KP_F1 },
-    { "KP_F2", XKB_KEY_KP_F2 },
-    { "KP_F3", XKB_KEY_KP_F3 },
-    { "KP_F4", XKB_KEY_KP_F4 },
-    { "KP_Home", XKB_KEY_KP_Home },
-    { "KP_Insert", XKB_KEY_KP_Insert },
-    { "KP_Left", XKB_KEY_KP_Left },
-    { "KP_Multiply", XKB_KEY_KP_Multiply },
-    { "KP_Next", XKB_KEY_KP_Next },
-    { "KP_Page_Down", XKB_KEY_KP_Page_Down },
-    { "KP_Page_Up", XKB_KEY_KP_Page_Up },
-    { "KP_Prior", XKB_KEY_KP_Prior },
-    { "KP_Right", XKB_KEY_KP_Right },
-    { "KP_Separator", XKB_KEY_KP_Separator },
-    { "KP_Space", XKB_KEY_KP_Space },
-    { "KP_Subtract", XKB_KEY_KP_Subtract },
-    { "KP_Tab", XKB_KEY_KP_Tab },
-    { "KP_Up", XKB_KEY_KP_Up },
-    { "kra", XKB_KEY_kra },
-    { "L", XKB_KEY_L },
-    { "l", XKB_KEY_l },
-    { "L1", XKB_KEY_L1 },
-    { "L10", XKB_KEY_L10 },
-    { "L2", XKB_KEY_L2 },
-    { "L3", XKB_KEY_L3 },
-    { "L4", XKB_KEY_L4 },
-    { "L5", XKB_KEY_L5 },
-    { "L6", XKB_KEY_L6 },
-    { "L7", XKB_KEY_L7 },
-    { "L8", XKB_KEY_L8 },
-    { "L9", XKB_KEY_L9 },
-    { "Lacute", XKB_KEY_Lacute },
-    { "lacute", XKB_KEY_lacute },
-    { "Last_Virtual_Screen", XKB_KEY_Last_Virtual_Screen },
-    { "latincross", XKB_KEY_latincross },
-    { "Lbelowdot", XKB_KEY_Lbelowdot },
-    { "lbelowdot", XKB_KEY_lbelowdot },
-    { "Lcaron", XKB_KEY_Lcaron },
-    { "lcaron", XKB_KEY_lcaron },
-    { "Lcedilla", XKB_KEY_Lcedilla },
-    { "lcedilla", XKB_KEY_lcedilla },
-    { "Left", XKB_KEY_Left },
-    { "leftanglebracket", XKB_KEY_leftanglebracket },
-    { "leftarrow", XKB_KEY_leftarrow },
-    { "leftcaret", XKB_KEY_leftcaret },
-    { "leftdoublequotemark", XKB_KEY_leftdoublequotemark },
-    { "leftmiddlecurlybrace", XKB_KEY_leftmiddlecurlybrace },
-    { "leftopentriangle", XKB_KEY_leftopentriangle },
-    { "leftpointer", XKB_KEY_leftpointer },
-    { "leftradical", XKB_KEY_leftradical },
-    { "leftshoe", XKB_KEY_leftshoe },
-    { "leftsinglequotemark", XKB_KEY_leftsinglequotemark },
-    { "leftt", XKB_KEY_leftt },
-    { "lefttack", XKB_KEY_lefttack },
-    { "less", XKB_KEY_less },
-    { "lessthanequal", XKB_KEY_lessthanequal },
-    { "lf", XKB_KEY_lf },
-    { "Linefeed", XKB_KEY_Linefeed },
-    { "lira", XKB_KEY_lira },
-    { "LiraSign", XKB_KEY_LiraSign },
-    { "logicaland", XKB_KEY_logicaland },
-    { "logicalor", XKB_KEY_logicalor },
-    { "longminus", XKB_KEY_longminus },
-    { "lowleftcorner", XKB_KEY_lowleftcorner },
-    { "lowrightcorner", XKB_KEY_lowrightcorner },
-    { "Lstroke", XKB_KEY_Lstroke },
-    { "lstroke", XKB_KEY_lstroke },
-    { "M", XKB_KEY_M },
-    { "m", XKB_KEY_m },
-    { "Mabovedot", XKB_KEY_Mabovedot },
-    { "mabovedot", XKB_KEY_mabovedot },
-    { "Macedonia_dse", XKB_KEY_Macedonia_dse },
-    { "Macedonia_DSE", XKB_KEY_Macedonia_DSE },
-    { "Macedonia_gje", XKB_KEY_Macedonia_gje },
-    { "Macedonia_GJE", XKB_KEY_Macedonia_GJE },
-    { "Macedonia_kje", XKB_KEY_Macedonia_kje },
-    { "Macedonia_KJE", XKB_KEY_Macedonia_KJE },
-    { "macron", XKB_KEY_macron },
-    { "Mae_Koho", XKB_KEY_Mae_Koho },
-    { "malesymbol", XKB_KEY_malesymbol },
-    { "maltesecross", XKB_KEY_maltesecross },
-    { "marker", XKB_KEY_marker },
-    { "masculine", XKB_KEY_masculine },
-    { "Massyo", XKB_KEY_Massyo },
-    { "Menu", XKB_KEY_Menu },
-    { "Meta_L", XKB_KEY_Meta_L },
-    { "Meta_R", XKB_KEY_Meta_R },
-    { "MillSign", XKB_KEY_MillSign },
-    { "minus", XKB_KEY_minus },
-    { "minutes", XKB_KEY_minutes },
-    { "Mode_switch", XKB_KEY_Mode_switch },
-    { "MouseKeys_Accel_Enable", XKB_KEY_MouseKeys_Accel_Enable },
-    { "MouseKeys_Enable", XKB_KEY_MouseKeys_Enable },
-    { "mu", XKB_KEY_mu },
-    { "Muhenkan", XKB_KEY_Muhenkan },
-    { "Multi_key", XKB_KEY_Multi_key },
-    { "MultipleCandidate", XKB_KEY_MultipleCandidate },
-    { "multiply", XKB_KEY_multiply },
-    { "musicalflat", XKB_KEY_musicalflat },
-    { "musicalsharp", XKB_KEY_musicalsharp },
-    { "mute_acute", XKB_KEY_mute_acute },
-    { "mute_asciicircum", XKB_KEY_mute_asciicircum },
-    { "mute_asciitilde", XKB_KEY_mute_asciitilde },
-    { "mute_diaeresis", XKB_KEY_mute_diaeresis },
-    { "mute_grave", XKB_KEY_mute_grave },
-    { "N", XKB_KEY_N },
-    { "n", XKB_KEY_n },
-    { "nabla", XKB_KEY_nabla },
-    { "Nacute", XKB_KEY_Nacute },
-    { "nacute", XKB_KEY_nacute },
-    { "NairaSign", XKB_KEY_NairaSign },
-    { "Ncaron", XKB_KEY_Ncaron },
-    { "ncaron", XKB_KEY_ncaron },
-    { "Ncedilla", XKB_KEY_Ncedilla },
-    { "ncedilla", XKB_KEY_ncedilla },
-    { "NewSheqelSign", XKB_KEY_NewSheqelSign },
-    { "Next", XKB_KEY_Next },
-    { "Next_Virtual_Screen", XKB_KEY_Next_Virtual_Screen },
-    { "ninesubscript", XKB_KEY_ninesubscript },
-    { "ninesuperior", XKB_KEY_ninesuperior },
-    { "nl", XKB_KEY_nl },
-    { "nobreakspace", XKB_KEY_nobreakspace },
-    { "NoSymbol", XKB_KEY_NoSymbol },
-    { "notapproxeq", XKB_KEY_notapproxeq },
-    { "notelementof", XKB_KEY_notelementof },
-    { "notequal", XKB_KEY_notequal },
-    { "notidentical", XKB_KEY_notidentical },
-    { "notsign", XKB_KEY_notsign },
-    { "Ntilde", XKB_KEY_Ntilde },
-    { "ntilde", XKB_KEY_ntilde },
-    { "Num_Lock", XKB_KEY_Num_Lock },
-    { "numbersign", XKB_KEY_numbersign },
-    { "numerosign", XKB_KEY_numerosign },
-    { "O", XKB_KEY_O },
-    { "o", XKB_KEY_o },
-    { "Oacute", XKB_KEY_Oacute },
-    { "oacute", XKB_KEY_oacute },
-    { "Obarred", XKB_KEY_Obarred },
-    { "obarred", XKB_KEY_obarred },
-    { "Obelowdot", XKB_KEY_Obelowdot },
-    { "obelowdot", XKB_KEY_obelowdot },
-    { "Ocaron", XKB_KEY_Ocaron },
-    { "ocaron", XKB_KEY_ocaron },
-    { "Ocircumflex", XKB_KEY_Ocircumflex },
-    { "ocircumflex", XKB_KEY_ocircumflex },
-    { "Ocircumflexacute", XKB_KEY_Ocircumflexacute },
-    { "ocircumflexacute", XKB_KEY_ocircumflexacute },
-    { "Ocircumflexbelowdot", XKB_KEY_Ocircumflexbelowdot },
-    { "ocircumflexbelowdot", XKB_KEY_ocircumflexbelowdot },
-    { "Ocircumflexgrave", XKB_KEY_Ocircumflexgrave },
-    { "ocircumflexgrave", XKB_KEY_ocircumflexgrave },
-    { "Ocircumflexhook", XKB_KEY_Ocircumflexhook },
-    { "ocircumflexhook", XKB_KEY_ocircumflexhook },
-    { "Ocircumflextilde", XKB_KEY_Ocircumflextilde },
-    { "ocircumflextilde", XKB_KEY_ocircumflextilde },
-    { "Odiaeresis", XKB_KEY_Odiaeresis },
-    { "odiaeresis", XKB_KEY_odiaeresis },
-    { "Odoubleacute", XKB_KEY_Odoubleacute },
-    { "odoubleacute", XKB_KEY_odoubleacute },
-    { "OE", XKB_KEY_OE },
-    { "oe", XKB_KEY_oe },
-    { "ogonek", XKB_KEY_ogonek },
-    { "Ograve", XKB_KEY_Ograve },
-    { "ograve", XKB_KEY_ograve },
-    { "Ohook", XKB_KEY_Ohook },
-    { "ohook", XKB_KEY_ohook },
-    { "Ohorn", XKB_KEY_Ohorn },
-    { "ohorn", XKB_KEY_ohorn },
-    { "Ohornacute", XKB_KEY_Ohornacute },
-    { "ohornacute", XKB_KEY_ohornacute },
-    { "Ohornbelowdot", XKB_KEY_Ohornbelowdot },
-    { "ohornbelowdot", XKB_KEY_ohornbelowdot },
-    { "Ohorngrave", XKB_KEY_Ohorngrave },
-    { "ohorngrave", XKB_KEY_ohorngrave },
-    { "Ohornhook", XKB_KEY_Ohornhook },
-    { "ohornhook", XKB_KEY_ohornhook },
-    { "Ohorntilde", XKB_KEY_Ohorntilde },
-    { "ohorntilde", XKB_KEY_ohorntilde },
-    { "Omacron", XKB_KEY_Omacron },
-    { "omacron", XKB_KEY_omacron },
-    { "oneeighth", XKB_KEY_oneeighth },
-    { "onefifth", XKB_KEY_onefifth },
-    { "onehalf", XKB_KEY_onehalf },
-    { "onequarter", XKB_KEY_onequarter },
-    { "onesixth", XKB_KEY_onesixth },
-    { "onesubscript", XKB_KEY_onesubscript },
-    { "onesuperior", XKB_KEY_onesuperior },
-    { "onethird", XKB_KEY_onethird },
-    { "Ooblique", XKB_KEY_Ooblique },
-    { "ooblique", XKB_KEY_ooblique },
-    { "openrectbullet", XKB_KEY_openrectbullet },
-    { "openstar", XKB_KEY_openstar },
-    { "opentribulletdown", XKB_KEY_opentribulletdown },
-    { "opentribulletup", XKB_KEY_opentribulletup },
-    { "ordfeminine", XKB_KEY_ordfeminine },
-    { "osfActivate", XKB_KEY_osfActivate },
-    { "osfAddMode", XKB_KEY_osfAddMode },
-    { "osfBackSpace", XKB_KEY_osfBackSpace },
-    { "osfBackTab", XKB_KEY_osfBackTab },
-    { "osfBeginData", XKB_KEY_osfBeginData },
-    { "osfBeginLine", XKB_KEY_osfBeginLine },
-    { "osfCancel", XKB_KEY_osfCancel },
-    { "osfClear", XKB_KEY_osfClear },
-    { "osfCopy", XKB_KEY_osfCopy },
-    { "osfCut", XKB_KEY_osfCut },
-    { "osfDelete", XKB_KEY_osfDelete },
-    { "osfDeselectAll", XKB_KEY_osfDeselectAll },
-    { "osfDown", XKB_KEY_osfDown },
-    { "osfEndData", XKB_KEY_osfEndData },
-    { "osfEndLine", XKB_KEY_osfEndLine },
-    { "osfEscape", XKB_KEY_osfEscape },
-    { "osfExtend", XKB_KEY_osfExtend },
-    { "osfHelp", XKB_KEY_osfHelp },
-    { "osfInsert", XKB_KEY_osfInsert },
-    { "osfLeft", XKB_KEY_osfLeft },
-    { "osfMenu", XKB_KEY_osfMenu },
-    { "osfMenuBar", XKB_KEY_osfMenuBar },
-    { "osfNextField", XKB_KEY_osfNextField },
-    { "osfNextMenu", XKB_KEY_osfNextMenu },
-    { "osfPageDown", XKB_KEY_osfPageDown },
-    { "osfPageLeft", XKB_KEY_osfPageLeft },
-    { "osfPageRight", XKB_KEY_osfPageRight },
-    { "osfPageUp", XKB_KEY_osfPageUp },
-    { "osfPaste", XKB_KEY_osfPaste },
-    { "osfPrevField", XKB_KEY_osfPrevField },
-    { "osfPrevMenu", XKB_KEY_osfPrevMenu },
-    { "osfPrimaryPaste", XKB_KEY_osfPrimaryPaste },
-    { "osfQuickPaste", XKB_KEY_osfQuickPaste },
-    { "osfReselect", XKB_KEY_osfReselect },
-    { "osfRestore", XKB_KEY_osfRestore },
-    { "osfRight", XKB_KEY_osfRight },
-    { "osfSelect", XKB_KEY_osfSelect },
-    { "osfSelectAll", XKB_KEY_osfSelectAll },
-    { "osfUndo", XKB_KEY_osfUndo },
-    { "osfUp", XKB_KEY_osfUp },
-    { "Oslash", XKB_KEY_Oslash },
-    { "oslash", XKB_KEY_oslash },
-    { "Otilde", XKB_KEY_Otilde },
-    { "otilde", XKB_KEY_otilde },
-    { "overbar", XKB_KEY_overbar },
-    { "Overlay1_Enable", XKB_KEY_Overlay1_Enable },
-    { "Overlay2_Enable", XKB_KEY_Overlay2_Enable },
-    { "overline", XKB_KEY_overline },
-    { "P", XKB_KEY_P },
-    { "p", XKB_KEY_p },
-    { "Pabovedot", XKB_KEY_Pabovedot },
-    { "pabovedot", XKB_KEY_pabovedot },
-    { "Page_Down", XKB_KEY_Page_Down },
-    { "Page_Up", XKB_KEY_Page_Up },
-    { "paragraph", XKB_KEY_paragraph },
-    { "parenleft", XKB_KEY_parenleft },
-    { "parenright", XKB_KEY_parenright },
-    { "partdifferential", XKB_KEY_partdifferential },
-    { "partialderivative", XKB_KEY_partialderivative },
-    { "Pause", XKB_KEY_Pause },
-    { "percent", XKB_KEY_percent },
-    { "period", XKB_KEY_period },
-    { "periodcentered", XKB_KEY_periodcentered },
-    { "permille", XKB_KEY_permille },
-    { "PesetaSign", XKB_KEY_PesetaSign },
-    { "phonographcopyright", XKB_KEY_phonographcopyright },
-    { "plus", XKB_KEY_plus },
-    { "plusminus", XKB_KEY_plusminus },
-    { "Pointer_Accelerate", XKB_KEY_Pointer_Accelerate },
-    { "Pointer_Button1", XKB_KEY_Pointer_Button1 },
-    { "Pointer_Button2", XKB_KEY_Pointer_Button2 },
-    { "Pointer_Button3", XKB_KEY_Pointer_Button3 },
-    { "Pointer_Button4", XKB_KEY_Pointer_Button4 },
-    { "Pointer_Button5", XKB_KEY_Pointer_Button5 },
-    { "Pointer_Button_Dflt", XKB_KEY_Pointer_Button_Dflt },
-    { "Pointer_DblClick1", XKB_KEY_Pointer_DblClick1 },
-    { "Pointer_DblClick2", XKB_KEY_Pointer_DblClick2 },
-    { "Pointer_DblClick3", XKB_KEY_Pointer_DblClick3 },
-    { "Pointer_DblClick4", XKB_KEY_Pointer_DblClick4 },
-    { "Pointer_DblClick5", XKB_KEY_Pointer_DblClick5 },
-    { "Pointer_DblClick_Dflt", XKB_KEY_Pointer_DblClick_Dflt },
-    { "Pointer_DfltBtnNext", XKB_KEY_Pointer_DfltBtnNext },
-    { "Pointer_DfltBtnPrev", XKB_KEY_Pointer_DfltBtnPrev },
-    { "Pointer_Down", XKB_KEY_Pointer_Down },
-    { "Pointer_DownLeft", XKB_KEY_Pointer_DownLeft },
-    { "Pointer_DownRight", XKB_KEY_Pointer_DownRight },
-    { "Pointer_Drag1", XKB_KEY_Pointer_Drag1 },
-    { "Pointer_Drag2", XKB_KEY_Pointer_Drag2 },
-    { "Pointer_Drag3", XKB_KEY_Pointer_Drag3 },
-    { "Pointer_Drag4", XKB_KEY_Pointer_Drag4 },
-    { "Pointer_Drag5", XKB_KEY_Pointer_Drag5 },
-    { "Pointer_Drag_Dflt", XKB_KEY_Pointer_Drag_Dflt },
-    { "Pointer_EnableKeys", XKB_KEY_Pointer_EnableKeys },
-    { "Pointer_Left", XKB_KEY_Pointer_Left },
-    { "Pointer_Right", XKB_KEY_Pointer_Right },
-    { "Pointer_Up", XKB_KEY_Pointer_Up },
-    { "Pointer_UpLeft", XKB_KEY_Pointer_UpLeft },
-    { "Pointer_UpRight", XKB_KEY_Pointer_UpRight },
-    { "prescription", XKB_KEY_prescription },
-    { "Prev_Virtual_Screen", XKB_KEY_Prev_Virtual_Screen },
-    { "PreviousCandidate", XKB_KEY_PreviousCandidate },
-    { "Print", XKB_KEY_Print },
-    { "Prior", XKB_KEY_Prior },
-    { "prolongedsound", XKB_KEY_prolongedsound },
-    { "punctspace", XKB_KEY_punctspace },
-    { "Q", XKB_KEY_Q },
-    { "q", XKB_KEY_q },
-    { "quad", XKB_KEY_quad },
-    { "question", XKB_KEY_question },
-    { "questiondown", XKB_KEY_questiondown },
-    { "quotedbl", XKB_KEY_quotedbl },
-    { "quoteleft", XKB_KEY_quoteleft },
-    { "quoteright", XKB_KEY_quoteright },
-    { "R", XKB_KEY_R },
-    { "r", XKB_KEY_r },
-    { "R1", XKB_KEY_R1 },
-    { "R10", XKB_KEY_R10 },
-    { "R11", XKB_KEY_R11 },
-    { "R12", XKB_KEY_R12 },
-    { "R13", XKB_KEY_R13 },
-    { "R14", XKB_KEY_R14 },
-    { "R15", XKB_KEY_R15 },
-    { "R2", XKB_KEY_R2 },
-    { "R3", XKB_KEY_R3 },
-    { "R4", XKB_KEY_R4 },
-    { "R5", XKB_KEY_R5 },
-    { "R6", XKB_KEY_R6 },
-    { "R7", XKB_KEY_R7 },
-    { "R8", XKB_KEY_R8 },
-    { "R9", XKB_KEY_R9 },
-    { "Racute", XKB_KEY_Racute },
-    { "racute", XKB_KEY_racute },
-    { "radical", XKB_KEY_radical },
-    { "Rcaron", XKB_KEY_Rcaron },
-    { "rcaron", XKB_KEY_rcaron },
-    { "Rcedilla", XKB_KEY_Rcedilla },
-    { "rcedilla", XKB_KEY_rcedilla },
-    { "Redo", XKB_KEY_Redo },
-    { "registered", XKB_KEY_registered },
-    { "RepeatKeys_Enable", XKB_KEY_RepeatKeys_Enable },
-    { "Reset", XKB_KEY_Reset },
-    { "Return", XKB_KEY_Return },
-    { "Right", XKB_KEY_Right },
-    { "rightanglebracket", XKB_KEY_rightanglebracket },
-    { "rightarrow", XKB_KEY_rightarrow },
-    { "rightcaret", XKB_KEY_rightcaret },
-    { "rightdoublequotemark", XKB_KEY_rightdoublequotemark },
-    { "rightmiddlecurlybrace", XKB_KEY_rightmiddlecurlybrace },
-    { "rightmiddlesummation", XKB_KEY_rightmiddlesummation },
-    { "rightopentriangle", XKB_KEY_rightopentriangle },
-    { "rightpointer", XKB_KEY_rightpointer },
-    { "rightshoe", XKB_KEY_rightshoe },
-    { "rightsinglequotemark", XKB_KEY_rightsinglequotemark },
-    { "rightt", XKB_KEY_rightt },
-    { "righttack", XKB_KEY_righttack },
-    { "Romaji", XKB_KEY_Romaji },
-    { "RupeeSign", XKB_KEY_RupeeSign },
-    { "S", XKB_KEY_S },
-    { "s", XKB_KEY_s },
-    { "Sabovedot", XKB_KEY_Sabovedot },
-    { "sabovedot", XKB_KEY_sabovedot },
-    { "Sacute", XKB_KEY_Sacute },
-    { "sacute", XKB_KEY_sacute },
-    { "Scaron", XKB_KEY_Scaron },
-    { "scaron", XKB_KEY_scaron },
-    { "Scedilla", XKB_KEY_Scedilla },
-    { "scedilla", XKB_KEY_scedilla },
-    { "SCHWA", XKB_KEY_SCHWA },
-    { "schwa", XKB_KEY_schwa },
-    { "Scircumflex", XKB_KEY_Scircumflex },
-    { "scircumflex", XKB_KEY_scircumflex },
-    { "script_switch", XKB_KEY_script_switch },
-    { "Scroll_Lock", XKB_KEY_Scroll_Lock },
-    { "seconds", XKB_KEY_seconds },
-    { "section", XKB_KEY_section },
-    { "Select", XKB_KEY_Select },
-    { "semicolon", XKB_KEY_semicolon },
-    { "semivoicedsound", XKB_KEY_semivoicedsound },
-    { "Serbian_dje", XKB_KEY_Serbian_dje },
-    { "Serbian_DJE", XKB_KEY_Serbian_DJE },
-    { "Serbian_dze", XKB_KEY_Serbian_dze },
-    { "Serbian_DZE", XKB_KEY_Serbian_DZE },
-    { "Serbian_je", XKB_KEY_Serbian_je },
-    { "Serbian_JE", XKB_KEY_Serbian_JE },
-    { "Serbian_lje", XKB_KEY_Serbian_lje },
-    { "Serbian_LJE", XKB_KEY_Serbian_LJE },
-    { "Serbian_nje", XKB_KEY_Serbian_nje },
-    { "Serbian_NJE", XKB_KEY_Serbian_NJE },
-    { "Serbian_tshe", XKB_KEY_Serbian_tshe },
-    { "Serbian_TSHE", XKB_KEY_Serbian_TSHE },
-    { "seveneighths", XKB_KEY_seveneighths },
-    { "sevensubscript", XKB_KEY_sevensubscript },
-    { "sevensuperior", XKB_KEY_sevensuperior },
-    { "Shift_L", XKB_KEY_Shift_L },
-    { "Shift_Lock", XKB_KEY_Shift_Lock },
-    { "Shift_R", XKB_KEY_Shift_R },
-    { "signaturemark", XKB_KEY_signaturemark },
-    { "signifblank", XKB_KEY_signifblank },
-    { "similarequal", XKB_KEY_similarequal },
-    { "SingleCandidate", XKB_KEY_SingleCandidate },
-    { "singlelowquotemark", XKB_KEY_singlelowquotemark },
-    { "Sinh_a", XKB_KEY_Sinh_a },
-    { "Sinh_aa", XKB_KEY_Sinh_aa },
-    { "Sinh_aa2", XKB_KEY_Sinh_aa2 },
-    { "Sinh_ae", XKB_KEY_Sinh_ae },
-    { "Sinh_ae2", XKB_KEY_Sinh_ae2 },
-    { "Sinh_aee", XKB_KEY_Sinh_aee },
-    { "Sinh_aee2", XKB_KEY_Sinh_aee2 },
-    { "Sinh_ai", XKB_KEY_Sinh_ai },
-    { "Sinh_ai2", XKB_KEY_Sinh_ai2 },
-    { "Sinh_al", XKB_KEY_Sinh_al },
-    { "Sinh_au", XKB_KEY_Sinh_au },
-    { "Sinh_au2", XKB_KEY_Sinh_au2 },
-    { "Sinh_ba", XKB_KEY_Sinh_ba },
-    { "Sinh_bha", XKB_KEY_Sinh_bha },
-    { "Sinh_ca", XKB_KEY_Sinh_ca },
-    { "Sinh_cha", XKB_KEY_Sinh_cha },
-    { "Sinh_dda", XKB_KEY_Sinh_dda },
-    { "Sinh_ddha", XKB_KEY_Sinh_ddha },
-    { "Sinh_dha", XKB_KEY_Sinh_dha },
-    { "Sinh_dhha", XKB_KEY_Sinh_dhha },
-    { "Sinh_e", XKB_KEY_Sinh_e },
-    { "Sinh_e2", XKB_KEY_Sinh_e2 },
-    { "Sinh_ee", XKB_KEY_Sinh_ee },
-    { "Sinh_ee2", XKB_KEY_Sinh_ee2 },
-    { "Sinh_fa", XKB_KEY_Sinh_fa },
-    { "Sinh_ga", XKB_KEY_Sinh_ga },
-    { "Sinh_gha", XKB_KEY_Sinh_gha },
-    { "Sinh_h2", XKB_KEY_Sinh_h2 },
-    { "Sinh_ha", XKB_KEY_Sinh_ha },
-    { "Sinh_i", XKB_KEY_Sinh_i },
-    { "Sinh_i2", XKB_KEY_Sinh_i2 },
-    { "Sinh_ii", XKB_KEY_Sinh_ii },
-    { "Sinh_ii2", XKB_KEY_Sinh_ii2 },
-    { "Sinh_ja", XKB_KEY_Sinh_ja },
-    { "Sinh_jha", XKB_KEY_Sinh_jha },
-    { "Sinh_jnya", XKB_KEY_Sinh_jnya },
-    { "Sinh_ka", XKB_KEY_Sinh_ka },
-    { "Sinh_kha", XKB_KEY_Sinh_kha },
-    { "Sinh_kunddaliya", XKB_KEY_Sinh_kunddaliya },
-    { "Sinh_la", XKB_KEY_Sinh_la },
-    { "Sinh_lla", XKB_KEY_Sinh_lla },
-    { "Sinh_lu", XKB_KEY_Sinh_lu },
-    { "Sinh_lu2", XKB_KEY_Sinh_lu2 },
-    { "Sinh_luu", XKB_KEY_Sinh_luu },
-    { "Sinh_luu2", XKB_KEY_Sinh_luu2 },
-    { "Sinh_ma", XKB_KEY_Sinh_ma },
-    { "Sinh_mba", XKB_KEY_Sinh_mba },
-    { "Sinh_na", XKB_KEY_Sinh_na },
-    { "Sinh_ndda", XKB_KEY_Sinh_ndda },
-    { "Sinh_ndha", XKB_KEY_Sinh_ndha },
-    { "Sinh_ng", XKB_KEY_Sinh_ng },
-    { "Sinh_ng2", XKB_KEY_Sinh_ng2 },
-    { "Sinh_nga", XKB_KEY_Sinh_nga },
-    { "Sinh_nja", XKB_KEY_Sinh_nja },
-    { "Sinh_nna", XKB_KEY_Sinh_nna },
-    { "Sinh_nya", XKB_KEY_Sinh_nya },
-    { "Sinh_o", XKB_KEY_Sinh_o },
-    { "Sinh_o2", XKB_KEY_Sinh_o2 },
-    { "Sinh_oo", XKB_KEY_Sinh_oo },
-    { "Sinh_oo2", XKB_KEY_Sinh_oo2 },
-    { "Sinh_pa", XKB_KEY_Sinh_pa },
-    { "Sinh_pha", XKB_KEY_Sinh_pha },
-    { "Sinh_ra", XKB_KEY_Sinh_ra },
-    { "Sinh_ri", XKB_KEY_Sinh_ri },
-    { "Sinh_rii", XKB_KEY_Sinh_rii },
-    { "Sinh_ru2", XKB_KEY_Sinh_ru2 },
-    { "Sinh_ruu2", XKB_KEY_Sinh_ruu2 },
-    { "Sinh_sa", XKB_KEY_Sinh_sa },
-    { "Sinh_sha", XKB_KEY_Sinh_sha },
-    { "Sinh_ssha", XKB_KEY_Sinh_ssha },
-    { "Sinh_tha", XKB_KEY_Sinh_tha },
-    { "Sinh_thha", XKB_KEY_Sinh_thha },
-    { "Sinh_tta", XKB_KEY_Sinh_tta },
-    { "Sinh_ttha", XKB_KEY_Sinh_ttha },
-    { "Sinh_u", XKB_KEY_Sinh_u },
-    { "Sinh_u2", XKB_KEY_Sinh_u2 },
-    { "Sinh_uu", XKB_KEY_Sinh_uu },
-    { "Sinh_uu2", XKB_KEY_Sinh_uu2 },
-    { "Sinh_va", XKB_KEY_Sinh_va },
-    { "Sinh_ya", XKB_KEY_Sinh_ya },
-    { "sixsubscript", XKB_KEY_sixsubscript },
-    { "sixsuperior", XKB_KEY_sixsuperior },
-    { "slash", XKB_KEY_slash },
-    { "SlowKeys_Enable", XKB_KEY_SlowKeys_Enable },
-    { "soliddiamond", XKB_KEY_soliddiamond },
-    { "space", XKB_KEY_space },
-    { "squareroot", XKB_KEY_squareroot },
-    { "ssharp", XKB_KEY_ssharp },
-    { "sterling", XKB_KEY_sterling },
-    { "StickyKeys_Enable", XKB_KEY_StickyKeys_Enable },
-    { "stricteq", XKB_KEY_stricteq },
-    { "SunAgain", XKB_KEY_SunAgain },
-    { "SunAltGraph", XKB_KEY_SunAltGraph },
-    { "SunAudioLowerVolume", XKB_KEY_SunAudioLowerVolume },
-    { "SunAudioMute", XKB_KEY_SunAudioMute },
-    { "SunAudioRaiseVolume", XKB_KEY_SunAudioRaiseVolume },
-    { "SunCompose", XKB_KEY_SunCompose },
-    { "SunCopy", XKB_KEY_SunCopy },
-    { "SunCut", XKB_KEY_SunCut },
-    { "SunF36", XKB_KEY_SunF36 },
-    { "SunF37", XKB_KEY_SunF37 },
-    { "SunFA_Acute", XKB_KEY_SunFA_Acute },
-    { "SunFA_Cedilla", XKB_KEY_SunFA_Cedilla },
-    { "SunFA_Circum", XKB_KEY_SunFA_Circum },
-    { "SunFA_Diaeresis", XKB_KEY_SunFA_Diaeresis },
-    { "SunFA_Grave", XKB_KEY_SunFA_Grave },
-    { "SunFA_Tilde", XKB_KEY_SunFA_Tilde },
-    { "SunFind", XKB_KEY_SunFind },
-    { "SunFront", XKB_KEY_SunFront },
-    { "SunOpen", XKB_KEY_SunOpen },
-    { "SunPageDown", XKB_KEY_SunPageDown },
-    { "SunPageUp", XKB_KEY_SunPageUp },
-    { "SunPaste", XKB_KEY_SunPaste },
-    { "SunPowerSwitch", XKB_KEY_SunPowerSwitch },
-    { "SunPowerSwitchShift", XKB_KEY_SunPowerSwitchShift },
-    { "SunPrint_Screen", XKB_KEY_SunPrint_Screen },
-    { "SunProps", XKB_KEY_SunProps },
-    { "SunStop", XKB_KEY_SunStop },
-    { "SunSys_Req", XKB_KEY_SunSys_Req },
-    { "SunUndo", XKB_KEY_SunUndo },
-    { "SunVideoDegauss", XKB_KEY_SunVideoDegauss },
-    { "SunVideoLowerBrightness", XKB_KEY_SunVideoLowerBrightness },
-    { "SunVideoRaiseBrightness", XKB_KEY_SunVideoRaiseBrightness },
-    { "Super_L", XKB_KEY_Super_L },
-    { "Super_R", XKB_KEY_Super_R },
-    { "Sys_Req", XKB_KEY_Sys_Req },
-    { "System", XKB_KEY_System },
-    { "T", XKB_KEY_T },
-    { "t", XKB_KEY_t },
-    { "Tab", XKB_KEY_Tab },
-    { "Tabovedot", XKB_KEY_Tabovedot },
-    { "tabovedot", XKB_KEY_tabovedot },
-    { "Tcaron", XKB_KEY_Tcaron },
-    { "tcaron", XKB_KEY_tcaron },
-    { "Tcedilla", XKB_KEY_Tcedilla },
-    { "tcedilla", XKB_KEY_tcedilla },
-    { "telephone", XKB_KEY_telephone },
-    { "telephonerecorder", XKB_KEY_telephonerecorder },
-    { "Terminate_Server", XKB_KEY_Terminate_Server },
-    { "Thai_baht", XKB_KEY_Thai_baht },
-    { "Thai_bobaimai", XKB_KEY_Thai_bobaimai },
-    { "Thai_chochan", XKB_KEY_Thai_chochan },
-    { "Thai_chochang", XKB_KEY_Thai_chochang },
-    { "Thai_choching", XKB_KEY_Thai_choching },
-    { "Thai_chochoe", XKB_KEY_Thai_chochoe },
-    { "Thai_dochada", XKB_KEY_Thai_dochada },
-    { "Thai_dodek", XKB_KEY_Thai_dodek },
-    { "Thai_fofa", XKB_KEY_Thai_fofa },
-    { "Thai_fofan", XKB_KEY_Thai_fofan },
-    { "Thai_hohip", XKB_KEY_Thai_hohip },
-    { "Thai_honokhuk", XKB_KEY_Thai_honokhuk },
-    { "Thai_khokhai", XKB_KEY_Thai_khokhai },
-    { "Thai_khokhon", XKB_KEY_Thai_khokhon },
-    { "Thai_khokhuat", XKB_KEY_Thai_khokhuat },
-    { "Thai_khokhwai", XKB_KEY_Thai_khokhwai },
-    { "Thai_khorakhang", XKB_KEY_Thai_khorakhang },
-    { "Thai_kokai", XKB_KEY_Thai_kokai },
-    { "Thai_lakkhangyao", XKB_KEY_Thai_lakkhangyao },
-    { "Thai_lekchet", XKB_KEY_Thai_lekchet },
-    { "Thai_lekha", XKB_KEY_Thai_lekha },
-    { "Thai_lekhok", XKB_KEY_Thai_lekhok },
-    { "Thai_lekkao", XKB_KEY_Thai_lekkao },
-    { "Thai_leknung", XKB_KEY_Thai_leknung },
-    { "Thai_lekpaet", XKB_KEY_Thai_lekpaet },
-    { "Thai_leksam", XKB_KEY_Thai_leksam },
-    { "Thai_leksi", XKB_KEY_Thai_leksi },
-    { "Thai_leksong", XKB_KEY_Thai_leksong },
-    { "Thai_leksun", XKB_KEY_Thai_leksun },
-    { "Thai_lochula", XKB_KEY_Thai_lochula },
-    { "Thai_loling", XKB_KEY_Thai_loling },
-    { "Thai_lu", XKB_KEY_Thai_lu },
-    { "Thai_maichattawa", XKB_KEY_Thai_maichattawa },
-    { "Thai_maiek", XKB_KEY_Thai_maiek },
-    { "Thai_maihanakat", XKB_KEY_Thai_maihanakat },
-    { "Thai_maihanakat_maitho", XKB_KEY_Thai_maihanakat_maitho },
-    { "Thai_maitaikhu", XKB_KEY_Thai_maitaikhu },
-    { "Thai_maitho", XKB_KEY_Thai_maitho },
-    { "Thai_maitri", XKB_KEY_Thai_maitri },
-    { "Thai_maiyamok", XKB_KEY_Thai_maiyamok },
-    { "Thai_moma", XKB_KEY_Thai_moma },
-    { "Thai_ngongu", XKB_KEY_Thai_ngongu },
-    { "Thai_nikhahit", XKB_KEY_Thai_nikhahit },
-    { "Thai_nonen", XKB_KEY_Thai_nonen },
-    { "Thai_nonu", XKB_KEY_Thai_nonu },
-    { "Thai_oang", XKB_KEY_Thai_oang },
-    { "Thai_paiyannoi", XKB_KEY_Thai_paiyannoi },
-    { "Thai_phinthu", XKB_KEY_Thai_phinthu },
-    { "Thai_phophan", XKB_KEY_Thai_phophan },
-    { "Thai_phophung", XKB_KEY_Thai_phophung },
-    { "Thai_phosamphao", XKB_KEY_Thai_phosamphao },
-    { "Thai_popla", XKB_KEY_Thai_popla },
-    { "Thai_rorua", XKB_KEY_Thai_rorua },
-    { "Thai_ru", XKB_KEY_Thai_ru },
-    { "Thai_saraa", XKB_KEY_Thai_saraa },
-    { "Thai_saraaa", XKB_KEY_Thai_saraaa },
-    { "Thai_saraae", XKB_KEY_Thai_saraae },
-    { "Thai_saraaimaimalai", XKB_KEY_Thai_saraaimaimalai },
-    { "Thai_saraaimaimuan", XKB_KEY_Thai_saraaimaimuan },
-    { "Thai_saraam", XKB_KEY_Thai_saraam },
-    { "Thai_sarae", XKB_KEY_Thai_sarae },
-    { "Thai_sarai", XKB_KEY_Thai_sarai },
-    { "Thai_saraii", XKB_KEY_Thai_saraii },
-    { "Thai_sarao", XKB_KEY_Thai_sarao },
-    { "Thai_sarau", XKB_KEY_Thai_sarau },
-    { "Thai_saraue", XKB_KEY_Thai_saraue },
-    { "Thai_sarauee", XKB_KEY_Thai_sarauee },
-    { "Thai_sarauu", XKB_KEY_Thai_sarauu },
-    { "Thai_sorusi", XKB_KEY_Thai_sorusi },
-    { "Thai_sosala", XKB_KEY_Thai_sosala },
-    { "Thai_soso", XKB_KEY_Thai_soso },
-    { "Thai_sosua", XKB_KEY_Thai_sosua },
-    { "Thai_thanthakhat", XKB_KEY_Thai_thanthakhat },
-    { "Thai_thonangmontho", XKB_KEY_Thai_thonangmontho },
-    { "Thai_thophuthao", XKB_KEY_Thai_thophuthao },
-    { "Thai_thothahan", XKB_KEY_Thai_thothahan },
-    { "Thai_thothan", XKB_KEY_Thai_thothan },
-    { "Thai_thothong", XKB_KEY_Thai_thothong },
-    { "Thai_thothung", XKB_KEY_Thai_thothung },
-    { "Thai_topatak", XKB_KEY_Thai_topatak },
-    { "Thai_totao", XKB_KEY_Thai_totao },
-    { "Thai_wowaen", XKB_KEY_Thai_wowaen },
-    { "Thai_yoyak", XKB_KEY_Thai_yoyak },
-    { "Thai_yoying", XKB_KEY_Thai_yoying },
-    { "therefore", XKB_KEY_therefore },
-    { "thinspace", XKB_KEY_thinspace },
-    { "THORN", XKB_KEY_THORN },
-    { "Thorn", XKB_KEY_Thorn },
-    { "thorn", XKB_KEY_thorn },
-    { "threeeighths", XKB_KEY_threeeighths },
-    { "threefifths", XKB_KEY_threefifths },
-    { "threequarters", XKB_KEY_threequarters },
-    { "threesubscript", XKB_KEY_threesubscript },
-    { "threesuperior", XKB_KEY_threesuperior },
-    { "tintegral", XKB_KEY_tintegral },
-    { "topintegral", XKB_KEY_topintegral },
-    { "topleftparens", XKB_KEY_topleftparens },
-    { "topleftradical", XKB_KEY_topleftradical },
-    { "topleftsqbracket", XKB_KEY_topleftsqbracket },
-    { "topleftsummation", XKB_KEY_topleftsummation },
-    { "toprightparens", XKB_KEY_toprightparens },
-    { "toprightsqbracket", XKB_KEY_toprightsqbracket },
-    { "toprightsummation", XKB_KEY_toprightsummation },
-    { "topt", XKB_KEY_topt },
-    { "topvertsummationconnector", XKB_KEY_topvertsummationconnector },
-    { "Touroku", XKB_KEY_Touroku },
-    { "trademark", XKB_KEY_trademark },
-    { "trademarkincircle", XKB_KEY_trademarkincircle },
-    { "Tslash", XKB_KEY_Tslash },
-    { "tslash", XKB_KEY_tslash },
-    { "twofifths", XKB_KEY_twofifths },
-    { "twosubscript", XKB_KEY_twosubscript },
-    { "twosuperior", XKB_KEY_twosuperior },
-    { "twothirds", XKB_KEY_twothirds },
-    { "U", XKB_KEY_U },
-    { "u", XKB_KEY_u },
-    { "Uacute", XKB_KEY_Uacute },
-    { "uacute", XKB_KEY_uacute },
-    { "Ubelowdot", XKB_KEY_Ubelowdot },
-    { "ubelowdot", XKB_KEY_ubelowdot },
-    { "Ubreve", XKB_KEY_Ubreve },
-    { "ubreve", XKB_KEY_ubreve },
-    { "Ucircumflex", XKB_KEY_Ucircumflex },
-    { "ucircumflex", XKB_KEY_ucircumflex },
-    { "Udiaeresis", XKB_KEY_Udiaeresis },
-    { "udiaeresis", XKB_KEY_udiaeresis },
-    { "Udoubleacute", XKB_KEY_Udoubleacute },
-    { "udoubleacute", XKB_KEY_udoubleacute },
-    { "Ugrave", XKB_KEY_Ugrave },
-    { "ugrave", XKB_KEY_ugrave },
-    { "Uhook", XKB_KEY_Uhook },
-    { "uhook", XKB_KEY_uhook },
-    { "Uhorn", XKB_KEY_Uhorn },
-    { "uhorn", XKB_KEY_uhorn },
-    { "Uhornacute", XKB_KEY_Uhornacute },
-    { "uhornacute", XKB_KEY_uhornacute },
-    { "Uhornbelowdot", XKB_KEY_Uhornbelowdot },
-    { "uhornbelowdot", XKB_KEY_uhornbelowdot },
-    { "Uhorngrave", XKB_KEY_Uhorngrave },
-    { "uhorngrave", XKB_KEY_uhorngrave },
-    { "Uhornhook", XKB_KEY_Uhornhook },
-    { "uhornhook", XKB_KEY_uhornhook },
-    { "Uhorntilde", XKB_KEY_Uhorntilde },
-    { "uhorntilde", XKB_KEY_uhorntilde },
-    { "Ukrainian_ghe_with_upturn", XKB_KEY_Ukrainian_ghe_with_upturn },
-    { "Ukrainian_GHE_WITH_UPTURN", XKB_KEY_Ukrainian_GHE_WITH_UPTURN },
-    { "Ukrainian_i", XKB_KEY_Ukrainian_i },
-    { "Ukrainian_I", XKB_KEY_Ukrainian_I },
-    { "Ukrainian_ie", XKB_KEY_Ukrainian_ie },
-    { "Ukrainian_IE", XKB_KEY_Ukrainian_IE },
-    { "Ukrainian_yi", XKB_KEY_Ukrainian_yi },
-    { "Ukrainian_YI", XKB_KEY_Ukrainian_YI },
-    { "Ukranian_i", XKB_KEY_Ukranian_i },
-    { "Ukranian_I", XKB_KEY_Ukranian_I },
-    { "Ukranian_je", XKB_KEY_Ukranian_je },
-    { "Ukranian_JE", XKB_KEY_Ukranian_JE },
-    { "Ukranian_yi", XKB_KEY_Ukranian_yi },
-    { "Ukranian_YI", XKB_KEY_Ukranian_YI },
-    { "Umacron", XKB_KEY_Umacron },
-    { "umacron", XKB_KEY_umacron },
-    { "underbar", XKB_KEY_underbar },
-    { "underscore", XKB_KEY_underscore },
-    { "Undo", XKB_KEY_Undo },
-    { "union", XKB_KEY_union },
-    { "Uogonek", XKB_KEY_Uogonek },
-    { "uogonek", XKB_KEY_uogonek },
-    { "Up", XKB_KEY_Up },
-    { "uparrow", XKB_KEY_uparrow },
-    { "upcaret", XKB_KEY_upcaret },
-    { "upleftcorner", XKB_KEY_upleftcorner },
-    { "uprightcorner", XKB_KEY_uprightcorner },
-    { "upshoe", XKB_KEY_upshoe },
-    { "upstile", XKB_KEY_upstile },
-    { "uptack", XKB_KEY_uptack },
-    { "Uring", XKB_KEY_Uring },
-    { "uring", XKB_KEY_uring },
-    { "User", XKB_KEY_User },
-    { "Utilde", XKB_KEY_Utilde },
-    { "utilde", XKB_KEY_utilde },
-    { "V", XKB_KEY_V },
-    { "v", XKB_KEY_v },
-    { "variation", XKB_KEY_variation },
-    { "vertbar", XKB_KEY_vertbar },
-    { "vertconnector", XKB_KEY_vertconnector },
-    { "voicedsound", XKB_KEY_voicedsound },
-    { "VoidSymbol", XKB_KEY_VoidSymbol },
-    { "vt", XKB_KEY_vt },
-    { "W", XKB_KEY_W },
-    { "w", XKB_KEY_w },
-    { "Wacute", XKB_KEY_Wacute },
-    { "wacute", XKB_KEY_wacute },
-    { "Wcircumflex", XKB_KEY_Wcircumflex },
-    { "wcircumflex", XKB_KEY_wcircumflex },
-    { "Wdiaeresis", XKB_KEY_Wdiaeresis },
-    { "wdiaeresis", XKB_KEY_wdiaeresis },
-    { "Wgrave", XKB_KEY_Wgrave },
-    { "wgrave", XKB_KEY_wgrave },
-    { "WonSign", XKB_KEY_WonSign },
-    { "X", XKB_KEY_X },
-    { "x", XKB_KEY_x },
-    { "Xabovedot", XKB_KEY_Xabovedot },
-    { "xabovedot", XKB_KEY_xabovedot },
-    { "XF86AddFavorite", XKB_KEY_XF86AddFavorite },
-    { "XF86ApplicationLeft", XKB_KEY_XF86ApplicationLeft },
-    { "XF86ApplicationRight", XKB_KEY_XF86ApplicationRight },
-    { "XF86AudioCycleTrack", XKB_KEY_XF86AudioCycleTrack },
-    { "XF86AudioForward", XKB_KEY_XF86AudioForward },
-    { "XF86AudioLowerVolume", XKB_KEY_XF86AudioLowerVolume },
-    { "XF86AudioMedia", XKB_KEY_XF86AudioMedia },
-    { "XF86AudioMicMute", XKB_KEY_XF86AudioMicMute },
-    { "XF86AudioMute", XKB_KEY_XF86AudioMute },
-    { "XF86AudioNext", XKB_KEY_XF86AudioNext },
-    { "XF86AudioPause", XKB_KEY_XF86AudioPause },
-    { "XF86AudioPlay", XKB_KEY_XF86AudioPlay },
-    { "XF86AudioPrev", XKB_KEY_XF86AudioPrev },
-    { "XF86AudioRaiseVolume", XKB_KEY_XF86AudioRaiseVolume },
-    { "XF86AudioRandomPlay", XKB_KEY_XF86AudioRandomPlay },
-    { "XF86AudioRecord", XKB_KEY_XF86AudioRecord },
-    { "XF86AudioRepeat", XKB_KEY_XF86AudioRepeat },
-    { "XF86AudioRewind", XKB_KEY_XF86AudioRewind },
-    { "XF86AudioStop", XKB_KEY_XF86AudioStop },
-    { "XF86Away", XKB_KEY_XF86Away },
-    { "XF86Back", XKB_KEY_XF86Back },
-    { "XF86BackForward", XKB_KEY_XF86BackForward },
-    { "XF86Battery", XKB_KEY_XF86Battery },
-    { "XF86Blue", XKB_KEY_XF86Blue },
-    { "XF86Bluetooth", XKB_KEY_XF86Bluetooth },
-    { "XF86Book", XKB_KEY_XF86Book },
-    { "XF86BrightnessAdjust", XKB_KEY_XF86BrightnessAdjust },
-    { "XF86Calculater", XKB_KEY_XF86Calculater },
-    { "XF86Calculator", XKB_KEY_XF86Calculator },
-    { "XF86Calendar", XKB_KEY_XF86Calendar },
-    { "XF86CD", XKB_KEY_XF86CD },
-    { "XF86Clear", XKB_KEY_XF86Clear },
-    { "XF86ClearGrab", XKB_KEY_XF86ClearGrab },
-    { "XF86Close", XKB_KEY_XF86Close },
-    { "XF86Community", XKB_KEY_XF86Community },
-    { "XF86ContrastAdjust", XKB_KEY_XF86ContrastAdjust },
-    { "XF86Copy", XKB_KEY_XF86Copy },
-    { "XF86Cut", XKB_KEY_XF86Cut },
-    { "XF86CycleAngle", XKB_KEY_XF86CycleAngle },
-    { "XF86Display", XKB_KEY_XF86Display },
-    { "XF86Documents", XKB_KEY_XF86Documents },
-    { "XF86DOS", XKB_KEY_XF86DOS },
-    { "XF86Eject", XKB_KEY_XF86Eject },
-    { "XF86Excel", XKB_KEY_XF86Excel },
-    { "XF86Explorer", XKB_KEY_XF86Explorer },
-    { "XF86Favorites", XKB_KEY_XF86Favorites },
-    { "XF86Finance", XKB_KEY_XF86Finance },
-    { "XF86Forward", XKB_KEY_XF86Forward },
-    { "XF86FrameBack", XKB_KEY_XF86FrameBack },
-    { "XF86FrameForward", XKB_KEY_XF86FrameForward },
-    { "XF86Game", XKB_KEY_XF86Game },
-    { "XF86Go", XKB_KEY_XF86Go },
-    { "XF86Green", XKB_KEY_XF86Green },
-    { "XF86Hibernate", XKB_KEY_XF86Hibernate },
-    { "XF86History", XKB_KEY_XF86History },
-    { "XF86HomePage", XKB_KEY_XF86HomePage },
-    { "XF86HotLinks", XKB_KEY_XF86HotLinks },
-    { "XF86iTouch", XKB_KEY_XF86iTouch },
-    { "XF86KbdBrightnessDown", XKB_KEY_XF86KbdBrightnessDown },
-    { "XF86KbdBrightnessUp", XKB_KEY_XF86KbdBrightnessUp },
-    { "XF86KbdLightOnOff", XKB_KEY_XF86KbdLightOnOff },
-    { "XF86Launch0", XKB_KEY_XF86Launch0 },
-    { "XF86Launch1", XKB_KEY_XF86Launch1 },
-    { "XF86Launch2", XKB_KEY_XF86Launch2 },
-    { "XF86Launch3", XKB_KEY_XF86Launch3 },
-    { "XF86Launch4", XKB_KEY_XF86Launch4 },
-    { "XF86Launch5", XKB_KEY_XF86Launch5 },
-    { "XF86Launch6", XKB_KEY_XF86Launch6 },
-    { "XF86Launch7", XKB_KEY_XF86Launch7 },
-    { "XF86Launch8", XKB_KEY_XF86Launch8 },
-    { "XF86Launch9", XKB_KEY_XF86Launch9 },
-    { "XF86LaunchA", XKB_KEY_XF86LaunchA },
-    { "XF86LaunchB", XKB_KEY_XF86LaunchB },
-    { "XF86LaunchC", XKB_KEY_XF86LaunchC },
-    { "XF86LaunchD", XKB_KEY_XF86LaunchD },
-    { "XF86LaunchE", XKB_KEY_XF86LaunchE },
-    { "XF86LaunchF", XKB_KEY_XF86LaunchF },
-    { "XF86LightBulb", XKB_KEY_XF86LightBulb },
-    { "XF86LogGrabInfo", XKB_KEY_XF86LogGrabInfo },
-    { "XF86LogOff", XKB_KEY_XF86LogOff },
-    { "XF86LogWindowTree", XKB_KEY_XF86LogWindowTree },
-    { "XF86Mail", XKB_KEY_XF86Mail },
-    { "XF86MailForward", XKB_KEY_XF86MailForward },
-    { "XF86Market", XKB_KEY_XF86Market },
-    { "XF86Meeting", XKB_KEY_XF86Meeting },
-    { "XF86Memo", XKB_KEY_XF86Memo },
-    { "XF86MenuKB", XKB_KEY_XF86MenuKB },
-    { "XF86MenuPB", XKB_KEY_XF86MenuPB },
-    { "XF86Messenger", XKB_KEY_XF86Messenger },
-    { "XF86ModeLock", XKB_KEY_XF86ModeLock },
-    { "XF86MonBrightnessDown", XKB_KEY_XF86MonBrightnessDown },
-    { "XF86MonBrightnessUp", XKB_KEY_XF86MonBrightnessUp },
-    { "XF86Music", XKB_KEY_XF86Music },
-    { "XF86MyComputer", XKB_KEY_XF86MyComputer },
-    { "XF86MySites", XKB_KEY_XF86MySites },
-    { "XF86New", XKB_KEY_XF86New },
-    { "XF86News", XKB_KEY_XF86News },
-    { "XF86Next_VMode", XKB_KEY_XF86Next_VMode },
-    { "XF86OfficeHome", XKB_KEY_XF86OfficeHome },
-    { "XF86Open", XKB_KEY_XF86Open },
-    { "XF86OpenURL", XKB_KEY_XF86OpenURL },
-    { "XF86Option", XKB_KEY_XF86Option },
-    { "XF86Paste", XKB_KEY_XF86Paste },
-    { "XF86Phone", XKB_KEY_XF86Phone },
-    { "XF86Pictures", XKB_KEY_XF86Pictures },
-    { "XF86PowerDown", XKB_KEY_XF86PowerDown },
-    { "XF86PowerOff", XKB_KEY_XF86PowerOff },
-    { "XF86Prev_VMode", XKB_KEY_XF86Prev_VMode },
-    { "XF86Q", XKB_KEY_XF86Q },
-    { "XF86Red", XKB_KEY_XF86Red },
-    { "XF86Refresh", XKB_KEY_XF86Refresh },
-    { "XF86Reload", XKB_KEY_XF86Reload },
-    { "XF86Reply", XKB_KEY_XF86Reply },
-    { "XF86RockerDown", XKB_KEY_XF86RockerDown },
-    { "XF86RockerEnter", XKB_KEY_XF86RockerEnter },
-    { "XF86RockerUp", XKB_KEY_XF86RockerUp },
-    { "XF86RotateWindows", XKB_KEY_XF86RotateWindows },
-    { "XF86RotationKB", XKB_KEY_XF86RotationKB },
-    { "XF86RotationPB", XKB_KEY_XF86RotationPB },
-    { "XF86Save", XKB_KEY_XF86Save },
-    { "XF86ScreenSaver", XKB_KEY_XF86ScreenSaver },
-    { "XF86ScrollClick", XKB_KEY_XF86ScrollClick },
-    { "XF86ScrollDown", XKB_KEY_XF86ScrollDown },
-    { "XF86ScrollUp", XKB_KEY_XF86ScrollUp },
-    { "XF86Search", XKB_KEY_XF86Search },
-    { "XF86Select", XKB_KEY_XF86Select },
-    { "XF86Send", XKB_KEY_XF86Send },
-    { "XF86Shop", XKB_KEY_XF86Shop },
-    { "XF86Sleep", XKB_KEY_XF86Sleep },
-    { "XF86Spell", XKB_KEY_XF86Spell },
-    { "XF86SplitScreen", XKB_KEY_XF86SplitScreen },
-    { "XF86Standby", XKB_KEY_XF86Standby },
-    { "XF86Start", XKB_KEY_XF86Start },
-    { "XF86Stop", XKB_KEY_XF86Stop },
-    { "XF86Subtitle", XKB_KEY_XF86Subtitle },
-    { "XF86Support", XKB_KEY_XF86Support },
-    { "XF86Suspend", XKB_KEY_XF86Suspend },
-    { "XF86Switch_VT_1", XKB_KEY_XF86Switch_VT_1 },
-    { "XF86Switch_VT_10", XKB_KEY_XF86Switch_VT_10 },
-    { "XF86Switch_VT_11", XKB_KEY_XF86Switch_VT_11 },
-    { "XF86Switch_VT_12", XKB_KEY_XF86Switch_VT_12 },
-    { "XF86Switch_VT_2", XKB_KEY_XF86Switch_VT_2 },
-    { "XF86Switch_VT_3", XKB_KEY_XF86Switch_VT_3 },
-    { "XF86Switch_VT_4", XKB_KEY_XF86Switch_VT_4 },
-    { "XF86Switch_VT_5", XKB_KEY_XF86Switch_VT_5 },
-    { "XF86Switch_VT_6", XKB_KEY_XF86Switch_VT_6 },
-    { "XF86Switch_VT_7", XKB_KEY_XF86Switch_VT_7 },
-    { "XF86Switch_VT_8", XKB_KEY_XF86Switch_VT_8 },
-    { "XF86Switch_VT_9", XKB_KEY_XF86Switch_VT_9 },
-    { "XF86TaskPane", XKB_KEY_XF86TaskPane },
-    { "XF86Terminal", XKB_KEY_XF86Terminal },
-    { "XF86Time", XKB_KEY_XF86Time },
-    { "XF86ToDoList", XKB_KEY_XF86ToDoList },
-    { "XF86Tools", XKB_KEY_XF86Tools },
-    { "XF86TopMenu", XKB_KEY_XF86TopMenu },
-    { "XF86TouchpadOff", XKB_KEY_XF86TouchpadOff },
-    { "XF86TouchpadOn", XKB_KEY_XF86TouchpadOn },
-    { "XF86TouchpadToggle", XKB_KEY_XF86TouchpadToggle },
-    { "XF86Travel", XKB_KEY_XF86Travel },
-    { "XF86Ungrab", XKB_KEY_XF86Ungrab },
-    { "XF86User1KB", XKB_KEY_XF86User1KB },
-    { "XF86User2KB", XKB_KEY_XF86User2KB },
-    { "XF86UserPB", XKB_KEY_XF86UserPB },
-    { "XF86UWB", XKB_KEY_XF86UWB },
-    { "XF86VendorHome", XKB_KEY_XF86VendorHome },
-    { "XF86Video", XKB_KEY_XF86Video },
-    { "XF86View", XKB_KEY_XF86View },
-    { "XF86WakeUp", XKB_KEY_XF86WakeUp },
-    { "XF86WebCam", XKB_KEY_XF86WebCam },
-    { "XF86WheelButton", XKB_KEY_XF86WheelButton },
-    { "XF86WLAN", XKB_KEY_XF86WLAN },
-    { "XF86Word", XKB_KEY_XF86Word },
-    { "XF86WWW", XKB_KEY_XF86WWW },
-    { "XF86Xfer", XKB_KEY_XF86Xfer },
-    { "XF86Yellow", XKB_KEY_XF86Yellow },
-    { "XF86ZoomIn", XKB_KEY_XF86ZoomIn },
-    { "XF86ZoomOut", XKB_KEY_XF86ZoomOut },
-    { "Y", XKB_KEY_Y },
-    { "y", XKB_KEY_y },
-    { "Yacute", XKB_KEY_Yacute },
-    { "yacute", XKB_KEY_yacute },
-    { "Ybelowdot", XKB_KEY_Ybelowdot },
-    { "ybelowdot", XKB_KEY_ybelowdot },
-    { "Ycircumflex", XKB_KEY_Ycircumflex },
-    { "ycircumflex", XKB_KEY_ycircumflex },
-    { "ydiaeresis", XKB_KEY_ydiaeresis },
-    { "Ydiaeresis", XKB_KEY_Ydiaeresis },
-    { "yen", XKB_KEY_yen },
-    { "Ygrave", XKB_KEY_Ygrave },
-    { "ygrave", XKB_KEY_ygrave },
-    { "Yhook", XKB_KEY_Yhook },
-    { "yhook", XKB_KEY_yhook },
-    { "Ytilde", XKB_KEY_Ytilde },
-    { "ytilde", XKB_KEY_ytilde },
-    { "Z", XKB_KEY_Z },
-    { "z", XKB_KEY_z },
-    { "Zabovedot", XKB_KEY_Zabovedot },
-    { "zabovedot", XKB_KEY_zabovedot },
-    { "Zacute", XKB_KEY_Zacute },
-    { "zacute", XKB_KEY_zacute },
-    { "Zcaron", XKB_KEY_Zcaron },
-    { "zcaron", XKB_KEY_zcaron },
-    { "Zen_Koho", XKB_KEY_Zen_Koho },
-    { "Zenkaku", XKB_KEY_Zenkaku },
-    { "Zenkaku_Hankaku", XKB_KEY_Zenkaku_Hankaku },
-    { "zerosubscript", XKB_KEY_zerosubscript },
-    { "zerosuperior", XKB_KEY_zerosuperior },
-    { "Zstroke", XKB_KEY_Zstroke },
-    { "zstroke", XKB_KEY_zstroke },
+    { XKB_KEY_0, 1 },
+    { XKB_KEY_1, 3 },
+    { XKB_KEY_2, 5 },
+    { XKB_KEY_3, 7 },
+    { XKB_KEY_3270_AltCursor, 9 },
+    { XKB_KEY_3270_Attn, 24 },
+    { XKB_KEY_3270_BackTab, 34 },
+    { XKB_KEY_3270_ChangeScreen, 47 },
+    { XKB_KEY_3270_Copy, 65 },
+    { XKB_KEY_3270_CursorBlink, 75 },
+    { XKB_KEY_3270_CursorSelect, 92 },
+    { XKB_KEY_3270_DeleteWord, 110 },
+    { XKB_KEY_3270_Duplicate, 126 },
+    { XKB_KEY_3270_Enter, 141 },
+    { XKB_KEY_3270_EraseEOF, 152 },
+    { XKB_KEY_3270_EraseInput, 166 },
+    { XKB_KEY_3270_ExSelect, 182 },
+    { XKB_KEY_3270_FieldMark, 196 },
+    { XKB_KEY_3270_Ident, 211 },
+    { XKB_KEY_3270_Jump, 222 },
+    { XKB_KEY_3270_KeyClick, 232 },
+    { XKB_KEY_3270_Left2, 246 },
+    { XKB_KEY_3270_PA1, 257 },
+    { XKB_KEY_3270_PA2, 266 },
+    { XKB_KEY_3270_PA3, 275 },
+    { XKB_KEY_3270_Play, 284 },
+    { XKB_KEY_3270_PrintScreen, 294 },
+    { XKB_KEY_3270_Quit, 311 },
+    { XKB_KEY_3270_Record, 321 },
+    { XKB_KEY_3270_Reset, 333 },
+    { XKB_KEY_3270_Right2, 344 },
+    { XKB_KEY_3270_Rule, 356 },
+    { XKB_KEY_3270_Setup, 366 },
+    { XKB_KEY_3270_Test, 377 },
+    { XKB_KEY_4, 387 },
+    { XKB_KEY_5, 389 },
+    { XKB_KEY_6, 391 },
+    { XKB_KEY_7, 393 },
+    { XKB_KEY_8, 395 },
+    { XKB_KEY_9, 397 },
+    { XKB_KEY_A, 399 },
+    { XKB_KEY_a, 401 },
+    { XKB_KEY_Aacute, 403 },
+    { XKB_KEY_aacute, 410 },
+    { XKB_KEY_Abelowdot, 417 },
+    { XKB_KEY_abelowdot, 427 },
+    { XKB_KEY_abovedot, 437 },
+    { XKB_KEY_Abreve, 446 },
+    { XKB_KEY_abreve, 453 },
+    { XKB_KEY_Abreveacute, 460 },
+    { XKB_KEY_abreveacute, 472 },
+    { XKB_KEY_Abrevebelowdot, 484 },
+    { XKB_KEY_abrevebelowdot, 499 },
+    { XKB_KEY_Abrevegrave, 514 },
+    { XKB_KEY_abrevegrave, 526 },
+    { XKB_KEY_Abrevehook, 538 },
+    { XKB_KEY_abrevehook, 549 },
+    { XKB_KEY_Abrevetilde, 560 },
+    { XKB_KEY_abrevetilde, 572 },
+    { XKB_KEY_AccessX_Enable, 584 },
+    { XKB_KEY_AccessX_Feedback_Enable, 599 },
+    { XKB_KEY_Acircumflex, 623 },
+    { XKB_KEY_acircumflex, 635 },
+    { XKB_KEY_Acircumflexacute, 647 },
+    { XKB_KEY_acircumflexacute, 664 },
+    { XKB_KEY_Acircumflexbelowdot, 681 },
+    { XKB_KEY_acircumflexbelowdot, 701 },
+    { XKB_KEY_Acircumflexgrave, 721 },
+    { XKB_KEY_acircumflexgrave, 738 },
+    { XKB_KEY_Acircumflexhook, 755 },
+    { XKB_KEY_acircumflexhook, 771 },
+    { XKB_KEY_Acircumflextilde, 787 },
+    { XKB_KEY_acircumflextilde, 804 },
+    { XKB_KEY_acute, 821 },
+    { XKB_KEY_Adiaeresis, 827 },
+    { XKB_KEY_adiaeresis, 838 },
+    { XKB_KEY_AE, 849 },
+    { XKB_KEY_ae, 852 },
+    { XKB_KEY_Agrave, 855 },
+    { XKB_KEY_agrave, 862 },
+    { XKB_KEY_Ahook, 869 },
+    { XKB_KEY_ahook, 875 },
+    { XKB_KEY_Alt_L, 881 },
+    { XKB_KEY_Alt_R, 887 },
+    { XKB_KEY_Amacron, 893 },
+    { XKB_KEY_amacron, 901 },
+    { XKB_KEY_ampersand, 909 },
+    { XKB_KEY_Aogonek, 919 },
+    { XKB_KEY_aogonek, 927 },
+    { XKB_KEY_apostrophe, 935 },
+    { XKB_KEY_approxeq, 946 },
+    { XKB_KEY_approximate, 955 },
+    { XKB_KEY_Arabic_0, 967 },
+    { XKB_KEY_Arabic_1, 976 },
+    { XKB_KEY_Arabic_2, 985 },
+    { XKB_KEY_Arabic_3, 994 },
+    { XKB_KEY_Arabic_4, 1003 },
+    { XKB_KEY_Arabic_5, 1012 },
+    { XKB_KEY_Arabic_6, 1021 },
+    { XKB_KEY_Arabic_7, 1030 },
+    { XKB_KEY_Arabic_8, 1039 },
+    { XKB_KEY_Arabic_9, 1048 },
+    { XKB_KEY_Arabic_ain, 1057 },
+    { XKB_KEY_Arabic_alef, 1068 },
+    { XKB_KEY_Arabic_alefmaksura, 1080 },
+    { XKB_KEY_Arabic_beh, 1099 },
+    { XKB_KEY_Arabic_comma, 1110 },
+    { XKB_KEY_Arabic_dad, 1123 },
+    { XKB_KEY_Arabic_dal, 1134 },
+    { XKB_KEY_Arabic_damma, 1145 },
+    { XKB_KEY_Arabic_dammatan, 1158 },
+    { XKB_KEY_Arabic_ddal, 1174 },
+    { XKB_KEY_Arabic_farsi_yeh, 1186 },
+    { XKB_KEY_Arabic_fatha, 1203 },
+    { XKB_KEY_Arabic_fathatan, 1216 },
+    { XKB_KEY_Arabic_feh, 1232 },
+    { XKB_KEY_Arabic_fullstop, 1243 },
+    { XKB_KEY_Arabic_gaf, 1259 },
+    { XKB_KEY_Arabic_ghain, 1270 },
+    { XKB_KEY_Arabic_ha, 1283 },
+    { XKB_KEY_Arabic_hah, 1293 },
+    { XKB_KEY_Arabic_hamza, 1304 },
+    { XKB_KEY_Arabic_hamza_above, 1317 },
+    { XKB_KEY_Arabic_hamza_below, 1336 },
+    { XKB_KEY_Arabic_hamzaonalef, 1355 },
+    { XKB_KEY_Arabic_hamzaonwaw, 1374 },
+    { XKB_KEY_Arabic_hamzaonyeh, 1392 },
+    { XKB_KEY_Arabic_hamzaunderalef, 1410 },
+    { XKB_KEY_Arabic_heh, 1432 },
+    { XKB_KEY_Arabic_heh_doachashmee, 1443 },
+    { XKB_KEY_Arabic_heh_goal, 1466 },
+    { XKB_KEY_Arabic_jeem, 1482 },
+    { XKB_KEY_Arabic_jeh, 1494 },
+    { XKB_KEY_Arabic_kaf, 1505 },
+    { XKB_KEY_Arabic_kasra, 1516 },
+    { XKB_KEY_Arabic_kasratan, 1529 },
+    { XKB_KEY_Arabic_keheh, 1545 },
+    { XKB_KEY_Arabic_khah, 1558 },
+    { XKB_KEY_Arabic_lam, 1570 },
+    { XKB_KEY_Arabic_madda_above, 1581 },
+    { XKB_KEY_Arabic_maddaonalef, 1600 },
+    { XKB_KEY_Arabic_meem, 1619 },
+    { XKB_KEY_Arabic_noon, 1631 },
+    { XKB_KEY_Arabic_noon_ghunna, 1643 },
+    { XKB_KEY_Arabic_peh, 1662 },
+    { XKB_KEY_Arabic_percent, 1673 },
+    { XKB_KEY_Arabic_qaf, 1688 },
+    { XKB_KEY_Arabic_question_mark, 1699 },
+    { XKB_KEY_Arabic_ra, 1720 },
+    { XKB_KEY_Arabic_rreh, 1730 },
+    { XKB_KEY_Arabic_sad, 1742 },
+    { XKB_KEY_Arabic_seen, 1753 },
+    { XKB_KEY_Arabic_semicolon, 1765 },
+    { XKB_KEY_Arabic_shadda, 1782 },
+    { XKB_KEY_Arabic_sheen, 1796 },
+    { XKB_KEY_Arabic_sukun, 1809 },
+    { XKB_KEY_Arabic_superscript_alef, 1822 },
+    { XKB_KEY_Arabic_switch, 1846 },
+    { XKB_KEY_Arabic_tah, 1860 },
+    { XKB_KEY_Arabic_tatweel, 1871 },
+    { XKB_KEY_Arabic_tcheh, 1886 },
+    { XKB_KEY_Arabic_teh, 1899 },
+    { XKB_KEY_Arabic_tehmarbuta, 1910 },
+    { XKB_KEY_Arabic_thal, 1928 },
+    { XKB_KEY_Arabic_theh, 1940 },
+    { XKB_KEY_Arabic_tteh, 1952 },
+    { XKB_KEY_Arabic_veh, 1964 },
+    { XKB_KEY_Arabic_waw, 1975 },
+    { XKB_KEY_Arabic_yeh, 1986 },
+    { XKB_KEY_Arabic_yeh_baree, 1997 },
+    { XKB_KEY_Arabic_zah, 2014 },
+    { XKB_KEY_Arabic_zain, 2025 },
+    { XKB_KEY_Aring, 2037 },
+    { XKB_KEY_aring, 2043 },
+    { XKB_KEY_Armenian_accent, 2049 },
+    { XKB_KEY_Armenian_amanak, 2065 },
+    { XKB_KEY_Armenian_apostrophe, 2081 },
+    { XKB_KEY_Armenian_AT, 2101 },
+    { XKB_KEY_Armenian_at, 2113 },
+    { XKB_KEY_Armenian_AYB, 2125 },
+    { XKB_KEY_Armenian_ayb, 2138 },
+    { XKB_KEY_Armenian_BEN, 2151 },
+    { XKB_KEY_Armenian_ben, 2164 },
+    { XKB_KEY_Armenian_but, 2177 },
+    { XKB_KEY_Armenian_CHA, 2190 },
+    { XKB_KEY_Armenian_cha, 2203 },
+    { XKB_KEY_Armenian_DA, 2216 },
+    { XKB_KEY_Armenian_da, 2228 },
+    { XKB_KEY_Armenian_DZA, 2240 },
+    { XKB_KEY_Armenian_dza, 2253 },
+    { XKB_KEY_Armenian_E, 2266 },
+    { XKB_KEY_Armenian_e, 2277 },
+    { XKB_KEY_Armenian_exclam, 2288 },
+    { XKB_KEY_Armenian_FE, 2304 },
+    { XKB_KEY_Armenian_fe, 2316 },
+    { XKB_KEY_Armenian_full_stop, 2328 },
+    { XKB_KEY_Armenian_GHAT, 2347 },
+    { XKB_KEY_Armenian_ghat, 2361 },
+    { XKB_KEY_Armenian_GIM, 2375 },
+    { XKB_KEY_Armenian_gim, 2388 },
+    { XKB_KEY_Armenian_HI, 2401 },
+    { XKB_KEY_Armenian_hi, 2413 },
+    { XKB_KEY_Armenian_HO, 2425 },
+    { XKB_KEY_Armenian_ho, 2437 },
+    { XKB_KEY_Armenian_hyphen, 2449 },
+    { XKB_KEY_Armenian_INI, 2465 },
+    { XKB_KEY_Armenian_ini, 2478 },
+    { XKB_KEY_Armenian_JE, 2491 },
+    { XKB_KEY_Armenian_je, 2503 },
+    { XKB_KEY_Armenian_KE, 2515 },
+    { XKB_KEY_Armenian_ke, 2527 },
+    { XKB_KEY_Armenian_KEN, 2539 },
+    { XKB_KEY_Armenian_ken, 2552 },
+    { XKB_KEY_Armenian_KHE, 2565 },
+    { XKB_KEY_Armenian_khe, 2578 },
+    { XKB_KEY_Armenian_ligature_ew, 2591 },
+    { XKB_KEY_Armenian_LYUN, 2612 },
+    { XKB_KEY_Armenian_lyun, 2626 },
+    { XKB_KEY_Armenian_MEN, 2640 },
+    { XKB_KEY_Armenian_men, 2653 },
+    { XKB_KEY_Armenian_NU, 2666 },
+    { XKB_KEY_Armenian_nu, 2678 },
+    { XKB_KEY_Armenian_O, 2690 },
+    { XKB_KEY_Armenian_o, 2701 },
+    { XKB_KEY_Armenian_paruyk, 2712 },
+    { XKB_KEY_Armenian_PE, 2728 },
+    { XKB_KEY_Armenian_pe, 2740 },
+    { XKB_KEY_Armenian_PYUR, 2752 },
+    { XKB_KEY_Armenian_pyur, 2766 },
+    { XKB_KEY_Armenian_question, 2780 },
+    { XKB_KEY_Armenian_RA, 2798 },
+    { XKB_KEY_Armenian_ra, 2810 },
+    { XKB_KEY_Armenian_RE, 2822 },
+    { XKB_KEY_Armenian_re, 2834 },
+    { XKB_KEY_Armenian_SE, 2846 },
+    { XKB_KEY_Armenian_se, 2858 },
+    { XKB_KEY_Armenian_separation_mark, 2870 },
+    { XKB_KEY_Armenian_SHA, 2895 },
+    { XKB_KEY_Armenian_sha, 2908 },
+    { XKB_KEY_Armenian_shesht, 2921 },
+    { XKB_KEY_Armenian_TCHE, 2937 },
+    { XKB_KEY_Armenian_tche, 2951 },
+    { XKB_KEY_Armenian_TO, 2965 },
+    { XKB_KEY_Armenian_to, 2977 },
+    { XKB_KEY_Armenian_TSA, 2989 },
+    { XKB_KEY_Armenian_tsa, 3002 },
+    { XKB_KEY_Armenian_TSO, 3015 },
+    { XKB_KEY_Armenian_tso, 3028 },
+    { XKB_KEY_Armenian_TYUN, 3041 },
+    { XKB_KEY_Armenian_tyun, 3055 },
+    { XKB_KEY_Armenian_verjaket, 3069 },
+    { XKB_KEY_Armenian_VEV, 3087 },
+    { XKB_KEY_Armenian_vev, 3100 },
+    { XKB_KEY_Armenian_VO, 3113 },
+    { XKB_KEY_Armenian_vo, 3125 },
+    { XKB_KEY_Armenian_VYUN, 3137 },
+    { XKB_KEY_Armenian_vyun, 3151 },
+    { XKB_KEY_Armenian_YECH, 3165 },
+    { XKB_KEY_Armenian_yech, 3179 },
+    { XKB_KEY_Armenian_yentamna, 3193 },
+    { XKB_KEY_Armenian_ZA, 3211 },
+    { XKB_KEY_Armenian_za, 3223 },
+    { XKB_KEY_Armenian_ZHE, 3235 },
+    { XKB_KEY_Armenian_zhe, 3248 },
+    { XKB_KEY_asciicircum, 3261 },
+    { XKB_KEY_asciitilde, 3273 },
+    { XKB_KEY_asterisk, 3284 },
+    { XKB_KEY_at, 3293 },
+    { XKB_KEY_Atilde, 3296 },
+    { XKB_KEY_atilde, 3303 },
+    { XKB_KEY_AudibleBell_Enable, 3310 },
+    { XKB_KEY_B, 3329 },
+    { XKB_KEY_b, 3331 },
+    { XKB_KEY_Babovedot, 3333 },
+    { XKB_KEY_babovedot, 3343 },
+    { XKB_KEY_backslash, 3353 },
+    { XKB_KEY_BackSpace, 3363 },
+    { XKB_KEY_BackTab, 3373 },
+    { XKB_KEY_ballotcross, 3381 },
+    { XKB_KEY_bar, 3393 },
+    { XKB_KEY_because, 3397 },
+    { XKB_KEY_Begin, 3405 },
+    { XKB_KEY_blank, 3411 },
+    { XKB_KEY_block, 3417 },
+    { XKB_KEY_botintegral, 3423 },
+    { XKB_KEY_botleftparens, 3435 },
+    { XKB_KEY_botleftsqbracket, 3449 },
+    { XKB_KEY_botleftsummation, 3466 },
+    { XKB_KEY_botrightparens, 3483 },
+    { XKB_KEY_botrightsqbracket, 3498 },
+    { XKB_KEY_botrightsummation, 3516 },
+    { XKB_KEY_bott, 3534 },
+    { XKB_KEY_botvertsummationconnector, 3539 },
+    { XKB_KEY_BounceKeys_Enable, 3565 },
+    { XKB_KEY_braceleft, 3583 },
+    { XKB_KEY_braceright, 3593 },
+    { XKB_KEY_bracketleft, 3604 },
+    { XKB_KEY_bracketright, 3616 },
+    { XKB_KEY_braille_blank, 3629 },
+    { XKB_KEY_braille_dot_1, 3643 },
+    { XKB_KEY_braille_dot_10, 3657 },
+    { XKB_KEY_braille_dot_2, 3672 },
+    { XKB_KEY_braille_dot_3, 3686 },
+    { XKB_KEY_braille_dot_4, 3700 },
+    { XKB_KEY_braille_dot_5, 3714 },
+    { XKB_KEY_braille_dot_6, 3728 },
+    { XKB_KEY_braille_dot_7, 3742 },
+    { XKB_KEY_braille_dot_8, 3756 },
+    { XKB_KEY_braille_dot_9, 3770 },
+    { XKB_KEY_braille_dots_1, 3784 },
+    { XKB_KEY_braille_dots_12, 3799 },
+    { XKB_KEY_braille_dots_123, 3815 },
+    { XKB_KEY_braille_dots_1234, 3832 },
+    { XKB_KEY_braille_dots_12345, 3850 },
+    { XKB_KEY_braille_dots_123456, 3869 },
+    { XKB_KEY_braille_dots_1234567, 3889 },
+    { XKB_KEY_braille_dots_12345678, 3910 },
+    { XKB_KEY_braille_dots_1234568, 3932 },
+    { XKB_KEY_braille_dots_123457, 3953 },
+    { XKB_KEY_braille_dots_1234578, 3973 },
+    { XKB_KEY_braille_dots_123458, 3994 },
+    { XKB_KEY_braille_dots_12346, 4014 },
+    { XKB_KEY_braille_dots_123467, 4033 },
+    { XKB_KEY_braille_dots_1234678, 4053 },
+    { XKB_KEY_braille_dots_123468, 4074 },
+    { XKB_KEY_braille_dots_12347, 4094 },
+    { XKB_KEY_braille_dots_123478, 4113 },
+    { XKB_KEY_braille_dots_12348, 4133 },
+    { XKB_KEY_braille_dots_1235, 4152 },
+    { XKB_KEY_braille_dots_12356, 4170 },
+    { XKB_KEY_braille_dots_123567, 4189 },
+    { XKB_KEY_braille_dots_1235678, 4209 },
+    { XKB_KEY_braille_dots_123568, 4230 },
+    { XKB_KEY_braille_dots_12357, 4250 },
+    { XKB_KEY_braille_dots_123578, 4269 },
+    { XKB_KEY_braille_dots_12358, 4289 },
+    { XKB_KEY_braille_dots_1236, 4308 },
+    { XKB_KEY_braille_dots_12367, 4326 },
+    { XKB_KEY_braille_dots_123678, 4345 },
+    { XKB_KEY_braille_dots_12368, 4365 },
+    { XKB_KEY_braille_dots_1237, 4384 },
+    { XKB_KEY_braille_dots_12378, 4402 },
+    { XKB_KEY_braille_dots_1238, 4421 },
+    { XKB_KEY_braille_dots_124, 4439 },
+    { XKB_KEY_braille_dots_1245, 4456 },
+    { XKB_KEY_braille_dots_12456, 4474 },
+    { XKB_KEY_braille_dots_124567, 4493 },
+    { XKB_KEY_braille_dots_1245678, 4513 },
+    { XKB_KEY_braille_dots_124568, 4534 },
+    { XKB_KEY_braille_dots_12457, 4554 },
+    { XKB_KEY_braille_dots_124578, 4573 },
+    { XKB_KEY_braille_dots_12458, 4593 },
+    { XKB_KEY_braille_dots_1246, 4612 },
+    { XKB_KEY_braille_dots_12467, 4630 },
+    { XKB_KEY_braille_dots_124678, 4649 },
+    { XKB_KEY_braille_dots_12468, 4669 },
+    { XKB_KEY_braille_dots_1247, 4688 },
+    { XKB_KEY_braille_dots_12478, 4706 },
+    { XKB_KEY_braille_dots_1248, 4725 },
+    { XKB_KEY_braille_dots_125, 4743 },
+    { XKB_KEY_braille_dots_1256, 4760 },
+    { XKB_KEY_braille_dots_12567, 4778 },
+    { XKB_KEY_braille_dots_125678, 4797 },
+    { XKB_KEY_braille_dots_12568, 4817 },
+    { XKB_KEY_braille_dots_1257, 4836 },
+    { XKB_KEY_braille_dots_12578, 4854 },
+    { XKB_KEY_braille_dots_1258, 4873 },
+    { XKB_KEY_braille_dots_126, 4891 },
+    { XKB_KEY_braille_dots_1267, 4908 },
+    { XKB_KEY_braille_dots_12678, 4926 },
+    { XKB_KEY_braille_dots_1268, 4945 },
+    { XKB_KEY_braille_dots_127, 4963 },
+    { XKB_KEY_braille_dots_1278, 4980 },
+    { XKB_KEY_braille_dots_128, 4998 },
+    { XKB_KEY_braille_dots_13, 5015 },
+    { XKB_KEY_braille_dots_134, 5031 },
+    { XKB_KEY_braille_dots_1345, 5048 },
+    { XKB_KEY_braille_dots_13456, 5066 },
+    { XKB_KEY_braille_dots_134567, 5085 },
+    { XKB_KEY_braille_dots_1345678, 5105 },
+    { XKB_KEY_braille_dots_134568, 5126 },
+    { XKB_KEY_braille_dots_13457, 5146 },
+    { XKB_KEY_braille_dots_134578, 5165 },
+    { XKB_KEY_braille_dots_13458, 5185 },
+    { XKB_KEY_braille_dots_1346, 5204 },
+    { XKB_KEY_braille_dots_13467, 5222 },
+    { XKB_KEY_braille_dots_134678, 5241 },
+    { XKB_KEY_braille_dots_13468, 5261 },
+    { XKB_KEY_braille_dots_1347, 5280 },
+    { XKB_KEY_braille_dots_13478, 5298 },
+    { XKB_KEY_braille_dots_1348, 5317 },
+    { XKB_KEY_braille_dots_135, 5335 },
+    { XKB_KEY_braille_dots_1356, 5352 },
+    { XKB_KEY_braille_dots_13567, 5370 },
+    { XKB_KEY_braille_dots_135678, 5389 },
+    { XKB_KEY_braille_dots_13568, 5409 },
+    { XKB_KEY_braille_dots_1357, 5428 },
+    { XKB_KEY_braille_dots_13578, 5446 },
+    { XKB_KEY_braille_dots_1358, 5465 },
+    { XKB_KEY_braille_dots_136, 5483 },
+    { XKB_KEY_braille_dots_1367, 5500 },
+    { XKB_KEY_braille_dots_13678, 5518 },
+    { XKB_KEY_braille_dots_1368, 5537 },
+    { XKB_KEY_braille_dots_137, 5555 },
+    { XKB_KEY_braille_dots_1378, 5572 },
+    { XKB_KEY_braille_dots_138, 5590 },
+    { XKB_KEY_braille_dots_14, 5607 },
+    { XKB_KEY_braille_dots_145, 5623 },
+    { XKB_KEY_braille_dots_1456, 5640 },
+    { XKB_KEY_braille_dots_14567, 5658 },
+    { XKB_KEY_braille_dots_145678, 5677 },
+    { XKB_KEY_braille_dots_14568, 5697 },
+    { XKB_KEY_braille_dots_1457, 5716 },
+    { XKB_KEY_braille_dots_14578, 5734 },
+    { XKB_KEY_braille_dots_1458, 5753 },
+    { XKB_KEY_braille_dots_146, 5771 },
+    { XKB_KEY_braille_dots_1467, 5788 },
+    { XKB_KEY_braille_dots_14678, 5806 },
+    { XKB_KEY_braille_dots_1468, 5825 },
+    { XKB_KEY_braille_dots_147, 5843 },
+    { XKB_KEY_braille_dots_1478, 5860 },
+    { XKB_KEY_braille_dots_148, 5878 },
+    { XKB_KEY_braille_dots_15, 5895 },
+    { XKB_KEY_braille_dots_156, 5911 },
+    { XKB_KEY_braille_dots_1567, 5928 },
+    { XKB_KEY_braille_dots_15678, 5946 },
+    { XKB_KEY_braille_dots_1568, 5965 },
+    { XKB_KEY_braille_dots_157, 5983 },
+    { XKB_KEY_braille_dots_1578, 6000 },
+    { XKB_KEY_braille_dots_158, 6018 },
+    { XKB_KEY_braille_dots_16, 6035 },
+    { XKB_KEY_braille_dots_167, 6051 },
+    { XKB_KEY_braille_dots_1678, 6068 },
+    { XKB_KEY_braille_dots_168, 6086 },
+    { XKB_KEY_braille_dots_17, 6103 },
+    { XKB_KEY_braille_dots_178, 6119 },
+    { XKB_KEY_braille_dots_18, 6136 },
+    { XKB_KEY_braille_dots_2, 6152 },
+    { XKB_KEY_braille_dots_23, 6167 },
+    { XKB_KEY_braille_dots_234, 6183 },
+    { XKB_KEY_braille_dots_2345, 6200 },
+    { XKB_KEY_braille_dots_23456, 6218 },
+    { XKB_KEY_braille_dots_234567, 6237 },
+    { XKB_KEY_braille_dots_2345678, 6257 },
+    { XKB_KEY_braille_dots_234568, 6278 },
+    { XKB_KEY_braille_dots_23457, 6298 },
+    { XKB_KEY_braille_dots_234578, 6317 },
+    { XKB_KEY_braille_dots_23458, 6337 },
+    { XKB_KEY_braille_dots_2346, 6356 },
+    { XKB_KEY_braille_dots_23467, 6374 },
+    { XKB_KEY_braille_dots_234678, 6393 },
+    { XKB_KEY_braille_dots_23468, 6413 },
+    { XKB_KEY_braille_dots_2347, 6432 },
+    { XKB_KEY_braille_dots_23478, 6450 },
+    { XKB_KEY_braille_dots_2348, 6469 },
+    { XKB_KEY_braille_dots_235, 6487 },
+    { XKB_KEY_braille_dots_2356, 6504 },
+    { XKB_KEY_braille_dots_23567, 6522 },
+    { XKB_KEY_braille_dots_235678, 6541 },
+    { XKB_KEY_braille_dots_23568, 6561 },
+    { XKB_KEY_braille_dots_2357, 6580 },
+    { XKB_KEY_braille_dots_23578, 6598 },
+    { XKB_KEY_braille_dots_2358, 6617 },
+    { XKB_KEY_braille_dots_236, 6635 },
+    { XKB_KEY_braille_dots_2367, 6652 },
+    { XKB_KEY_braille_dots_23678, 6670 },
+    { XKB_KEY_braille_dots_2368, 6689 },
+    { XKB_KEY_braille_dots_237, 6707 },
+    { XKB_KEY_braille_dots_2378, 6724 },
+    { XKB_KEY_braille_dots_238, 6742 },
+    { XKB_KEY_braille_dots_24, 6759 },
+    { XKB_KEY_braille_dots_245, 6775 },
+    { XKB_KEY_braille_dots_2456, 6792 },
+    { XKB_KEY_braille_dots_24567, 6810 },
+    { XKB_KEY_braille_dots_245678, 6829 },
+    { XKB_KEY_braille_dots_24568, 6849 },
+    { XKB_KEY_braille_dots_2457, 6868 },
+    { XKB_KEY_braille_dots_24578, 6886 },
+    { XKB_KEY_braille_dots_2458, 6905 },
+    { XKB_KEY_braille_dots_246, 6923 },
+    { XKB_KEY_braille_dots_2467, 6940 },
+    { XKB_KEY_braille_dots_24678, 6958 },
+    { XKB_KEY_braille_dots_2468, 6977 },
+    { XKB_KEY_braille_dots_247, 6995 },
+    { XKB_KEY_braille_dots_2478, 7012 },
+    { XKB_KEY_braille_dots_248, 7030 },
+    { XKB_KEY_braille_dots_25, 7047 },
+    { XKB_KEY_braille_dots_256, 7063 },
+    { XKB_KEY_braille_dots_2567, 7080 },
+    { XKB_KEY_braille_dots_25678, 7098 },
+    { XKB_KEY_braille_dots_2568, 7117 },
+    { XKB_KEY_braille_dots_257, 7135 },
+    { XKB_KEY_braille_dots_2578, 7152 },
+    { XKB_KEY_braille_dots_258, 7170 },
+    { XKB_KEY_braille_dots_26, 7187 },
+    { XKB_KEY_braille_dots_267, 7203 },
+    { XKB_KEY_braille_dots_2678, 7220 },
+    { XKB_KEY_braille_dots_268, 7238 },
+    { XKB_KEY_braille_dots_27, 7255 },
+    { XKB_KEY_braille_dots_278, 7271 },
+    { XKB_KEY_braille_dots_28, 7288 },
+    { XKB_KEY_braille_dots_3, 7304 },
+    { XKB_KEY_braille_dots_34, 7319 },
+    { XKB_KEY_braille_dots_345, 7335 },
+    { XKB_KEY_braille_dots_3456, 7352 },
+    { XKB_KEY_braille_dots_34567, 7370 },
+    { XKB_KEY_braille_dots_345678, 7389 },
+    { XKB_KEY_braille_dots_34568, 7409 },
+    { XKB_KEY_braille_dots_3457, 7428 },
+    { XKB_KEY_braille_dots_34578, 7446 },
+    { XKB_KEY_braille_dots_3458, 7465 },
+    { XKB_KEY_braille_dots_346, 7483 },
+    { XKB_KEY_braille_dots_3467, 7500 },
+    { XKB_KEY_braille_dots_34678, 7518 },
+    { XKB_KEY_braille_dots_3468, 7537 },
+    { XKB_KEY_braille_dots_347, 7555 },
+    { XKB_KEY_braille_dots_3478, 7572 },
+    { XKB_KEY_braille_dots_348, 7590 },
+    { XKB_KEY_braille_dots_35, 7607 },
+    { XKB_KEY_braille_dots_356, 7623 },
+    { XKB_KEY_braille_dots_3567, 7640 },
+    { XKB_KEY_braille_dots_35678, 7658 },
+    { XKB_KEY_braille_dots_3568, 7677 },
+    { XKB_KEY_braille_dots_357, 7695 },
+    { XKB_KEY_braille_dots_3578, 7712 },
+    { XKB_KEY_braille_dots_358, 7730 },
+    { XKB_KEY_braille_dots_36, 7747 },
+    { XKB_KEY_braille_dots_367, 7763 },
+    { XKB_KEY_braille_dots_3678, 7780 },
+    { XKB_KEY_braille_dots_368, 7798 },
+    { XKB_KEY_braille_dots_37, 7815 },
+    { XKB_KEY_braille_dots_378, 7831 },
+    { XKB_KEY_braille_dots_38, 7848 },
+    { XKB_KEY_braille_dots_4, 7864 },
+    { XKB_KEY_braille_dots_45, 7879 },
+    { XKB_KEY_braille_dots_456, 7895 },
+    { XKB_KEY_braille_dots_4567, 7912 },
+    { XKB_KEY_braille_dots_45678, 7930 },
+    { XKB_KEY_braille_dots_4568, 7949 },
+    { XKB_KEY_braille_dots_457, 7967 },
+    { XKB_KEY_braille_dots_4578, 7984 },
+    { XKB_KEY_braille_dots_458, 8002 },
+    { XKB_KEY_braille_dots_46, 8019 },
+    { XKB_KEY_braille_dots_467, 8035 },
+    { XKB_KEY_braille_dots_4678, 8052 },
+    { XKB_KEY_braille_dots_468, 8070 },
+    { XKB_KEY_braille_dots_47, 8087 },
+    { XKB_KEY_braille_dots_478, 8103 },
+    { XKB_KEY_braille_dots_48, 8120 },
+    { XKB_KEY_braille_dots_5, 8136 },
+    { XKB_KEY_braille_dots_56, 8151 },
+    { XKB_KEY_braille_dots_567, 8167 },
+    { XKB_KEY_braille_dots_5678, 8184 },
+    { XKB_KEY_braille_dots_568, 8202 },
+    { XKB_KEY_braille_dots_57, 8219 },
+    { XKB_KEY_braille_dots_578, 8235 },
+    { XKB_KEY_braille_dots_58, 8252 },
+    { XKB_KEY_braille_dots_6, 8268 },
+    { XKB_KEY_braille_dots_67, 8283 },
+    { XKB_KEY_braille_dots_678, 8299 },
+    { XKB_KEY_braille_dots_68, 8316 },
+    { XKB_KEY_braille_dots_7, 8332 },
+    { XKB_KEY_braille_dots_78, 8347 },
+    { XKB_KEY_braille_dots_8, 8363 },
+    { XKB_KEY_Break, 8378 },
+    { XKB_KEY_breve, 8384 },
+    { XKB_KEY_brokenbar, 8390 },
+    { XKB_KEY_Byelorussian_shortu, 8400 },
+    { XKB_KEY_Byelorussian_SHORTU, 8420 },
+    { XKB_KEY_C, 8440 },
+    { XKB_KEY_c, 8442 },
+    { XKB_KEY_c_h, 8444 },
+    { XKB_KEY_C_h, 8448 },
+    { XKB_KEY_C_H, 8452 },
+    { XKB_KEY_Cabovedot, 8456 },
+    { XKB_KEY_cabovedot, 8466 },
+    { XKB_KEY_Cacute, 8476 },
+    { XKB_KEY_cacute, 8483 },
+    { XKB_KEY_Cancel, 8490 },
+    { XKB_KEY_Caps_Lock, 8497 },
+    { XKB_KEY_careof, 8507 },
+    { XKB_KEY_caret, 8514 },
+    { XKB_KEY_caron, 8520 },
+    { XKB_KEY_Ccaron, 8526 },
+    { XKB_KEY_ccaron, 8533 },
+    { XKB_KEY_Ccedilla, 8540 },
+    { XKB_KEY_ccedilla, 8549 },
+    { XKB_KEY_Ccircumflex, 8558 },
+    { XKB_KEY_ccircumflex, 8570 },
+    { XKB_KEY_cedilla, 8582 },
+    { XKB_KEY_cent, 8590 },
+    { XKB_KEY_ch, 8595 },
+    { XKB_KEY_Ch, 8598 },
+    { XKB_KEY_CH, 8601 },
+    { XKB_KEY_checkerboard, 8604 },
+    { XKB_KEY_checkmark, 8617 },
+    { XKB_KEY_circle, 8627 },
+    { XKB_KEY_Clear, 8634 },
+    { XKB_KEY_ClearLine, 8640 },
+    { XKB_KEY_club, 8650 },
+    { XKB_KEY_Codeinput, 8655 },
+    { XKB_KEY_colon, 8665 },
+    { XKB_KEY_ColonSign, 8671 },
+    { XKB_KEY_comma, 8681 },
+    { XKB_KEY_containsas, 8687 },
+    { XKB_KEY_Control_L, 8698 },
+    { XKB_KEY_Control_R, 8708 },
+    { XKB_KEY_copyright, 8718 },
+    { XKB_KEY_cr, 8728 },
+    { XKB_KEY_crossinglines, 8731 },
+    { XKB_KEY_CruzeiroSign, 8745 },
+    { XKB_KEY_cuberoot, 8758 },
+    { XKB_KEY_currency, 8767 },
+    { XKB_KEY_cursor, 8776 },
+    { XKB_KEY_Cyrillic_a, 8783 },
+    { XKB_KEY_Cyrillic_A, 8794 },
+    { XKB_KEY_Cyrillic_be, 8805 },
+    { XKB_KEY_Cyrillic_BE, 8817 },
+    { XKB_KEY_Cyrillic_che, 8829 },
+    { XKB_KEY_Cyrillic_CHE, 8842 },
+    { XKB_KEY_Cyrillic_CHE_descender, 8855 },
+    { XKB_KEY_Cyrillic_che_descender, 8878 },
+    { XKB_KEY_Cyrillic_CHE_vertstroke, 8901 },
+    { XKB_KEY_Cyrillic_che_vertstroke, 8925 },
+    { XKB_KEY_Cyrillic_de, 8949 },
+    { XKB_KEY_Cyrillic_DE, 8961 },
+    { XKB_KEY_Cyrillic_dzhe, 8973 },
+    { XKB_KEY_Cyrillic_DZHE, 8987 },
+    { XKB_KEY_Cyrillic_e, 9001 },
+    { XKB_KEY_Cyrillic_E, 9012 },
+    { XKB_KEY_Cyrillic_ef, 9023 },
+    { XKB_KEY_Cyrillic_EF, 9035 },
+    { XKB_KEY_Cyrillic_el, 9047 },
+    { XKB_KEY_Cyrillic_EL, 9059 },
+    { XKB_KEY_Cyrillic_em, 9071 },
+    { XKB_KEY_Cyrillic_EM, 9083 },
+    { XKB_KEY_Cyrillic_en, 9095 },
+    { XKB_KEY_Cyrillic_EN, 9107 },
+    { XKB_KEY_Cyrillic_EN_descender, 9119 },
+    { XKB_KEY_Cyrillic_en_descender, 9141 },
+    { XKB_KEY_Cyrillic_er, 9163 },
+    { XKB_KEY_Cyrillic_ER, 9175 },
+    { XKB_KEY_Cyrillic_es, 9187 },
+    { XKB_KEY_Cyrillic_ES, 9199 },
+    { XKB_KEY_Cyrillic_ghe, 9211 },
+    { XKB_KEY_Cyrillic_GHE, 9224 },
+    { XKB_KEY_Cyrillic_GHE_bar, 9237 },
+    { XKB_KEY_Cyrillic_ghe_bar, 9254 },
+    { XKB_KEY_Cyrillic_ha, 9271 },
+    { XKB_KEY_Cyrillic_HA, 9283 },
+    { XKB_KEY_Cyrillic_HA_descender, 9295 },
+    { XKB_KEY_Cyrillic_ha_descender, 9317 },
+    { XKB_KEY_Cyrillic_hardsign, 9339 },
+    { XKB_KEY_Cyrillic_HARDSIGN, 9357 },
+    { XKB_KEY_Cyrillic_i, 9375 },
+    { XKB_KEY_Cyrillic_I, 9386 },
+    { XKB_KEY_Cyrillic_I_macron, 9397 },
+    { XKB_KEY_Cyrillic_i_macron, 9415 },
+    { XKB_KEY_Cyrillic_ie, 9433 },
+    { XKB_KEY_Cyrillic_IE, 9445 },
+    { XKB_KEY_Cyrillic_io, 9457 },
+    { XKB_KEY_Cyrillic_IO, 9469 },
+    { XKB_KEY_Cyrillic_je, 9481 },
+    { XKB_KEY_Cyrillic_JE, 9493 },
+    { XKB_KEY_Cyrillic_ka, 9505 },
+    { XKB_KEY_Cyrillic_KA, 9517 },
+    { XKB_KEY_Cyrillic_KA_descender, 9529 },
+    { XKB_KEY_Cyrillic_ka_descender, 9551 },
+    { XKB_KEY_Cyrillic_KA_vertstroke, 9573 },
+    { XKB_KEY_Cyrillic_ka_vertstroke, 9596 },
+    { XKB_KEY_Cyrillic_lje, 9619 },
+    { XKB_KEY_Cyrillic_LJE, 9632 },
+    { XKB_KEY_Cyrillic_nje, 9645 },
+    { XKB_KEY_Cyrillic_NJE, 9658 },
+    { XKB_KEY_Cyrillic_o, 9671 },
+    { XKB_KEY_Cyrillic_O, 9682 },
+    { XKB_KEY_Cyrillic_O_bar, 9693 },
+    { XKB_KEY_Cyrillic_o_bar, 9708 },
+    { XKB_KEY_Cyrillic_pe, 9723 },
+    { XKB_KEY_Cyrillic_PE, 9735 },
+    { XKB_KEY_Cyrillic_SCHWA, 9747 },
+    { XKB_KEY_Cyrillic_schwa, 9762 },
+    { XKB_KEY_Cyrillic_sha, 9777 },
+    { XKB_KEY_Cyrillic_SHA, 9790 },
+    { XKB_KEY_Cyrillic_shcha, 9803 },
+    { XKB_KEY_Cyrillic_SHCHA, 9818 },
+    { XKB_KEY_Cyrillic_SHHA, 9833 },
+    { XKB_KEY_Cyrillic_shha, 9847 },
+    { XKB_KEY_Cyrillic_shorti, 9861 },
+    { XKB_KEY_Cyrillic_SHORTI, 9877 },
+    { XKB_KEY_Cyrillic_softsign, 9893 },
+    { XKB_KEY_Cyrillic_SOFTSIGN, 9911 },
+    { XKB_KEY_Cyrillic_te, 9929 },
+    { XKB_KEY_Cyrillic_TE, 9941 },
+    { XKB_KEY_Cyrillic_tse, 9953 },
+    { XKB_KEY_Cyrillic_TSE, 9966 },
+    { XKB_KEY_Cyrillic_u, 9979 },
+    { XKB_KEY_Cyrillic_U, 9990 },
+    { XKB_KEY_Cyrillic_U_macron, 10001 },
+    { XKB_KEY_Cyrillic_u_macron, 10019 },
+    { XKB_KEY_Cyrillic_U_straight, 10037 },
+    { XKB_KEY_Cyrillic_u_straight, 10057 },
+    { XKB_KEY_Cyrillic_U_straight_bar, 10077 },
+    { XKB_KEY_Cyrillic_u_straight_bar, 10101 },
+    { XKB_KEY_Cyrillic_ve, 10125 },
+    { XKB_KEY_Cyrillic_VE, 10137 },
+    { XKB_KEY_Cyrillic_ya, 10149 },
+    { XKB_KEY_Cyrillic_YA, 10161 },
+    { XKB_KEY_Cyrillic_yeru, 10173 },
+    { XKB_KEY_Cyrillic_YERU, 10187 },
+    { XKB_KEY_Cyrillic_yu, 10201 },
+    { XKB_KEY_Cyrillic_YU, 10213 },
+    { XKB_KEY_Cyrillic_ze, 10225 },
+    { XKB_KEY_Cyrillic_ZE, 10237 },
+    { XKB_KEY_Cyrillic_zhe, 10249 },
+    { XKB_KEY_Cyrillic_ZHE, 10262 },
+    { XKB_KEY_Cyrillic_ZHE_descender, 10275 },
+    { XKB_KEY_Cyrillic_zhe_descender, 10298 },
+    { XKB_KEY_D, 10321 },
+    { XKB_KEY_d, 10323 },
+    { XKB_KEY_Dabovedot, 10325 },
+    { XKB_KEY_dabovedot, 10335 },
+    { XKB_KEY_Dacute_accent, 10345 },
+    { XKB_KEY_dagger, 10359 },
+    { XKB_KEY_Dcaron, 10366 },
+    { XKB_KEY_dcaron, 10373 },
+    { XKB_KEY_Dcedilla_accent, 10380 },
+    { XKB_KEY_Dcircumflex_accent, 10396 },
+    { XKB_KEY_Ddiaeresis, 10415 },
+    { XKB_KEY_dead_a, 10426 },
+    { XKB_KEY_dead_A, 10433 },
+    { XKB_KEY_dead_abovecomma, 10440 },
+    { XKB_KEY_dead_abovedot, 10456 },
+    { XKB_KEY_dead_abovereversedcomma, 10470 },
+    { XKB_KEY_dead_abovering, 10494 },
+    { XKB_KEY_dead_acute, 10509 },
+    { XKB_KEY_dead_belowbreve, 10520 },
+    { XKB_KEY_dead_belowcircumflex, 10536 },
+    { XKB_KEY_dead_belowcomma, 10557 },
+    { XKB_KEY_dead_belowdiaeresis, 10573 },
+    { XKB_KEY_dead_belowdot, 10593 },
+    { XKB_KEY_dead_belowmacron, 10607 },
+    { XKB_KEY_dead_belowring, 10624 },
+    { XKB_KEY_dead_belowtilde, 10639 },
+    { XKB_KEY_dead_breve, 10655 },
+    { XKB_KEY_dead_capital_schwa, 10666 },
+    { XKB_KEY_dead_caron, 10685 },
+    { XKB_KEY_dead_cedilla, 10696 },
+    { XKB_KEY_dead_circumflex, 10709 },
+    { XKB_KEY_dead_currency, 10725 },
+    { XKB_KEY_dead_dasia, 10739 },
+    { XKB_KEY_dead_diaeresis, 10750 },
+    { XKB_KEY_dead_doubleacute, 10765 },
+    { XKB_KEY_dead_doublegrave, 10782 },
+    { XKB_KEY_dead_e, 10799 },
+    { XKB_KEY_dead_E, 10806 },
+    { XKB_KEY_dead_grave, 10813 },
+    { XKB_KEY_dead_greek, 10824 },
+    { XKB_KEY_dead_hook, 10835 },
+    { XKB_KEY_dead_horn, 10845 },
+    { XKB_KEY_dead_i, 10855 },
+    { XKB_KEY_dead_I, 10862 },
+    { XKB_KEY_dead_invertedbreve, 10869 },
+    { XKB_KEY_dead_iota, 10888 },
+    { XKB_KEY_dead_macron, 10898 },
+    { XKB_KEY_dead_o, 10910 },
+    { XKB_KEY_dead_O, 10917 },
+    { XKB_KEY_dead_ogonek, 10924 },
+    { XKB_KEY_dead_perispomeni, 10936 },
+    { XKB_KEY_dead_psili, 10953 },
+    { XKB_KEY_dead_semivoiced_sound, 10964 },
+    { XKB_KEY_dead_small_schwa, 10986 },
+    { XKB_KEY_dead_stroke, 11003 },
+    { XKB_KEY_dead_tilde, 11015 },
+    { XKB_KEY_dead_u, 11026 },
+    { XKB_KEY_dead_U, 11033 },
+    { XKB_KEY_dead_voiced_sound, 11040 },
+    { XKB_KEY_decimalpoint, 11058 },
+    { XKB_KEY_degree, 11071 },
+    { XKB_KEY_Delete, 11078 },
+    { XKB_KEY_DeleteChar, 11085 },
+    { XKB_KEY_DeleteLine, 11096 },
+    { XKB_KEY_Dgrave_accent, 11107 },
+    { XKB_KEY_diaeresis, 11121 },
+    { XKB_KEY_diamond, 11131 },
+    { XKB_KEY_digitspace, 11139 },
+    { XKB_KEY_dintegral, 11150 },
+    { XKB_KEY_division, 11160 },
+    { XKB_KEY_dollar, 11169 },
+    { XKB_KEY_DongSign, 11176 },
+    { XKB_KEY_doubbaselinedot, 11185 },
+    { XKB_KEY_doubleacute, 11201 },
+    { XKB_KEY_doubledagger, 11213 },
+    { XKB_KEY_doublelowquotemark, 11226 },
+    { XKB_KEY_Down, 11245 },
+    { XKB_KEY_downarrow, 11250 },
+    { XKB_KEY_downcaret, 11260 },
+    { XKB_KEY_downshoe, 11270 },
+    { XKB_KEY_downstile, 11279 },
+    { XKB_KEY_downtack, 11289 },
+    { XKB_KEY_DRemove, 11298 },
+    { XKB_KEY_Dring_accent, 11306 },
+    { XKB_KEY_Dstroke, 11319 },
+    { XKB_KEY_dstroke, 11327 },
+    { XKB_KEY_Dtilde, 11335 },
+    { XKB_KEY_E, 11342 },
+    { XKB_KEY_e, 11344 },
+    { XKB_KEY_Eabovedot, 11346 },
+    { XKB_KEY_eabovedot, 11356 },
+    { XKB_KEY_Eacute, 11366 },
+    { XKB_KEY_eacute, 11373 },
+    { XKB_KEY_Ebelowdot, 11380 },
+    { XKB_KEY_ebelowdot, 11390 },
+    { XKB_KEY_Ecaron, 11400 },
+    { XKB_KEY_ecaron, 11407 },
+    { XKB_KEY_Ecircumflex, 11414 },
+    { XKB_KEY_ecircumflex, 11426 },
+    { XKB_KEY_Ecircumflexacute, 11438 },
+    { XKB_KEY_ecircumflexacute, 11455 },
+    { XKB_KEY_Ecircumflexbelowdot, 11472 },
+    { XKB_KEY_ecircumflexbelowdot, 11492 },
+    { XKB_KEY_Ecircumflexgrave, 11512 },
+    { XKB_KEY_ecircumflexgrave, 11529 },
+    { XKB_KEY_Ecircumflexhook, 11546 },
+    { XKB_KEY_ecircumflexhook, 11562 },
+    { XKB_KEY_Ecircumflextilde, 11578 },
+    { XKB_KEY_ecircumflextilde, 11595 },
+    { XKB_KEY_EcuSign, 11612 },
+    { XKB_KEY_Ediaeresis, 11620 },
+    { XKB_KEY_ediaeresis, 11631 },
+    { XKB_KEY_Egrave, 11642 },
+    { XKB_KEY_egrave, 11649 },
+    { XKB_KEY_Ehook, 11656 },
+    { XKB_KEY_ehook, 11662 },
+    { XKB_KEY_eightsubscript, 11668 },
+    { XKB_KEY_eightsuperior, 11683 },
+    { XKB_KEY_Eisu_Shift, 11697 },
+    { XKB_KEY_Eisu_toggle, 11708 },
+    { XKB_KEY_elementof, 11720 },
+    { XKB_KEY_ellipsis, 11730 },
+    { XKB_KEY_em3space, 11739 },
+    { XKB_KEY_em4space, 11748 },
+    { XKB_KEY_Emacron, 11757 },
+    { XKB_KEY_emacron, 11765 },
+    { XKB_KEY_emdash, 11773 },
+    { XKB_KEY_emfilledcircle, 11780 },
+    { XKB_KEY_emfilledrect, 11795 },
+    { XKB_KEY_emopencircle, 11808 },
+    { XKB_KEY_emopenrectangle, 11821 },
+    { XKB_KEY_emptyset, 11837 },
+    { XKB_KEY_emspace, 11846 },
+    { XKB_KEY_End, 11854 },
+    { XKB_KEY_endash, 11858 },
+    { XKB_KEY_enfilledcircbullet, 11865 },
+    { XKB_KEY_enfilledsqbullet, 11884 },
+    { XKB_KEY_ENG, 11901 },
+    { XKB_KEY_eng, 11905 },
+    { XKB_KEY_enopencircbullet, 11909 },
+    { XKB_KEY_enopensquarebullet, 11926 },
+    { XKB_KEY_enspace, 11945 },
+    { XKB_KEY_Eogonek, 11953 },
+    { XKB_KEY_eogonek, 11961 },
+    { XKB_KEY_equal, 11969 },
+    { XKB_KEY_Escape, 11975 },
+    { XKB_KEY_ETH, 11982 },
+    { XKB_KEY_Eth, 11986 },
+    { XKB_KEY_eth, 11990 },
+    { XKB_KEY_Etilde, 11994 },
+    { XKB_KEY_etilde, 12001 },
+    { XKB_KEY_EuroSign, 12008 },
+    { XKB_KEY_exclam, 12017 },
+    { XKB_KEY_exclamdown, 12024 },
+    { XKB_KEY_Execute, 12035 },
+    { XKB_KEY_Ext16bit_L, 12043 },
+    { XKB_KEY_Ext16bit_R, 12054 },
+    { XKB_KEY_EZH, 12065 },
+    { XKB_KEY_ezh, 12069 },
+    { XKB_KEY_F, 12073 },
+    { XKB_KEY_f, 12075 },
+    { XKB_KEY_F1, 12077 },
+    { XKB_KEY_F10, 12080 },
+    { XKB_KEY_F11, 12084 },
+    { XKB_KEY_F12, 12088 },
+    { XKB_KEY_F13, 12092 },
+    { XKB_KEY_F14, 12096 },
+    { XKB_KEY_F15, 12100 },
+    { XKB_KEY_F16, 12104 },
+    { XKB_KEY_F17, 12108 },
+    { XKB_KEY_F18, 12112 },
+    { XKB_KEY_F19, 12116 },
+    { XKB_KEY_F2, 12120 },
+    { XKB_KEY_F20, 12123 },
+    { XKB_KEY_F21, 12127 },
+    { XKB_KEY_F22, 12131 },
+    { XKB_KEY_F23, 12135 },
+    { XKB_KEY_F24, 12139 },
+    { XKB_KEY_F25, 12143 },
+    { XKB_KEY_F26, 12147 },
+    { XKB_KEY_F27, 12151 },
+    { XKB_KEY_F28, 12155 },
+    { XKB_KEY_F29, 12159 },
+    { XKB_KEY_F3, 12163 },
+    { XKB_KEY_F30, 12166 },
+    { XKB_KEY_F31, 12170 },
+    { XKB_KEY_F32, 12174 },
+    { XKB_KEY_F33, 12178 },
+    { XKB_KEY_F34, 12182 },
+    { XKB_KEY_F35, 12186 },
+    { XKB_KEY_F4, 12190 },
+    { XKB_KEY_F5, 12193 },
+    { XKB_KEY_F6, 12196 },
+    { XKB_KEY_F7, 12199 },
+    { XKB_KEY_F8, 12202 },
+    { XKB_KEY_F9, 12205 },
+    { XKB_KEY_Fabovedot, 12208 },
+    { XKB_KEY_fabovedot, 12218 },
+    { XKB_KEY_Farsi_0, 12228 },
+    { XKB_KEY_Farsi_1, 12236 },
+    { XKB_KEY_Farsi_2, 12244 },
+    { XKB_KEY_Farsi_3, 12252 },
+    { XKB_KEY_Farsi_4, 12260 },
+    { XKB_KEY_Farsi_5, 12268 },
+    { XKB_KEY_Farsi_6, 12276 },
+    { XKB_KEY_Farsi_7, 12284 },
+    { XKB_KEY_Farsi_8, 12292 },
+    { XKB_KEY_Farsi_9, 12300 },
+    { XKB_KEY_Farsi_yeh, 12308 },
+    { XKB_KEY_femalesymbol, 12318 },
+    { XKB_KEY_ff, 12331 },
+    { XKB_KEY_FFrancSign, 12334 },
+    { XKB_KEY_figdash, 12345 },
+    { XKB_KEY_filledlefttribullet, 12353 },
+    { XKB_KEY_filledrectbullet, 12373 },
+    { XKB_KEY_filledrighttribullet, 12390 },
+    { XKB_KEY_filledtribulletdown, 12411 },
+    { XKB_KEY_filledtribulletup, 12431 },
+    { XKB_KEY_Find, 12449 },
+    { XKB_KEY_First_Virtual_Screen, 12454 },
+    { XKB_KEY_fiveeighths, 12475 },
+    { XKB_KEY_fivesixths, 12487 },
+    { XKB_KEY_fivesubscript, 12498 },
+    { XKB_KEY_fivesuperior, 12512 },
+    { XKB_KEY_fourfifths, 12525 },
+    { XKB_KEY_foursubscript, 12536 },
+    { XKB_KEY_foursuperior, 12550 },
+    { XKB_KEY_fourthroot, 12563 },
+    { XKB_KEY_function, 12574 },
+    { XKB_KEY_G, 12583 },
+    { XKB_KEY_g, 12585 },
+    { XKB_KEY_Gabovedot, 12587 },
+    { XKB_KEY_gabovedot, 12597 },
+    { XKB_KEY_Gbreve, 12607 },
+    { XKB_KEY_gbreve, 12614 },
+    { XKB_KEY_Gcaron, 12621 },
+    { XKB_KEY_gcaron, 12628 },
+    { XKB_KEY_Gcedilla, 12635 },
+    { XKB_KEY_gcedilla, 12644 },
+    { XKB_KEY_Gcircumflex, 12653 },
+    { XKB_KEY_gcircumflex, 12665 },
+    { XKB_KEY_Georgian_an, 12677 },
+    { XKB_KEY_Georgian_ban, 12689 },
+    { XKB_KEY_Georgian_can, 12702 },
+    { XKB_KEY_Georgian_char, 12715 },
+    { XKB_KEY_Georgian_chin, 12729 },
+    { XKB_KEY_Georgian_cil, 12743 },
+    { XKB_KEY_Georgian_don, 12756 },
+    { XKB_KEY_Georgian_en, 12769 },
+    { XKB_KEY_Georgian_fi, 12781 },
+    { XKB_KEY_Georgian_gan, 12793 },
+    { XKB_KEY_Georgian_ghan, 12806 },
+    { XKB_KEY_Georgian_hae, 12820 },
+    { XKB_KEY_Georgian_har, 12833 },
+    { XKB_KEY_Georgian_he, 12846 },
+    { XKB_KEY_Georgian_hie, 12858 },
+    { XKB_KEY_Georgian_hoe, 12871 },
+    { XKB_KEY_Georgian_in, 12884 },
+    { XKB_KEY_Georgian_jhan, 12896 },
+    { XKB_KEY_Georgian_jil, 12910 },
+    { XKB_KEY_Georgian_kan, 12923 },
+    { XKB_KEY_Georgian_khar, 12936 },
+    { XKB_KEY_Georgian_las, 12950 },
+    { XKB_KEY_Georgian_man, 12963 },
+    { XKB_KEY_Georgian_nar, 12976 },
+    { XKB_KEY_Georgian_on, 12989 },
+    { XKB_KEY_Georgian_par, 13001 },
+    { XKB_KEY_Georgian_phar, 13014 },
+    { XKB_KEY_Georgian_qar, 13028 },
+    { XKB_KEY_Georgian_rae, 13041 },
+    { XKB_KEY_Georgian_san, 13054 },
+    { XKB_KEY_Georgian_shin, 13067 },
+    { XKB_KEY_Georgian_tan, 13081 },
+    { XKB_KEY_Georgian_tar, 13094 },
+    { XKB_KEY_Georgian_un, 13107 },
+    { XKB_KEY_Georgian_vin, 13119 },
+    { XKB_KEY_Georgian_we, 13132 },
+    { XKB_KEY_Georgian_xan, 13144 },
+    { XKB_KEY_Georgian_zen, 13157 },
+    { XKB_KEY_Georgian_zhar, 13170 },
+    { XKB_KEY_grave, 13184 },
+    { XKB_KEY_greater, 13190 },
+    { XKB_KEY_greaterthanequal, 13198 },
+    { XKB_KEY_Greek_accentdieresis, 13215 },
+    { XKB_KEY_Greek_ALPHA, 13236 },
+    { XKB_KEY_Greek_alpha, 13248 },
+    { XKB_KEY_Greek_ALPHAaccent, 13260 },
+    { XKB_KEY_Greek_alphaaccent, 13278 },
+    { XKB_KEY_Greek_BETA, 13296 },
+    { XKB_KEY_Greek_beta, 13307 },
+    { XKB_KEY_Greek_CHI, 13318 },
+    { XKB_KEY_Greek_chi, 13328 },
+    { XKB_KEY_Greek_DELTA, 13338 },
+    { XKB_KEY_Greek_delta, 13350 },
+    { XKB_KEY_Greek_EPSILON, 13362 },
+    { XKB_KEY_Greek_epsilon, 13376 },
+    { XKB_KEY_Greek_EPSILONaccent, 13390 },
+    { XKB_KEY_Greek_epsilonaccent, 13410 },
+    { XKB_KEY_Greek_ETA, 13430 },
+    { XKB_KEY_Greek_eta, 13440 },
+    { XKB_KEY_Greek_ETAaccent, 13450 },
+    { XKB_KEY_Greek_etaaccent, 13466 },
+    { XKB_KEY_Greek_finalsmallsigma, 13482 },
+    { XKB_KEY_Greek_GAMMA, 13504 },
+    { XKB_KEY_Greek_gamma, 13516 },
+    { XKB_KEY_Greek_horizbar, 13528 },
+    { XKB_KEY_Greek_IOTA, 13543 },
+    { XKB_KEY_Greek_iota, 13554 },
+    { XKB_KEY_Greek_IOTAaccent, 13565 },
+    { XKB_KEY_Greek_iotaaccent, 13582 },
+    { XKB_KEY_Greek_iotaaccentdieresis, 13599 },
+    { XKB_KEY_Greek_IOTAdiaeresis, 13624 },
+    { XKB_KEY_Greek_IOTAdieresis, 13644 },
+    { XKB_KEY_Greek_iotadieresis, 13663 },
+    { XKB_KEY_Greek_KAPPA, 13682 },
+    { XKB_KEY_Greek_kappa, 13694 },
+    { XKB_KEY_Greek_LAMBDA, 13706 },
+    { XKB_KEY_Greek_lambda, 13719 },
+    { XKB_KEY_Greek_LAMDA, 13732 },
+    { XKB_KEY_Greek_lamda, 13744 },
+    { XKB_KEY_Greek_MU, 13756 },
+    { XKB_KEY_Greek_mu, 13765 },
+    { XKB_KEY_Greek_NU, 13774 },
+    { XKB_KEY_Greek_nu, 13783 },
+    { XKB_KEY_Greek_OMEGA, 13792 },
+    { XKB_KEY_Greek_omega, 13804 },
+    { XKB_KEY_Greek_OMEGAaccent, 13816 },
+    { XKB_KEY_Greek_omegaaccent, 13834 },
+    { XKB_KEY_Greek_OMICRON, 13852 },
+    { XKB_KEY_Greek_omicron, 13866 },
+    { XKB_KEY_Greek_OMICRONaccent, 13880 },
+    { XKB_KEY_Greek_omicronaccent, 13900 },
+    { XKB_KEY_Greek_PHI, 13920 },
+    { XKB_KEY_Greek_phi, 13930 },
+    { XKB_KEY_Greek_PI, 13940 },
+    { XKB_KEY_Greek_pi, 13949 },
+    { XKB_KEY_Greek_PSI, 13958 },
+    { XKB_KEY_Greek_psi, 13968 },
+    { XKB_KEY_Greek_RHO, 13978 },
+    { XKB_KEY_Greek_rho, 13988 },
+    { XKB_KEY_Greek_SIGMA, 13998 },
+    { XKB_KEY_Greek_sigma, 14010 },
+    { XKB_KEY_Greek_switch, 14022 },
+    { XKB_KEY_Greek_TAU, 14035 },
+    { XKB_KEY_Greek_tau, 14045 },
+    { XKB_KEY_Greek_THETA, 14055 },
+    { XKB_KEY_Greek_theta, 14067 },
+    { XKB_KEY_Greek_UPSILON, 14079 },
+    { XKB_KEY_Greek_upsilon, 14093 },
+    { XKB_KEY_Greek_UPSILONaccent, 14107 },
+    { XKB_KEY_Greek_upsilonaccent, 14127 },
+    { XKB_KEY_Greek_upsilonaccentdieresis, 14147 },
+    { XKB_KEY_Greek_UPSILONdieresis, 14175 },
+    { XKB_KEY_Greek_upsilondieresis, 14197 },
+    { XKB_KEY_Greek_XI, 14219 },
+    { XKB_KEY_Greek_xi, 14228 },
+    { XKB_KEY_Greek_ZETA, 14237 },
+    { XKB_KEY_Greek_zeta, 14248 },
+    { XKB_KEY_guilder, 14259 },
+    { XKB_KEY_guillemotleft, 14267 },
+    { XKB_KEY_guillemotright, 14281 },
+    { XKB_KEY_H, 14296 },
+    { XKB_KEY_h, 14298 },
+    { XKB_KEY_hairspace, 14300 },
+    { XKB_KEY_Hangul, 14310 },
+    { XKB_KEY_Hangul_A, 14317 },
+    { XKB_KEY_Hangul_AE, 14326 },
+    { XKB_KEY_Hangul_AraeA, 14336 },
+    { XKB_KEY_Hangul_AraeAE, 14349 },
+    { XKB_KEY_Hangul_Banja, 14363 },
+    { XKB_KEY_Hangul_Cieuc, 14376 },
+    { XKB_KEY_Hangul_Codeinput, 14389 },
+    { XKB_KEY_Hangul_Dikeud, 14406 },
+    { XKB_KEY_Hangul_E, 14420 },
+    { XKB_KEY_Hangul_End, 14429 },
+    { XKB_KEY_Hangul_EO, 14440 },
+    { XKB_KEY_Hangul_EU, 14450 },
+    { XKB_KEY_Hangul_Hanja, 14460 },
+    { XKB_KEY_Hangul_Hieuh, 14473 },
+    { XKB_KEY_Hangul_I, 14486 },
+    { XKB_KEY_Hangul_Ieung, 14495 },
+    { XKB_KEY_Hangul_J_Cieuc, 14508 },
+    { XKB_KEY_Hangul_J_Dikeud, 14523 },
+    { XKB_KEY_Hangul_J_Hieuh, 14539 },
+    { XKB_KEY_Hangul_J_Ieung, 14554 },
+    { XKB_KEY_Hangul_J_Jieuj, 14569 },
+    { XKB_KEY_Hangul_J_Khieuq, 14584 },
+    { XKB_KEY_Hangul_J_Kiyeog, 14600 },
+    { XKB_KEY_Hangul_J_KiyeogSios, 14616 },
+    { XKB_KEY_Hangul_J_KkogjiDalrinIeung, 14636 },
+    { XKB_KEY_Hangul_J_Mieum, 14663 },
+    { XKB_KEY_Hangul_J_Nieun, 14678 },
+    { XKB_KEY_Hangul_J_NieunHieuh, 14693 },
+    { XKB_KEY_Hangul_J_NieunJieuj, 14713 },
+    { XKB_KEY_Hangul_J_PanSios, 14733 },
+    { XKB_KEY_Hangul_J_Phieuf, 14750 },
+    { XKB_KEY_Hangul_J_Pieub, 14766 },
+    { XKB_KEY_Hangul_J_PieubSios, 14781 },
+    { XKB_KEY_Hangul_J_Rieul, 14800 },
+    { XKB_KEY_Hangul_J_RieulHieuh, 14815 },
+    { XKB_KEY_Hangul_J_RieulKiyeog, 14835 },
+    { XKB_KEY_Hangul_J_RieulMieum, 14856 },
+    { XKB_KEY_Hangul_J_RieulPhieuf, 14876 },
+    { XKB_KEY_Hangul_J_RieulPieub, 14897 },
+    { XKB_KEY_Hangul_J_RieulSios, 14917 },
+    { XKB_KEY_Hangul_J_RieulTieut, 14936 },
+    { XKB_KEY_Hangul_J_Sios, 14956 },
+    { XKB_KEY_Hangul_J_SsangKiyeog, 14970 },
+    { XKB_KEY_Hangul_J_SsangSios, 14991 },
+    { XKB_KEY_Hangul_J_Tieut, 15010 },
+    { XKB_KEY_Hangul_J_YeorinHieuh, 15025 },
+    { XKB_KEY_Hangul_Jamo, 15046 },
+    { XKB_KEY_Hangul_Jeonja, 15058 },
+    { XKB_KEY_Hangul_Jieuj, 15072 },
+    { XKB_KEY_Hangul_Khieuq, 15085 },
+    { XKB_KEY_Hangul_Kiyeog, 15099 },
+    { XKB_KEY_Hangul_KiyeogSios, 15113 },
+    { XKB_KEY_Hangul_KkogjiDalrinIeung, 15131 },
+    { XKB_KEY_Hangul_Mieum, 15156 },
+    { XKB_KEY_Hangul_MultipleCandidate, 15169 },
+    { XKB_KEY_Hangul_Nieun, 15194 },
+    { XKB_KEY_Hangul_NieunHieuh, 15207 },
+    { XKB_KEY_Hangul_NieunJieuj, 15225 },
+    { XKB_KEY_Hangul_O, 15243 },
+    { XKB_KEY_Hangul_OE, 15252 },
+    { XKB_KEY_Hangul_PanSios, 15262 },
+    { XKB_KEY_Hangul_Phieuf, 15277 },
+    { XKB_KEY_Hangul_Pieub, 15291 },
+    { XKB_KEY_Hangul_PieubSios, 15304 },
+    { XKB_KEY_Hangul_PostHanja, 15321 },
+    { XKB_KEY_Hangul_PreHanja, 15338 },
+    { XKB_KEY_Hangul_PreviousCandidate, 15354 },
+    { XKB_KEY_Hangul_Rieul, 15379 },
+    { XKB_KEY_Hangul_RieulHieuh, 15392 },
+    { XKB_KEY_Hangul_RieulKiyeog, 15410 },
+    { XKB_KEY_Hangul_RieulMieum, 15429 },
+    { XKB_KEY_Hangul_RieulPhieuf, 15447 },
+    { XKB_KEY_Hangul_RieulPieub, 15466 },
+    { XKB_KEY_Hangul_RieulSios, 15484 },
+    { XKB_KEY_Hangul_RieulTieut, 15501 },
+    { XKB_KEY_Hangul_RieulYeorinHieuh, 15519 },
+    { XKB_KEY_Hangul_Romaja, 15543 },
+    { XKB_KEY_Hangul_SingleCandidate, 15557 },
+    { XKB_KEY_Hangul_Sios, 15580 },
+    { XKB_KEY_Hangul_Special, 15592 },
+    { XKB_KEY_Hangul_SsangDikeud, 15607 },
+    { XKB_KEY_Hangul_SsangJieuj, 15626 },
+    { XKB_KEY_Hangul_SsangKiyeog, 15644 },
+    { XKB_KEY_Hangul_SsangPieub, 15663 },
+    { XKB_KEY_Hangul_SsangSios, 15681 },
+    { XKB_KEY_Hangul_Start, 15698 },
+    { XKB_KEY_Hangul_SunkyeongeumMieum, 15711 },
+    { XKB_KEY_Hangul_SunkyeongeumPhieuf, 15736 },
+    { XKB_KEY_Hangul_SunkyeongeumPieub, 15762 },
+    { XKB_KEY_Hangul_switch, 15787 },
+    { XKB_KEY_Hangul_Tieut, 15801 },
+    { XKB_KEY_Hangul_U, 15814 },
+    { XKB_KEY_Hangul_WA, 15823 },
+    { XKB_KEY_Hangul_WAE, 15833 },
+    { XKB_KEY_Hangul_WE, 15844 },
+    { XKB_KEY_Hangul_WEO, 15854 },
+    { XKB_KEY_Hangul_WI, 15865 },
+    { XKB_KEY_Hangul_YA, 15875 },
+    { XKB_KEY_Hangul_YAE, 15885 },
+    { XKB_KEY_Hangul_YE, 15896 },
+    { XKB_KEY_Hangul_YEO, 15906 },
+    { XKB_KEY_Hangul_YeorinHieuh, 15917 },
+    { XKB_KEY_Hangul_YI, 15936 },
+    { XKB_KEY_Hangul_YO, 15946 },
+    { XKB_KEY_Hangul_YU, 15956 },
+    { XKB_KEY_Hankaku, 15966 },
+    { XKB_KEY_Hcircumflex, 15974 },
+    { XKB_KEY_hcircumflex, 15986 },
+    { XKB_KEY_heart, 15998 },
+    { XKB_KEY_hebrew_aleph, 16004 },
+    { XKB_KEY_hebrew_ayin, 16017 },
+    { XKB_KEY_hebrew_bet, 16029 },
+    { XKB_KEY_hebrew_beth, 16040 },
+    { XKB_KEY_hebrew_chet, 16052 },
+    { XKB_KEY_hebrew_dalet, 16064 },
+    { XKB_KEY_hebrew_daleth, 16077 },
+    { XKB_KEY_hebrew_doublelowline, 16091 },
+    { XKB_KEY_hebrew_finalkaph, 16112 },
+    { XKB_KEY_hebrew_finalmem, 16129 },
+    { XKB_KEY_hebrew_finalnun, 16145 },
+    { XKB_KEY_hebrew_finalpe, 16161 },
+    { XKB_KEY_hebrew_finalzade, 16176 },
+    { XKB_KEY_hebrew_finalzadi, 16193 },
+    { XKB_KEY_hebrew_gimel, 16210 },
+    { XKB_KEY_hebrew_gimmel, 16223 },
+    { XKB_KEY_hebrew_he, 16237 },
+    { XKB_KEY_hebrew_het, 16247 },
+    { XKB_KEY_hebrew_kaph, 16258 },
+    { XKB_KEY_hebrew_kuf, 16270 },
+    { XKB_KEY_hebrew_lamed, 16281 },
+    { XKB_KEY_hebrew_mem, 16294 },
+    { XKB_KEY_hebrew_nun, 16305 },
+    { XKB_KEY_hebrew_pe, 16316 },
+    { XKB_KEY_hebrew_qoph, 16326 },
+    { XKB_KEY_hebrew_resh, 16338 },
+    { XKB_KEY_hebrew_samech, 16350 },
+    { XKB_KEY_hebrew_samekh, 16364 },
+    { XKB_KEY_hebrew_shin, 16378 },
+    { XKB_KEY_Hebrew_switch, 16390 },
+    { XKB_KEY_hebrew_taf, 16404 },
+    { XKB_KEY_hebrew_taw, 16415 },
+    { XKB_KEY_hebrew_tet, 16426 },
+    { XKB_KEY_hebrew_teth, 16437 },
+    { XKB_KEY_hebrew_waw, 16449 },
+    { XKB_KEY_hebrew_yod, 16460 },
+    { XKB_KEY_hebrew_zade, 16471 },
+    { XKB_KEY_hebrew_zadi, 16483 },
+    { XKB_KEY_hebrew_zain, 16495 },
+    { XKB_KEY_hebrew_zayin, 16507 },
+    { XKB_KEY_Help, 16520 },
+    { XKB_KEY_Henkan, 16525 },
+    { XKB_KEY_Henkan_Mode, 16532 },
+    { XKB_KEY_hexagram, 16544 },
+    { XKB_KEY_Hiragana, 16553 },
+    { XKB_KEY_Hiragana_Katakana, 16562 },
+    { XKB_KEY_Home, 16580 },
+    { XKB_KEY_horizconnector, 16585 },
+    { XKB_KEY_horizlinescan1, 16600 },
+    { XKB_KEY_horizlinescan3, 16615 },
+    { XKB_KEY_horizlinescan5, 16630 },
+    { XKB_KEY_horizlinescan7, 16645 },
+    { XKB_KEY_horizlinescan9, 16660 },
+    { XKB_KEY_hpBackTab, 16675 },
+    { XKB_KEY_hpblock, 16685 },
+    { XKB_KEY_hpClearLine, 16693 },
+    { XKB_KEY_hpDeleteChar, 16705 },
+    { XKB_KEY_hpDeleteLine, 16718 },
+    { XKB_KEY_hpguilder, 16731 },
+    { XKB_KEY_hpInsertChar, 16741 },
+    { XKB_KEY_hpInsertLine, 16754 },
+    { XKB_KEY_hpIO, 16767 },
+    { XKB_KEY_hpKP_BackTab, 16772 },
+    { XKB_KEY_hplira, 16785 },
+    { XKB_KEY_hplongminus, 16792 },
+    { XKB_KEY_hpModelock1, 16804 },
+    { XKB_KEY_hpModelock2, 16816 },
+    { XKB_KEY_hpmute_acute, 16828 },
+    { XKB_KEY_hpmute_asciicircum, 16841 },
+    { XKB_KEY_hpmute_asciitilde, 16860 },
+    { XKB_KEY_hpmute_diaeresis, 16878 },
+    { XKB_KEY_hpmute_grave, 16895 },
+    { XKB_KEY_hpReset, 16908 },
+    { XKB_KEY_hpSystem, 16916 },
+    { XKB_KEY_hpUser, 16925 },
+    { XKB_KEY_hpYdiaeresis, 16932 },
+    { XKB_KEY_Hstroke, 16945 },
+    { XKB_KEY_hstroke, 16953 },
+    { XKB_KEY_ht, 16961 },
+    { XKB_KEY_Hyper_L, 16964 },
+    { XKB_KEY_Hyper_R, 16972 },
+    { XKB_KEY_hyphen, 16980 },
+    { XKB_KEY_I, 16987 },
+    { XKB_KEY_i, 16989 },
+    { XKB_KEY_Iabovedot, 16991 },
+    { XKB_KEY_Iacute, 17001 },
+    { XKB_KEY_iacute, 17008 },
+    { XKB_KEY_Ibelowdot, 17015 },
+    { XKB_KEY_ibelowdot, 17025 },
+    { XKB_KEY_Ibreve, 17035 },
+    { XKB_KEY_ibreve, 17042 },
+    { XKB_KEY_Icircumflex, 17049 },
+    { XKB_KEY_icircumflex, 17061 },
+    { XKB_KEY_identical, 17073 },
+    { XKB_KEY_Idiaeresis, 17083 },
+    { XKB_KEY_idiaeresis, 17094 },
+    { XKB_KEY_idotless, 17105 },
+    { XKB_KEY_ifonlyif, 17114 },
+    { XKB_KEY_Igrave, 17123 },
+    { XKB_KEY_igrave, 17130 },
+    { XKB_KEY_Ihook, 17137 },
+    { XKB_KEY_ihook, 17143 },
+    { XKB_KEY_Imacron, 17149 },
+    { XKB_KEY_imacron, 17157 },
+    { XKB_KEY_implies, 17165 },
+    { XKB_KEY_includedin, 17173 },
+    { XKB_KEY_includes, 17184 },
+    { XKB_KEY_infinity, 17193 },
+    { XKB_KEY_Insert, 17202 },
+    { XKB_KEY_InsertChar, 17209 },
+    { XKB_KEY_InsertLine, 17220 },
+    { XKB_KEY_integral, 17231 },
+    { XKB_KEY_intersection, 17240 },
+    { XKB_KEY_IO, 17253 },
+    { XKB_KEY_Iogonek, 17256 },
+    { XKB_KEY_iogonek, 17264 },
+    { XKB_KEY_ISO_Center_Object, 17272 },
+    { XKB_KEY_ISO_Continuous_Underline, 17290 },
+    { XKB_KEY_ISO_Discontinuous_Underline, 17315 },
+    { XKB_KEY_ISO_Emphasize, 17343 },
+    { XKB_KEY_ISO_Enter, 17357 },
+    { XKB_KEY_ISO_Fast_Cursor_Down, 17367 },
+    { XKB_KEY_ISO_Fast_Cursor_Left, 17388 },
+    { XKB_KEY_ISO_Fast_Cursor_Right, 17409 },
+    { XKB_KEY_ISO_Fast_Cursor_Up, 17431 },
+    { XKB_KEY_ISO_First_Group, 17450 },
+    { XKB_KEY_ISO_First_Group_Lock, 17466 },
+    { XKB_KEY_ISO_Group_Latch, 17487 },
+    { XKB_KEY_ISO_Group_Lock, 17503 },
+    { XKB_KEY_ISO_Group_Shift, 17518 },
+    { XKB_KEY_ISO_Last_Group, 17534 },
+    { XKB_KEY_ISO_Last_Group_Lock, 17549 },
+    { XKB_KEY_ISO_Left_Tab, 17569 },
+    { XKB_KEY_ISO_Level2_Latch, 17582 },
+    { XKB_KEY_ISO_Level3_Latch, 17599 },
+    { XKB_KEY_ISO_Level3_Lock, 17616 },
+    { XKB_KEY_ISO_Level3_Shift, 17632 },
+    { XKB_KEY_ISO_Level5_Latch, 17649 },
+    { XKB_KEY_ISO_Level5_Lock, 17666 },
+    { XKB_KEY_ISO_Level5_Shift, 17682 },
+    { XKB_KEY_ISO_Lock, 17699 },
+    { XKB_KEY_ISO_Move_Line_Down, 17708 },
+    { XKB_KEY_ISO_Move_Line_Up, 17727 },
+    { XKB_KEY_ISO_Next_Group, 17744 },
+    { XKB_KEY_ISO_Next_Group_Lock, 17759 },
+    { XKB_KEY_ISO_Partial_Line_Down, 17779 },
+    { XKB_KEY_ISO_Partial_Line_Up, 17801 },
+    { XKB_KEY_ISO_Partial_Space_Left, 17821 },
+    { XKB_KEY_ISO_Partial_Space_Right, 17844 },
+    { XKB_KEY_ISO_Prev_Group, 17868 },
+    { XKB_KEY_ISO_Prev_Group_Lock, 17883 },
+    { XKB_KEY_ISO_Release_Both_Margins, 17903 },
+    { XKB_KEY_ISO_Release_Margin_Left, 17928 },
+    { XKB_KEY_ISO_Release_Margin_Right, 17952 },
+    { XKB_KEY_ISO_Set_Margin_Left, 17977 },
+    { XKB_KEY_ISO_Set_Margin_Right, 17997 },
+    { XKB_KEY_Itilde, 18018 },
+    { XKB_KEY_itilde, 18025 },
+    { XKB_KEY_J, 18032 },
+    { XKB_KEY_j, 18034 },
+    { XKB_KEY_Jcircumflex, 18036 },
+    { XKB_KEY_jcircumflex, 18048 },
+    { XKB_KEY_jot, 18060 },
+    { XKB_KEY_K, 18064 },
+    { XKB_KEY_k, 18066 },
+    { XKB_KEY_kana_a, 18068 },
+    { XKB_KEY_kana_A, 18075 },
+    { XKB_KEY_kana_CHI, 18082 },
+    { XKB_KEY_kana_closingbracket, 18091 },
+    { XKB_KEY_kana_comma, 18111 },
+    { XKB_KEY_kana_conjunctive, 18122 },
+    { XKB_KEY_kana_e, 18139 },
+    { XKB_KEY_kana_E, 18146 },
+    { XKB_KEY_kana_FU, 18153 },
+    { XKB_KEY_kana_fullstop, 18161 },
+    { XKB_KEY_kana_HA, 18175 },
+    { XKB_KEY_kana_HE, 18183 },
+    { XKB_KEY_kana_HI, 18191 },
+    { XKB_KEY_kana_HO, 18199 },
+    { XKB_KEY_kana_HU, 18207 },
+    { XKB_KEY_kana_i, 18215 },
+    { XKB_KEY_kana_I, 18222 },
+    { XKB_KEY_kana_KA, 18229 },
+    { XKB_KEY_kana_KE, 18237 },
+    { XKB_KEY_kana_KI, 18245 },
+    { XKB_KEY_kana_KO, 18253 },
+    { XKB_KEY_kana_KU, 18261 },
+    { XKB_KEY_Kana_Lock, 18269 },
+    { XKB_KEY_kana_MA, 18279 },
+    { XKB_KEY_kana_ME, 18287 },
+    { XKB_KEY_kana_MI, 18295 },
+    { XKB_KEY_kana_middledot, 18303 },
+    { XKB_KEY_kana_MO, 18318 },
+    { XKB_KEY_kana_MU, 18326 },
+    { XKB_KEY_kana_N, 18334 },
+    { XKB_KEY_kana_NA, 18341 },
+    { XKB_KEY_kana_NE, 18349 },
+    { XKB_KEY_kana_NI, 18357 },
+    { XKB_KEY_kana_NO, 18365 },
+    { XKB_KEY_kana_NU, 18373 },
+    { XKB_KEY_kana_o, 18381 },
+    { XKB_KEY_kana_O, 18388 },
+    { XKB_KEY_kana_openingbracket, 18395 },
+    { XKB_KEY_kana_RA, 18415 },
+    { XKB_KEY_kana_RE, 18423 },
+    { XKB_KEY_kana_RI, 18431 },
+    { XKB_KEY_kana_RO, 18439 },
+    { XKB_KEY_kana_RU, 18447 },
+    { XKB_KEY_kana_SA, 18455 },
+    { XKB_KEY_kana_SE, 18463 },
+    { XKB_KEY_kana_SHI, 18471 },
+    { XKB_KEY_Kana_Shift, 18480 },
+    { XKB_KEY_kana_SO, 18491 },
+    { XKB_KEY_kana_SU, 18499 },
+    { XKB_KEY_kana_switch, 18507 },
+    { XKB_KEY_kana_TA, 18519 },
+    { XKB_KEY_kana_TE, 18527 },
+    { XKB_KEY_kana_TI, 18535 },
+    { XKB_KEY_kana_TO, 18543 },
+    { XKB_KEY_kana_tsu, 18551 },
+    { XKB_KEY_kana_TSU, 18560 },
+    { XKB_KEY_kana_tu, 18569 },
+    { XKB_KEY_kana_TU, 18577 },
+    { XKB_KEY_kana_u, 18585 },
+    { XKB_KEY_kana_U, 18592 },
+    { XKB_KEY_kana_WA, 18599 },
+    { XKB_KEY_kana_WO, 18607 },
+    { XKB_KEY_kana_ya, 18615 },
+    { XKB_KEY_kana_YA, 18623 },
+    { XKB_KEY_kana_yo, 18631 },
+    { XKB_KEY_kana_YO, 18639 },
+    { XKB_KEY_kana_yu, 18647 },
+    { XKB_KEY_kana_YU, 18655 },
+    { XKB_KEY_Kanji, 18663 },
+    { XKB_KEY_Kanji_Bangou, 18669 },
+    { XKB_KEY_kappa, 18682 },
+    { XKB_KEY_Katakana, 18688 },
+    { XKB_KEY_Kcedilla, 18697 },
+    { XKB_KEY_kcedilla, 18706 },
+    { XKB_KEY_Korean_Won, 18715 },
+    { XKB_KEY_KP_0, 18726 },
+    { XKB_KEY_KP_1, 18731 },
+    { XKB_KEY_KP_2, 18736 },
+    { XKB_KEY_KP_3, 18741 },
+    { XKB_KEY_KP_4, 18746 },
+    { XKB_KEY_KP_5, 18751 },
+    { XKB_KEY_KP_6, 18756 },
+    { XKB_KEY_KP_7, 18761 },
+    { XKB_KEY_KP_8, 18766 },
+    { XKB_KEY_KP_9, 18771 },
+    { XKB_KEY_KP_Add, 18776 },
+    { XKB_KEY_KP_BackTab, 18783 },
+    { XKB_KEY_KP_Begin, 18794 },
+    { XKB_KEY_KP_Decimal, 18803 },
+    { XKB_KEY_KP_Delete, 18814 },
+    { XKB_KEY_KP_Divide, 18824 },
+    { XKB_KEY_KP_Down, 18834 },
+    { XKB_KEY_KP_End, 18842 },
+    { XKB_KEY_KP_Enter, 18849 },
+    { XKB_KEY_KP_Equal, 18858 },
+    { XKB_KEY_KP_F1, 18867 },
+    { XKB_KEY_KP_F2, 18873 },
+    { XKB_KEY_KP_F3, 18879 },
+    { XKB_KEY_KP_F4, 18885 },
+    { XKB_KEY_KP_Home, 18891 },
+    { XKB_KEY_KP_Insert, 18899 },
+    { XKB_KEY_KP_Left, 18909 },
+    { XKB_KEY_KP_Multiply, 18917 },
+    { XKB_KEY_KP_Next, 18929 },
+    { XKB_KEY_KP_Page_Down, 18937 },
+    { XKB_KEY_KP_Page_Up, 18950 },
+    { XKB_KEY_KP_Prior, 18961 },
+    { XKB_KEY_KP_Right, 18970 },
+    { XKB_KEY_KP_Separator, 18979 },
+    { XKB_KEY_KP_Space, 18992 },
+    { XKB_KEY_KP_Subtract, 19001 },
+    { XKB_KEY_KP_Tab, 19013 },
+    { XKB_KEY_KP_Up, 19020 },
+    { XKB_KEY_kra, 19026 },
+    { XKB_KEY_L, 19030 },
+    { XKB_KEY_l, 19032 },
+    { XKB_KEY_L1, 19034 },
+    { XKB_KEY_L10, 19037 },
+    { XKB_KEY_L2, 19041 },
+    { XKB_KEY_L3, 19044 },
+    { XKB_KEY_L4, 19047 },
+    { XKB_KEY_L5, 19050 },
+    { XKB_KEY_L6, 19053 },
+    { XKB_KEY_L7, 19056 },
+    { XKB_KEY_L8, 19059 },
+    { XKB_KEY_L9, 19062 },
+    { XKB_KEY_Lacute, 19065 },
+    { XKB_KEY_lacute, 19072 },
+    { XKB_KEY_Last_Virtual_Screen, 19079 },
+    { XKB_KEY_latincross, 19099 },
+    { XKB_KEY_Lbelowdot, 19110 },
+    { XKB_KEY_lbelowdot, 19120 },
+    { XKB_KEY_Lcaron, 19130 },
+    { XKB_KEY_lcaron, 19137 },
+    { XKB_KEY_Lcedilla, 19144 },
+    { XKB_KEY_lcedilla, 19153 },
+    { XKB_KEY_Left, 19162 },
+    { XKB_KEY_leftanglebracket, 19167 },
+    { XKB_KEY_leftarrow, 19184 },
+    { XKB_KEY_leftcaret, 19194 },
+    { XKB_KEY_leftdoublequotemark, 19204 },
+    { XKB_KEY_leftmiddlecurlybrace, 19224 },
+    { XKB_KEY_leftopentriangle, 19245 },
+    { XKB_KEY_leftpointer, 19262 },
+    { XKB_KEY_leftradical, 19274 },
+    { XKB_KEY_leftshoe, 19286 },
+    { XKB_KEY_leftsinglequotemark, 19295 },
+    { XKB_KEY_leftt, 19315 },
+    { XKB_KEY_lefttack, 19321 },
+    { XKB_KEY_less, 19330 },
+    { XKB_KEY_lessthanequal, 19335 },
+    { XKB_KEY_lf, 19349 },
+    { XKB_KEY_Linefeed, 19352 },
+    { XKB_KEY_lira, 19361 },
+    { XKB_KEY_LiraSign, 19366 },
+    { XKB_KEY_logicaland, 19375 },
+    { XKB_KEY_logicalor, 19386 },
+    { XKB_KEY_longminus, 19396 },
+    { XKB_KEY_lowleftcorner, 19406 },
+    { XKB_KEY_lowrightcorner, 19420 },
+    { XKB_KEY_Lstroke, 19435 },
+    { XKB_KEY_lstroke, 19443 },
+    { XKB_KEY_M, 19451 },
+    { XKB_KEY_m, 19453 },
+    { XKB_KEY_Mabovedot, 19455 },
+    { XKB_KEY_mabovedot, 19465 },
+    { XKB_KEY_Macedonia_dse, 19475 },
+    { XKB_KEY_Macedonia_DSE, 19489 },
+    { XKB_KEY_Macedonia_gje, 19503 },
+    { XKB_KEY_Macedonia_GJE, 19517 },
+    { XKB_KEY_Macedonia_kje, 19531 },
+    { XKB_KEY_Macedonia_KJE, 19545 },
+    { XKB_KEY_macron, 19559 },
+    { XKB_KEY_Mae_Koho, 19566 },
+    { XKB_KEY_malesymbol, 19575 },
+    { XKB_KEY_maltesecross, 19586 },
+    { XKB_KEY_marker, 19599 },
+    { XKB_KEY_masculine, 19606 },
+    { XKB_KEY_Massyo, 19616 },
+    { XKB_KEY_Menu, 19623 },
+    { XKB_KEY_Meta_L, 19628 },
+    { XKB_KEY_Meta_R, 19635 },
+    { XKB_KEY_MillSign, 19642 },
+    { XKB_KEY_minus, 19651 },
+    { XKB_KEY_minutes, 19657 },
+    { XKB_KEY_Mode_switch, 19665 },
+    { XKB_KEY_MouseKeys_Accel_Enable, 19677 },
+    { XKB_KEY_MouseKeys_Enable, 19700 },
+    { XKB_KEY_mu, 19717 },
+    { XKB_KEY_Muhenkan, 19720 },
+    { XKB_KEY_Multi_key, 19729 },
+    { XKB_KEY_MultipleCandidate, 19739 },
+    { XKB_KEY_multiply, 19757 },
+    { XKB_KEY_musicalflat, 19766 },
+    { XKB_KEY_musicalsharp, 19778 },
+    { XKB_KEY_mute_acute, 19791 },
+    { XKB_KEY_mute_asciicircum, 19802 },
+    { XKB_KEY_mute_asciitilde, 19819 },
+    { XKB_KEY_mute_diaeresis, 19835 },
+    { XKB_KEY_mute_grave, 19850 },
+    { XKB_KEY_N, 19861 },
+    { XKB_KEY_n, 19863 },
+    { XKB_KEY_nabla, 19865 },
+    { XKB_KEY_Nacute, 19871 },
+    { XKB_KEY_nacute, 19878 },
+    { XKB_KEY_NairaSign, 19885 },
+    { XKB_KEY_Ncaron, 19895 },
+    { XKB_KEY_ncaron, 19902 },
+    { XKB_KEY_Ncedilla, 19909 },
+    { XKB_KEY_ncedilla, 19918 },
+    { XKB_KEY_NewSheqelSign, 19927 },
+    { XKB_KEY_Next, 19941 },
+    { XKB_KEY_Next_Virtual_Screen, 19946 },
+    { XKB_KEY_ninesubscript, 19966 },
+    { XKB_KEY_ninesuperior, 19980 },
+    { XKB_KEY_nl, 19993 },
+    { XKB_KEY_nobreakspace, 19996 },
+    { XKB_KEY_NoSymbol, 20009 },
+    { XKB_KEY_notapproxeq, 20018 },
+    { XKB_KEY_notelementof, 20030 },
+    { XKB_KEY_notequal, 20043 },
+    { XKB_KEY_notidentical, 20052 },
+    { XKB_KEY_notsign, 20065 },
+    { XKB_KEY_Ntilde, 20073 },
+    { XKB_KEY_ntilde, 20080 },
+    { XKB_KEY_Num_Lock, 20087 },
+    { XKB_KEY_numbersign, 20096 },
+    { XKB_KEY_numerosign, 20107 },
+    { XKB_KEY_O, 20118 },
+    { XKB_KEY_o, 20120 },
+    { XKB_KEY_Oacute, 20122 },
+    { XKB_KEY_oacute, 20129 },
+    { XKB_KEY_Obarred, 20136 },
+    { XKB_KEY_obarred, 20144 },
+    { XKB_KEY_Obelowdot, 20152 },
+    { XKB_KEY_obelowdot, 20162 },
+    { XKB_KEY_Ocaron, 20172 },
+    { XKB_KEY_ocaron, 20179 },
+    { XKB_KEY_Ocircumflex, 20186 },
+    { XKB_KEY_ocircumflex, 20198 },
+    { XKB_KEY_Ocircumflexacute, 20210 },
+    { XKB_KEY_ocircumflexacute, 20227 },
+    { XKB_KEY_Ocircumflexbelowdot, 20244 },
+    { XKB_KEY_ocircumflexbelowdot, 20264 },
+    { XKB_KEY_Ocircumflexgrave, 20284 },
+    { XKB_KEY_ocircumflexgrave, 20301 },
+    { XKB_KEY_Ocircumflexhook, 20318 },
+    { XKB_KEY_ocircumflexhook, 20334 },
+    { XKB_KEY_Ocircumflextilde, 20350 },
+    { XKB_KEY_ocircumflextilde, 20367 },
+    { XKB_KEY_Odiaeresis, 20384 },
+    { XKB_KEY_odiaeresis, 20395 },
+    { XKB_KEY_Odoubleacute, 20406 },
+    { XKB_KEY_odoubleacute, 20419 },
+    { XKB_KEY_OE, 20432 },
+    { XKB_KEY_oe, 20435 },
+    { XKB_KEY_ogonek, 20438 },
+    { XKB_KEY_Ograve, 20445 },
+    { XKB_KEY_ograve, 20452 },
+    { XKB_KEY_Ohook, 20459 },
+    { XKB_KEY_ohook, 20465 },
+    { XKB_KEY_Ohorn, 20471 },
+    { XKB_KEY_ohorn, 20477 },
+    { XKB_KEY_Ohornacute, 20483 },
+    { XKB_KEY_ohornacute, 20494 },
+    { XKB_KEY_Ohornbelowdot, 20505 },
+    { XKB_KEY_ohornbelowdot, 20519 },
+    { XKB_KEY_Ohorngrave, 20533 },
+    { XKB_KEY_ohorngrave, 20544 },
+    { XKB_KEY_Ohornhook, 20555 },
+    { XKB_KEY_ohornhook, 20565 },
+    { XKB_KEY_Ohorntilde, 20575 },
+    { XKB_KEY_ohorntilde, 20586 },
+    { XKB_KEY_Omacron, 20597 },
+    { XKB_KEY_omacron, 20605 },
+    { XKB_KEY_oneeighth, 20613 },
+    { XKB_KEY_onefifth, 20623 },
+    { XKB_KEY_onehalf, 20632 },
+    { XKB_KEY_onequarter, 20640 },
+    { XKB_KEY_onesixth, 20651 },
+    { XKB_KEY_onesubscript, 20660 },
+    { XKB_KEY_onesuperior, 20673 },
+    { XKB_KEY_onethird, 20685 },
+    { XKB_KEY_Ooblique, 20694 },
+    { XKB_KEY_ooblique, 20703 },
+    { XKB_KEY_openrectbullet, 20712 },
+    { XKB_KEY_openstar, 20727 },
+    { XKB_KEY_opentribulletdown, 20736 },
+    { XKB_KEY_opentribulletup, 20754 },
+    { XKB_KEY_ordfeminine, 20770 },
+    { XKB_KEY_osfActivate, 20782 },
+    { XKB_KEY_osfAddMode, 20794 },
+    { XKB_KEY_osfBackSpace, 20805 },
+    { XKB_KEY_osfBackTab, 20818 },
+    { XKB_KEY_osfBeginData, 20829 },
+    { XKB_KEY_osfBeginLine, 20842 },
+    { XKB_KEY_osfCancel, 20855 },
+    { XKB_KEY_osfClear, 20865 },
+    { XKB_KEY_osfCopy, 20874 },
+    { XKB_KEY_osfCut, 20882 },
+    { XKB_KEY_osfDelete, 20889 },
+    { XKB_KEY_osfDeselectAll, 20899 },
+    { XKB_KEY_osfDown, 20914 },
+    { XKB_KEY_osfEndData, 20922 },
+    { XKB_KEY_osfEndLine, 20933 },
+    { XKB_KEY_osfEscape, 20944 },
+    { XKB_KEY_osfExtend, 20954 },
+    { XKB_KEY_osfHelp, 20964 },
+    { XKB_KEY_osfInsert, 20972 },
+    { XKB_KEY_osfLeft, 20982 },
+    { XKB_KEY_osfMenu, 20990 },
+    { XKB_KEY_osfMenuBar, 20998 },
+    { XKB_KEY_osfNextField, 21009 },
+    { XKB_KEY_osfNextMenu, 21022 },
+    { XKB_KEY_osfPageDown, 21034 },
+    { XKB_KEY_osfPageLeft, 21046 },
+    { XKB_KEY_osfPageRight, 21058 },
+    { XKB_KEY_osfPageUp, 21071 },
+    { XKB_KEY_osfPaste, 21081 },
+    { XKB_KEY_osfPrevField, 21090 },
+    { XKB_KEY_osfPrevMenu, 21103 },
+    { XKB_KEY_osfPrimaryPaste, 21115 },
+    { XKB_KEY_osfQuickPaste, 21131 },
+    { XKB_KEY_osfReselect, 21145 },
+    { XKB_KEY_osfRestore, 21157 },
+    { XKB_KEY_osfRight, 21168 },
+    { XKB_KEY_osfSelect, 21177 },
+    { XKB_KEY_osfSelectAll, 21187 },
+    { XKB_KEY_osfUndo, 21200 },
+    { XKB_KEY_osfUp, 21208 },
+    { XKB_KEY_Oslash, 21214 },
+    { XKB_KEY_oslash, 21221 },
+    { XKB_KEY_Otilde, 21228 },
+    { XKB_KEY_otilde, 21235 },
+    { XKB_KEY_overbar, 21242 },
+    { XKB_KEY_Overlay1_Enable, 21250 },
+    { XKB_KEY_Overlay2_Enable, 21266 },
+    { XKB_KEY_overline, 21282 },
+    { XKB_KEY_P, 21291 },
+    { XKB_KEY_p, 21293 },
+    { XKB_KEY_Pabovedot, 21295 },
+    { XKB_KEY_pabovedot, 21305 },
+    { XKB_KEY_Page_Down, 21315 },
+    { XKB_KEY_Page_Up, 21325 },
+    { XKB_KEY_paragraph, 21333 },
+    { XKB_KEY_parenleft, 21343 },
+    { XKB_KEY_parenright, 21353 },
+    { XKB_KEY_partdifferential, 21364 },
+    { XKB_KEY_partialderivative, 21381 },
+    { XKB_KEY_Pause, 21399 },
+    { XKB_KEY_percent, 21405 },
+    { XKB_KEY_period, 21413 },
+    { XKB_KEY_periodcentered, 21420 },
+    { XKB_KEY_permille, 21435 },
+    { XKB_KEY_PesetaSign, 21444 },
+    { XKB_KEY_phonographcopyright, 21455 },
+    { XKB_KEY_plus, 21475 },
+    { XKB_KEY_plusminus, 21480 },
+    { XKB_KEY_Pointer_Accelerate, 21490 },
+    { XKB_KEY_Pointer_Button1, 21509 },
+    { XKB_KEY_Pointer_Button2, 21525 },
+    { XKB_KEY_Pointer_Button3, 21541 },
+    { XKB_KEY_Pointer_Button4, 21557 },
+    { XKB_KEY_Pointer_Button5, 21573 },
+    { XKB_KEY_Pointer_Button_Dflt, 21589 },
+    { XKB_KEY_Pointer_DblClick1, 21609 },
+    { XKB_KEY_Pointer_DblClick2, 21627 },
+    { XKB_KEY_Pointer_DblClick3, 21645 },
+    { XKB_KEY_Pointer_DblClick4, 21663 },
+    { XKB_KEY_Pointer_DblClick5, 21681 },
+    { XKB_KEY_Pointer_DblClick_Dflt, 21699 },
+    { XKB_KEY_Pointer_DfltBtnNext, 21721 },
+    { XKB_KEY_Pointer_DfltBtnPrev, 21741 },
+    { XKB_KEY_Pointer_Down, 21761 },
+    { XKB_KEY_Pointer_DownLeft, 21774 },
+    { XKB_KEY_Pointer_DownRight, 21791 },
+    { XKB_KEY_Pointer_Drag1, 21809 },
+    { XKB_KEY_Pointer_Drag2, 21823 },
+    { XKB_KEY_Pointer_Drag3, 21837 },
+    { XKB_KEY_Pointer_Drag4, 21851 },
+    { XKB_KEY_Pointer_Drag5, 21865 },
+    { XKB_KEY_Pointer_Drag_Dflt, 21879 },
+    { XKB_KEY_Pointer_EnableKeys, 21897 },
+    { XKB_KEY_Pointer_Left, 21916 },
+    { XKB_KEY_Pointer_Right, 21929 },
+    { XKB_KEY_Pointer_Up, 21943 },
+    { XKB_KEY_Pointer_UpLeft, 21954 },
+    { XKB_KEY_Pointer_UpRight, 21969 },
+    { XKB_KEY_prescription, 21985 },
+    { XKB_KEY_Prev_Virtual_Screen, 21998 },
+    { XKB_KEY_PreviousCandidate, 22018 },
+    { XKB_KEY_Print, 22036 },
+    { XKB_KEY_Prior, 22042 },
+    { XKB_KEY_prolongedsound, 22048 },
+    { XKB_KEY_punctspace, 22063 },
+    { XKB_KEY_Q, 22074 },
+    { XKB_KEY_q, 22076 },
+    { XKB_KEY_quad, 22078 },
+    { XKB_KEY_question, 22083 },
+    { XKB_KEY_questiondown, 22092 },
+    { XKB_KEY_quotedbl, 22105 },
+    { XKB_KEY_quoteleft, 22114 },
+    { XKB_KEY_quoteright, 22124 },
+    { XKB_KEY_R, 22135 },
+    { XKB_KEY_r, 22137 },
+    { XKB_KEY_R1, 22139 },
+    { XKB_KEY_R10, 22142 },
+    { XKB_KEY_R11, 22146 },
+    { XKB_KEY_R12, 22150 },
+    { XKB_KEY_R13, 22154 },
+    { XKB_KEY_R14, 22158 },
+    { XKB_KEY_R15, 22162 },
+    { XKB_KEY_R2, 22166 },
+    { XKB_KEY_R3, 22169 },
+    { XKB_KEY_R4, 22172 },
+    { XKB_KEY_R5, 22175 },
+    { XKB_KEY_R6, 22178 },
+    { XKB_KEY_R7, 22181 },
+    { XKB_KEY_R8, 22184 },
+    { XKB_KEY_R9, 22187 },
+    { XKB_KEY_Racute, 22190 },
+    { XKB_KEY_racute, 22197 },
+    { XKB_KEY_radical, 22204 },
+    { XKB_KEY_Rcaron, 22212 },
+    { XKB_KEY_rcaron, 22219 },
+    { XKB_KEY_Rcedilla, 22226 },
+    { XKB_KEY_rcedilla, 22235 },
+    { XKB_KEY_Redo, 22244 },
+    { XKB_KEY_registered, 22249 },
+    { XKB_KEY_RepeatKeys_Enable, 22260 },
+    { XKB_KEY_Reset, 22278 },
+    { XKB_KEY_Return, 22284 },
+    { XKB_KEY_Right, 22291 },
+    { XKB_KEY_rightanglebracket, 22297 },
+    { XKB_KEY_rightarrow, 22315 },
+    { XKB_KEY_rightcaret, 22326 },
+    { XKB_KEY_rightdoublequotemark, 22337 },
+    { XKB_KEY_rightmiddlecurlybrace, 22358 },
+    { XKB_KEY_rightmiddlesummation, 22380 },
+    { XKB_KEY_rightopentriangle, 22401 },
+    { XKB_KEY_rightpointer, 22419 },
+    { XKB_KEY_rightshoe, 22432 },
+    { XKB_KEY_rightsinglequotemark, 22442 },
+    { XKB_KEY_rightt, 22463 },
+    { XKB_KEY_righttack, 22470 },
+    { XKB_KEY_Romaji, 22480 },
+    { XKB_KEY_RupeeSign, 22487 },
+    { XKB_KEY_S, 22497 },
+    { XKB_KEY_s, 22499 },
+    { XKB_KEY_Sabovedot, 22501 },
+    { XKB_KEY_sabovedot, 22511 },
+    { XKB_KEY_Sacute, 22521 },
+    { XKB_KEY_sacute, 22528 },
+    { XKB_KEY_Scaron, 22535 },
+    { XKB_KEY_scaron, 22542 },
+    { XKB_KEY_Scedilla, 22549 },
+    { XKB_KEY_scedilla, 22558 },
+    { XKB_KEY_SCHWA, 22567 },
+    { XKB_KEY_schwa, 22573 },
+    { XKB_KEY_Scircumflex, 22579 },
+    { XKB_KEY_scircumflex, 22591 },
+    { XKB_KEY_script_switch, 22603 },
+    { XKB_KEY_Scroll_Lock, 22617 },
+    { XKB_KEY_seconds, 22629 },
+    { XKB_KEY_section, 22637 },
+    { XKB_KEY_Select, 22645 },
+    { XKB_KEY_semicolon, 22652 },
+    { XKB_KEY_semivoicedsound, 22662 },
+    { XKB_KEY_Serbian_dje, 22678 },
+    { XKB_KEY_Serbian_DJE, 22690 },
+    { XKB_KEY_Serbian_dze, 22702 },
+    { XKB_KEY_Serbian_DZE, 22714 },
+    { XKB_KEY_Serbian_je, 22726 },
+    { XKB_KEY_Serbian_JE, 22737 },
+    { XKB_KEY_Serbian_lje, 22748 },
+    { XKB_KEY_Serbian_LJE, 22760 },
+    { XKB_KEY_Serbian_nje, 22772 },
+    { XKB_KEY_Serbian_NJE, 22784 },
+    { XKB_KEY_Serbian_tshe, 22796 },
+    { XKB_KEY_Serbian_TSHE, 22809 },
+    { XKB_KEY_seveneighths, 22822 },
+    { XKB_KEY_sevensubscript, 22835 },
+    { XKB_KEY_sevensuperior, 22850 },
+    { XKB_KEY_Shift_L, 22864 },
+    { XKB_KEY_Shift_Lock, 22872 },
+    { XKB_KEY_Shift_R, 22883 },
+    { XKB_KEY_signaturemark, 22891 },
+    { XKB_KEY_signifblank, 22905 },
+    { XKB_KEY_similarequal, 22917 },
+    { XKB_KEY_SingleCandidate, 22930 },
+    { XKB_KEY_singlelowquotemark, 22946 },
+    { XKB_KEY_Sinh_a, 22965 },
+    { XKB_KEY_Sinh_aa, 22972 },
+    { XKB_KEY_Sinh_aa2, 22980 },
+    { XKB_KEY_Sinh_ae, 22989 },
+    { XKB_KEY_Sinh_ae2, 22997 },
+    { XKB_KEY_Sinh_aee, 23006 },
+    { XKB_KEY_Sinh_aee2, 23015 },
+    { XKB_KEY_Sinh_ai, 23025 },
+    { XKB_KEY_Sinh_ai2, 23033 },
+    { XKB_KEY_Sinh_al, 23042 },
+    { XKB_KEY_Sinh_au, 23050 },
+    { XKB_KEY_Sinh_au2, 23058 },
+    { XKB_KEY_Sinh_ba, 23067 },
+    { XKB_KEY_Sinh_bha, 23075 },
+    { XKB_KEY_Sinh_ca, 23084 },
+    { XKB_KEY_Sinh_cha, 23092 },
+    { XKB_KEY_Sinh_dda, 23101 },
+    { XKB_KEY_Sinh_ddha, 23110 },
+    { XKB_KEY_Sinh_dha, 23120 },
+    { XKB_KEY_Sinh_dhha, 23129 },
+    { XKB_KEY_Sinh_e, 23139 },
+    { XKB_KEY_Sinh_e2, 23146 },
+    { XKB_KEY_Sinh_ee, 23154 },
+    { XKB_KEY_Sinh_ee2, 23162 },
+    { XKB_KEY_Sinh_fa, 23171 },
+    { XKB_KEY_Sinh_ga, 23179 },
+    { XKB_KEY_Sinh_gha, 23187 },
+    { XKB_KEY_Sinh_h2, 23196 },
+    { XKB_KEY_Sinh_ha, 23204 },
+    { XKB_KEY_Sinh_i, 23212 },
+    { XKB_KEY_Sinh_i2, 23219 },
+    { XKB_KEY_Sinh_ii, 23227 },
+    { XKB_KEY_Sinh_ii2, 23235 },
+    { XKB_KEY_Sinh_ja, 23244 },
+    { XKB_KEY_Sinh_jha, 23252 },
+    { XKB_KEY_Sinh_jnya, 23261 },
+    { XKB_KEY_Sinh_ka, 23271 },
+    { XKB_KEY_Sinh_kha, 23279 },
+    { XKB_KEY_Sinh_kunddaliya, 23288 },
+    { XKB_KEY_Sinh_la, 23304 },
+    { XKB_KEY_Sinh_lla, 23312 },
+    { XKB_KEY_Sinh_lu, 23321 },
+    { XKB_KEY_Sinh_lu2, 23329 },
+    { XKB_KEY_Sinh_luu, 23338 },
+    { XKB_KEY_Sinh_luu2, 23347 },
+    { XKB_KEY_Sinh_ma, 23357 },
+    { XKB_KEY_Sinh_mba, 23365 },
+    { XKB_KEY_Sinh_na, 23374 },
+    { XKB_KEY_Sinh_ndda, 23382 },
+    { XKB_KEY_Sinh_ndha, 23392 },
+    { XKB_KEY_Sinh_ng, 23402 },
+    { XKB_KEY_Sinh_ng2, 23410 },
+    { XKB_KEY_Sinh_nga, 23419 },
+    { XKB_KEY_Sinh_nja, 23428 },
+    { XKB_KEY_Sinh_nna, 23437 },
+    { XKB_KEY_Sinh_nya, 23446 },
+    { XKB_KEY_Sinh_o, 23455 },
+    { XKB_KEY_Sinh_o2, 23462 },
+    { XKB_KEY_Sinh_oo, 23470 },
+    { XKB_KEY_Sinh_oo2, 23478 },
+    { XKB_KEY_Sinh_pa, 23487 },
+    { XKB_KEY_Sinh_pha, 23495 },
+    { XKB_KEY_Sinh_ra, 23504 },
+    { XKB_KEY_Sinh_ri, 23512 },
+    { XKB_KEY_Sinh_rii, 23520 },
+    { XKB_KEY_Sinh_ru2, 23529 },
+    { XKB_KEY_Sinh_ruu2, 23538 },
+    { XKB_KEY_Sinh_sa, 23548 },
+    { XKB_KEY_Sinh_sha, 23556 },
+    { XKB_KEY_Sinh_ssha, 23565 },
+    { XKB_KEY_Sinh_tha, 23575 },
+    { XKB_KEY_Sinh_thha, 23584 },
+    { XKB_KEY_Sinh_tta, 23594 },
+    { XKB_KEY_Sinh_ttha, 23603 },
+    { XKB_KEY_Sinh_u, 23613 },
+    { XKB_KEY_Sinh_u2, 23620 },
+    { XKB_KEY_Sinh_uu, 23628 },
+    { XKB_KEY_Sinh_uu2, 23636 },
+    { XKB_KEY_Sinh_va, 23645 },
+    { XKB_KEY_Sinh_ya, 23653 },
+    { XKB_KEY_sixsubscript, 23661 },
+    { XKB_KEY_sixsuperior, 23674 },
+    { XKB_KEY_slash, 23686 },
+    { XKB_KEY_SlowKeys_Enable, 23692 },
+    { XKB_KEY_soliddiamond, 23708 },
+    { XKB_KEY_space, 23721 },
+    { XKB_KEY_squareroot, 23727 },
+    { XKB_KEY_ssharp, 23738 },
+    { XKB_KEY_sterling, 23745 },
+    { XKB_KEY_StickyKeys_Enable, 23754 },
+    { XKB_KEY_stricteq, 23772 },
+    { XKB_KEY_SunAgain, 23781 },
+    { XKB_KEY_SunAltGraph, 23790 },
+    { XKB_KEY_SunAudioLowerVolume, 23802 },
+    { XKB_KEY_SunAudioMute, 23822 },
+    { XKB_KEY_SunAudioRaiseVolume, 23835 },
+    { XKB_KEY_SunCompose, 23855 },
+    { XKB_KEY_SunCopy, 23866 },
+    { XKB_KEY_SunCut, 23874 },
+    { XKB_KEY_SunF36, 23881 },
+    { XKB_KEY_SunF37, 23888 },
+    { XKB_KEY_SunFA_Acute, 23895 },
+    { XKB_KEY_SunFA_Cedilla, 23907 },
+    { XKB_KEY_SunFA_Circum, 23921 },
+    { XKB_KEY_SunFA_Diaeresis, 23934 },
+    { XKB_KEY_SunFA_Grave, 23950 },
+    { XKB_KEY_SunFA_Tilde, 23962 },
+    { XKB_KEY_SunFind, 23974 },
+    { XKB_KEY_SunFront, 23982 },
+    { XKB_KEY_SunOpen, 23991 },
+    { XKB_KEY_SunPageDown, 23999 },
+    { XKB_KEY_SunPageUp, 24011 },
+    { XKB_KEY_SunPaste, 24021 },
+    { XKB_KEY_SunPowerSwitch, 24030 },
+    { XKB_KEY_SunPowerSwitchShift, 24045 },
+    { XKB_KEY_SunPrint_Screen, 24065 },
+    { XKB_KEY_SunProps, 24081 },
+    { XKB_KEY_SunStop, 24090 },
+    { XKB_KEY_SunSys_Req, 24098 },
+    { XKB_KEY_SunUndo, 24109 },
+    { XKB_KEY_SunVideoDegauss, 24117 },
+    { XKB_KEY_SunVideoLowerBrightness, 24133 },
+    { XKB_KEY_SunVideoRaiseBrightness, 24157 },
+    { XKB_KEY_Super_L, 24181 },
+    { XKB_KEY_Super_R, 24189 },
+    { XKB_KEY_Sys_Req, 24197 },
+    { XKB_KEY_System, 24205 },
+    { XKB_KEY_T, 24212 },
+    { XKB_KEY_t, 24214 },
+    { XKB_KEY_Tab, 24216 },
+    { XKB_KEY_Tabovedot, 24220 },
+    { XKB_KEY_tabovedot, 24230 },
+    { XKB_KEY_Tcaron, 24240 },
+    { XKB_KEY_tcaron, 24247 },
+    { XKB_KEY_Tcedilla, 24254 },
+    { XKB_KEY_tcedilla, 24263 },
+    { XKB_KEY_telephone, 24272 },
+    { XKB_KEY_telephonerecorder, 24282 },
+    { XKB_KEY_Terminate_Server, 24300 },
+    { XKB_KEY_Thai_baht, 24317 },
+    { XKB_KEY_Thai_bobaimai, 24327 },
+    { XKB_KEY_Thai_chochan, 24341 },
+    { XKB_KEY_Thai_chochang, 24354 },
+    { XKB_KEY_Thai_choching, 24368 },
+    { XKB_KEY_Thai_chochoe, 24382 },
+    { XKB_KEY_Thai_dochada, 24395 },
+    { XKB_KEY_Thai_dodek, 24408 },
+    { XKB_KEY_Thai_fofa, 24419 },
+    { XKB_KEY_Thai_fofan, 24429 },
+    { XKB_KEY_Thai_hohip, 24440 },
+    { XKB_KEY_Thai_honokhuk, 24451 },
+    { XKB_KEY_Thai_khokhai, 24465 },
+    { XKB_KEY_Thai_khokhon, 24478 },
+    { XKB_KEY_Thai_khokhuat, 24491 },
+    { XKB_KEY_Thai_khokhwai, 24505 },
+    { XKB_KEY_Thai_khorakhang, 24519 },
+    { XKB_KEY_Thai_kokai, 24535 },
+    { XKB_KEY_Thai_lakkhangyao, 24546 },
+    { XKB_KEY_Thai_lekchet, 24563 },
+    { XKB_KEY_Thai_lekha, 24576 },
+    { XKB_KEY_Thai_lekhok, 24587 },
+    { XKB_KEY_Thai_lekkao, 24599 },
+    { XKB_KEY_Thai_leknung, 24611 },
+    { XKB_KEY_Thai_lekpaet, 24624 },
+    { XKB_KEY_Thai_leksam, 24637 },
+    { XKB_KEY_Thai_leksi, 24649 },
+    { XKB_KEY_Thai_leksong, 24660 },
+    { XKB_KEY_Thai_leksun, 24673 },
+    { XKB_KEY_Thai_lochula, 24685 },
+    { XKB_KEY_Thai_loling, 24698 },
+    { XKB_KEY_Thai_lu, 24710 },
+    { XKB_KEY_Thai_maichattawa, 24718 },
+    { XKB_KEY_Thai_maiek, 24735 },
+    { XKB_KEY_Thai_maihanakat, 24746 },
+    { XKB_KEY_Thai_maihanakat_maitho, 24762 },
+    { XKB_KEY_Thai_maitaikhu, 24785 },
+    { XKB_KEY_Thai_maitho, 24800 },
+    { XKB_KEY_Thai_maitri, 24812 },
+    { XKB_KEY_Thai_maiyamok, 24824 },
+    { XKB_KEY_Thai_moma, 24838 },
+    { XKB_KEY_Thai_ngongu, 24848 },
+    { XKB_KEY_Thai_nikhahit, 24860 },
+    { XKB_KEY_Thai_nonen, 24874 },
+    { XKB_KEY_Thai_nonu, 24885 },
+    { XKB_KEY_Thai_oang, 24895 },
+    { XKB_KEY_Thai_paiyannoi, 24905 },
+    { XKB_KEY_Thai_phinthu, 24920 },
+    { XKB_KEY_Thai_phophan, 24933 },
+    { XKB_KEY_Thai_phophung, 24946 },
+    { XKB_KEY_Thai_phosamphao, 24960 },
+    { XKB_KEY_Thai_popla, 24976 },
+    { XKB_KEY_Thai_rorua, 24987 },
+    { XKB_KEY_Thai_ru, 24998 },
+    { XKB_KEY_Thai_saraa, 25006 },
+    { XKB_KEY_Thai_saraaa, 25017 },
+    { XKB_KEY_Thai_saraae, 25029 },
+    { XKB_KEY_Thai_saraaimaimalai, 25041 },
+    { XKB_KEY_Thai_saraaimaimuan, 25061 },
+    { XKB_KEY_Thai_saraam, 25080 },
+    { XKB_KEY_Thai_sarae, 25092 },
+    { XKB_KEY_Thai_sarai, 25103 },
+    { XKB_KEY_Thai_saraii, 25114 },
+    { XKB_KEY_Thai_sarao, 25126 },
+    { XKB_KEY_Thai_sarau, 25137 },
+    { XKB_KEY_Thai_saraue, 25148 },
+    { XKB_KEY_Thai_sarauee, 25160 },
+    { XKB_KEY_Thai_sarauu, 25173 },
+    { XKB_KEY_Thai_sorusi, 25185 },
+    { XKB_KEY_Thai_sosala, 25197 },
+    { XKB_KEY_Thai_soso, 25209 },
+    { XKB_KEY_Thai_sosua, 25219 },
+    { XKB_KEY_Thai_thanthakhat, 25230 },
+    { XKB_KEY_Thai_thonangmontho, 25247 },
+    { XKB_KEY_Thai_thophuthao, 25266 },
+    { XKB_KEY_Thai_thothahan, 25282 },
+    { XKB_KEY_Thai_thothan, 25297 },
+    { XKB_KEY_Thai_thothong, 25310 },
+    { XKB_KEY_Thai_thothung, 25324 },
+    { XKB_KEY_Thai_topatak, 25338 },
+    { XKB_KEY_Thai_totao, 25351 },
+    { XKB_KEY_Thai_wowaen, 25362 },
+    { XKB_KEY_Thai_yoyak, 25374 },
+    { XKB_KEY_Thai_yoying, 25385 },
+    { XKB_KEY_therefore, 25397 },
+    { XKB_KEY_thinspace, 25407 },
+    { XKB_KEY_THORN, 25417 },
+    { XKB_KEY_Thorn, 25423 },
+    { XKB_KEY_thorn, 25429 },
+    { XKB_KEY_threeeighths, 25435 },
+    { XKB_KEY_threefifths, 25448 },
+    { XKB_KEY_threequarters, 25460 },
+    { XKB_KEY_threesubscript, 25474 },
+    { XKB_KEY_threesuperior, 25489 },
+    { XKB_KEY_tintegral, 25503 },
+    { XKB_KEY_topintegral, 25513 },
+    { XKB_KEY_topleftparens, 25525 },
+    { XKB_KEY_topleftradical, 25539 },
+    { XKB_KEY_topleftsqbracket, 25554 },
+    { XKB_KEY_topleftsummation, 25571 },
+    { XKB_KEY_toprightparens, 25588 },
+    { XKB_KEY_toprightsqbracket, 25603 },
+    { XKB_KEY_toprightsummation, 25621 },
+    { XKB_KEY_topt, 25639 },
+    { XKB_KEY_topvertsummationconnector, 25644 },
+    { XKB_KEY_Touroku, 25670 },
+    { XKB_KEY_trademark, 25678 },
+    { XKB_KEY_trademarkincircle, 25688 },
+    { XKB_KEY_Tslash, 25706 },
+    { XKB_KEY_tslash, 25713 },
+    { XKB_KEY_twofifths, 25720 },
+    { XKB_KEY_twosubscript, 25730 },
+    { XKB_KEY_twosuperior, 25743 },
+    { XKB_KEY_twothirds, 25755 },
+    { XKB_KEY_U, 25765 },
+    { XKB_KEY_u, 25767 },
+    { XKB_KEY_Uacute, 25769 },
+    { XKB_KEY_uacute, 25776 },
+    { XKB_KEY_Ubelowdot, 25783 },
+    { XKB_KEY_ubelowdot, 25793 },
+    { XKB_KEY_Ubreve, 25803 },
+    { XKB_KEY_ubreve, 25810 },
+    { XKB_KEY_Ucircumflex, 25817 },
+    { XKB_KEY_ucircumflex, 25829 },
+    { XKB_KEY_Udiaeresis, 25841 },
+    { XKB_KEY_udiaeresis, 25852 },
+    { XKB_KEY_Udoubleacute, 25863 },
+    { XKB_KEY_udoubleacute, 25876 },
+    { XKB_KEY_Ugrave, 25889 },
+    { XKB_KEY_ugrave, 25896 },
+    { XKB_KEY_Uhook, 25903 },
+    { XKB_KEY_uhook, 25909 },
+    { XKB_KEY_Uhorn, 25915 },
+    { XKB_KEY_uhorn, 25921 },
+    { XKB_KEY_Uhornacute, 25927 },
+    { XKB_KEY_uhornacute, 25938 },
+    { XKB_KEY_Uhornbelowdot, 25949 },
+    { XKB_KEY_uhornbelowdot, 25963 },
+    { XKB_KEY_Uhorngrave, 25977 },
+    { XKB_KEY_uhorngrave, 25988 },
+    { XKB_KEY_Uhornhook, 25999 },
+    { XKB_KEY_uhornhook, 26009 },
+    { XKB_KEY_Uhorntilde, 26019 },
+    { XKB_KEY_uhorntilde, 26030 },
+    { XKB_KEY_Ukrainian_ghe_with_upturn, 26041 },
+    { XKB_KEY_Ukrainian_GHE_WITH_UPTURN, 26067 },
+    { XKB_KEY_Ukrainian_i, 26093 },
+    { XKB_KEY_Ukrainian_I, 26105 },
+    { XKB_KEY_Ukrainian_ie, 26117 },
+    { XKB_KEY_Ukrainian_IE, 26130 },
+    { XKB_KEY_Ukrainian_yi, 26143 },
+    { XKB_KEY_Ukrainian_YI, 26156 },
+    { XKB_KEY_Ukranian_i, 26169 },
+    { XKB_KEY_Ukranian_I, 26180 },
+    { XKB_KEY_Ukranian_je, 26191 },
+    { XKB_KEY_Ukranian_JE, 26203 },
+    { XKB_KEY_Ukranian_yi, 26215 },
+    { XKB_KEY_Ukranian_YI, 26227 },
+    { XKB_KEY_Umacron, 26239 },
+    { XKB_KEY_umacron, 26247 },
+    { XKB_KEY_underbar, 26255 },
+    { XKB_KEY_underscore, 26264 },
+    { XKB_KEY_Undo, 26275 },
+    { XKB_KEY_union, 26280 },
+    { XKB_KEY_Uogonek, 26286 },
+    { XKB_KEY_uogonek, 26294 },
+    { XKB_KEY_Up, 26302 },
+    { XKB_KEY_uparrow, 26305 },
+    { XKB_KEY_upcaret, 26313 },
+    { XKB_KEY_upleftcorner, 26321 },
+    { XKB_KEY_uprightcorner, 26334 },
+    { XKB_KEY_upshoe, 26348 },
+    { XKB_KEY_upstile, 26355 },
+    { XKB_KEY_uptack, 26363 },
+    { XKB_KEY_Uring, 26370 },
+    { XKB_KEY_uring, 26376 },
+    { XKB_KEY_User, 26382 },
+    { XKB_KEY_Utilde, 26387 },
+    { XKB_KEY_utilde, 26394 },
+    { XKB_KEY_V, 26401 },
+    { XKB_KEY_v, 26403 },
+    { XKB_KEY_variation, 26405 },
+    { XKB_KEY_vertbar, 26415 },
+    { XKB_KEY_vertconnector, 26423 },
+    { XKB_KEY_voicedsound, 26437 },
+    { XKB_KEY_VoidSymbol, 26449 },
+    { XKB_KEY_vt, 26460 },
+    { XKB_KEY_W, 26463 },
+    { XKB_KEY_w, 26465 },
+    { XKB_KEY_Wacute, 26467 },
+    { XKB_KEY_wacute, 26474 },
+    { XKB_KEY_Wcircumflex, 26481 },
+    { XKB_KEY_wcircumflex, 26493 },
+    { XKB_KEY_Wdiaeresis, 26505 },
+    { XKB_KEY_wdiaeresis, 26516 },
+    { XKB_KEY_Wgrave, 26527 },
+    { XKB_KEY_wgrave, 26534 },
+    { XKB_KEY_WonSign, 26541 },
+    { XKB_KEY_X, 26549 },
+    { XKB_KEY_x, 26551 },
+    { XKB_KEY_Xabovedot, 26553 },
+    { XKB_KEY_xabovedot, 26563 },
+    { XKB_KEY_XF86AddFavorite, 26573 },
+    { XKB_KEY_XF86ApplicationLeft, 26589 },
+    { XKB_KEY_XF86ApplicationRight, 26609 },
+    { XKB_KEY_XF86AudioCycleTrack, 26630 },
+    { XKB_KEY_XF86AudioForward, 26650 },
+    { XKB_KEY_XF86AudioLowerVolume, 26667 },
+    { XKB_KEY_XF86AudioMedia, 26688 },
+    { XKB_KEY_XF86AudioMicMute, 26703 },
+    { XKB_KEY_XF86AudioMute, 26720 },
+    { XKB_KEY_XF86AudioNext, 26734 },
+    { XKB_KEY_XF86AudioPause, 26748 },
+    { XKB_KEY_XF86AudioPlay, 26763 },
+    { XKB_KEY_XF86AudioPrev, 26777 },
+    { XKB_KEY_XF86AudioRaiseVolume, 26791 },
+    { XKB_KEY_XF86AudioRandomPlay, 26812 },
+    { XKB_KEY_XF86AudioRecord, 26832 },
+    { XKB_KEY_XF86AudioRepeat, 26848 },
+    { XKB_KEY_XF86AudioRewind, 26864 },
+    { XKB_KEY_XF86AudioStop, 26880 },
+    { XKB_KEY_XF86Away, 26894 },
+    { XKB_KEY_XF86Back, 26903 },
+    { XKB_KEY_XF86BackForward, 26912 },
+    { XKB_KEY_XF86Battery, 26928 },
+    { XKB_KEY_XF86Blue, 26940 },
+    { XKB_KEY_XF86Bluetooth, 26949 },
+    { XKB_KEY_XF86Book, 26963 },
+    { XKB_KEY_XF86BrightnessAdjust, 26972 },
+    { XKB_KEY_XF86Calculater, 26993 },
+    { XKB_KEY_XF86Calculator, 27008 },
+    { XKB_KEY_XF86Calendar, 27023 },
+    { XKB_KEY_XF86CD, 27036 },
+    { XKB_KEY_XF86Clear, 27043 },
+    { XKB_KEY_XF86ClearGrab, 27053 },
+    { XKB_KEY_XF86Close, 27067 },
+    { XKB_KEY_XF86Community, 27077 },
+    { XKB_KEY_XF86ContrastAdjust, 27091 },
+    { XKB_KEY_XF86Copy, 27110 },
+    { XKB_KEY_XF86Cut, 27119 },
+    { XKB_KEY_XF86CycleAngle, 27127 },
+    { XKB_KEY_XF86Display, 27142 },
+    { XKB_KEY_XF86Documents, 27154 },
+    { XKB_KEY_XF86DOS, 27168 },
+    { XKB_KEY_XF86Eject, 27176 },
+    { XKB_KEY_XF86Excel, 27186 },
+    { XKB_KEY_XF86Explorer, 27196 },
+    { XKB_KEY_XF86Favorites, 27209 },
+    { XKB_KEY_XF86Finance, 27223 },
+    { XKB_KEY_XF86Forward, 27235 },
+    { XKB_KEY_XF86FrameBack, 27247 },
+    { XKB_KEY_XF86FrameForward, 27261 },
+    { XKB_KEY_XF86Game, 27278 },
+    { XKB_KEY_XF86Go, 27287 },
+    { XKB_KEY_XF86Green, 27294 },
+    { XKB_KEY_XF86Hibernate, 27304 },
+    { XKB_KEY_XF86History, 27318 },
+    { XKB_KEY_XF86HomePage, 27330 },
+    { XKB_KEY_XF86HotLinks, 27343 },
+    { XKB_KEY_XF86iTouch, 27356 },
+    { XKB_KEY_XF86KbdBrightnessDown, 27367 },
+    { XKB_KEY_XF86KbdBrightnessUp, 27389 },
+    { XKB_KEY_XF86KbdLightOnOff, 27409 },
+    { XKB_KEY_XF86Launch0, 27427 },
+    { XKB_KEY_XF86Launch1, 27439 },
+    { XKB_KEY_XF86Launch2, 27451 },
+    { XKB_KEY_XF86Launch3, 27463 },
+    { XKB_KEY_XF86Launch4, 27475 },
+    { XKB_KEY_XF86Launch5, 27487 },
+    { XKB_KEY_XF86Launch6, 27499 },
+    { XKB_KEY_XF86Launch7, 27511 },
+    { XKB_KEY_XF86Launch8, 27523 },
+    { XKB_KEY_XF86Launch9, 27535 },
+    { XKB_KEY_XF86LaunchA, 27547 },
+    { XKB_KEY_XF86LaunchB, 27559 },
+    { XKB_KEY_XF86LaunchC, 27571 },
+    { XKB_KEY_XF86LaunchD, 27583 },
+    { XKB_KEY_XF86LaunchE, 27595 },
+    { XKB_KEY_XF86LaunchF, 27607 },
+    { XKB_KEY_XF86LightBulb, 27619 },
+    { XKB_KEY_XF86LogGrabInfo, 27633 },
+    { XKB_KEY_XF86LogOff, 27649 },
+    { XKB_KEY_XF86LogWindowTree, 27660 },
+    { XKB_KEY_XF86Mail, 27678 },
+    { XKB_KEY_XF86MailForward, 27687 },
+    { XKB_KEY_XF86Market, 27703 },
+    { XKB_KEY_XF86Meeting, 27714 },
+    { XKB_KEY_XF86Memo, 27726 },
+    { XKB_KEY_XF86MenuKB, 27735 },
+    { XKB_KEY_XF86MenuPB, 27746 },
+    { XKB_KEY_XF86Messenger, 27757 },
+    { XKB_KEY_XF86ModeLock, 27771 },
+    { XKB_KEY_XF86MonBrightnessDown, 27784 },
+    { XKB_KEY_XF86MonBrightnessUp, 27806 },
+    { XKB_KEY_XF86Music, 27826 },
+    { XKB_KEY_XF86MyComputer, 27836 },
+    { XKB_KEY_XF86MySites, 27851 },
+    { XKB_KEY_XF86New, 27863 },
+    { XKB_KEY_XF86News, 27871 },
+    { XKB_KEY_XF86Next_VMode, 27880 },
+    { XKB_KEY_XF86OfficeHome, 27895 },
+    { XKB_KEY_XF86Open, 27910 },
+    { XKB_KEY_XF86OpenURL, 27919 },
+    { XKB_KEY_XF86Option, 27931 },
+    { XKB_KEY_XF86Paste, 27942 },
+    { XKB_KEY_XF86Phone, 27952 },
+    { XKB_KEY_XF86Pictures, 27962 },
+    { XKB_KEY_XF86PowerDown, 27975 },
+    { XKB_KEY_XF86PowerOff, 27989 },
+    { XKB_KEY_XF86Prev_VMode, 28002 },
+    { XKB_KEY_XF86Q, 28017 },
+    { XKB_KEY_XF86Red, 28023 },
+    { XKB_KEY_XF86Refresh, 28031 },
+    { XKB_KEY_XF86Reload, 28043 },
+    { XKB_KEY_XF86Reply, 28054 },
+    { XKB_KEY_XF86RockerDown, 28064 },
+    { XKB_KEY_XF86RockerEnter, 28079 },
+    { XKB_KEY_XF86RockerUp, 28095 },
+    { XKB_KEY_XF86RotateWindows, 28108 },
+    { XKB_KEY_XF86RotationKB, 28126 },
+    { XKB_KEY_XF86RotationPB, 28141 },
+    { XKB_KEY_XF86Save, 28156 },
+    { XKB_KEY_XF86ScreenSaver, 28165 },
+    { XKB_KEY_XF86ScrollClick, 28181 },
+    { XKB_KEY_XF86ScrollDown, 28197 },
+    { XKB_KEY_XF86ScrollUp, 28212 },
+    { XKB_KEY_XF86Search, 28225 },
+    { XKB_KEY_XF86Select, 28236 },
+    { XKB_KEY_XF86Send, 28247 },
+    { XKB_KEY_XF86Shop, 28256 },
+    { XKB_KEY_XF86Sleep, 28265 },
+    { XKB_KEY_XF86Spell, 28275 },
+    { XKB_KEY_XF86SplitScreen, 28285 },
+    { XKB_KEY_XF86Standby, 28301 },
+    { XKB_KEY_XF86Start, 28313 },
+    { XKB_KEY_XF86Stop, 28323 },
+    { XKB_KEY_XF86Subtitle, 28332 },
+    { XKB_KEY_XF86Support, 28345 },
+    { XKB_KEY_XF86Suspend, 28357 },
+    { XKB_KEY_XF86Switch_VT_1, 28369 },
+    { XKB_KEY_XF86Switch_VT_10, 28385 },
+    { XKB_KEY_XF86Switch_VT_11, 28402 },
+    { XKB_KEY_XF86Switch_VT_12, 28419 },
+    { XKB_KEY_XF86Switch_VT_2, 28436 },
+    { XKB_KEY_XF86Switch_VT_3, 28452 },
+    { XKB_KEY_XF86Switch_VT_4, 28468 },
+    { XKB_KEY_XF86Switch_VT_5, 28484 },
+    { XKB_KEY_XF86Switch_VT_6, 28500 },
+    { XKB_KEY_XF86Switch_VT_7, 28516 },
+    { XKB_KEY_XF86Switch_VT_8, 28532 },
+    { XKB_KEY_XF86Switch_VT_9, 28548 },
+    { XKB_KEY_XF86TaskPane, 28564 },
+    { XKB_KEY_XF86Terminal, 28577 },
+    { XKB_KEY_XF86Time, 28590 },
+    { XKB_KEY_XF86ToDoList, 28599 },
+    { XKB_KEY_XF86Tools, 28612 },
+    { XKB_KEY_XF86TopMenu, 28622 },
+    { XKB_KEY_XF86TouchpadOff, 28634 },
+    { XKB_KEY_XF86TouchpadOn, 28650 },
+    { XKB_KEY_XF86TouchpadToggle, 28665 },
+    { XKB_KEY_XF86Travel, 28684 },
+    { XKB_KEY_XF86Ungrab, 28695 },
+    { XKB_KEY_XF86User1KB, 28706 },
+    { XKB_KEY_XF86User2KB, 28718 },
+    { XKB_KEY_XF86UserPB, 28730 },
+    { XKB_KEY_XF86UWB, 28741 },
+    { XKB_KEY_XF86VendorHome, 28749 },
+    { XKB_KEY_XF86Video, 28764 },
+    { XKB_KEY_XF86View, 28774 },
+    { XKB_KEY_XF86WakeUp, 28783 },
+    { XKB_KEY_XF86WebCam, 28794 },
+    { XKB_KEY_XF86WheelButton, 28805 },
+    { XKB_KEY_XF86WLAN, 28821 },
+    { XKB_KEY_XF86Word, 28830 },
+    { XKB_KEY_XF86WWW, 28839 },
+    { XKB_KEY_XF86Xfer, 28847 },
+    { XKB_KEY_XF86Yellow, 28856 },
+    { XKB_KEY_XF86ZoomIn, 28867 },
+    { XKB_KEY_XF86ZoomOut, 28878 },
+    { XKB_KEY_Y, 28890 },
+    { XKB_KEY_y, 28892 },
+    { XKB_KEY_Yacute, 28894 },
+    { XKB_KEY_yacute, 28901 },
+    { XKB_KEY_Ybelowdot, 28908 },
+    { XKB_KEY_ybelowdot, 28918 },
+    { XKB_KEY_Ycircumflex, 28928 },
+    { XKB_KEY_ycircumflex, 28940 },
+    { XKB_KEY_ydiaeresis, 28952 },
+    { XKB_KEY_Ydiaeresis, 28963 },
+    { XKB_KEY_yen, 28974 },
+    { XKB_KEY_Ygrave, 28978 },
+    { XKB_KEY_ygrave, 28985 },
+    { XKB_KEY_Yhook, 28992 },
+    { XKB_KEY_yhook, 28998 },
+    { XKB_KEY_Ytilde, 29004 },
+    { XKB_KEY_ytilde, 29011 },
+    { XKB_KEY_Z, 29018 },
+    { XKB_KEY_z, 29020 },
+    { XKB_KEY_Zabovedot, 29022 },
+    { XKB_KEY_zabovedot, 29032 },
+    { XKB_KEY_Zacute, 29042 },
+    { XKB_KEY_zacute, 29049 },
+    { XKB_KEY_Zcaron, 29056 },
+    { XKB_KEY_zcaron, 29063 },
+    { XKB_KEY_Zen_Koho, 29070 },
+    { XKB_KEY_Zenkaku, 29079 },
+    { XKB_KEY_Zenkaku_Hankaku, 29087 },
+    { XKB_KEY_zerosubscript, 29103 },
+    { XKB_KEY_zerosuperior, 29117 },
+    { XKB_KEY_Zstroke, 29130 },
+    { XKB_KEY_zstroke, 29138 },
+};
+
+static const int32_t name_to_keysym_displace[] = {
+    6, -4, 1, 5, 3, 9, 33, -16,
+    10, 1, 1, -22, 0, 13, 0, -40,
+    6, 2, 1, 0, 4, 4, -52, 2,
+    -66, 1, 13, 5, -71, 1, 1, 0,
+    1, 1, 2, -77, 0, -93, 1, 1,
+    1, 1, -107, 3, -108, -115, 1, -117,
+    -120, -125, 4, 1, 1, 8, 2, 0,
+    -130, 4, 4, 3, 6, 1, 2, 3,
+    -141, 4, 12, -147, 2, 0, -149, -152,
+    3, 6, 3, 0, -156, -160, 19, -162,
+    1, -170, 15, 1, 1, 1, 10, 0,
+    1, -179, 10, 16, 8, -184, -188, 6,
+    1, 3, -196, 1, 0, 0, 2, 8,
+    -214, 0, 0, 1, -225, -230, -241, -243,
+    2, 17, 5, 0, -252, 5, 3, 5,
+    6, 7, 1, 2, 22, 1, 3, 0,
+    1, -261, 1, -273, 0, 1, -276, 2,
+    20, 2, -290, 17, -309, 6, -311, 3,
+    1, 1, 0, -317, -322, -326, 7, 1,
+    4, 0, -335, 12, 2, 5, 5, -338,
+    -365, -366, 3, -368, 2, 32, -369, 14,
+    -373, -379, -383, 1, 3, -402, 5, 2,
+    7, 1, 9, 8, 3, -406, -410, 1,
+    0, -420, 5, 1, 1, 1, -437, 4,
+    -470, 6, 8, 10, 2, 1, 5, 2,
+    8, 1, -472, 2, 1, 1, 3, 0,
+    0, 1, 9, 3, -473, 0, -483, -493,
+    -502, 10, -508, 4, 21, 1, 36, 1,
+    -512, 2, 10, 0, 0, 2, -517, 1,
+    1, 3, 48, 0, 3, -520, 8, -525,
+    2, -537, -542, -545, -547, 3, 10, 16,
+    5, -555, 1, 1, 3, -561, -572, -584,
+    2, 1, 1, -588, 13, 3, 1, -591,
+    0, 0, -596, 31, 0, 6, 0, 5,
+    1, -600, -601, 10, -604, 2, 2, 9,
+    0, 7, 0, 0, 15, 2, 11, 0,
+    0, -609, -611, 18, 4, 4, 3, 0,
+    -617, 16, -627, -630, 29, -634, 0, 3,
+    0, 3, 1, -641, 0, 0, 1, 0,
+    3, 1, 8, -644, 1, 7, 1, -647,
+    -653, 1, 0, 1, 0, 2, 11, 23,
+    1, 2, -654, 10, -660, 4, -663, 0,
+    -667, 1, -689, 2, 1, 0, 0, 1,
+    2, 1, 5, -697, 0, -699, 6, 1,
+    3, -724, 6, -740, 1, 7, 1, -748,
+    4, 0, 2, -756, -776, 2, 2, 7,
+    -777, 0, -781, 1, -789, -793, 10, 2,
+    2, 1, -794, -800, 5, 6, 4, 0,
+    26, -801, 0, 1, 0, 7, 92, 1,
+    15, 0, 0, 2, 1, -802, 1, 3,
+    -809, 1, 3, 11, 5, 2, -824, 0,
+    2, 2, -826, -828, -829, 3, 30, 5,
+    2, 34, 6, -831, -849, -855, 3, 1,
+    4, 1, 8, -857, -888, -889, -897, -904,
+    8, 28, 1, 8, 2, 5, 72, 0,
+    -908, -911, 3, 0, 5, 24, -919, 38,
+    -936, 8, -943, 7, 0, -951, 3, 25,
+    7, 0, 0, 3, 0, 0, 106, 7,
+    -970, 0, 0, 3, -972, 0, 2, 1,
+    1, -975, 79, 10, 9, -985, 0, 6,
+    3, 11, -987, 1, 3, -988, 11, -993,
+    2, 11, 1, 13, 13, 6, 24, 11,
+    -996, -1004, -1006, 2, 4, -1009, 1, -1012,
+    4, 1, 3, 10, -1013, 11, 7, 40,
+    65, 10, 43, 3, 6, -1014, -1016, -1020,
+    0, 8, 1, -1038, -1039, -1041, 2, -1058,
+    0, 20, 17, 2, 4, -1064, 4, 9,
+    4, 6, -1065, -1072, 2, 0, 1, 1,
+    2, 1, -1096, 6, 43, -1112, -1114, 1,
+    34, 1, 2, 0, 4, 0, 4, -1119,
+    -1142, 3, 2, 15, 19, 71, -1161, 0,
+    3, 0, 78, 11, 1, -1166, -1168, -1178,
+    1, 3, -1181, 7, 9, 0, 1, 1,
+    0, -1189, 5, 1, 0, 3, 6, -1209,
+    -1219, 47, 2, 0, 29, -1223, -1225, -1226,
+    0, 4, -1228, 31, -1233, -1238, 25, -1241,
+    -1247, 1, -1263, 0, 15, 0, -1264, 4,
+    -1279, 2, 102, -1280, 10, 15, 9, 2,
+    13, 0, 0, 30, 7, 31, 4, 0,
+    -1284, 3, -1293, -1297, 2, 2, 0, 2,
+    2, 3, 1, 5, -1300, 10, 19, 6,
+    0, -1311, -1346, 7, 0, 0, -1356, 0,
+    -1359, -1371, -1379, 0, -1384, 19, 41, 56,
+    5, 50, 2, -1387, -1393, -1396, 42, -1397,
+    -1399, 4, 3, 19, -1401, 10, -1404, 1,
+    3, 32, 14, 27, 0, 1, 4, 7,
+    15, 33, -1417, -1419, 0, 41, 1, 6,
+    -1428, -1442, 3, 4, 17, 4, 44, 4,
+    -1452, 19, 37, -1456, 6, 1, 0, 9,
+    0, 7, 102, 0, 1, 4, 141, 3,
+    0, -1473, -1476, 2, 20, 35, -1483, 4,
+    1, 2, 3, 0, 8, 35, 23, 0,
+    3, 4, 1, -1511, 5, 17, 1, 0,
+    4, -1512, -1520, -1521, 0, -1526, 16, 16,
+    8, 1, 14, 0, 1, 15, 61, 58,
+    7, 13, -1538, -1544, 3, 2, 5, 0,
+    45, 32, 16, 4, 2, -1553, 20, -1586,
+    15, 0, -1594, 21, 5, 2, 4, 13,
+    1, 3, 28, 0, 0, 7, 2, -1601,
+    3, 3, 1, -1607, 0, 1, 2, 6,
+    1, 0, 5, -1613, -1617, -1619, 11, 0,
+    -1627, 0, -1637, -1639, 4, 6, 4, 1,
+    2, 1, 1, 2, 1, -1642, 4, 34,
+    -1658, 3, -1660, 10, 4, 22, 16, -1675,
+    37, -1682, 5, -1685, 2, 28, 3, -1694,
+    3, 20, 0, 1, 3, 3, 3, 1,
+    6, 1, 4, 26, 21, 0, 0, 20,
+    26, -1696, -1699, 1, 18, -1714, 1, 4,
+    0, 1, 1, -1725, 0, 4, -1728, 36,
+    3, -1731, 2, 1, 39, -1732, 20, 0,
+    3, 8, -1734, 2, 1, -1736, 37, 13,
+    -1742, 1, 20, 0, 5, 1, -1747, 0,
+    -1751, 0, 1, 2, 5, 78, 37, 22,
+    68, -1760, 14, 0, 43, -1782, 0, 8,
+    2, -1785, 12, 16, 6, -1789, 35, 64,
+    7, -1791, 4, 2, -1793, 0, -1796, 0,
+    7, 0, 1, 0, 22, 0, 1, 4,
+    3, 8, 10, -1808, 22, 1, 0, -1809,
+    8, -1810, 13, -1813, 14, 1, 37, 22,
+    17, 1, 1, 1, 4, 4, 32, 72,
+    0, -1821, 6, 3, 0, 17, 3, -1830,
+    15, -1840, 0, 2, 8, 0, 0, 6,
+    -1850, 1, -1861, 0, -1883, 5, 1, 5,
+    -1891, -1899, 37, 4, -1900, 8, 5, 92,
+    0, -1910, 3, 11, 1, 15, -1913, 5,
+    39, 3, -1919, 8, -1925, 34, 81, 2,
+    -1946, -1947, 0, -1956, 2, 3, 9, 11,
+    28, -1971, -1984, 4, -1992, 0, 4, 2,
+    14, 41, -1998, 0, 34, -2001, -2011, 34,
+    3, 0, 29, 15, 0, 1, 7, -2012,
+    25, 5, 19, 10, 3, -2021, 3, 8,
+    -2025, 3, 32, -2040, -2050, 31, 4, 19,
+    59, 3, 11, 8, 4, -2075, 3, 0,
+    -2083, -2094, 59, -2095, 13, -2116, -2117, 0,
+    27, 0, 9, -2119, 0, 4, 2, 3,
+    0, 1, 7, 3, 2, 7, 2, 2,
+    9, 2, 42, 52, -2122, 5, -2128, 0,
+    19, 1, 4, -2129, 40, 14, 1, 1,
+    67, 0, -2141, 23, -2153, 7, 36, 66,
+    7, 14, -2165, 20, -2168, -2182, 57, -2191,
+    50, 14, 1, 2, 6, 9, -2199, -2202,
+    -2205, -2207, 13, 132, -2212, 40, 5, 114,
+    16, 48, 28, 17, -2255, 0, 9, 0,
+    0, 0, 1, 12, 66, 224, 0, 12,
+    0, 0, 37, 1, 0, 105, -2277, 162,
+    2, 3, 63, 148, 18, 1, 11, 0,
+    30, 3, -2280, -2289, -2310, 0, -2317, 9,
+    29, 1, 5, 97, 0, -2325, 1, -2329,
+    -2339, 9, 80, 41, -2357, 56, 257, 14,
+    20, -2364, -2375, 1, 5, -2378, 112,
+};
+
+static const uint16_t name_to_keysym_index[] = {
+    702, 834, 568, 441, 2370, 2007, 877, 450,
+    674, 811, 1937, 1394, 412, 939, 1550, 1450,
+    1690, 847, 160, 1241, 2222, 52, 1837, 1857,
+    666, 531, 774, 1814, 1524, 72, 569, 551,
+    184, 1501, 890, 2170, 2078, 823, 1781, 895,
+    1075, 2291, 1730, 1479, 397, 233, 724, 917,
+    2346, 462, 2215, 391, 1839, 1666, 1880, 1840,
+    1741, 642, 1477, 1863, 1604, 1772, 592, 573,
+    486, 1118, 1819, 1124, 223, 177, 1094, 1327,
+    963, 2072, 1874, 286, 1028, 1317, 1585, 30,
+    56, 390, 1385, 822, 1882, 2217, 1483, 1577,
+    125, 375, 721, 1639, 2156, 532, 2030, 2355,
+    1716, 95, 591, 838, 918, 2224, 1844, 2282,
+    1103, 1457, 747, 942, 224, 366, 1890, 61,
+    694, 2112, 853, 33, 2080, 736, 1778, 2220,
+    2349, 252, 1404, 364, 467, 933, 1350, 1234,
+    2044, 372, 1886, 1921, 1458, 1162, 1189, 967,
+    65, 2197, 943, 940, 1469, 1036, 632, 1865,
+    1527, 1815, 2119, 1700, 190, 306, 1557, 2281,
+    1171, 1142, 1520, 2221, 1549, 1467, 1605, 1436,
+    1009, 354, 1035, 1166, 767, 1038, 1706, 1726,
+    1843, 1609, 1336, 448, 11, 936, 2367, 1266,
+    1084, 816, 1365, 710, 1156, 1521, 400, 1573,
+    1159, 2246, 275, 1590, 2202, 2267, 700, 929,
+    829, 1399, 589, 972, 1992, 1505, 638, 1624,
+    713, 1165, 812, 1820, 203, 290, 373, 452,
+    187, 2193, 155, 482, 1509, 2302, 2087, 2082,
+    2149, 1835, 2116, 1939, 804, 1630, 1975, 1233,
+    727, 9, 2064, 1687, 67, 759, 108, 2009,
+    620, 1565, 1256, 1173, 1290, 248, 2250, 2161,
+    1628, 1273, 633, 2351, 1021, 840, 1760, 843,
+    824, 1125, 195, 1748, 2205, 1963, 1254, 1917,
+    1484, 2035, 2171, 2321, 135, 2247, 154, 1737,
+    1464, 2372, 1742, 2043, 497, 407, 1259, 1885,
+    1767, 634, 581, 957, 2210, 781, 2239, 1375,
+    1528, 422, 831, 1651, 1161, 1774, 470, 1092,
+    227, 1079, 856, 1210, 1642, 188, 2166, 1120,
+    396, 2338, 2364, 1492, 1962, 636, 2241, 2339,
+    1602, 2331, 1868, 1131, 821, 1169, 222, 121,
+    1611, 2306, 891, 2042, 277, 1776, 1804, 1643,
+    523, 928, 1969, 667, 471, 1994, 964, 1427,
+    314, 194, 1463, 2293, 1953, 1155, 1861, 1465,
+    105, 199, 212, 1014, 1765, 1295, 295, 1110,
+    2299, 648, 2012, 368, 1353, 2187, 347, 1852,
+    1020, 2025, 1372, 416, 285, 323, 2182, 826,
+    723, 527, 1610, 1121, 1635, 1871, 878, 1799,
+    1920, 2137, 1507, 1248, 1721, 1553, 1023, 1946,
+    1360, 6, 1198, 1571, 1148, 1314, 460, 2145,
+    338, 1396, 1405, 492, 246, 857, 806, 430,
+    965, 2255, 657, 875, 1323, 1568, 2216, 1989,
+    571, 180, 1785, 78, 902, 376, 1027, 1845,
+    1959, 599, 827, 2341, 1803, 503, 2081, 1637,
+    60, 17, 1526, 706, 82, 512, 228, 2231,
+    1541, 801, 256, 1655, 2359, 879, 1944, 1326,
+    2213, 1395, 2356, 1928, 226, 215, 1678, 587,
+    2008, 1305, 1286, 483, 737, 1146, 1179, 2357,
+    1995, 2050, 2328, 1200, 1536, 978, 1816, 2148,
+    854, 185, 509, 1938, 2000, 576, 791, 249,
+    1258, 1957, 2332, 140, 1828, 1056, 2240, 504,
+    2172, 1596, 567, 1579, 1732, 1564, 357, 1669,
+    2133, 1042, 508, 1143, 2129, 722, 1356, 1598,
+    1789, 440, 1510, 1841, 1766, 792, 1866, 560,
+    410, 1617, 1740, 1089, 1903, 1907, 1797, 2397,
+    1176, 1218, 656, 669, 1223, 142, 1080, 1990,
+    629, 1039, 166, 1503, 1812, 1224, 2046, 2053,
+    1144, 1010, 688, 920, 578, 1592, 1912, 2034,
+    1670, 1140, 1860, 1636, 608, 1499, 1768, 322,
+    2096, 2033, 1081, 730, 1756, 679, 733, 867,
+    1680, 2026, 2092, 709, 1913, 2022, 1838, 1508,
+    1694, 872, 1826, 129, 2388, 631, 1752, 635,
+    1057, 279, 1582, 1048, 70, 2124, 1555, 2011,
+    378, 1251, 1382, 714, 1561, 598, 157, 825,
+    1915, 1062, 1412, 715, 1743, 1923, 1805, 1908,
+    2036, 126, 1472, 1288, 1654, 802, 1916, 540,
+    1025, 956, 740, 1614, 602, 640, 841, 1268,
+    870, 595, 1936, 2106, 1712, 992, 2102, 1069,
+    1167, 1625, 613, 2218, 1147, 240, 293, 1801,
+    1895, 1170, 2055, 1608, 516, 2236, 983, 1638,
+    2020, 484, 1827, 1997, 506, 2276, 1761, 1053,
+    351, 974, 2045, 955, 283, 2219, 1127, 1514,
+    2125, 1074, 1798, 909, 1633, 1708, 977, 2198,
+    2380, 2108, 418, 704, 1898, 2185, 778, 521,
+    954, 697, 534, 73, 844, 779, 799, 49,
+    1117, 417, 43, 1011, 2278, 1315, 935, 394,
+    1237, 1067, 558, 1220, 320, 193, 41, 1973,
+    2113, 1833, 570, 905, 496, 137, 1878, 1578,
+    1632, 2391, 511, 234, 1873, 1008, 707, 1003,
+    554, 913, 2385, 681, 869, 2097, 743, 1851,
+    209, 336, 0, 1334, 1102, 436, 889, 2031,
+    1226, 334, 1083, 1870, 1043, 1947, 232, 183,
+    2249, 2365, 433, 208, 1158, 205, 2384, 1739,
+    1374, 2037, 36, 1971, 379, 2047, 438, 1310,
+    2238, 612, 919, 1269, 1291, 2317, 1601, 472,
+    1822, 118, 1448, 550, 261, 575, 1306, 529,
+    2271, 2004, 1319, 1563, 808, 1087, 1283, 639,
+    2262, 536, 1230, 1116, 1745, 703, 1054, 1807,
+    251, 850, 758, 887, 2203, 1122, 2344, 1030,
+    2168, 104, 1538, 839, 1714, 2041, 161, 153,
+    1498, 374, 998, 2368, 131, 651, 535, 1855,
+    662, 719, 100, 1715, 1701, 2093, 2150, 1482,
+    682, 1114, 39, 1892, 2052, 1693, 1904, 2083,
+    1445, 934, 1440, 1328, 772, 381, 1662, 577,
+    282, 284, 1932, 1664, 1763, 611, 1576, 1446,
+    2136, 260, 1, 1540, 783, 2132, 139, 1206,
+    132, 369, 1130, 2325, 1263, 744, 999, 2028,
+    455, 1922, 871, 119, 2051, 1544, 1518, 2098,
+    1007, 1346, 38, 1667, 559, 1488, 1216, 621,
+    1151, 2089, 1783, 750, 2295, 756, 763, 685,
+    2343, 198, 2155, 1517, 863, 1792, 1088, 649,
+    101, 989, 948, 1647, 2292, 312, 1289, 1569,
+    1623, 1060, 457, 1442, 2120, 324, 398, 1581,
+    238, 959, 221, 2248, 1245, 2376, 565, 1644,
+    1487, 54, 395, 2060, 1296, 2019, 156, 1881,
+    1724, 849, 1432, 660, 1437, 941, 2154, 1713,
+    2256, 1534, 1420, 1086, 170, 626, 7, 1688,
+    365, 507, 2178, 1599, 2233, 186, 1435, 1747,
+    1361, 1362, 1001, 287, 268, 117, 1698, 610,
+    169, 1648, 1725, 1697, 211, 552, 272, 1597,
+    147, 1545, 1019, 971, 852, 1378, 1869, 566,
+    671, 753, 1620, 1757, 1138, 145, 259, 2059,
+    480, 18, 768, 330, 1242, 1979, 257, 2375,
+    1192, 1299, 1720, 1985, 1897, 1095, 705, 1246,
+    907, 1673, 427, 1257, 1076, 961, 28, 735,
+    1260, 1848, 123, 1447, 1051, 991, 748, 1366,
+    858, 1476, 1451, 377, 127, 903, 938, 900,
+    837, 1126, 1343, 1293, 1231, 1558, 1677, 385,
+    2228, 1531, 1400, 2298, 453, 1455, 1421, 200,
+    491, 2353, 1671, 2382, 1773, 342, 1910, 310,
+    380, 1379, 23, 2073, 1207, 411, 1566, 426,
+    652, 1222, 848, 1506, 1188, 1478, 914, 1595,
+    1082, 1034, 393, 42, 868, 1163, 754, 1227,
+    658, 2181, 553, 1572, 1512, 524, 1154, 1935,
+    281, 556, 788, 2118, 98, 1100, 2029, 1046,
+    225, 1099, 1834, 1386, 2146, 1149, 2039, 1333,
+    888, 582, 2162, 447, 1249, 1663, 1137, 172,
+    2163, 1516, 1864, 1686, 1240, 2360, 580, 605,
+    562, 654, 2330, 2342, 1406, 454, 760, 1351,
+    1312, 984, 1370, 247, 1672, 2345, 1430, 2127,
+    1107, 1160, 1622, 973, 1243, 2074, 1431, 242,
+    1809, 1145, 751, 2128, 616, 1779, 1562, 1183,
+    1580, 2389, 2269, 2206, 1309, 1376, 490, 10,
+    1270, 339, 1347, 2305, 2312, 1181, 2273, 624,
+    1888, 2195, 1211, 1320, 2212, 1460, 84, 1135,
+    2275, 2348, 71, 1777, 794, 684, 874, 526,
+    1345, 815, 1229, 2110, 2123, 1393, 1462, 2358,
+    996, 1369, 584, 695, 204, 1342, 975, 437,
+    893, 358, 305, 1441, 1384, 473, 1960, 987,
+    548, 1411, 1133, 1924, 143, 313, 304, 1723,
+    1972, 614, 2160, 2068, 1703, 1271, 297, 2141,
+    362, 2266, 1072, 1219, 2237, 425, 795, 13,
+    434, 1613, 487, 528, 2135, 1059, 219, 1294,
+    2287, 178, 111, 2165, 2301, 309, 752, 2257,
+    1593, 1471, 367, 884, 269, 734, 1050, 458,
+    533, 1363, 976, 1657, 1791, 904, 1085, 2071,
+    359, 628, 796, 1413, 1228, 2303, 174, 2290,
+    206, 40, 1914, 22, 1787, 2261, 1502, 604,
+    2209, 2139, 173, 1031, 403, 1153, 1811, 1755,
+    701, 1367, 428, 2395, 845, 1423, 549, 213,
+    593, 2015, 1918, 276, 69, 58, 128, 1950,
+    1340, 2252, 646, 1000, 461, 468, 343, 1583,
+    298, 818, 93, 738, 81, 1077, 1278, 2183,
+    464, 1355, 318, 171, 561, 2111, 2131, 106,
+    1491, 2394, 1443, 1808, 1373, 1806, 2208, 1790,
+    1684, 675, 1368, 1940, 2159, 619, 333, 1535,
+    1872, 271, 1490, 2094, 415, 1202, 1063, 46,
+    302, 2099, 786, 2258, 317, 164, 530, 1877,
+    1429, 1468, 2373, 1495, 691, 68, 1419, 1214,
+    2173, 1705, 2134, 371, 1016, 1022, 1466, 1199,
+    1679, 1253, 1899, 1409, 644, 1261, 680, 2067,
+    739, 465, 1511, 2296, 505, 1993, 725, 2006,
+    2024, 1274, 1650, 253, 445, 1731, 331, 12,
+    1139, 27, 925, 144, 1426, 2322, 76, 886,
+    1108, 1236, 1071, 860, 2310, 2109, 230, 1853,
+    1769, 1543, 262, 1934, 1983, 2253, 1325, 1887,
+    14, 2190, 25, 924, 585, 515, 726, 44,
+    2005, 1786, 1252, 280, 1033, 1665, 307, 1029,
+    1225, 1390, 851, 1247, 757, 2105, 699, 265,
+    1318, 1641, 1052, 1570, 809, 1388, 2211, 114,
+    1164, 1900, 1734, 1397, 708, 1836, 755, 1619,
+    1494, 2101, 1422, 2377, 388, 150, 2245, 865,
+    1018, 1965, 1338, 16, 389, 1341, 1178, 2223,
+    908, 175, 1902, 420, 316, 1942, 846, 2307,
+    289, 2174, 1682, 474, 196, 477, 2158, 1408,
+    363, 1896, 1473, 729, 421, 622, 158, 90,
+    2300, 2268, 842, 951, 2062, 830, 1098, 665,
+    1796, 2383, 92, 563, 1948, 1754, 1951, 64,
+    2164, 716, 115, 83, 401, 1736, 332, 2103,
+    1810, 1371, 789, 547, 985, 513, 1966, 937,
+    245, 1519, 2225, 2327, 152, 514, 239, 355,
+    2347, 1674, 1744, 217, 782, 1357, 1433, 47,
+    1244, 538, 1589, 327, 1733, 274, 1784, 1213,
+    1746, 2366, 1279, 627, 1313, 163, 1106, 1649,
+    165, 99, 2084, 2352, 2334, 1859, 1681, 1195,
+    134, 1621, 1999, 1364, 2379, 2336, 55, 833,
+    683, 2319, 311, 980, 1984, 1696, 1344, 596,
+    1707, 546, 1489, 1970, 1066, 1559, 264, 1987,
+    1911, 110, 609, 1645, 1337, 141, 601, 299,
+    2014, 1586, 1308, 659, 2254, 35, 1064, 498,
+    1710, 1061, 1196, 1889, 1113, 300, 2079, 1332,
+    1981, 3, 742, 1449, 1090, 1591, 1818, 1197,
+    1415, 947, 678, 254, 103, 258, 2363, 278,
+    1978, 1424, 2309, 2142, 862, 1699, 2369, 344,
+    231, 218, 1906, 1065, 2323, 2018, 775, 2371,
+    1168, 1695, 2333, 2152, 2069, 1417, 2143, 931,
+    2350, 787, 2130, 19, 1738, 2329, 75, 2189,
+    1180, 1418, 1329, 859, 2251, 1497, 1661, 2199,
+    1174, 63, 21, 1584, 970, 2186, 1842, 1554,
+    564, 650, 625, 597, 475, 1659, 499, 1646,
+    1186, 670, 1658, 1606, 361, 2010, 1058, 689,
+    693, 1284, 731, 1530, 930, 1832, 1821, 485,
+    1548, 1685, 1702, 1359, 1758, 776, 1005, 663,
+    2390, 1588, 1817, 1453, 444, 1172, 1824, 1879,
+    1091, 1275, 820, 932, 1513, 1856, 370, 4,
+    1941, 1068, 1004, 590, 2048, 2280, 1909, 1302,
+    1132, 2316, 120, 216, 910, 1459, 1919, 1618,
+    615, 1753, 637, 2279, 543, 2188, 409, 1381,
+    960, 1040, 1793, 1470, 321, 1276, 443, 1377,
+    995, 1691, 1829, 1391, 1267, 1221, 273, 1012,
+    1676, 1026, 2057, 1205, 2088, 1212, 906, 2392,
+    1575, 1683, 1255, 402, 2313, 762, 653, 864,
+    2107, 990, 1157, 1311, 1958, 1282, 1277, 2264,
+    1653, 2167, 641, 2075, 244, 1539, 2138, 335,
+    1111, 2063, 1991, 243, 2002, 2095, 1782, 1055,
+    2001, 711, 2200, 291, 1522, 732, 1933, 1339,
+    2284, 2175, 77, 446, 1750, 2144, 2294, 2061,
+    2049, 882, 59, 1425, 1324, 340, 1461, 1603,
+    1250, 2381, 1542, 510, 1717, 2114, 2038, 785,
+    2244, 466, 1929, 770, 2318, 325, 950, 1474,
+    885, 1537, 32, 267, 1867, 819, 1964, 2320,
+    1104, 1152, 1006, 861, 1515, 2297, 406, 386,
+    1403, 2151, 922, 476, 329, 136, 945, 1525,
+    1262, 20, 741, 235, 771, 2337, 1770, 1015,
+    270, 876, 419, 873, 800, 1194, 1115, 1398,
+    807, 2354, 647, 1428, 797, 2117, 2386, 348,
+    881, 1037, 1656, 1967, 176, 1675, 2191, 813,
+    1930, 2177, 2229, 1235, 912, 2076, 1380, 1352,
+    1358, 1486, 1201, 456, 1304, 1349, 953, 2201,
+    883, 133, 1858, 1190, 1481, 478, 2315, 2274,
+    690, 986, 1101, 1612, 1689, 1728, 1925, 784,
+    672, 673, 326, 1846, 192, 37, 179, 1215,
+    26, 1850, 1711, 162, 149, 916, 1185, 583,
+    1759, 2157, 1704, 353, 1264, 494, 1949, 2086,
+    382, 1943, 525, 146, 1727, 780, 1945, 2227,
+    392, 618, 2147, 2263, 1301, 2003, 423, 579,
+    923, 435, 1875, 1955, 2286, 151, 2100, 1504,
+    817, 2340, 1322, 1232, 720, 2, 2283, 1893,
+    1560, 2126, 1692, 1764, 1891, 31, 250, 2378,
+    383, 88, 542, 522, 915, 1883, 1556, 481,
+    643, 946, 1722, 2013, 87, 655, 501, 1389,
+    1175, 91, 696, 424, 2180, 48, 1729, 2226,
+    1749, 2077, 698, 2259, 2153, 130, 74, 1187,
+    1354, 350, 220, 810, 112, 1485, 600, 303,
+    2104, 102, 828, 798, 1208, 606, 1184, 2090,
+    1204, 1968, 182, 1998, 408, 86, 2396, 315,
+    793, 1438, 790, 2335, 1751, 2140, 1335, 1876,
+    1177, 926, 686, 1952, 952, 2311, 1078, 79,
+    1660, 997, 880, 1238, 1209, 1331, 1631, 1298,
+    1523, 1292, 2243, 2374, 210, 2017, 1129, 988,
+    328, 53, 2324, 469, 1607, 1141, 29, 769,
+    5, 1281, 107, 1493, 1901, 2304, 2393, 617,
+    1045, 1456, 630, 555, 1265, 1976, 1830, 201,
+    2058, 1134, 1762, 1847, 668, 405, 607, 1402,
+    1500, 574, 1032, 921, 1600, 431, 2361, 1203,
+    1823, 113, 519, 969, 572, 1719, 911, 404,
+    766, 8, 2115, 488, 124, 661, 2242, 892,
+    1905, 167, 1414, 489, 1128, 1285, 1627, 181,
+    502, 1097, 1567, 168, 761, 1150, 2326, 15,
+    319, 1191, 2021, 966, 294, 1532, 1977, 2204,
+    1802, 62, 1316, 777, 765, 1348, 1330, 45,
+    1454, 89, 832, 2184, 899, 1854, 1123, 255,
+    545, 1272, 237, 341, 451, 459, 1017, 1387,
+    207, 2234, 958, 645, 94, 2235, 814, 296,
+    1496, 1529, 214, 479, 1475, 603, 1546, 749,
+    1119, 229, 1615, 2179, 728, 1439, 345, 1533,
+    2272, 1002, 1307, 1044, 1986, 414, 2027, 1182,
+    236, 1287, 968, 1444, 346, 2192, 1849, 1961,
+    266, 1894, 51, 1452, 1049, 413, 1831, 80,
+    962, 803, 1193, 1709, 241, 677, 866, 2091,
+    1407, 2066, 623, 1956, 2054, 2362, 2016, 1105,
+    1884, 263, 1788, 292, 1718, 24, 994, 855,
+    2214, 2065, 1410, 1813, 2207, 1629, 537, 544,
+    2314, 85, 692, 1668, 1093, 1931, 520, 1587,
+    539, 1735, 897, 148, 1927, 1392, 1594, 2270,
+    1652, 687, 1982, 717, 50, 894, 1073, 1980,
+    1800, 1547, 301, 97, 746, 586, 1480, 116,
+    1112, 495, 1401, 2308, 2121, 1771, 1136, 1825,
+    2023, 676, 1954, 2260, 1640, 896, 1297, 944,
+    2232, 159, 352, 1321, 1383, 541, 1070, 288,
+    982, 1795, 122, 836, 202, 66, 138, 773,
+    517, 2194, 2289, 2085, 449, 898, 764, 191,
+    927, 557, 439, 981, 805, 1280, 1552, 594,
+    109, 1013, 384, 2032, 34, 387, 835, 2196,
+    432, 1862, 2387, 360, 1217, 1616, 993, 1996,
+    1634, 1109, 463, 1926, 2277, 1416, 337, 2265,
+    2122, 356, 979, 1303, 1047, 429, 2230, 2040,
+    588, 1780, 518, 718, 1988, 2070, 1626, 442,
+    96, 189, 1574, 349, 1794, 2285, 1775, 1096,
+    1041, 712, 949, 1974, 1434, 745, 1024, 2176,
+    308, 2169, 493, 2056, 399, 1300, 901, 1239,
+    664, 500, 57, 197, 1551, 2288,
+};
+
+static const int32_t name_to_keysym_icase_displace[] = {
+    -7, 0, 6, -8, 8, 2, 0, 8,
+    -10, 1, 0, -12, -13, -38, -48, -55,
+    7, 2, 12, -63, -74, 11, 9, 3,
+    -85, -87, 5, -102, 13, -107, -110, 14,
+    2, 2, 1, -121, 2, -122, 3, -132,
+    -142, 0, 4, 1, -153, 1, 1, -167,
+    1, 1, 6, 3, 0, 13, 0, 0,
+    -168, -183, 2, 0, -185, 2, 5, -196,
+    9, 3, 0, 0, -212, -213, 1, 7,
+    2, 13, 2, -215, -218, 0, -223, 0,
+    36, 8, 1, -229, 1, 0, 0, 7,
+    -236, 6, -237, 1, 1, 21, 0, 1,
+    -240, 1, 6, 0, 1, 2, 2, 0,
+    0, 0, 1, 4, 1, 1, 0, -246,
+    7, 0, 1, 1, 3, 5, -249, 0,
+    4, 6, 5, 3, 13, 0, 1, -257,
+    6, -258, 0, -263, -267, -275, -289, 0,
+    -290, 10, 19, 0, 5, 1, 7, -298,
+    2, 1, -314, -318, 0, 1, -324, 2,
+    -327, 2, 2, 1, -340, -347, 22, -352,
+    3, 17, 1, -354, 1, 2, -369, -387,
+    2, 4, -395, 1, 14, 1, 19, 3,
+    3, 6, 14, 0, 0, 11, 0, -401,
+    1, 5, 1, -408, 2, 1, 0, 20,
+    0, 2, 1, 0, 25, -409, 1, 1,
+    -412, 3, 0, -415, 3, 8, 1, 1,
+    1, 1, 2, 10, 6, 2, 1, 0,
+    0, 7, 3, 3, -430, 1, 0, 23,
+    -450, 0, -459, 3, 0, 17, 8, 3,
+    6, -462, 1, 2, 0, -463, 31, 0,
+    -465, 1, -472, 1, 0, -474, 2, -497,
+    8, 1, -506, 17, 8, 2, 0, 2,
+    0, -525, -540, 1, 2, 1, 1, 20,
+    -547, -548, -550, -555, 3, 3, 8, 15,
+    -559, 1, 8, 1, -564, 2, 1, -568,
+    1, -584, 1, -599, 1, 0, -601, 5,
+    1, 0, 0, -605, 3, 12, 3, 4,
+    -611, -615, 1, -620, 1, -624, 28, 4,
+    3, -629, -630, 2, 1, 1, -637, 0,
+    8, 0, -638, 3, -643, 1, 1, 4,
+    1, 11, 1, -659, 2, 5, -662, 1,
+    1, 52, 4, 8, 23, 2, 1, 0,
+    5, 0, 16, 1, -663, 0, -671, 1,
+    2, 1, 5, 4, 3, 63, -679, -697,
+    1, 1, 23, 4, -735, 1, 12, 1,
+    6, -742, 3, -762, 0, 9, 5, 3,
+    -766, 0, 22, 20, 13, 4, 10, 2,
+    -773, 4, 17, 4, 1, 1, -786, -789,
+    3, -795, 4, 5, 4, 1, -809, 1,
+    -824, 20, 7, 1, 1, 4, 0, 4,
+    1, 4, 20, -832, 1, -838, -841, 1,
+    36, 4, 8, 13, 4, 11, -850, 3,
+    0, -854, 0, -868, -880, -894, 0, 6,
+    0, 40, -903, -905, 4, 2, 17, 6,
+    19, -923, 34, 2, -924, 0, 0, 7,
+    -925, 3, 9, 14, 3, -953, 9, -1000,
+    -1008, 21, 33, 17, -1015, 2, 1, -1033,
+    13, 20, 0, 2, 3, -1037, 0, 0,
+    -1044, 1, 17, 3, 0, 0, 0, -1050,
+    1, 3, 1, 2, -1065, 3, -1076, 17,
+    4, 25, 13, 0, 36, 4, 4, 1,
+    0, 0, 5, 8, -1078, 0, 0, 0,
+    0, -1084, 16, 2, 0, 0, 8, 1,
+    -1088, 2, 24, 6, 26, -1090, 5, 2,
+    -1091, 3, 1, -1121, -1124, 2, 1, 2,
+    1, 12, 18, 0, 1, 20, -1129, -1132,
+    -1145, 59, 3, 10, 26, -1153, 8, -1162,
+    0, 5, 5, 18, 9, 22, 9, 7,
+    3, 8, 21, 3, 21, 1, 2, 1,
+    -1172, 0, 14, 9, 1, 0, -1174, -1180,
+    6, 10, 1, 12, 6, 2, 4, -1189,
+    0, 47, 2, 4, -1193, -1198, 1, 33,
+    12, 2, 2, 13, 1, 4, 0, -1201,
+    17, 2, 22, 0, 19, -1210, 4, 6,
+    15, -1222, 1, 1, -1232, 5, 7, 5,
+    32, 37, 6, 1, 5, 30, 0, 4,
+    -1241, 6, 34, 2, 1, 22, 51, 0,
+    -1243, 45, 3, -1246, 1, -1251, 12, -1253,
+    34, 2, 9, -1261, 1, 0, 5, 18,
+    0, 0, 15, -1265, -1269, 7, 7, 4,
+    15, 25, 0, 12, 104, 6, -1271, 5,
+    0, 37, 3, 0, 0, 1, 0, 0,
+    37, 1, 1, -1272, -1288, -1290, 20, -1302,
+    32, 5, -1318, -1325, 0, 0, 18, 29,
+    -1331, 0, -1340, -1367, 2, 3, 85, 6,
+    -1373, 1, -1383, 0, 1, 2, -1388, 18,
+    16, -1398, 23, 39, 0, 5, 8, 9,
+    -1401, 1, 2, -1407, 8, 0, 4, 4,
+    6, -1408, -1431, -1434, -1446, -1447, -1459, -1460,
+    -1467, 17, 5, 1, 4, 35, 0, 0,
+    -1482, 3, 15, 3, 27, -1484, 0, 50,
+    -1493, 0, 0, 59, 5, 0, 8, -1499,
+    2, 6, 0, -1513, -1514, 3, 9, 4,
+    -1526, -1527, -1541, 39, 4, 0, -1549, 7,
+    5, 72, 4, 2, 3, 0, 5, 19,
+    0, 2, 37, 0, 52, 22, -1550, 19,
+    7, -1562, 0, 0, 0, -1564, 11, -1573,
+    75, -1574, -1576, 2, 12, 5, 2, 8,
+    -1582, 0, -1607, 0, 3, 2, 10, 0,
+    25, 39, 1, 12, 28, 5, 0, 1,
+    6, 6, 4, 62, -1635, 6, -1643, -1645,
+    -1655, 12, 0, 33, 13, 5, 1, 36,
+    10, 8, -1684, 18, 15, 1, 2, 29,
+    -1694, 11, 2, 6, -1708, -1711, 0, -1724,
+    6, 1, 51, 8, 2, 10, -1730, 19,
+    48, 14, 1, 8, 31, -1734, 28, 17,
+    7, 1, 2, 1, 0, 42, 9, 13,
+    6, 0, 0, 0, 8, 0, 0, 7,
+    10, -1737, -1741, 5, 2, 0, 0, 90,
+    23, 78, -1758, -1782, -1807, 1, 1, 0,
+    2, 0, 1, 28, 1, 11, -1810, 9,
+    -1813, -1823, 7, -1825, 68, 0, 41, 1,
+    36, 60, 22, 1, 1, 0, 80, 0,
+    -1826, 84, -1827, 2, 6, 45, 5, 1,
+    3, 18, 63, -1833, 6, 9, -1837, 41,
+    1, 5, 0, 1, 1, -1840, -1846, -1848,
+    0, -1849, 6, 35, -1858, -1871, -1876, -1882,
+    -1889, 1, 21, 27, -1898, 35, 3, 1,
+    10, 0, 11, 20, -1915, -1927, 12, 5,
+    5, 1, 81, 11, 38, 3, -1928, 65,
+    5, 1, 48, -1930, 6, 86, -1931, 173,
+    21, 49, 17, 43, 2, 2, -1946, -1948,
+    -1970, 0, 25, 1, 4, 1, 12, 0,
+    1, -1972, 0, -1984, -1990, 0, -2000, 27,
+    -2001, -2010, 18, 181, -2011, -2020, 195, -2024,
+    -2035, 0, 1, 27, 1, -2051, 6, 20,
+    168, 10, 0, 1, 7, 5, 25, 3,
+    2, -2052, 6, 0, 7, -2054, 6, 17,
+    130, 2, 0, 0,
+};
+
+static const uint16_t name_to_keysym_icase_index[] = {
+    903, 1408, 251, 1999, 297, 1611, 426, 2343,
+    1926, 369, 1034, 5, 35, 1686, 1085, 336,
+    229, 492, 2032, 239, 2360, 159, 728, 491,
+    913, 1765, 370, 1303, 111, 2012, 326, 1683,
+    2073, 1895, 688, 753, 164, 1503, 0, 47,
+    2067, 332, 1801, 117, 1664, 1219, 763, 1141,
+    797, 597, 1390, 1552, 658, 1946, 1032, 1405,
+    1410, 1016, 514, 205, 310, 732, 742, 2199,
+    1978, 1, 1142, 170, 1506, 504, 1255, 773,
+    1995, 1136, 366, 2171, 127, 706, 1324, 1906,
+    2316, 149, 654, 944, 71, 2211, 1177, 1127,
+    2303, 1502, 757, 2026, 1554, 2059, 2237, 473,
+    1143, 795, 237, 1222, 684, 535, 2044, 2329,
+    1814, 1418, 21, 1097, 1121, 1724, 1856, 1128,
+    1961, 175, 287, 1699, 1542, 2158, 338, 1217,
+    984, 12, 966, 97, 841, 1951, 774, 1212,
+    1755, 358, 1965, 1971, 788, 1468, 1083, 1824,
+    1321, 1680, 1974, 434, 2216, 186, 196, 323,
+    262, 1466, 1279, 284, 148, 1018, 2185, 1838,
+    40, 2129, 26, 312, 550, 2000, 2115, 392,
+    1689, 183, 1746, 1302, 123, 1060, 2208, 2356,
+    2374, 1326, 1527, 490, 305, 1769, 1896, 858,
+    1791, 929, 2224, 1818, 2341, 1992, 1104, 897,
+    1937, 1452, 421, 727, 518, 1173, 355, 1199,
+    932, 1396, 2070, 1182, 130, 959, 1657, 920,
+    344, 1767, 1120, 990, 1239, 846, 1426, 1218,
+    1764, 1966, 2334, 1945, 2230, 408, 1800, 2033,
+    2187, 1546, 436, 1169, 1949, 1597, 2066, 1563,
+    250, 1568, 300, 533, 2210, 384, 1924, 1773,
+    286, 1649, 927, 1871, 10, 1988, 1681, 1637,
+    786, 482, 2221, 2061, 854, 2336, 1138, 365,
+    1652, 1241, 1927, 225, 1140, 513, 1229, 557,
+    29, 916, 498, 1754, 1872, 416, 144, 1789,
+    2376, 792, 1626, 2191, 953, 368, 377, 1137,
+    523, 397, 1115, 1460, 1958, 1186, 890, 1232,
+    887, 787, 549, 2180, 986, 2324, 1825, 1108,
+    22, 1363, 939, 891, 1844, 2027, 2007, 444,
+    791, 2173, 136, 299, 1448, 2002, 36, 468,
+    1695, 1317, 267, 2288, 1975, 396, 777, 1210,
+    1423, 1178, 1973, 1539, 1312, 985, 556, 1910,
+    1704, 2242, 2295, 1086, 1277, 132, 2297, 933,
+    901, 1387, 2212, 2093, 574, 881, 309, 83,
+    1693, 1708, 23, 2051, 1848, 2028, 2395, 268,
+    184, 494, 2269, 982, 698, 27, 389, 1023,
+    2268, 1058, 1248, 2342, 935, 1548, 2348, 311,
+    301, 435, 8, 1481, 1339, 1914, 880, 361,
+    1345, 6, 731, 1443, 2243, 1102, 987, 1727,
+    1315, 1931, 327, 2258, 716, 1915, 2313, 867,
+    1833, 1647, 1533, 1804, 1784, 2263, 1798, 941,
+    2154, 1061, 882, 44, 918, 2389, 1294, 2354,
+    1292, 2133, 2251, 1930, 2262, 1759, 1572, 845,
+    1653, 611, 2190, 2086, 1090, 2137, 76, 1935,
+    1273, 1682, 2042, 1847, 347, 519, 1146, 1726,
+    462, 2005, 145, 682, 479, 811, 759, 1285,
+    266, 1458, 800, 973, 1447, 2085, 534, 1585,
+    501, 1901, 746, 862, 288, 2355, 2333, 1126,
+    2318, 181, 1890, 2219, 1549, 488, 704, 112,
+    1535, 994, 359, 1354, 34, 2040, 424, 348,
+    360, 1369, 1350, 937, 401, 527, 898, 576,
+    105, 1904, 1917, 2392, 1432, 1076, 500, 246,
+    308, 1428, 1328, 1886, 1440, 1439, 1110, 471,
+    1863, 53, 1479, 604, 1215, 100, 114, 2098,
+    813, 2206, 278, 345, 2314, 1208, 91, 1758,
+    2024, 2011, 463, 1048, 1622, 2338, 343, 1026,
+    15, 1158, 135, 924, 680, 2294, 1461, 1299,
+    80, 2393, 334, 1508, 457, 998, 2020, 909,
+    2222, 1567, 1595, 1197, 1994, 541, 726, 150,
+    1200, 542, 484, 1715, 2193, 1716, 2062, 24,
+    2111, 1471, 333, 1677, 417, 1544, 1310, 403,
+    176, 1382, 1775, 739, 200, 1453, 137, 342,
+    2257, 1377, 1691, 2079, 1246, 595, 2311, 1579,
+    460, 974, 1860, 1770, 1570, 1491, 1168, 1763,
+    1006, 450, 600, 2068, 578, 1909, 1263, 1286,
+    1922, 2247, 1831, 591, 1855, 94, 19, 1442,
+    2281, 767, 98, 1359, 2289, 1858, 87, 1750,
+    177, 1171, 2087, 486, 1206, 1316, 1089, 1636,
+    464, 1320, 1733, 1816, 634, 648, 622, 1381,
+    1404, 1020, 1052, 1866, 364, 1846, 1383, 1421,
+    877, 1792, 1070, 18, 294, 1012, 84, 1556,
+    2194, 1962, 2227, 1276, 1368, 1666, 1306, 628,
+    2276, 1601, 1360, 1000, 1046, 1887, 1990, 1465,
+    1977, 1214, 459, 2345, 1936, 259, 2016, 946,
+    904, 1118, 1944, 102, 869, 1489, 837, 2347,
+    404, 1547, 1613, 1234, 93, 1743, 402, 736,
+    1970, 1509, 470, 620, 2123, 1582, 2285, 853,
+    830, 2253, 618, 598, 303, 1454, 1388, 2189,
+    1139, 875, 28, 16, 1151, 1852, 1883, 548,
+    215, 1117, 2310, 2287, 220, 2178, 1633, 1079,
+    1247, 1301, 1379, 536, 453, 1928, 2284, 520,
+    1386, 694, 1920, 1513, 754, 415, 322, 374,
+    1635, 138, 2204, 545, 692, 1788, 388, 2080,
+    1569, 911, 2174, 834, 207, 2019, 738, 1346,
+    1555, 1226, 769, 1713, 1541, 2383, 981, 1876,
+    1253, 2037, 232, 1808, 1147, 2119, 2082, 353,
+    1823, 1658, 1874, 2034, 815, 432, 602, 2159,
+    30, 1889, 1998, 564, 1313, 963, 1257, 2064,
+    141, 379, 601, 104, 525, 723, 1499, 964,
+    2244, 1329, 438, 1902, 1244, 1540, 718, 714,
+    2245, 1333, 405, 2164, 1878, 515, 1605, 69,
+    1191, 1106, 1172, 630, 1170, 949, 406, 1864,
+    1739, 844, 543, 38, 20, 1738, 328, 1487,
+    1891, 283, 1152, 139, 248, 1729, 1642, 554,
+    1319, 1485, 213, 282, 2004, 324, 1684, 1639,
+    1908, 1419, 2362, 979, 188, 2220, 2041, 1877,
+    2337, 1678, 1857, 798, 879, 236, 674, 1968,
+    1953, 1573, 255, 1873, 458, 1593, 1394, 912,
+    279, 2233, 594, 1879, 977, 131, 1777, 1029,
+    835, 2312, 1078, 1446, 1744, 971, 489, 2370,
+    65, 179, 380, 2218, 1620, 2335, 852, 1933,
+    1038, 2340, 790, 1947, 2381, 764, 955, 2047,
+    1202, 1124, 1181, 558, 2045, 1859, 1221, 2176,
+    2056, 1010, 993, 1950, 1437, 745, 1868, 265,
+    1514, 429, 1500, 1112, 560, 1099, 1536, 2094,
+    905, 770, 603, 1336, 1672, 801, 906, 1661,
+    61, 1797, 1899, 1674, 2344, 1361, 2058, 1258,
+    863, 2153, 2359, 2022, 2366, 1955, 162, 828,
+    1853, 2223, 313, 395, 646, 690, 1584, 1403,
+    285, 1187, 371, 1325, 2364, 779, 893, 244,
+    740, 1344, 579, 1456, 945, 280, 1751, 589,
+    1477, 430, 1159, 642, 1433, 737, 2238, 668,
+    2290, 31, 2014, 1224, 782, 1731, 1056, 1752,
+    1948, 2394, 2017, 2350, 517, 780, 1732, 872,
+    2018, 174, 529, 1799, 1402, 2363, 802, 419,
+    530, 1967, 1932, 1240, 2050, 1069, 2274, 4,
+    2215, 1942, 2308, 1559, 330, 1341, 493, 427,
+    2081, 2307, 1515, 2235, 292, 1722, 1436, 1662,
+    1842, 1870, 547, 2072, 1067, 1084, 1880, 1074,
+    1233, 281, 1231, 1335, 768, 537, 165, 1318,
+    1923, 1213, 838, 2326, 1694, 445, 2168, 859,
+    1697, 650, 423, 447, 2148, 2113, 2076, 972,
+    202, 2103, 289, 608, 1843, 230, 1211, 1913,
+    1042, 502, 115, 446, 1525, 1429, 1406, 1189,
+    855, 1493, 2379, 1929, 264, 2250, 2265, 2261,
+    2201, 992, 1063, 1129, 1618, 331, 980, 1337,
+    510, 1114, 2095, 2365, 1893, 805, 2049, 1095,
+    391, 1747, 1703, 660, 167, 1367, 1607, 1762,
+    765, 559, 2060, 750, 1959, 2052, 609, 394,
+    1242, 1054, 320, 1100, 1272, 195, 2184, 1256,
+    1087, 2065, 2271, 839, 2170, 1969, 1624, 596,
+    273, 1176, 1679, 849, 1464, 1742, 448, 321,
+    1250, 116, 172, 316, 400, 1274, 1663, 1188,
+    2296, 480, 1897, 1254, 1802, 884, 140, 521,
+    2139, 652, 119, 307, 1609, 2309, 483, 1441,
+    796, 1107, 793, 2196, 146, 1480, 154, 1774,
+    2330, 1467, 809, 2305, 996, 708, 1900, 1157,
+    109, 2046, 270, 999, 2339, 2091, 107, 942,
+    399, 1532, 1184, 2300, 386, 1392, 1835, 1230,
+    1793, 1850, 1378, 804, 2029, 1984, 2270, 1179,
+    1735, 847, 910, 1779, 2302, 678, 1260, 962,
+    1575, 1912, 561, 2299, 1327, 1270, 771, 1225,
+    1771, 2006, 1989, 1964, 1646, 2099, 914, 567,
+    896, 1494, 1940, 33, 1659, 260, 2283, 1651,
+    1338, 293, 306, 2256, 1523, 827, 1921, 451,
+    744, 335, 917, 961, 2161, 160, 428, 1265,
+    724, 1905, 1812, 2385, 1235, 118, 1008, 760,
+    497, 1749, 1264, 1845, 439, 337, 976, 276,
+    1591, 842, 352, 2151, 899, 99, 1517, 1934,
+    505, 1156, 1288, 51, 1050, 851, 1530, 2009,
+    1309, 1505, 339, 290, 1776, 2131, 528, 2149,
+    1323, 437, 2069, 2361, 2387, 39, 2105, 1281,
+    2055, 1119, 357, 390, 784, 776, 1330, 1794,
+    1024, 1882, 511, 1283, 1580, 411, 1459, 151,
+    2039, 2090, 2259, 1300, 2198, 2157, 1434, 1516,
+    1875, 25, 565, 1473, 2030, 1820, 874, 387,
+    1562, 96, 2352, 452, 553, 157, 2197, 156,
+    1839, 1741, 1462, 1810, 2043, 1371, 1455, 1014,
+    1550, 785, 1125, 1757, 1861, 2368, 1614, 1362,
+    2327, 1431, 1133, 1445, 2078, 475, 741, 412,
+    1183, 414, 2317, 1261, 983, 1728, 398, 1898,
+    670, 1450, 794, 110, 1656, 840, 1719, 1954,
+    1881, 1521, 1760, 1223, 889, 46, 506, 735,
+    1411, 2063, 147, 951, 133, 1756, 967, 1986,
+    749, 1671, 2240, 555, 2054, 1837, 2125, 789,
+    1956, 2172, 1987, 2163, 2141, 1355, 158, 991,
+    686, 957, 1670, 970, 2353, 1723, 2053, 848,
+    614, 2357, 1082, 613, 817, 1701, 82, 1507,
+    1925, 1220, 192, 1982, 871, 9, 1519, 2057,
+    2145, 1534, 638, 2008, 487, 1357, 367, 59,
+    1438, 729, 95, 198, 936, 1469, 13, 1997,
+    234, 2301, 988, 1311, 1166, 1268, 346, 1105,
+    319, 1557, 92, 86, 1803, 302, 509, 1298,
+    1343, 1380, 1888, 1862, 166, 2249, 1259, 1322,
+    496, 422, 1266, 2200, 1501, 2003, 1407, 1385,
+    632, 211, 712, 1638, 873, 55, 1654, 1175,
+    644, 2320, 2207, 1685, 1193, 925, 1131, 2010,
+    1347, 799, 540, 433, 32, 1907, 1077, 2097,
+    1162, 1116, 2351, 2035, 1435, 1829, 772, 807,
+    1780, 836, 860, 1180, 57, 126, 2117, 478,
+    710, 522, 2083, 2071, 113, 539, 2239, 1352,
+    1113, 1996, 1002, 472, 562, 1692, 2229, 134,
+    947, 456, 128, 571, 1510, 1737, 778, 2319,
+    1040, 1702, 1851, 2202, 2092, 257, 1249, 1409,
+    2266, 2036, 672, 1348, 1993, 3, 1675, 1160,
+    1578, 888, 1401, 63, 455, 441, 734, 507,
+    1565, 551, 1093, 1766, 2001, 449, 1918, 1236,
+    978, 2346, 1796, 1192, 1734, 1952, 2275, 606,
+    1204, 1267, 968, 1714, 1185, 1911, 2226, 190,
+    1531, 1486, 1072, 467, 1869, 1941, 240, 2084,
+    580, 440, 2306, 1748, 1553, 1389, 626, 531,
+    2323, 733, 340, 295, 1365, 1144, 296, 1538,
+    407, 894, 1655, 153, 2160, 363, 943, 743,
+    461, 1174, 1122, 908, 1366, 2143, 610, 1262,
+    1198, 420, 1400, 1849, 2, 418, 1030, 42,
+    1867, 372, 1391, 1111, 152, 2248, 1498, 823,
+    1397, 218, 2150, 921, 168, 2277, 2396, 1305,
+    2273, 2135, 1123, 526, 227, 1036, 1717, 969,
+    1384, 997, 1645, 1985, 2272, 1065, 1718, 1150,
+    2109, 1589, 341, 1399, 1730, 2279, 664, 1667,
+    1243, 2015, 864, 1630, 325, 431, 1205, 1289,
+    2298, 1668, 393, 1103, 2155, 1245, 2205, 1427,
+    885, 163, 696, 1700, 886, 756, 1457, 1916,
+    892, 1044, 1957, 546, 2254, 1787, 1135, 499,
+    2278, 1251, 1939, 748, 385, 1252, 1768, 1297,
+    870, 2101, 722, 1148, 2280, 1425, 883, 49,
+    1512, 1673, 1314, 751, 90, 1497, 67, 907,
+    1304, 2225, 2260, 1545, 318, 1207, 2048, 1153,
+    895, 1587, 1290, 124, 1165, 1648, 930, 143,
+    1463, 1772, 349, 375, 1894, 481, 413, 2147,
+    1740, 524, 1398, 1599, 960, 1271, 2332, 7,
+    2236, 1721, 931, 224, 662, 476, 1603, 2391,
+    1482, 1149, 762, 1669, 106, 2025, 193, 2325,
+    1745, 1736, 2107, 1790, 14, 783, 503, 1884,
+    298, 781, 37, 2121, 425, 666, 566, 2127,
+    2166, 552, 209, 171, 850, 1444, 1145, 2023,
+    1196, 1415, 926, 1001, 2021, 1495, 1203, 2252,
+    1155, 624, 2331, 2349, 1376, 1806, 1308, 989,
+    2322, 640, 1004, 1496, 2038, 465, 2100, 965,
+    1227, 1822, 2013, 1201, 1725, 120, 466, 2293,
+    1529, 1130, 291, 2282, 101, 1413, 512, 1640,
+    995, 253, 532, 2077, 1574, 1885, 1972, 2377,
+    1706, 583, 720, 758, 373, 1195, 351, 508,
+    1375, 1634, 1571, 1470, 1583, 381, 1163, 1865,
+    821, 1821, 1332, 605, 702, 60, 1370, 612,
+    1650, 1511, 1560, 315, 74, 700, 277, 2291,
+    922, 1091, 1537, 2234, 934, 516, 2255, 73,
+    1712, 161, 2231, 317, 2195, 2358, 1417, 1478,
+    676, 563, 409, 382, 1960, 354, 2328, 1795,
+    1782, 2232, 155, 1340, 1628, 1903, 1616, 616,
+    108, 538, 1660, 103, 1395, 89, 2246, 2089,
+    1643, 1161, 2241, 1577, 1483, 1334, 1476, 940,
+    1644, 747, 469, 454, 1134, 2213, 1101, 2088,
+    825, 204, 1238, 1786, 2264, 2192, 1474, 1543,
+    1705, 1632, 2315, 923, 442, 1096, 636, 378,
+    2267, 2304, 329, 975, 1094, 1342, 1827, 1237,
+    1938, 2203, 1028, 590, 304, 376, 362, 485,
+    1665, 1576, 1854, 2286, 1785, 819, 1475, 129,
+    656, 1088, 1021, 121, 11, 607, 169, 928,
+    1132, 1194, 1154, 350, 78, 1209, 1449, 2321,
+    1451, 2182, 1841, 495, 1331, 2214, 1892, 410,
+    2217, 222, 1228, 1710, 2209, 1709, 1092, 356,
+    900, 2372, 1711, 581, 1216, 587, 314, 1980,
+    2228, 271, 2156, 919, 122, 1687, 2169, 938,
+    902, 1720, 142, 1109, 582, 569, 1707, 1551,
+    275, 17, 443, 1819, 1372, 1081, 242, 477,
+    1919, 1963, 1504, 474, 832, 752, 1840, 599,
+    857, 585, 1374, 1164, 216, 1296, 2031, 1676,
+    2292, 1991, 1943, 544, 383, 1098, 125, 1167,
+};
+
+static const uint32_t keysym_name_pages[] = {
+    0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7,
+    0x8, 0x9, 0xa, 0xb, 0xc, 0xd, 0xe, 0x13,
+    0x20, 0xfd, 0xfe, 0xff, 0xffff, 0x10001, 0x10002, 0x10004,
+    0x10005, 0x10006, 0x1000d, 0x10010, 0x1001e, 0x10020, 0x10022, 0x10028,
+    0x100000, 0x1000fe, 0x1000ff, 0x1004ff, 0x1005ff, 0x1008fe, 0x1008ff,
 };
 
-static const struct name_keysym keysym_to_name[] = {
-    { "NoSymbol", XKB_KEY_NoSymbol },
-    { "space", XKB_KEY_space },
-    { "exclam", XKB_KEY_exclam },
-    { "quotedbl", XKB_KEY_quotedbl },
-    { "numbersign", XKB_KEY_numbersign },
-    { "dollar", XKB_KEY_dollar },
-    { "percent", XKB_KEY_percent },
-    { "ampersand", XKB_KEY_ampersand },
-    { "apostrophe", XKB_KEY_apostrophe },
-    { "parenleft", XKB_KEY_parenleft },
-    { "parenright", XKB_KEY_parenright },
-    { "asterisk", XKB_KEY_asterisk },
-    { "plus", XKB_KEY_plus },
-    { "comma", XKB_KEY_comma },
-    { "minus", XKB_KEY_minus },
-    { "period", XKB_KEY_period },
-    { "slash", XKB_KEY_slash },
-    { "0", XKB_KEY_0 },
-    { "1", XKB_KEY_1 },
-    { "2", XKB_KEY_2 },
-    { "3", XKB_KEY_3 },
-    { "4", XKB_KEY_4 },
-    { "5", XKB_KEY_5 },
-    { "6", XKB_KEY_6 },
-    { "7", XKB_KEY_7 },
-    { "8", XKB_KEY_8 },
-    { "9", XKB_KEY_9 },
-    { "colon", XKB_KEY_colon },
-    { "semicolon", XKB_KEY_semicolon },
-    { "less", XKB_KEY_less },
-    { "equal", XKB_KEY_equal },
-    { "greater", XKB_KEY_greater },
-    { "question", XKB_KEY_question },
-    { "at", XKB_KEY_at },
-    { "A", XKB_KEY_A },
-    { "B", XKB_KEY_B },
-    { "C", XKB_KEY_C },
-    { "D", XKB_KEY_D },
-    { "E", XKB_KEY_E },
-    { "F", XKB_KEY_F },
-    { "G", XKB_KEY_G },
-    { "H", XKB_KEY_H },
-    { "I", XKB_KEY_I },
-    { "J", XKB_KEY_J },
-    { "K", XKB_KEY_K },
-    { "L", XKB_KEY_L },
-    { "M", XKB_KEY_M },
-    { "N", XKB_KEY_N },
-    { "O", XKB_KEY_O },
-    { "P", XKB_KEY_P },
-    { "Q", XKB_KEY_Q },
-    { "R", XKB_KEY_R },
-    { "S", XKB_KEY_S },
-    { "T", XKB_KEY_T },
-    { "U", XKB_KEY_U },
-    { "V", XKB_KEY_V },
-    { "W", XKB_KEY_W },
-    { "X", XKB_KEY_X },
-    { "Y", XKB_KEY_Y },
-    { "Z", XKB_KEY_Z },
-    { "bracketleft", XKB_KEY_bracketleft },
-    { "backslash", XKB_KEY_backslash },
-    { "bracketright", XKB_KEY_bracketright },
-    { "asciicircum", XKB_KEY_asciicircum },
-    { "underscore", XKB_KEY_underscore },
-    { "grave", XKB_KEY_grave },
-    { "a", XKB_KEY_a },
-    { "b", XKB_KEY_b },
-    { "c", XKB_KEY_c },
-    { "d", XKB_KEY_d },
-    { "e", XKB_KEY_e },
-    { "f", XKB_KEY_f },
-    { "g", XKB_KEY_g },
-    { "h", XKB_KEY_h },
-    { "i", XKB_KEY_i },
-    { "j", XKB_KEY_j },
-    { "k", XKB_KEY_k },
-    { "l", XKB_KEY_l },
-    { "m", XKB_KEY_m },
-    { "n", XKB_KEY_n },
-    { "o", XKB_KEY_o },
-    { "p", XKB_KEY_p },
-    { "q", XKB_KEY_q },
-    { "r", XKB_KEY_r },
-    { "s", XKB_KEY_s },
-    { "t", XKB_KEY_t },
-    { "u", XKB_KEY_u },
-    { "v", XKB_KEY_v },
-    { "w", XKB_KEY_w },
-    { "x", XKB_KEY_x },
-    { "y", XKB_KEY_y },
-    { "z", XKB_KEY_z },
-    { "braceleft", XKB_KEY_braceleft },
-    { "bar", XKB_KEY_bar },
-    { "braceright", XKB_KEY_braceright },
-    { "asciitilde", XKB_KEY_asciitilde },
-    { "nobreakspace", XKB_KEY_nobreakspace },
-    { "exclamdown", XKB_KEY_exclamdown },
-    { "cent", XKB_KEY_cent },
-    { "sterling", XKB_KEY_sterling },
-    { "currency", XKB_KEY_currency },
-    { "yen", XKB_KEY_yen },
-    { "brokenbar", XKB_KEY_brokenbar },
-    { "section", XKB_KEY_section },
-    { "diaeresis", XKB_KEY_diaeresis },
-    { "copyright", XKB_KEY_copyright },
-    { "ordfeminine", XKB_KEY_ordfeminine },
-    { "guillemotleft", XKB_KEY_guillemotleft },
-    { "notsign", XKB_KEY_notsign },
-    { "hyphen", XKB_KEY_hyphen },
-    { "registered", XKB_KEY_registered },
-    { "macron", XKB_KEY_macron },
-    { "degree", XKB_KEY_degree },
-    { "plusminus", XKB_KEY_plusminus },
-    { "twosuperior", XKB_KEY_twosuperior },
-    { "threesuperior", XKB_KEY_threesuperior },
-    { "acute", XKB_KEY_acute },
-    { "mu", XKB_KEY_mu },
-    { "paragraph", XKB_KEY_paragraph },
-    { "periodcentered", XKB_KEY_periodcentered },
-    { "cedilla", XKB_KEY_cedilla },
-    { "onesuperior", XKB_KEY_onesuperior },
-    { "masculine", XKB_KEY_masculine },
-    { "guillemotright", XKB_KEY_guillemotright },
-    { "onequarter", XKB_KEY_onequarter },
-    { "onehalf", XKB_KEY_onehalf },
-    { "threequarters", XKB_KEY_threequarters },
-    { "questiondown", XKB_KEY_questiondown },
-    { "Agrave", XKB_KEY_Agrave },
-    { "Aacute", XKB_KEY_Aacute },
-    { "Acircumflex", XKB_KEY_Acircumflex },
-    { "Atilde", XKB_KEY_Atilde },
-    { "Adiaeresis", XKB_KEY_Adiaeresis },
-    { "Aring", XKB_KEY_Aring },
-    { "AE", XKB_KEY_AE },
-    { "Ccedilla", XKB_KEY_Ccedilla },
-    { "Egrave", XKB_KEY_Egrave },
-    { "Eacute", XKB_KEY_Eacute },
-    { "Ecircumflex", XKB_KEY_Ecircumflex },
-    { "Ediaeresis", XKB_KEY_Ediaeresis },
-    { "Igrave", XKB_KEY_Igrave },
-    { "Iacute", XKB_KEY_Iacute },
-    { "Icircumflex", XKB_KEY_Icircumflex },
-    { "Idiaeresis", XKB_KEY_Idiaeresis },
-    { "ETH", XKB_KEY_ETH },
-    { "Ntilde", XKB_KEY_Ntilde },
-    { "Ograve", XKB_KEY_Ograve },
-    { "Oacute", XKB_KEY_Oacute },
-    { "Ocircumflex", XKB_KEY_Ocircumflex },
-    { "Otilde", XKB_KEY_Otilde },
-    { "Odiaeresis", XKB_KEY_Odiaeresis },
-    { "multiply", XKB_KEY_multiply },
-    { "Oslash", XKB_KEY_Oslash },
-    { "Ugrave", XKB_KEY_Ugrave },
-    { "Uacute", XKB_KEY_Uacute },
-    { "Ucircumflex", XKB_KEY_Ucircumflex },
-    { "Udiaeresis", XKB_KEY_Udiaeresis },
-    { "Yacute", XKB_KEY_Yacute },
-    { "THORN", XKB_KEY_THORN },
-    { "ssharp", XKB_KEY_ssharp },
-    { "agrave", XKB_KEY_agrave },
-    { "aacute", XKB_KEY_aacute },
-    { "acircumflex", XKB_KEY_acircumflex },
-    { "atilde", XKB_KEY_atilde },
-    { "adiaeresis", XKB_KEY_adiaeresis },
-    { "aring", XKB_KEY_aring },
-    { "ae", XKB_KEY_ae },
-    { "ccedilla", XKB_KEY_ccedilla },
-    { "egrave", XKB_KEY_egrave },
-    { "eacute", XKB_KEY_eacute },
-    { "ecircumflex", XKB_KEY_ecircumflex },
-    { "ediaeresis", XKB_KEY_ediaeresis },
-    { "igrave", XKB_KEY_igrave },
-    { "iacute", XKB_KEY_iacute },
-    { "icircumflex", XKB_KEY_icircumflex },
-    { "idiaeresis", XKB_KEY_idiaeresis },
-    { "eth", XKB_KEY_eth },
-    { "ntilde", XKB_KEY_ntilde },
-    { "ograve", XKB_KEY_ograve },
-    { "oacute", XKB_KEY_oacute },
-    { "ocircumflex", XKB_KEY_ocircumflex },
-    { "otilde", XKB_KEY_otilde },
-    { "odiaeresis", XKB_KEY_odiaeresis },
-    { "division", XKB_KEY_division },
-    { "oslash", XKB_KEY_oslash },
-    { "ugrave", XKB_KEY_ugrave },
-    { "uacute", XKB_KEY_uacute },
-    { "ucircumflex", XKB_KEY_ucircumflex },
-    { "udiaeresis", XKB_KEY_udiaeresis },
-    { "yacute", XKB_KEY_yacute },
-    { "thorn", XKB_KEY_thorn },
-    { "ydiaeresis", XKB_KEY_ydiaeresis },
-    { "Aogonek", XKB_KEY_Aogonek },
-    { "breve", XKB_KEY_breve },
-    { "Lstroke", XKB_KEY_Lstroke },
-    { "Lcaron", XKB_KEY_Lcaron },
-    { "Sacute", XKB_KEY_Sacute },
-    { "Scaron", XKB_KEY_Scaron },
-    { "Scedilla", XKB_KEY_Scedilla },
-    { "Tcaron", XKB_KEY_Tcaron },
-    { "Zacute", XKB_KEY_Zacute },
-    { "Zcaron", XKB_KEY_Zcaron },
-    { "Zabovedot", XKB_KEY_Zabovedot },
-    { "aogonek", XKB_KEY_aogonek },
-    { "ogonek", XKB_KEY_ogonek },
-    { "lstroke", XKB_KEY_lstroke },
-    { "lcaron", XKB_KEY_lcaron },
-    { "sacute", XKB_KEY_sacute },
-    { "caron", XKB_KEY_caron },
-    { "scaron", XKB_KEY_scaron },
-    { "scedilla", XKB_KEY_scedilla },
-    { "tcaron", XKB_KEY_tcaron },
-    { "zacute", XKB_KEY_zacute },
-    { "doubleacute", XKB_KEY_doubleacute },
-    { "zcaron", XKB_KEY_zcaron },
-    { "zabovedot", XKB_KEY_zabovedot },
-    { "Racute", XKB_KEY_Racute },
-    { "Abreve", XKB_KEY_Abreve },
-    { "Lacute", XKB_KEY_Lacute },
-    { "Cacute", XKB_KEY_Cacute },
-    { "Ccaron", XKB_KEY_Ccaron },
-    { "Eogonek", XKB_KEY_Eogonek },
-    { "Ecaron", XKB_KEY_Ecaron },
-    { "Dcaron", XKB_KEY_Dcaron },
-    { "Dstroke", XKB_KEY_Dstroke },
-    { "Nacute", XKB_KEY_Nacute },
-    { "Ncaron", XKB_KEY_Ncaron },
-    { "Odoubleacute", XKB_KEY_Odoubleacute },
-    { "Rcaron", XKB_KEY_Rcaron },
-    { "Uring", XKB_KEY_Uring },
-    { "Udoubleacute", XKB_KEY_Udoubleacute },
-    { "Tcedilla", XKB_KEY_Tcedilla },
-    { "racute", XKB_KEY_racute },
-    { "abreve", XKB_KEY_abreve },
-    { "lacute", XKB_KEY_lacute },
-    { "cacute", XKB_KEY_cacute },
-    { "ccaron", XKB_KEY_ccaron },
-    { "eogonek", XKB_KEY_eogonek },
-    { "ecaron", XKB_KEY_ecaron },
-    { "dcaron", XKB_KEY_dcaron },
-    { "dstroke", XKB_KEY_dstroke },
-    { "nacute", XKB_KEY_nacute },
-    { "ncaron", XKB_KEY_ncaron },
-    { "odoubleacute", XKB_KEY_odoubleacute },
-    { "rcaron", XKB_KEY_rcaron },
-    { "uring", XKB_KEY_uring },
-    { "udoubleacute", XKB_KEY_udoubleacute },
-    { "tcedilla", XKB_KEY_tcedilla },
-    { "abovedot", XKB_KEY_abovedot },
-    { "Hstroke", XKB_KEY_Hstroke },
-    { "Hcircumflex", XKB_KEY_Hcircumflex },
-    { "Iabovedot", XKB_KEY_Iabovedot },
-    { "Gbreve", XKB_KEY_Gbreve },
-    { "Jcircumflex", XKB_KEY_Jcircumflex },
-    { "hstroke", XKB_KEY_hstroke },
-    { "hcircumflex", XKB_KEY_hcircumflex },
-    { "idotless", XKB_KEY_idotless },
-    { "gbreve", XKB_KEY_gbreve },
-    { "jcircumflex", XKB_KEY_jcircumflex },
-    { "Cabovedot", XKB_KEY_Cabovedot },
-    { "Ccircumflex", XKB_KEY_Ccircumflex },
-    { "Gabovedot", XKB_KEY_Gabovedot },
-    { "Gcircumflex", XKB_KEY_Gcircumflex },
-    { "Ubreve", XKB_KEY_Ubreve },
-    { "Scircumflex", XKB_KEY_Scircumflex },
-    { "cabovedot", XKB_KEY_cabovedot },
-    { "ccircumflex", XKB_KEY_ccircumflex },
-    { "gabovedot", XKB_KEY_gabovedot },
-    { "gcircumflex", XKB_KEY_gcircumflex },
-    { "ubreve", XKB_KEY_ubreve },
-    { "scircumflex", XKB_KEY_scircumflex },
-    { "kra", XKB_KEY_kra },
-    { "Rcedilla", XKB_KEY_Rcedilla },
-    { "Itilde", XKB_KEY_Itilde },
-    { "Lcedilla", XKB_KEY_Lcedilla },
-    { "Emacron", XKB_KEY_Emacron },
-    { "Gcedilla", XKB_KEY_Gcedilla },
-    { "Tslash", XKB_KEY_Tslash },
-    { "rcedilla", XKB_KEY_rcedilla },
-    { "itilde", XKB_KEY_itilde },
-    { "lcedilla", XKB_KEY_lcedilla },
-    { "emacron", XKB_KEY_emacron },
-    { "gcedilla", XKB_KEY_gcedilla },
-    { "tslash", XKB_KEY_tslash },
-    { "ENG", XKB_KEY_ENG },
-    { "eng", XKB_KEY_eng },
-    { "Amacron", XKB_KEY_Amacron },
-    { "Iogonek", XKB_KEY_Iogonek },
-    { "Eabovedot", XKB_KEY_Eabovedot },
-    { "Imacron", XKB_KEY_Imacron },
-    { "Ncedilla", XKB_KEY_Ncedilla },
-    { "Omacron", XKB_KEY_Omacron },
-    { "Kcedilla", XKB_KEY_Kcedilla },
-    { "Uogonek", XKB_KEY_Uogonek },
-    { "Utilde", XKB_KEY_Utilde },
-    { "Umacron", XKB_KEY_Umacron },
-    { "amacron", XKB_KEY_amacron },
-    { "iogonek", XKB_KEY_iogonek },
-    { "eabovedot", XKB_KEY_eabovedot },
-    { "imacron", XKB_KEY_imacron },
-    { "ncedilla", XKB_KEY_ncedilla },
-    { "omacron", XKB_KEY_omacron },
-    { "kcedilla", XKB_KEY_kcedilla },
-    { "uogonek", XKB_KEY_uogonek },
-    { "utilde", XKB_KEY_utilde },
-    { "umacron", XKB_KEY_umacron },
-    { "overline", XKB_KEY_overline },
-    { "kana_fullstop", XKB_KEY_kana_fullstop },
-    { "kana_openingbracket", XKB_KEY_kana_openingbracket },
-    { "kana_closingbracket", XKB_KEY_kana_closingbracket },
-    { "kana_comma", XKB_KEY_kana_comma },
-    { "kana_conjunctive", XKB_KEY_kana_conjunctive },
-    { "kana_WO", XKB_KEY_kana_WO },
-    { "kana_a", XKB_KEY_kana_a },
-    { "kana_i", XKB_KEY_kana_i },
-    { "kana_u", XKB_KEY_kana_u },
-    { "kana_e", XKB_KEY_kana_e },
-    { "kana_o", XKB_KEY_kana_o },
-    { "kana_ya", XKB_KEY_kana_ya },
-    { "kana_yu", XKB_KEY_kana_yu },
-    { "kana_yo", XKB_KEY_kana_yo },
-    { "kana_tsu", XKB_KEY_kana_tsu },
-    { "prolongedsound", XKB_KEY_prolongedsound },
-    { "kana_A", XKB_KEY_kana_A },
-    { "kana_I", XKB_KEY_kana_I },
-    { "kana_U", XKB_KEY_kana_U },
-    { "kana_E", XKB_KEY_kana_E },
-    { "kana_O", XKB_KEY_kana_O },
-    { "kana_KA", XKB_KEY_kana_KA },
-    { "kana_KI", XKB_KEY_kana_KI },
-    { "kana_KU", XKB_KEY_kana_KU },
-    { "kana_KE", XKB_KEY_kana_KE },
-    { "kana_KO", XKB_KEY_kana_KO },
-    { "kana_SA", XKB_KEY_kana_SA },
-    { "kana_SHI", XKB_KEY_kana_SHI },
-    { "kana_SU", XKB_KEY_kana_SU },
-    { "kana_SE", XKB_KEY_kana_SE },
-    { "kana_SO", XKB_KEY_kana_SO },
-    { "kana_TA", XKB_KEY_kana_TA },
-    { "kana_CHI", XKB_KEY_kana_CHI },
-    { "kana_TSU", XKB_KEY_kana_TSU },
-    { "kana_TE", XKB_KEY_kana_TE },
-    { "kana_TO", XKB_KEY_kana_TO },
-    { "kana_NA", XKB_KEY_kana_NA },
-    { "kana_NI", XKB_KEY_kana_NI },
-    { "kana_NU", XKB_KEY_kana_NU },
-    { "kana_NE", XKB_KEY_kana_NE },
-    { "kana_NO", XKB_KEY_kana_NO },
-    { "kana_HA", XKB_KEY_kana_HA },
-    { "kana_HI", XKB_KEY_kana_HI },
-    { "kana_FU", XKB_KEY_kana_FU },
-    { "kana_HE", XKB_KEY_kana_HE },
-    { "kana_HO", XKB_KEY_kana_HO },
-    { "kana_MA", XKB_KEY_kana_MA },
-    { "kana_MI", XKB_KEY_kana_MI },
-    { "kana_MU", XKB_KEY_kana_MU },
-    { "kana_ME", XKB_KEY_kana_ME },
-    { "kana_MO", XKB_KEY_kana_MO },
-    { "kana_YA", XKB_KEY_kana_YA },
-    { "kana_YU", XKB_KEY_kana_YU },
-    { "kana_YO", XKB_KEY_kana_YO },
-    { "kana_RA", XKB_KEY_kana_RA },
-    { "kana_RI", XKB_KEY_kana_RI },
-    { "kana_RU", XKB_KEY_kana_RU },
-    { "kana_RE", XKB_KEY_kana_RE },
-    { "kana_RO", XKB_KEY_kana_RO },
-    { "kana_WA", XKB_KEY_kana_WA },
-    { "kana_N", XKB_KEY_kana_N },
-    { "voicedsound", XKB_KEY_voicedsound },
-    { "semivoicedsound", XKB_KEY_semivoicedsound },
-    { "Arabic_comma", XKB_KEY_Arabic_comma },
-    { "Arabic_semicolon", XKB_KEY_Arabic_semicolon },
-    { "Arabic_question_mark", XKB_KEY_Arabic_question_mark },
-    { "Arabic_hamza", XKB_KEY_Arabic_hamza },
-    { "Arabic_maddaonalef", XKB_KEY_Arabic_maddaonalef },
-    { "Arabic_hamzaonalef", XKB_KEY_Arabic_hamzaonalef },
-    { "Arabic_hamzaonwaw", XKB_KEY_Arabic_hamzaonwaw },
-    { "Arabic_hamzaunderalef", XKB_KEY_Arabic_hamzaunderalef },
-    { "Arabic_hamzaonyeh", XKB_KEY_Arabic_hamzaonyeh },
-    { "Arabic_alef", XKB_KEY_Arabic_alef },
-    { "Arabic_beh", XKB_KEY_Arabic_beh },
-    { "Arabic_tehmarbuta", XKB_KEY_Arabic_tehmarbuta },
-    { "Arabic_teh", XKB_KEY_Arabic_teh },
-    { "Arabic_theh", XKB_KEY_Arabic_theh },
-    { "Arabic_jeem", XKB_KEY_Arabic_jeem },
-    { "Arabic_hah", XKB_KEY_Arabic_hah },
-    { "Arabic_khah", XKB_KEY_Arabic_khah },
-    { "Arabic_dal", XKB_KEY_Arabic_dal },
-    { "Arabic_thal", XKB_KEY_Arabic_thal },
-    { "Arabic_ra", XKB_KEY_Arabic_ra },
-    { "Arabic_zain", XKB_KEY_Arabic_zain },
-    { "Arabic_seen", XKB_KEY_Arabic_seen },
-    { "Arabic_sheen", XKB_KEY_Arabic_sheen },
-    { "Arabic_sad", XKB_KEY_Arabic_sad },
-    { "Arabic_dad", XKB_KEY_Arabic_dad },
-    { "Arabic_tah", XKB_KEY_Arabic_tah },
-    { "Arabic_zah", XKB_KEY_Arabic_zah },
-    { "Arabic_ain", XKB_KEY_Arabic_ain },
-    { "Arabic_ghain", XKB_KEY_Arabic_ghain },
-    { "Arabic_tatweel", XKB_KEY_Arabic_tatweel },
-    { "Arabic_feh", XKB_KEY_Arabic_feh },
-    { "Arabic_qaf", XKB_KEY_Arabic_qaf },
-    { "Arabic_kaf", XKB_KEY_Arabic_kaf },
-    { "Arabic_lam", XKB_KEY_Arabic_lam },
-    { "Arabic_meem", XKB_KEY_Arabic_meem },
-    { "Arabic_noon", XKB_KEY_Arabic_noon },
-    { "Arabic_ha", XKB_KEY_Arabic_ha },
-    { "Arabic_waw", XKB_KEY_Arabic_waw },
-    { "Arabic_alefmaksura", XKB_KEY_Arabic_alefmaksura },
-    { "Arabic_yeh", XKB_KEY_Arabic_yeh },
-    { "Arabic_fathatan", XKB_KEY_Arabic_fathatan },
-    { "Arabic_dammatan", XKB_KEY_Arabic_dammatan },
-    { "Arabic_kasratan", XKB_KEY_Arabic_kasratan },
-    { "Arabic_fatha", XKB_KEY_Arabic_fatha },
-    { "Arabic_damma", XKB_KEY_Arabic_damma },
-    { "Arabic_kasra", XKB_KEY_Arabic_kasra },
-    { "Arabic_shadda", XKB_KEY_Arabic_shadda },
-    { "Arabic_sukun", XKB_KEY_Arabic_sukun },
-    { "Serbian_dje", XKB_KEY_Serbian_dje },
-    { "Macedonia_gje", XKB_KEY_Macedonia_gje },
-    { "Cyrillic_io", XKB_KEY_Cyrillic_io },
-    { "Ukrainian_ie", XKB_KEY_Ukrainian_ie },
-    { "Macedonia_dse", XKB_KEY_Macedonia_dse },
-    { "Ukrainian_i", XKB_KEY_Ukrainian_i },
-    { "Ukrainian_yi", XKB_KEY_Ukrainian_yi },
-    { "Cyrillic_je", XKB_KEY_Cyrillic_je },
-    { "Cyrillic_lje", XKB_KEY_Cyrillic_lje },
-    { "Cyrillic_nje", XKB_KEY_Cyrillic_nje },
-    { "Serbian_tshe", XKB_KEY_Serbian_tshe },
-    { "Macedonia_kje", XKB_KEY_Macedonia_kje },
-    { "Ukrainian_ghe_with_upturn", XKB_KEY_Ukrainian_ghe_with_upturn },
-    { "Byelorussian_shortu", XKB_KEY_Byelorussian_shortu },
-    { "Cyrillic_dzhe", XKB_KEY_Cyrillic_dzhe },
-    { "numerosign", XKB_KEY_numerosign },
-    { "Serbian_DJE", XKB_KEY_Serbian_DJE },
-    { "Macedonia_GJE", XKB_KEY_Macedonia_GJE },
-    { "Cyrillic_IO", XKB_KEY_Cyrillic_IO },
-    { "Ukrainian_IE", XKB_KEY_Ukrainian_IE },
-    { "Macedonia_DSE", XKB_KEY_Macedonia_DSE },
-    { "Ukrainian_I", XKB_KEY_Ukrainian_I },
-    { "Ukrainian_YI", XKB_KEY_Ukrainian_YI },
-    { "Cyrillic_JE", XKB_KEY_Cyrillic_JE },
-    { "Cyrillic_LJE", XKB_KEY_Cyrillic_LJE },
-    { "Cyrillic_NJE", XKB_KEY_Cyrillic_NJE },
-    { "Serbian_TSHE", XKB_KEY_Serbian_TSHE },
-    { "Macedonia_KJE", XKB_KEY_Macedonia_KJE },
-    { "Ukrainian_GHE_WITH_UPTURN", XKB_KEY_Ukrainian_GHE_WITH_UPTURN },
-    { "Byelorussian_SHORTU", XKB_KEY_Byelorussian_SHORTU },
-    { "Cyrillic_DZHE", XKB_KEY_Cyrillic_DZHE },
-    { "Cyrillic_yu", XKB_KEY_Cyrillic_yu },
-    { "Cyrillic_a", XKB_KEY_Cyrillic_a },
-    { "Cyrillic_be", XKB_KEY_Cyrillic_be },
-    { "Cyrillic_tse", XKB_KEY_Cyrillic_tse },
-    { "Cyrillic_de", XKB_KEY_Cyrillic_de },
-    { "Cyrillic_ie", XKB_KEY_Cyrillic_ie },
-    { "Cyrillic_ef", XKB_KEY_Cyrillic_ef },
-    { "Cyrillic_ghe", XKB_KEY_Cyrillic_ghe },
-    { "Cyrillic_ha", XKB_KEY_Cyrillic_ha },
-    { "Cyrillic_i", XKB_KEY_Cyrillic_i },
-    { "Cyrillic_shorti", XKB_KEY_Cyrillic_shorti },
-    { "Cyrillic_ka", XKB_KEY_Cyrillic_ka },
-    { "Cyrillic_el", XKB_KEY_Cyrillic_el },
-    { "Cyrillic_em", XKB_KEY_Cyrillic_em },
-    { "Cyrillic_en", XKB_KEY_Cyrillic_en },
-    { "Cyrillic_o", XKB_KEY_Cyrillic_o },
-    { "Cyrillic_pe", XKB_KEY_Cyrillic_pe },
-    { "Cyrillic_ya", XKB_KEY_Cyrillic_ya },
-    { "Cyrillic_er", XKB_KEY_Cyrillic_er },
-    { "Cyrillic_es", XKB_KEY_Cyrillic_es },
-    { "Cyrillic_te", XKB_KEY_Cyrillic_te },
-    { "Cyrillic_u", XKB_KEY_Cyrillic_u },
-    { "Cyrillic_zhe", XKB_KEY_Cyrillic_zhe },
-    { "Cyrillic_ve", XKB_KEY_Cyrillic_ve },
-    { "Cyrillic_softsign", XKB_KEY_Cyrillic_softsign },
-    { "Cyrillic_yeru", XKB_KEY_Cyrillic_yeru },
-    { "Cyrillic_ze", XKB_KEY_Cyrillic_ze },
-    { "Cyrillic_sha", XKB_KEY_Cyrillic_sha },
-    { "Cyrillic_e", XKB_KEY_Cyrillic_e },
-    { "Cyrillic_shcha", XKB_KEY_Cyrillic_shcha },
-    { "Cyrillic_che", XKB_KEY_Cyrillic_che },
-    { "Cyrillic_hardsign", XKB_KEY_Cyrillic_hardsign },
-    { "Cyrillic_YU", XKB_KEY_Cyrillic_YU },
-    { "Cyrillic_A", XKB_KEY_Cyrillic_A },
-    { "Cyrillic_BE", XKB_KEY_Cyrillic_BE },
-    { "Cyrillic_TSE", XKB_KEY_Cyrillic_TSE },
-    { "Cyrillic_DE", XKB_KEY_Cyrillic_DE },
-    { "Cyrillic_IE", XKB_KEY_Cyrillic_IE },
-    { "Cyrillic_EF", XKB_KEY_Cyrillic_EF },
-    { "Cyrillic_GHE", XKB_KEY_Cyrillic_GHE },
-    { "Cyrillic_HA", XKB_KEY_Cyrillic_HA },
-    { "Cyrillic_I", XKB_KEY_Cyrillic_I },
-    { "Cyrillic_SHORTI", XKB_KEY_Cyrillic_SHORTI },
-    { "Cyrillic_KA", XKB_KEY_Cyrillic_KA },
-    { "Cyrillic_EL", XKB_KEY_Cyrillic_EL },
-    { "Cyrillic_EM", XKB_KEY_Cyrillic_EM },
-    { "Cyrillic_EN", XKB_KEY_Cyrillic_EN },
-    { "Cyrillic_O", XKB_KEY_Cyrillic_O },
-    { "Cyrillic_PE", XKB_KEY_Cyrillic_PE },
-    { "Cyrillic_YA", XKB_KEY_Cyrillic_YA },
-    { "Cyrillic_ER", XKB_KEY_Cyrillic_ER },
-    { "Cyrillic_ES", XKB_KEY_Cyrillic_ES },
-    { "Cyrillic_TE", XKB_KEY_Cyrillic_TE },
-    { "Cyrillic_U", XKB_KEY_Cyrillic_U },
-    { "Cyrillic_ZHE", XKB_KEY_Cyrillic_ZHE },
-    { "Cyrillic_VE", XKB_KEY_Cyrillic_VE },
-    { "Cyrillic_SOFTSIGN", XKB_KEY_Cyrillic_SOFTSIGN },
-    { "Cyrillic_YERU", XKB_KEY_Cyrillic_YERU },
-    { "Cyrillic_ZE", XKB_KEY_Cyrillic_ZE },
-    { "Cyrillic_SHA", XKB_KEY_Cyrillic_SHA },
-    { "Cyrillic_E", XKB_KEY_Cyrillic_E },
-    { "Cyrillic_SHCHA", XKB_KEY_Cyrillic_SHCHA },
-    { "Cyrillic_CHE", XKB_KEY_Cyrillic_CHE },
-    { "Cyrillic_HARDSIGN", XKB_KEY_Cyrillic_HARDSIGN },
-    { "Greek_ALPHAaccent", XKB_KEY_Greek_ALPHAaccent },
-    { "Greek_EPSILONaccent", XKB_KEY_Greek_EPSILONaccent },
-    { "Greek_ETAaccent", XKB_KEY_Greek_ETAaccent },
-    { "Greek_IOTAaccent", XKB_KEY_Greek_IOTAaccent },
-    { "Greek_IOTAdieresis", XKB_KEY_Greek_IOTAdieresis },
-    { "Greek_OMICRONaccent", XKB_KEY_Greek_OMICRONaccent },
-    { "Greek_UPSILONaccent", XKB_KEY_Greek_UPSILONaccent },
-    { "Greek_UPSILONdieresis", XKB_KEY_Greek_UPSILONdieresis },
-    { "Greek_OMEGAaccent", XKB_KEY_Greek_OMEGAaccent },
-    { "Greek_accentdieresis", XKB_KEY_Greek_accentdieresis },
-    { "Greek_horizbar", XKB_KEY_Greek_horizbar },
-    { "Greek_alphaaccent", XKB_KEY_Greek_alphaaccent },
-    { "Greek_epsilonaccent", XKB_KEY_Greek_epsilonaccent },
-    { "Greek_etaaccent", XKB_KEY_Greek_etaaccent },
-    { "Greek_iotaaccent", XKB_KEY_Greek_iotaaccent },
-    { "Greek_iotadieresis", XKB_KEY_Greek_iotadieresis },
-    { "Greek_iotaaccentdieresis", XKB_KEY_Greek_iotaaccentdieresis },
-    { "Greek_omicronaccent", XKB_KEY_Greek_omicronaccent },
-    { "Greek_upsilonaccent", XKB_KEY_Greek_upsilonaccent },
-    { "Greek_upsilondieresis", XKB_KEY_Greek_upsilondieresis },
-    { "Greek_upsilonaccentdieresis", XKB_KEY_Greek_upsilonaccentdieresis },
-    { "Greek_omegaaccent", XKB_KEY_Greek_omegaaccent },
-    { "Greek_ALPHA", XKB_KEY_Greek_ALPHA },
-    { "Greek_BETA", XKB_KEY_Greek_BETA },
-    { "Greek_GAMMA", XKB_KEY_Greek_GAMMA },
-    { "Greek_DELTA", XKB_KEY_Greek_DELTA },
-    { "Greek_EPSILON", XKB_KEY_Greek_EPSILON },
-    { "Greek_ZETA", XKB_KEY_Greek_ZETA },
-    { "Greek_ETA", XKB_KEY_Greek_ETA },
-    { "Greek_THETA", XKB_KEY_Greek_THETA },
-    { "Greek_IOTA", XKB_KEY_Greek_IOTA },
-    { "Greek_KAPPA", XKB_KEY_Greek_KAPPA },
-    { "Greek_LAMDA", XKB_KEY_Greek_LAMDA },
-    { "Greek_MU", XKB_KEY_Greek_MU },
-    { "Greek_NU", XKB_KEY_Greek_NU },
-    { "Greek_XI", XKB_KEY_Greek_XI },
-    { "Greek_OMICRON", XKB_KEY_Greek_OMICRON },
-    { "Greek_PI", XKB_KEY_Greek_PI },
-    { "Greek_RHO", XKB_KEY_Greek_RHO },
-    { "Greek_SIGMA", XKB_KEY_Greek_SIGMA },
-    { "Greek_TAU", XKB_KEY_Greek_TAU },
-    { "Greek_UPSILON", XKB_KEY_Greek_UPSILON },
-    { "Greek_PHI", XKB_KEY_Greek_PHI },
-    { "Greek_CHI", XKB_KEY_Greek_CHI },
-    { "Greek_PSI", XKB_KEY_Greek_PSI },
-    { "Greek_OMEGA", XKB_KEY_Greek_OMEGA },
-    { "Greek_alpha", XKB_KEY_Greek_alpha },
-    { "Greek_beta", XKB_KEY_Greek_beta },
-    { "Greek_gamma", XKB_KEY_Greek_gamma },
-    { "Greek_delta", XKB_KEY_Greek_delta },
-    { "Greek_epsilon", XKB_KEY_Greek_epsilon },
-    { "Greek_zeta", XKB_KEY_Greek_zeta },
-    { "Greek_eta", XKB_KEY_Greek_eta },
-    { "Greek_theta", XKB_KEY_Greek_theta },
-    { "Greek_iota", XKB_KEY_Greek_iota },
-    { "Greek_kappa", XKB_KEY_Greek_kappa },
-    { "Greek_lamda", XKB_KEY_Greek_lamda },
-    { "Greek_mu", XKB_KEY_Greek_mu },
-    { "Greek_nu", XKB_KEY_Greek_nu },
-    { "Greek_xi", XKB_KEY_Greek_xi },
-    { "Greek_omicron", XKB_KEY_Greek_omicron },
-    { "Greek_pi", XKB_KEY_Greek_pi },
-    { "Greek_rho", XKB_KEY_Greek_rho },
-    { "Greek_sigma", XKB_KEY_Greek_sigma },
-    { "Greek_finalsmallsigma", XKB_KEY_Greek_finalsmallsigma },
-    { "Greek_tau", XKB_KEY_Greek_tau },
-    { "Greek_upsilon", XKB_KEY_Greek_upsilon },
-    { "Greek_phi", XKB_KEY_Greek_phi },
-    { "Greek_chi", XKB_KEY_Greek_chi },
-    { "Greek_psi", XKB_KEY_Greek_psi },
-    { "Greek_omega", XKB_KEY_Greek_omega },
-    { "leftradical", XKB_KEY_leftradical },
-    { "topleftradical", XKB_KEY_topleftradical },
-    { "horizconnector", XKB_KEY_horizconnector },
-    { "topintegral", XKB_KEY_topintegral },
-    { "botintegral", XKB_KEY_botintegral },
-    { "vertconnector", XKB_KEY_vertconnector },
-    { "topleftsqbracket", XKB_KEY_topleftsqbracket },
-    { "botleftsqbracket", XKB_KEY_botleftsqbracket },
-    { "toprightsqbracket", XKB_KEY_toprightsqbracket },
-    { "botrightsqbracket", XKB_KEY_botrightsqbracket },
-    { "topleftparens", XKB_KEY_topleftparens },
-    { "botleftparens", XKB_KEY_botleftparens },
-    { "toprightparens", XKB_KEY_toprightparens },
-    { "botrightparens", XKB_KEY_botrightparens },
-    { "leftmiddlecurlybrace", XKB_KEY_leftmiddlecurlybrace },
-    { "rightmiddlecurlybrace", XKB_KEY_rightmiddlecurlybrace },
-    { "topleftsummation", XKB_KEY_topleftsummation },
-    { "botleftsummation", XKB_KEY_botleftsummation },
-    { "topvertsummationconnector", XKB_KEY_topvertsummationconnector },
-    { "botvertsummationconnector", XKB_KEY_botvertsummationconnector },
-    { "toprightsummation", XKB_KEY_toprightsummation },
-    { "botrightsummation", XKB_KEY_botrightsummation },
-    { "rightmiddlesummation", XKB_KEY_rightmiddlesummation },
-    { "lessthanequal", XKB_KEY_lessthanequal },
-    { "notequal", XKB_KEY_notequal },
-    { "greaterthanequal", XKB_KEY_greaterthanequal },
-    { "integral", XKB_KEY_integral },
-    { "therefore", XKB_KEY_therefore },
-    { "variation", XKB_KEY_variation },
-    { "infinity", XKB_KEY_infinity },
-    { "nabla", XKB_KEY_nabla },
-    { "approximate", XKB_KEY_approximate },
-    { "similarequal", XKB_KEY_similarequal },
-    { "ifonlyif", XKB_KEY_ifonlyif },
-    { "implies", XKB_KEY_implies },
-    { "identical", XKB_KEY_identical },
-    { "radical", XKB_KEY_radical },
-    { "includedin", XKB_KEY_includedin },
-    { "includes", XKB_KEY_includes },
-    { "intersection", XKB_KEY_intersection },
-    { "union", XKB_KEY_union },
-    { "logicaland", XKB_KEY_logicaland },
-    { "logicalor", XKB_KEY_logicalor },
-    { "partialderivative", XKB_KEY_partialderivative },
-    { "function", XKB_KEY_function },
-    { "leftarrow", XKB_KEY_leftarrow },
-    { "uparrow", XKB_KEY_uparrow },
-    { "rightarrow", XKB_KEY_rightarrow },
-    { "downarrow", XKB_KEY_downarrow },
-    { "blank", XKB_KEY_blank },
-    { "soliddiamond", XKB_KEY_soliddiamond },
-    { "checkerboard", XKB_KEY_checkerboard },
-    { "ht", XKB_KEY_ht },
-    { "ff", XKB_KEY_ff },
-    { "cr", XKB_KEY_cr },
-    { "lf", XKB_KEY_lf },
-    { "nl", XKB_KEY_nl },
-    { "vt", XKB_KEY_vt },
-    { "lowrightcorner", XKB_KEY_lowrightcorner },
-    { "uprightcorner", XKB_KEY_uprightcorner },
-    { "upleftcorner", XKB_KEY_upleftcorner },
-    { "lowleftcorner", XKB_KEY_lowleftcorner },
-    { "crossinglines", XKB_KEY_crossinglines },
-    { "horizlinescan1", XKB_KEY_horizlinescan1 },
-    { "horizlinescan3", XKB_KEY_horizlinescan3 },
-    { "horizlinescan5", XKB_KEY_horizlinescan5 },
-    { "horizlinescan7", XKB_KEY_horizlinescan7 },
-    { "horizlinescan9", XKB_KEY_horizlinescan9 },
-    { "leftt", XKB_KEY_leftt },
-    { "rightt", XKB_KEY_rightt },
-    { "bott", XKB_KEY_bott },
-    { "topt", XKB_KEY_topt },
-    { "vertbar", XKB_KEY_vertbar },
-    { "emspace", XKB_KEY_emspace },
-    { "enspace", XKB_KEY_enspace },
-    { "em3space", XKB_KEY_em3space },
-    { "em4space", XKB_KEY_em4space },
-    { "digitspace", XKB_KEY_digitspace },
-    { "punctspace", XKB_KEY_punctspace },
-    { "thinspace", XKB_KEY_thinspace },
-    { "hairspace", XKB_KEY_hairspace },
-    { "emdash", XKB_KEY_emdash },
-    { "endash", XKB_KEY_endash },
-    { "signifblank", XKB_KEY_signifblank },
-    { "ellipsis", XKB_KEY_ellipsis },
-    { "doubbaselinedot", XKB_KEY_doubbaselinedot },
-    { "onethird", XKB_KEY_onethird },
-    { "twothirds", XKB_KEY_twothirds },
-    { "onefifth", XKB_KEY_onefifth },
-    { "twofifths", XKB_KEY_twofifths },
-    { "threefifths", XKB_KEY_threefifths },
-    { "fourfifths", XKB_KEY_fourfifths },
-    { "onesixth", XKB_KEY_onesixth },
-    { "fivesixths", XKB_KEY_fivesixths },
-    { "careof", XKB_KEY_careof },
-    { "figdash", XKB_KEY_figdash },
-    { "leftanglebracket", XKB_KEY_leftanglebracket },
-    { "decimalpoint", XKB_KEY_decimalpoint },
-    { "rightanglebracket", XKB_KEY_rightanglebracket },
-    { "marker", XKB_KEY_marker },
-    { "oneeighth", XKB_KEY_oneeighth },
-    { "threeeighths", XKB_KEY_threeeighths },
-    { "fiveeighths", XKB_KEY_fiveeighths },
-    { "seveneighths", XKB_KEY_seveneighths },
-    { "trademark", XKB_KEY_trademark },
-    { "signaturemark", XKB_KEY_signaturemark },
-    { "trademarkincircle", XKB_KEY_trademarkincircle },
-    { "leftopentriangle", XKB_KEY_leftopentriangle },
-    { "rightopentriangle", XKB_KEY_rightopentriangle },
-    { "emopencircle", XKB_KEY_emopencircle },
-    { "emopenrectangle", XKB_KEY_emopenrectangle },
-    { "leftsinglequotemark", XKB_KEY_leftsinglequotemark },
-    { "rightsinglequotemark", XKB_KEY_rightsinglequotemark },
-    { "leftdoublequotemark", XKB_KEY_leftdoublequotemark },
-    { "rightdoublequotemark", XKB_KEY_rightdoublequotemark },
-    { "prescription", XKB_KEY_prescription },
-    { "permille", XKB_KEY_permille },
-    { "minutes", XKB_KEY_minutes },
-    { "seconds", XKB_KEY_seconds },
-    { "latincross", XKB_KEY_latincross },
-    { "hexagram", XKB_KEY_hexagram },
-    { "filledrectbullet", XKB_KEY_filledrectbullet },
-    { "filledlefttribullet", XKB_KEY_filledlefttribullet },
-    { "filledrighttribullet", XKB_KEY_filledrighttribullet },
-    { "emfilledcircle", XKB_KEY_emfilledcircle },
-    { "emfilledrect", XKB_KEY_emfilledrect },
-    { "enopencircbullet", XKB_KEY_enopencircbullet },
-    { "enopensquarebullet", XKB_KEY_enopensquarebullet },
-    { "openrectbullet", XKB_KEY_openrectbullet },
-    { "opentribulletup", XKB_KEY_opentribulletup },
-    { "opentribulletdown", XKB_KEY_opentribulletdown },
-    { "openstar", XKB_KEY_openstar },
-    { "enfilledcircbullet", XKB_KEY_enfilledcircbullet },
-    { "enfilledsqbullet", XKB_KEY_enfilledsqbullet },
-    { "filledtribulletup", XKB_KEY_filledtribulletup },
-    { "filledtribulletdown", XKB_KEY_filledtribulletdown },
-    { "leftpointer", XKB_KEY_leftpointer },
-    { "rightpointer", XKB_KEY_rightpointer },
-    { "club", XKB_KEY_club },
-    { "diamond", XKB_KEY_diamond },
-    { "heart", XKB_KEY_heart },
-    { "maltesecross", XKB_KEY_maltesecross },
-    { "dagger", XKB_KEY_dagger },
-    { "doubledagger", XKB_KEY_doubledagger },
-    { "checkmark", XKB_KEY_checkmark },
-    { "ballotcross", XKB_KEY_ballotcross },
-    { "musicalsharp", XKB_KEY_musicalsharp },
-    { "musicalflat", XKB_KEY_musicalflat },
-    { "malesymbol", XKB_KEY_malesymbol },
-    { "femalesymbol", XKB_KEY_femalesymbol },
-    { "telephone", XKB_KEY_telephone },
-    { "telephonerecorder", XKB_KEY_telephonerecorder },
-    { "phonographcopyright", XKB_KEY_phonographcopyright },
-    { "caret", XKB_KEY_caret },
-    { "singlelowquotemark", XKB_KEY_singlelowquotemark },
-    { "doublelowquotemark", XKB_KEY_doublelowquotemark },
-    { "cursor", XKB_KEY_cursor },
-    { "leftcaret", XKB_KEY_leftcaret },
-    { "rightcaret", XKB_KEY_rightcaret },
-    { "downcaret", XKB_KEY_downcaret },
-    { "upcaret", XKB_KEY_upcaret },
-    { "overbar", XKB_KEY_overbar },
-    { "downtack", XKB_KEY_downtack },
-    { "upshoe", XKB_KEY_upshoe },
-    { "downstile", XKB_KEY_downstile },
-    { "underbar", XKB_KEY_underbar },
-    { "jot", XKB_KEY_jot },
-    { "quad", XKB_KEY_quad },
-    { "uptack", XKB_KEY_uptack },
-    { "circle", XKB_KEY_circle },
-    { "upstile", XKB_KEY_upstile },
-    { "downshoe", XKB_KEY_downshoe },
-    { "rightshoe", XKB_KEY_rightshoe },
-    { "leftshoe", XKB_KEY_leftshoe },
-    { "lefttack", XKB_KEY_lefttack },
-    { "righttack", XKB_KEY_righttack },
-    { "hebrew_doublelowline", XKB_KEY_hebrew_doublelowline },
-    { "hebrew_aleph", XKB_KEY_hebrew_aleph },
-    { "hebrew_bet", XKB_KEY_hebrew_bet },
-    { "hebrew_gimel", XKB_KEY_hebrew_gimel },
-    { "hebrew_dalet", XKB_KEY_hebrew_dalet },
-    { "hebrew_he", XKB_KEY_hebrew_he },
-    { "hebrew_waw", XKB_KEY_hebrew_waw },
-    { "hebrew_zain", XKB_KEY_hebrew_zain },
-    { "hebrew_chet", XKB_KEY_hebrew_chet },
-    { "hebrew_tet", XKB_KEY_hebrew_tet },
-    { "hebrew_yod", XKB_KEY_hebrew_yod },
-    { "hebrew_finalkaph", XKB_KEY_hebrew_finalkaph },
-    { "hebrew_kaph", XKB_KEY_hebrew_kaph },
-    { "hebrew_lamed", XKB_KEY_hebrew_lamed },
-    { "hebrew_finalmem", XKB_KEY_hebrew_finalmem },
-    { "hebrew_mem", XKB_KEY_hebrew_mem },
-    { "hebrew_finalnun", XKB_KEY_hebrew_finalnun },
-    { "hebrew_nun", XKB_KEY_hebrew_nun },
-    { "hebrew_samech", XKB_KEY_hebrew_samech },
-    { "hebrew_ayin", XKB_KEY_hebrew_ayin },
-    { "hebrew_finalpe", XKB_KEY_hebrew_finalpe },
-    { "hebrew_pe", XKB_KEY_hebrew_pe },
-    { "hebrew_finalzade", XKB_KEY_hebrew_finalzade },
-    { "hebrew_zade", XKB_KEY_hebrew_zade },
-    { "hebrew_qoph", XKB_KEY_hebrew_qoph },
-    { "hebrew_resh", XKB_KEY_hebrew_resh },
-    { "hebrew_shin", XKB_KEY_hebrew_shin },
-    { "hebrew_taw", XKB_KEY_hebrew_taw },
-    { "Thai_kokai", XKB_KEY_Thai_kokai },
-    { "Thai_khokhai", XKB_KEY_Thai_khokhai },
-    { "Thai_khokhuat", XKB_KEY_Thai_khokhuat },
-    { "Thai_khokhwai", XKB_KEY_Thai_khokhwai },
-    { "Thai_khokhon", XKB_KEY_Thai_khokhon },
-    { "Thai_khorakhang", XKB_KEY_Thai_khorakhang },
-    { "Thai_ngongu", XKB_KEY_Thai_ngongu },
-    { "Thai_chochan", XKB_KEY_Thai_chochan },
-    { "Thai_choching", XKB_KEY_Thai_choching },
-    { "Thai_chochang", XKB_KEY_Thai_chochang },
-    { "Thai_soso", XKB_KEY_Thai_soso },
-    { "Thai_chochoe", XKB_KEY_Thai_chochoe },
-    { "Thai_yoying", XKB_KEY_Thai_yoying },
-    { "Thai_dochada", XKB_KEY_Thai_dochada },
-    { "Thai_topatak", XKB_KEY_Thai_topatak },
-    { "Thai_thothan", XKB_KEY_Thai_thothan },
-    { "Thai_thonangmontho", XKB_KEY_Thai_thonangmontho },
-    { "Thai_thophuthao", XKB_KEY_Thai_thophuthao },
-    { "Thai_nonen", XKB_KEY_Thai_nonen },
-    { "Thai_dodek", XKB_KEY_Thai_dodek },
-    { "Thai_totao", XKB_KEY_Thai_totao },
-    { "Thai_thothung", XKB_KEY_Thai_thothung },
-    { "Thai_thothahan", XKB_KEY_Thai_thothahan },
-    { "Thai_thothong", XKB_KEY_Thai_thothong },
-    { "Thai_nonu", XKB_KEY_Thai_nonu },
-    { "Thai_bobaimai", XKB_KEY_Thai_bobaimai },
-    { "Thai_popla", XKB_KEY_Thai_popla },
-    { "Thai_phophung", XKB_KEY_Thai_phophung },
-    { "Thai_fofa", XKB_KEY_Thai_fofa },
-    { "Thai_phophan", XKB_KEY_Thai_phophan },
-    { "Thai_fofan", XKB_KEY_Thai_fofan },
-    { "Thai_phosamphao", XKB_KEY_Thai_phosamphao },
-    { "Thai_moma", XKB_KEY_Thai_moma },
-    { "Thai_yoyak", XKB_KEY_Thai_yoyak },
-    { "Thai_rorua", XKB_KEY_Thai_rorua },
-    { "Thai_ru", XKB_KEY_Thai_ru },
-    { "Thai_loling", XKB_KEY_Thai_loling },
-    { "Thai_lu", XKB_KEY_Thai_lu },
-    { "Thai_wowaen", XKB_KEY_Thai_wowaen },
-    { "Thai_sosala", XKB_KEY_Thai_sosala },
-    { "Thai_sorusi", XKB_KEY_Thai_sorusi },
-    { "Thai_sosua", XKB_KEY_Thai_sosua },
-    { "Thai_hohip", XKB_KEY_Thai_hohip },
-    { "Thai_lochula", XKB_KEY_Thai_lochula },
-    { "Thai_oang", XKB_KEY_Thai_oang },
-    { "Thai_honokhuk", XKB_KEY_Thai_honokhuk },
-    { "Thai_paiyannoi", XKB_KEY_Thai_paiyannoi },
-    { "Thai_saraa", XKB_KEY_Thai_saraa },
-    { "Thai_maihanakat", XKB_KEY_Thai_maihanakat },
-    { "Thai_saraaa", XKB_KEY_Thai_saraaa },
-    { "Thai_saraam", XKB_KEY_Thai_saraam },
-    { "Thai_sarai", XKB_KEY_Thai_sarai },
-    { "Thai_saraii", XKB_KEY_Thai_saraii },
-    { "Thai_saraue", XKB_KEY_Thai_saraue },
-    { "Thai_sarauee", XKB_KEY_Thai_sarauee },
-    { "Thai_sarau", XKB_KEY_Thai_sarau },
-    { "Thai_sarauu", XKB_KEY_Thai_sarauu },
-    { "Thai_phinthu", XKB_KEY_Thai_phinthu },
-    { "Thai_maihanakat_maitho", XKB_KEY_Thai_maihanakat_maitho },
-    { "Thai_baht", XKB_KEY_Thai_baht },
-    { "Thai_sarae", XKB_KEY_Thai_sarae },
-    { "Thai_saraae", XKB_KEY_Thai_saraae },
-    { "Thai_sarao", XKB_KEY_Thai_sarao },
-    { "Thai_saraaimaimuan", XKB_KEY_Thai_saraaimaimuan },
-    { "Thai_saraaimaimalai", XKB_KEY_Thai_saraaimaimalai },
-    { "Thai_lakkhangyao", XKB_KEY_Thai_lakkhangyao },
-    { "Thai_maiyamok", XKB_KEY_Thai_maiyamok },
-    { "Thai_maitaikhu", XKB_KEY_Thai_maitaikhu },
-    { "Thai_maiek", XKB_KEY_Thai_maiek },
-    { "Thai_maitho", XKB_KEY_Thai_maitho },
-    { "Thai_maitri", XKB_KEY_Thai_maitri },
-    { "Thai_maichattawa", XKB_KEY_Thai_maichattawa },
-    { "Thai_thanthakhat", XKB_KEY_Thai_thanthakhat },
-    { "Thai_nikhahit", XKB_KEY_Thai_nikhahit },
-    { "Thai_leksun", XKB_KEY_Thai_leksun },
-    { "Thai_leknung", XKB_KEY_Thai_leknung },
-    { "Thai_leksong", XKB_KEY_Thai_leksong },
-    { "Thai_leksam", XKB_KEY_Thai_leksam },
-    { "Thai_leksi", XKB_KEY_Thai_leksi },
-    { "Thai_lekha", XKB_KEY_Thai_lekha },
-    { "Thai_lekhok", XKB_KEY_Thai_lekhok },
-    { "Thai_lekchet", XKB_KEY_Thai_lekchet },
-    { "Thai_lekpaet", XKB_KEY_Thai_lekpaet },
-    { "Thai_lekkao", XKB_KEY_Thai_lekkao },
-    { "Hangul_Kiyeog", XKB_KEY_Hangul_Kiyeog },
-    { "Hangul_SsangKiyeog", XKB_KEY_Hangul_SsangKiyeog },
-    { "Hangul_KiyeogSios", XKB_KEY_Hangul_KiyeogSios },
-    { "Hangul_Nieun", XKB_KEY_Hangul_Nieun },
-    { "Hangul_NieunJieuj", XKB_KEY_Hangul_NieunJieuj },
-    { "Hangul_NieunHieuh", XKB_KEY_Hangul_NieunHieuh },
-    { "Hangul_Dikeud", XKB_KEY_Hangul_Dikeud },
-    { "Hangul_SsangDikeud", XKB_KEY_Hangul_SsangDikeud },
-    { "Hangul_Rieul", XKB_KEY_Hangul_Rieul },
-    { "Hangul_RieulKiyeog", XKB_KEY_Hangul_RieulKiyeog },
-    { "Hangul_RieulMieum", XKB_KEY_Hangul_RieulMieum },
-    { "Hangul_RieulPieub", XKB_KEY_Hangul_RieulPieub },
-    { "Hangul_RieulSios", XKB_KEY_Hangul_RieulSios },
-    { "Hangul_RieulTieut", XKB_KEY_Hangul_RieulTieut },
-    { "Hangul_RieulPhieuf", XKB_KEY_Hangul_RieulPhieuf },
-    { "Hangul_RieulHieuh", XKB_KEY_Hangul_RieulHieuh },
-    { "Hangul_Mieum", XKB_KEY_Hangul_Mieum },
-    { "Hangul_Pieub", XKB_KEY_Hangul_Pieub },
-    { "Hangul_SsangPieub", XKB_KEY_Hangul_SsangPieub },
-    { "Hangul_PieubSios", XKB_KEY_Hangul_PieubSios },
-    { "Hangul_Sios", XKB_KEY_Hangul_Sios },
-    { "Hangul_SsangSios", XKB_KEY_Hangul_SsangSios },
-    { "Hangul_Ieung", XKB_KEY_Hangul_Ieung },
-    { "Hangul_Jieuj", XKB_KEY_Hangul_Jieuj },
-    { "Hangul_SsangJieuj", XKB_KEY_Hangul_SsangJieuj },
-    { "Hangul_Cieuc", XKB_KEY_Hangul_Cieuc },
-    { "Hangul_Khieuq", XKB_KEY_Hangul_Khieuq },
-    { "Hangul_Tieut", XKB_KEY_Hangul_Tieut },
-    { "Hangul_Phieuf", XKB_KEY_Hangul_Phieuf },
-    { "Hangul_Hieuh", XKB_KEY_Hangul_Hieuh },
-    { "Hangul_A", XKB_KEY_Hangul_A },
-    { "Hangul_AE", XKB_KEY_Hangul_AE },
-    { "Hangul_YA", XKB_KEY_Hangul_YA },
-    { "Hangul_YAE", XKB_KEY_Hangul_YAE },
-    { "Hangul_EO", XKB_KEY_Hangul_EO },
-    { "Hangul_E", XKB_KEY_Hangul_E },
-    { "Hangul_YEO", XKB_KEY_Hangul_YEO },
-    { "Hangul_YE", XKB_KEY_Hangul_YE },
-    { "Hangul_O", XKB_KEY_Hangul_O },
-    { "Hangul_WA", XKB_KEY_Hangul_WA },
-    { "Hangul_WAE", XKB_KEY_Hangul_WAE },
-    { "Hangul_OE", XKB_KEY_Hangul_OE },
-    { "Hangul_YO", XKB_KEY_Hangul_YO },
-    { "Hangul_U", XKB_KEY_Hangul_U },
-    { "Hangul_WEO", XKB_KEY_Hangul_WEO },
-    { "Hangul_WE", XKB_KEY_Hangul_WE },
-    { "Hangul_WI", XKB_KEY_Hangul_WI },
-    { "Hangul_YU", XKB_KEY_Hangul_YU },
-    { "Hangul_EU", XKB_KEY_Hangul_EU },
-    { "Hangul_YI", XKB_KEY_Hangul_YI },
-    { "Hangul_I", XKB_KEY_Hangul_I },
-    { "Hangul_J_Kiyeog", XKB_KEY_Hangul_J_Kiyeog },
-    { "Hangul_J_SsangKiyeog", XKB_KEY_Hangul_J_SsangKiyeog },
-    { "Hangul_J_KiyeogSios", XKB_KEY_Hangul_J_KiyeogSios },
-    { "Hangul_J_Nieun", XKB_KEY_Hangul_J_Nieun },
-    { "Hangul_J_NieunJieuj", XKB_KEY_Hangul_J_NieunJieuj },
-    { "Hangul_J_NieunHieuh", XKB_KEY_Hangul_J_NieunHieuh },
-    { "Hangul_J_Dikeud", XKB_KEY_Hangul_J_Dikeud },
-    { "Hangul_J_Rieul", XKB_KEY_Hangul_J_Rieul },
-    { "Hangul_J_RieulKiyeog", XKB_KEY_Hangul_J_RieulKiyeog },
-    { "Hangul_J_RieulMieum", XKB_KEY_Hangul_J_RieulMieum },
-    { "Hangul_J_RieulPieub", XKB_KEY_Hangul_J_RieulPieub },
-    { "Hangul_J_RieulSios", XKB_KEY_Hangul_J_RieulSios },
-    { "Hangul_J_RieulTieut", XKB_KEY_Hangul_J_RieulTieut },
-    { "Hangul_J_RieulPhieuf", XKB_KEY_Hangul_J_RieulPhieuf },
-    { "Hangul_J_RieulHieuh", XKB_KEY_Hangul_J_RieulHieuh },
-    { "Hangul_J_Mieum", XKB_KEY_Hangul_J_Mieum },
-    { "Hangul_J_Pieub", XKB_KEY_Hangul_J_Pieub },
-    { "Hangul_J_PieubSios", XKB_KEY_Hangul_J_PieubSios },
-    { "Hangul_J_Sios", XKB_KEY_Hangul_J_Sios },
-    { "Hangul_J_SsangSios", XKB_KEY_Hangul_J_SsangSios },
-    { "Hangul_J_Ieung", XKB_KEY_Hangul_J_Ieung },
-    { "Hangul_J_Jieuj", XKB_KEY_Hangul_J_Jieuj },
-    { "Hangul_J_Cieuc", XKB_KEY_Hangul_J_Cieuc },
-    { "Hangul_J_Khieuq", XKB_KEY_Hangul_J_Khieuq },
-    { "Hangul_J_Tieut", XKB_KEY_Hangul_J_Tieut },
-    { "Hangul_J_Phieuf", XKB_KEY_Hangul_J_Phieuf },
-    { "Hangul_J_Hieuh", XKB_KEY_Hangul_J_Hieuh },
-    { "Hangul_RieulYeorinHieuh", XKB_KEY_Hangul_RieulYeorinHieuh },
-    { "Hangul_SunkyeongeumMieum", XKB_KEY_Hangul_SunkyeongeumMieum },
-    { "Hangul_SunkyeongeumPieub", XKB_KEY_Hangul_SunkyeongeumPieub },
-    { "Hangul_PanSios", XKB_KEY_Hangul_PanSios },
-    { "Hangul_KkogjiDalrinIeung", XKB_KEY_Hangul_KkogjiDalrinIeung },
-    { "Hangul_SunkyeongeumPhieuf", XKB_KEY_Hangul_SunkyeongeumPhieuf },
-    { "Hangul_YeorinHieuh", XKB_KEY_Hangul_YeorinHieuh },
-    { "Hangul_AraeA", XKB_KEY_Hangul_AraeA },
-    { "Hangul_AraeAE", XKB_KEY_Hangul_AraeAE },
-    { "Hangul_J_PanSios", XKB_KEY_Hangul_J_PanSios },
-    { "Hangul_J_KkogjiDalrinIeung", XKB_KEY_Hangul_J_KkogjiDalrinIeung },
-    { "Hangul_J_YeorinHieuh", XKB_KEY_Hangul_J_YeorinHieuh },
-    { "Korean_Won", XKB_KEY_Korean_Won },
-    { "OE", XKB_KEY_OE },
-    { "oe", XKB_KEY_oe },
-    { "Ydiaeresis", XKB_KEY_Ydiaeresis },
-    { "EuroSign", XKB_KEY_EuroSign },
-    { "3270_Duplicate", XKB_KEY_3270_Duplicate },
-    { "3270_FieldMark", XKB_KEY_3270_FieldMark },
-    { "3270_Right2", XKB_KEY_3270_Right2 },
-    { "3270_Left2", XKB_KEY_3270_Left2 },
-    { "3270_BackTab", XKB_KEY_3270_BackTab },
-    { "3270_EraseEOF", XKB_KEY_3270_EraseEOF },
-    { "3270_EraseInput", XKB_KEY_3270_EraseInput },
-    { "3270_Reset", XKB_KEY_3270_Reset },
-    { "3270_Quit", XKB_KEY_3270_Quit },
-    { "3270_PA1", XKB_KEY_3270_PA1 },
-    { "3270_PA2", XKB_KEY_3270_PA2 },
-    { "3270_PA3", XKB_KEY_3270_PA3 },
-    { "3270_Test", XKB_KEY_3270_Test },
-    { "3270_Attn", XKB_KEY_3270_Attn },
-    { "3270_CursorBlink", XKB_KEY_3270_CursorBlink },
-    { "3270_AltCursor", XKB_KEY_3270_AltCursor },
-    { "3270_KeyClick", XKB_KEY_3270_KeyClick },
-    { "3270_Jump", XKB_KEY_3270_Jump },
-    { "3270_Ident", XKB_KEY_3270_Ident },
-    { "3270_Rule", XKB_KEY_3270_Rule },
-    { "3270_Copy", XKB_KEY_3270_Copy },
-    { "3270_Play", XKB_KEY_3270_Play },
-    { "3270_Setup", XKB_KEY_3270_Setup },
-    { "3270_Record", XKB_KEY_3270_Record },
-    { "3270_ChangeScreen", XKB_KEY_3270_ChangeScreen },
-    { "3270_DeleteWord", XKB_KEY_3270_DeleteWord },
-    { "3270_ExSelect", XKB_KEY_3270_ExSelect },
-    { "3270_CursorSelect", XKB_KEY_3270_CursorSelect },
-    { "3270_PrintScreen", XKB_KEY_3270_PrintScreen },
-    { "3270_Enter", XKB_KEY_3270_Enter },
-    { "ISO_Lock", XKB_KEY_ISO_Lock },
-    { "ISO_Level2_Latch", XKB_KEY_ISO_Level2_Latch },
-    { "ISO_Level3_Shift", XKB_KEY_ISO_Level3_Shift },
-    { "ISO_Level3_Latch", XKB_KEY_ISO_Level3_Latch },
-    { "ISO_Level3_Lock", XKB_KEY_ISO_Level3_Lock },
-    { "ISO_Group_Latch", XKB_KEY_ISO_Group_Latch },
-    { "ISO_Group_Lock", XKB_KEY_ISO_Group_Lock },
-    { "ISO_Next_Group", XKB_KEY_ISO_Next_Group },
-    { "ISO_Next_Group_Lock", XKB_KEY_ISO_Next_Group_Lock },
-    { "ISO_Prev_Group", XKB_KEY_ISO_Prev_Group },
-    { "ISO_Prev_Group_Lock", XKB_KEY_ISO_Prev_Group_Lock },
-    { "ISO_First_Group", XKB_KEY_ISO_First_Group },
-    { "ISO_First_Group_Lock", XKB_KEY_ISO_First_Group_Lock },
-    { "ISO_Last_Group", XKB_KEY_ISO_Last_Group },
-    { "ISO_Last_Group_Lock", XKB_KEY_ISO_Last_Group_Lock },
-    { "ISO_Level5_Shift", XKB_KEY_ISO_Level5_Shift },
-    { "ISO_Level5_Latch", XKB_KEY_ISO_Level5_Latch },
-    { "ISO_Level5_Lock", XKB_KEY_ISO_Level5_Lock },
-    { "ISO_Left_Tab", XKB_KEY_ISO_Left_Tab },
-    { "ISO_Move_Line_Up", XKB_KEY_ISO_Move_Line_Up },
-    { "ISO_Move_Line_Down", XKB_KEY_ISO_Move_Line_Down },
-    { "ISO_Partial_Line_Up", XKB_KEY_ISO_Partial_Line_Up },
-    { "ISO_Partial_Line_Down", XKB_KEY_ISO_Partial_Line_Down },
-    { "ISO_Partial_Space_Left", XKB_KEY_ISO_Partial_Space_Left },
-    { "ISO_Partial_Space_Right", XKB_KEY_ISO_Partial_Space_Right },
-    { "ISO_Set_Margin_Left", XKB_KEY_ISO_Set_Margin_Left },
-    { "ISO_Set_Margin_Right", XKB_KEY_ISO_Set_Margin_Right },
-    { "ISO_Release_Margin_Left", XKB_KEY_ISO_Release_Margin_Left },
-    { "ISO_Release_Margin_Right", XKB_KEY_ISO_Release_Margin_Right },
-    { "ISO_Release_Both_Margins", XKB_KEY_ISO_Release_Both_Margins },
-    { "ISO_Fast_Cursor_Left", XKB_KEY_ISO_Fast_Cursor_Left },
-    { "ISO_Fast_Cursor_Right", XKB_KEY_ISO_Fast_Cursor_Right },
-    { "ISO_Fast_Cursor_Up", XKB_KEY_ISO_Fast_Cursor_Up },
-    { "ISO_Fast_Cursor_Down", XKB_KEY_ISO_Fast_Cursor_Down },
-    { "ISO_Continuous_Underline", XKB_KEY_ISO_Continuous_Underline },
-    { "ISO_Discontinuous_Underline", XKB_KEY_ISO_Discontinuous_Underline },
-    { "ISO_Emphasize", XKB_KEY_ISO_Emphasize },
-    { "ISO_Center_Object", XKB_KEY_ISO_Center_Object },
-    { "ISO_Enter", XKB_KEY_ISO_Enter },
-    { "dead_grave", XKB_KEY_dead_grave },
-    { "dead_acute", XKB_KEY_dead_acute },
-    { "dead_circumflex", XKB_KEY_dead_circumflex },
-    { "dead_tilde", XKB_KEY_dead_tilde },
-    { "dead_macron", XKB_KEY_dead_macron },
-    { "dead_breve", XKB_KEY_dead_breve },
-    { "dead_abovedot", XKB_KEY_dead_abovedot },
-    { "dead_diaeresis", XKB_KEY_dead_diaeresis },
-    { "dead_abovering", XKB_KEY_dead_abovering },
-    { "dead_doubleacute", XKB_KEY_dead_doubleacute },
-    { "dead_caron", XKB_KEY_dead_caron },
-    { "dead_cedilla", XKB_KEY_dead_cedilla },
-    { "dead_ogonek", XKB_KEY_dead_ogonek },
-    { "dead_iota", XKB_KEY_dead_iota },
-    { "dead_voiced_sound", XKB_KEY_dead_voiced_sound },
-    { "dead_semivoiced_sound", XKB_KEY_dead_semivoiced_sound },
-    { "dead_belowdot", XKB_KEY_dead_belowdot },
-    { "dead_hook", XKB_KEY_dead_hook },
-    { "dead_horn", XKB_KEY_dead_horn },
-    { "dead_stroke", XKB_KEY_dead_stroke },
-    { "dead_abovecomma", XKB_KEY_dead_abovecomma },
-    { "dead_abovereversedcomma", XKB_KEY_dead_abovereversedcomma },
-    { "dead_doublegrave", XKB_KEY_dead_doublegrave },
-    { "dead_belowring", XKB_KEY_dead_belowring },
-    { "dead_belowmacron", XKB_KEY_dead_belowmacron },
-    { "dead_belowcircumflex", XKB_KEY_dead_belowcircumflex },
-    { "dead_belowtilde", XKB_KEY_dead_belowtilde },
-    { "dead_belowbreve", XKB_KEY_dead_belowbreve },
-    { "dead_belowdiaeresis", XKB_KEY_dead_belowdiaeresis },
-    { "dead_invertedbreve", XKB_KEY_dead_invertedbreve },
-    { "dead_belowcomma", XKB_KEY_dead_belowcomma },
-    { "dead_currency", XKB_KEY_dead_currency },
-    { "AccessX_Enable", XKB_KEY_AccessX_Enable },
-    { "AccessX_Feedback_Enable", XKB_KEY_AccessX_Feedback_Enable },
-    { "RepeatKeys_Enable", XKB_KEY_RepeatKeys_Enable },
-    { "SlowKeys_Enable", XKB_KEY_SlowKeys_Enable },
-    { "BounceKeys_Enable", XKB_KEY_BounceKeys_Enable },
-    { "StickyKeys_Enable", XKB_KEY_StickyKeys_Enable },
-    { "MouseKeys_Enable", XKB_KEY_MouseKeys_Enable },
-    { "MouseKeys_Accel_Enable", XKB_KEY_MouseKeys_Accel_Enable },
-    { "Overlay1_Enable", XKB_KEY_Overlay1_Enable },
-    { "Overlay2_Enable", XKB_KEY_Overlay2_Enable },
-    { "AudibleBell_Enable", XKB_KEY_AudibleBell_Enable },
-    { "dead_a", XKB_KEY_dead_a },
-    { "dead_A", XKB_KEY_dead_A },
-    { "dead_e", XKB_KEY_dead_e },
-    { "dead_E", XKB_KEY_dead_E },
-    { "dead_i", XKB_KEY_dead_i },
-    { "dead_I", XKB_KEY_dead_I },
-    { "dead_o", XKB_KEY_dead_o },
-    { "dead_O", XKB_KEY_dead_O },
-    { "dead_u", XKB_KEY_dead_u },
-    { "dead_U", XKB_KEY_dead_U },
-    { "dead_small_schwa", XKB_KEY_dead_small_schwa },
-    { "dead_capital_schwa", XKB_KEY_dead_capital_schwa },
-    { "dead_greek", XKB_KEY_dead_greek },
-    { "ch", XKB_KEY_ch },
-    { "Ch", XKB_KEY_Ch },
-    { "CH", XKB_KEY_CH },
-    { "c_h", XKB_KEY_c_h },
-    { "C_h", XKB_KEY_C_h },
-    { "C_H", XKB_KEY_C_H },
-    { "First_Virtual_Screen", XKB_KEY_First_Virtual_Screen },
-    { "Prev_Virtual_Screen", XKB_KEY_Prev_Virtual_Screen },
-    { "Next_Virtual_Screen", XKB_KEY_Next_Virtual_Screen },
-    { "Last_Virtual_Screen", XKB_KEY_Last_Virtual_Screen },
-    { "Terminate_Server", XKB_KEY_Terminate_Server },
-    { "Pointer_Left", XKB_KEY_Pointer_Left },
-    { "Pointer_Right", XKB_KEY_Pointer_Right },
-    { "Pointer_Up", XKB_KEY_Pointer_Up },
-    { "Pointer_Down", XKB_KEY_Pointer_Down },
-    { "Pointer_UpLeft", XKB_KEY_Pointer_UpLeft },
-    { "Pointer_UpRight", XKB_KEY_Pointer_UpRight },
-    { "Pointer_DownLeft", XKB_KEY_Pointer_DownLeft },
-    { "Pointer_DownRight", XKB_KEY_Pointer_DownRight },
-    { "Pointer_Button_Dflt", XKB_KEY_Pointer_Button_Dflt },
-    { "Pointer_Button1", XKB_KEY_Pointer_Button1 },
-    { "Pointer_Button2", XKB_KEY_Pointer_Button2 },
-    { "Pointer_Button3", XKB_KEY_Pointer_Button3 },
-    { "Pointer_Button4", XKB_KEY_Pointer_Button4 },
-    { "Pointer_Button5", XKB_KEY_Pointer_Button5 },
-    { "Pointer_DblClick_Dflt", XKB_KEY_Pointer_DblClick_Dflt },
-    { "Pointer_DblClick1", XKB_KEY_Pointer_DblClick1 },
-    { "Pointer_DblClick2", XKB_KEY_Pointer_DblClick2 },
-    { "Pointer_DblClick3", XKB_KEY_Pointer_DblClick3 },
-    { "Pointer_DblClick4", XKB_KEY_Pointer_DblClick4 },
-    { "Pointer_DblClick5", XKB_KEY_Pointer_DblClick5 },
-    { "Pointer_Drag_Dflt", XKB_KEY_Pointer_Drag_Dflt },
-    { "Pointer_Drag1", XKB_KEY_Pointer_Drag1 },
-    { "Pointer_Drag2", XKB_KEY_Pointer_Drag2 },
-    { "Pointer_Drag3", XKB_KEY_Pointer_Drag3 },
-    { "Pointer_Drag4", XKB_KEY_Pointer_Drag4 },
-    { "Pointer_EnableKeys", XKB_KEY_Pointer_EnableKeys },
-    { "Pointer_Accelerate", XKB_KEY_Pointer_Accelerate },
-    { "Pointer_DfltBtnNext", XKB_KEY_Pointer_DfltBtnNext },
-    { "Pointer_DfltBtnPrev", XKB_KEY_Pointer_DfltBtnPrev },
-    { "Pointer_Drag5", XKB_KEY_Pointer_Drag5 },
-    { "BackSpace", XKB_KEY_BackSpace },
-    { "Tab", XKB_KEY_Tab },
-    { "Linefeed", XKB_KEY_Linefeed },
-    { "Clear", XKB_KEY_Clear },
-    { "Return", XKB_KEY_Return },
-    { "Pause", XKB_KEY_Pause },
-    { "Scroll_Lock", XKB_KEY_Scroll_Lock },
-    { "Sys_Req", XKB_KEY_Sys_Req },
-    { "Escape", XKB_KEY_Escape },
-    { "Multi_key", XKB_KEY_Multi_key },
-    { "Kanji", XKB_KEY_Kanji },
-    { "Muhenkan", XKB_KEY_Muhenkan },
-    { "Henkan_Mode", XKB_KEY_Henkan_Mode },
-    { "Romaji", XKB_KEY_Romaji },
-    { "Hiragana", XKB_KEY_Hiragana },
-    { "Katakana", XKB_KEY_Katakana },
-    { "Hiragana_Katakana", XKB_KEY_Hiragana_Katakana },
-    { "Zenkaku", XKB_KEY_Zenkaku },
-    { "Hankaku", XKB_KEY_Hankaku },
-    { "Zenkaku_Hankaku", XKB_KEY_Zenkaku_Hankaku },
-    { "Touroku", XKB_KEY_Touroku },
-    { "Massyo", XKB_KEY_Massyo },
-    { "Kana_Lock", XKB_KEY_Kana_Lock },
-    { "Kana_Shift", XKB_KEY_Kana_Shift },
-    { "Eisu_Shift", XKB_KEY_Eisu_Shift },
-    { "Eisu_toggle", XKB_KEY_Eisu_toggle },
-    { "Hangul", XKB_KEY_Hangul },
-    { "Hangul_Start", XKB_KEY_Hangul_Start },
-    { "Hangul_End", XKB_KEY_Hangul_End },
-    { "Hangul_Hanja", XKB_KEY_Hangul_Hanja },
-    { "Hangul_Jamo", XKB_KEY_Hangul_Jamo },
-    { "Hangul_Romaja", XKB_KEY_Hangul_Romaja },
-    { "Codeinput", XKB_KEY_Codeinput },
-    { "Hangul_Jeonja", XKB_KEY_Hangul_Jeonja },
-    { "Hangul_Banja", XKB_KEY_Hangul_Banja },
-    { "Hangul_PreHanja", XKB_KEY_Hangul_PreHanja },
-    { "Hangul_PostHanja", XKB_KEY_Hangul_PostHanja },
-    { "SingleCandidate", XKB_KEY_SingleCandidate },
-    { "MultipleCandidate", XKB_KEY_MultipleCandidate },
-    { "PreviousCandidate", XKB_KEY_PreviousCandidate },
-    { "Hangul_Special", XKB_KEY_Hangul_Special },
-    { "Home", XKB_KEY_Home },
-    { "Left", XKB_KEY_Left },
-    { "Up", XKB_KEY_Up },
-    { "Right", XKB_KEY_Right },
-    { "Down", XKB_KEY_Down },
-    { "Prior", XKB_KEY_Prior },
-    { "Next", XKB_KEY_Next },
-    { "End", XKB_KEY_End },
-    { "Begin", XKB_KEY_Begin },
-    { "Select", XKB_KEY_Select },
-    { "Print", XKB_KEY_Print },
-    { "Execute", XKB_KEY_Execute },
-    { "Insert", XKB_KEY_Insert },
-    { "Undo", XKB_KEY_Undo },
-    { "Redo", XKB_KEY_Redo },
-    { "Menu", XKB_KEY_Menu },
-    { "Find", XKB_KEY_Find },
-    { "Cancel", XKB_KEY_Cancel },
-    { "Help", XKB_KEY_Help },
-    { "Break", XKB_KEY_Break },
-    { "Mode_switch", XKB_KEY_Mode_switch },
-    { "Num_Lock", XKB_KEY_Num_Lock },
-    { "KP_Space", XKB_KEY_KP_Space },
-    { "KP_Tab", XKB_KEY_KP_Tab },
-    { "KP_Enter", XKB_KEY_KP_Enter },
-    { "KP_F1", XKB_KEY_KP_F1 },
-    { "KP_F2", XKB_KEY_KP_F2 },
-    { "KP_F3", XKB_KEY_KP_F3 },
-    { "KP_F4", XKB_KEY_KP_F4 },
-    { "KP_Home", XKB_KEY_KP_Home },
-    { "KP_Left", XKB_KEY_KP_Left },
-    { "KP_Up", XKB_KEY_KP_Up },
-    { "KP_Right", XKB_KEY_KP_Right },
-    { "KP_Down", XKB_KEY_KP_Down },
-    { "KP_Prior", XKB_KEY_KP_Prior },
-    { "KP_Next", XKB_KEY_KP_Next },
-    { "KP_End", XKB_KEY_KP_End },
-    { "KP_Begin", XKB_KEY_KP_Begin },
-    { "KP_Insert", XKB_KEY_KP_Insert },
-    { "KP_Delete", XKB_KEY_KP_Delete },
-    { "KP_Multiply", XKB_KEY_KP_Multiply },
-    { "KP_Add", XKB_KEY_KP_Add },
-    { "KP_Separator", XKB_KEY_KP_Separator },
-    { "KP_Subtract", XKB_KEY_KP_Subtract },
-    { "KP_Decimal", XKB_KEY_KP_Decimal },
-    { "KP_Divide", XKB_KEY_KP_Divide },
-    { "KP_0", XKB_KEY_KP_0 },
-    { "KP_1", XKB_KEY_KP_1 },
-    { "KP_2", XKB_KEY_KP_2 },
-    { "KP_3", XKB_KEY_KP_3 },
-    { "KP_4", XKB_KEY_KP_4 },
-    { "KP_5", XKB_KEY_KP_5 },
-    { "KP_6", XKB_KEY_KP_6 },
-    { "KP_7", XKB_KEY_KP_7 },
-    { "KP_8", XKB_KEY_KP_8 },
-    { "KP_9", XKB_KEY_KP_9 },
-    { "KP_Equal", XKB_KEY_KP_Equal },
-    { "F1", XKB_KEY_F1 },
-    { "F2", XKB_KEY_F2 },
-    { "F3", XKB_KEY_F3 },
-    { "F4", XKB_KEY_F4 },
-    { "F5", XKB_KEY_F5 },
-    { "F6", XKB_KEY_F6 },
-    { "F7", XKB_KEY_F7 },
-    { "F8", XKB_KEY_F8 },
-    { "F9", XKB_KEY_F9 },
-    { "F10", XKB_KEY_F10 },
-    { "F11", XKB_KEY_F11 },
-    { "F12", XKB_KEY_F12 },
-    { "F13", XKB_KEY_F13 },
-    { "F14", XKB_KEY_F14 },
-    { "F15", XKB_KEY_F15 },
-    { "F16", XKB_KEY_F16 },
-    { "F17", XKB_KEY_F17 },
-    { "F18", XKB_KEY_F18 },
-    { "F19", XKB_KEY_F19 },
-    { "F20", XKB_KEY_F20 },
-    { "F21", XKB_KEY_F21 },
-    { "F22", XKB_KEY_F22 },
-    { "F23", XKB_KEY_F23 },
-    { "F24", XKB_KEY_F24 },
-    { "F25", XKB_KEY_F25 },
-    { "F26", XKB_KEY_F26 },
-    { "F27", XKB_KEY_F27 },
-    { "F28", XKB_KEY_F28 },
-    { "F29", XKB_KEY_F29 },
-    { "F30", XKB_KEY_F30 },
-    { "F31", XKB_KEY_F31 },
-    { "F32", XKB_KEY_F32 },
-    { "F33", XKB_KEY_F33 },
-    { "F34", XKB_KEY_F34 },
-    { "F35", XKB_KEY_F35 },
-    { "Shift_L", XKB_KEY_Shift_L },
-    { "Shift_R", XKB_KEY_Shift_R },
-    { "Control_L", XKB_KEY_Control_L },
-    { "Control_R", XKB_KEY_Control_R },
-    { "Caps_Lock", XKB_KEY_Caps_Lock },
-    { "Shift_Lock", XKB_KEY_Shift_Lock },
-    { "Meta_L", XKB_KEY_Meta_L },
-    { "Meta_R", XKB_KEY_Meta_R },
-    { "Alt_L", XKB_KEY_Alt_L },
-    { "Alt_R", XKB_KEY_Alt_R },
-    { "Super_L", XKB_KEY_Super_L },
-    { "Super_R", XKB_KEY_Super_R },
-    { "Hyper_L", XKB_KEY_Hyper_L },
-    { "Hyper_R", XKB_KEY_Hyper_R },
-    { "braille_dot_1", XKB_KEY_braille_dot_1 },
-    { "braille_dot_2", XKB_KEY_braille_dot_2 },
-    { "braille_dot_3", XKB_KEY_braille_dot_3 },
-    { "braille_dot_4", XKB_KEY_braille_dot_4 },
-    { "braille_dot_5", XKB_KEY_braille_dot_5 },
-    { "braille_dot_6", XKB_KEY_braille_dot_6 },
-    { "braille_dot_7", XKB_KEY_braille_dot_7 },
-    { "braille_dot_8", XKB_KEY_braille_dot_8 },
-    { "braille_dot_9", XKB_KEY_braille_dot_9 },
-    { "braille_dot_10", XKB_KEY_braille_dot_10 },
-    { "Delete", XKB_KEY_Delete },
-    { "VoidSymbol", XKB_KEY_VoidSymbol },
-    { "Ibreve", XKB_KEY_Ibreve },
-    { "ibreve", XKB_KEY_ibreve },
-    { "Wcircumflex", XKB_KEY_Wcircumflex },
-    { "wcircumflex", XKB_KEY_wcircumflex },
-    { "Ycircumflex", XKB_KEY_Ycircumflex },
-    { "ycircumflex", XKB_KEY_ycircumflex },
-    { "SCHWA", XKB_KEY_SCHWA },
-    { "Obarred", XKB_KEY_Obarred },
-    { "Ohorn", XKB_KEY_Ohorn },
-    { "ohorn", XKB_KEY_ohorn },
-    { "Uhorn", XKB_KEY_Uhorn },
-    { "uhorn", XKB_KEY_uhorn },
-    { "Zstroke", XKB_KEY_Zstroke },
-    { "zstroke", XKB_KEY_zstroke },
-    { "EZH", XKB_KEY_EZH },
-    { "Ocaron", XKB_KEY_Ocaron },
-    { "ocaron", XKB_KEY_ocaron },
-    { "Gcaron", XKB_KEY_Gcaron },
-    { "gcaron", XKB_KEY_gcaron },
-    { "schwa", XKB_KEY_schwa },
-    { "obarred", XKB_KEY_obarred },
-    { "ezh", XKB_KEY_ezh },
-    { "Cyrillic_GHE_bar", XKB_KEY_Cyrillic_GHE_bar },
-    { "Cyrillic_ghe_bar", XKB_KEY_Cyrillic_ghe_bar },
-    { "Cyrillic_ZHE_descender", XKB_KEY_Cyrillic_ZHE_descender },
-    { "Cyrillic_zhe_descender", XKB_KEY_Cyrillic_zhe_descender },
-    { "Cyrillic_KA_descender", XKB_KEY_Cyrillic_KA_descender },
-    { "Cyrillic_ka_descender", XKB_KEY_Cyrillic_ka_descender },
-    { "Cyrillic_KA_vertstroke", XKB_KEY_Cyrillic_KA_vertstroke },
-    { "Cyrillic_ka_vertstroke", XKB_KEY_Cyrillic_ka_vertstroke },
-    { "Cyrillic_EN_descender", XKB_KEY_Cyrillic_EN_descender },
-    { "Cyrillic_en_descender", XKB_KEY_Cyrillic_en_descender },
-    { "Cyrillic_U_straight", XKB_KEY_Cyrillic_U_straight },
-    { "Cyrillic_u_straight", XKB_KEY_Cyrillic_u_straight },
-    { "Cyrillic_U_straight_bar", XKB_KEY_Cyrillic_U_straight_bar },
-    { "Cyrillic_u_straight_bar", XKB_KEY_Cyrillic_u_straight_bar },
-    { "Cyrillic_HA_descender", XKB_KEY_Cyrillic_HA_descender },
-    { "Cyrillic_ha_descender", XKB_KEY_Cyrillic_ha_descender },
-    { "Cyrillic_CHE_descender", XKB_KEY_Cyrillic_CHE_descender },
-    { "Cyrillic_che_descender", XKB_KEY_Cyrillic_che_descender },
-    { "Cyrillic_CHE_vertstroke", XKB_KEY_Cyrillic_CHE_vertstroke },
-    { "Cyrillic_che_vertstroke", XKB_KEY_Cyrillic_che_vertstroke },
-    { "Cyrillic_SHHA", XKB_KEY_Cyrillic_SHHA },
-    { "Cyrillic_shha", XKB_KEY_Cyrillic_shha },
-    { "Cyrillic_SCHWA", XKB_KEY_Cyrillic_SCHWA },
-    { "Cyrillic_schwa", XKB_KEY_Cyrillic_schwa },
-    { "Cyrillic_I_macron", XKB_KEY_Cyrillic_I_macron },
-    { "Cyrillic_i_macron", XKB_KEY_Cyrillic_i_macron },
-    { "Cyrillic_O_bar", XKB_KEY_Cyrillic_O_bar },
-    { "Cyrillic_o_bar", XKB_KEY_Cyrillic_o_bar },
-    { "Cyrillic_U_macron", XKB_KEY_Cyrillic_U_macron },
-    { "Cyrillic_u_macron", XKB_KEY_Cyrillic_u_macron },
-    { "Armenian_AYB", XKB_KEY_Armenian_AYB },
-    { "Armenian_BEN", XKB_KEY_Armenian_BEN },
-    { "Armenian_GIM", XKB_KEY_Armenian_GIM },
-    { "Armenian_DA", XKB_KEY_Armenian_DA },
-    { "Armenian_YECH", XKB_KEY_Armenian_YECH },
-    { "Armenian_ZA", XKB_KEY_Armenian_ZA },
-    { "Armenian_E", XKB_KEY_Armenian_E },
-    { "Armenian_AT", XKB_KEY_Armenian_AT },
-    { "Armenian_TO", XKB_KEY_Armenian_TO },
-    { "Armenian_ZHE", XKB_KEY_Armenian_ZHE },
-    { "Armenian_INI", XKB_KEY_Armenian_INI },
-    { "Armenian_LYUN", XKB_KEY_Armenian_LYUN },
-    { "Armenian_KHE", XKB_KEY_Armenian_KHE },
-    { "Armenian_TSA", XKB_KEY_Armenian_TSA },
-    { "Armenian_KEN", XKB_KEY_Armenian_KEN },
-    { "Armenian_HO", XKB_KEY_Armenian_HO },
-    { "Armenian_DZA", XKB_KEY_Armenian_DZA },
-    { "Armenian_GHAT", XKB_KEY_Armenian_GHAT },
-    { "Armenian_TCHE", XKB_KEY_Armenian_TCHE },
-    { "Armenian_MEN", XKB_KEY_Armenian_MEN },
-    { "Armenian_HI", XKB_KEY_Armenian_HI },
-    { "Armenian_NU", XKB_KEY_Armenian_NU },
-    { "Armenian_SHA", XKB_KEY_Armenian_SHA },
-    { "Armenian_VO", XKB_KEY_Armenian_VO },
-    { "Armenian_CHA", XKB_KEY_Armenian_CHA },
-    { "Armenian_PE", XKB_KEY_Armenian_PE },
-    { "Armenian_JE", XKB_KEY_Armenian_JE },
-    { "Armenian_RA", XKB_KEY_Armenian_RA },
-    { "Armenian_SE", XKB_KEY_Armenian_SE },
-    { "Armenian_VEV", XKB_KEY_Armenian_VEV },
-    { "Armenian_TYUN", XKB_KEY_Armenian_TYUN },
-    { "Armenian_RE", XKB_KEY_Armenian_RE },
-    { "Armenian_TSO", XKB_KEY_Armenian_TSO },
-    { "Armenian_VYUN", XKB_KEY_Armenian_VYUN },
-    { "Armenian_PYUR", XKB_KEY_Armenian_PYUR },
-    { "Armenian_KE", XKB_KEY_Armenian_KE },
-    { "Armenian_O", XKB_KEY_Armenian_O },
-    { "Armenian_FE", XKB_KEY_Armenian_FE },
-    { "Armenian_apostrophe", XKB_KEY_Armenian_apostrophe },
-    { "Armenian_accent", XKB_KEY_Armenian_accent },
-    { "Armenian_exclam", XKB_KEY_Armenian_exclam },
-    { "Armenian_separation_mark", XKB_KEY_Armenian_separation_mark },
-    { "Armenian_question", XKB_KEY_Armenian_question },
-    { "Armenian_ayb", XKB_KEY_Armenian_ayb },
-    { "Armenian_ben", XKB_KEY_Armenian_ben },
-    { "Armenian_gim", XKB_KEY_Armenian_gim },
-    { "Armenian_da", XKB_KEY_Armenian_da },
-    { "Armenian_yech", XKB_KEY_Armenian_yech },
-    { "Armenian_za", XKB_KEY_Armenian_za },
-    { "Armenian_e", XKB_KEY_Armenian_e },
-    { "Armenian_at", XKB_KEY_Armenian_at },
-    { "Armenian_to", XKB_KEY_Armenian_to },
-    { "Armenian_zhe", XKB_KEY_Armenian_zhe },
-    { "Armenian_ini", XKB_KEY_Armenian_ini },
-    { "Armenian_lyun", XKB_KEY_Armenian_lyun },
-    { "Armenian_khe", XKB_KEY_Armenian_khe },
-    { "Armenian_tsa", XKB_KEY_Armenian_tsa },
-    { "Armenian_ken", XKB_KEY_Armenian_ken },
-    { "Armenian_ho", XKB_KEY_Armenian_ho },
-    { "Armenian_dza", XKB_KEY_Armenian_dza },
-    { "Armenian_ghat", XKB_KEY_Armenian_ghat },
-    { "Armenian_tche", XKB_KEY_Armenian_tche },
-    { "Armenian_men", XKB_KEY_Armenian_men },
-    { "Armenian_hi", XKB_KEY_Armenian_hi },
-    { "Armenian_nu", XKB_KEY_Armenian_nu },
-    { "Armenian_sha", XKB_KEY_Armenian_sha },
-    { "Armenian_vo", XKB_KEY_Armenian_vo },
-    { "Armenian_cha", XKB_KEY_Armenian_cha },
-    { "Armenian_pe", XKB_KEY_Armenian_pe },
-    { "Armenian_je", XKB_KEY_Armenian_je },
-    { "Armenian_ra", XKB_KEY_Armenian_ra },
-    { "Armenian_se", XKB_KEY_Armenian_se },
-    { "Armenian_vev", XKB_KEY_Armenian_vev },
-    { "Armenian_tyun", XKB_KEY_Armenian_tyun },
-    { "Armenian_re", XKB_KEY_Armenian_re },
-    { "Armenian_tso", XKB_KEY_Armenian_tso },
-    { "Armenian_vyun", XKB_KEY_Armenian_vyun },
-    { "Armenian_pyur", XKB_KEY_Armenian_pyur },
-    { "Armenian_ke", XKB_KEY_Armenian_ke },
-    { "Armenian_o", XKB_KEY_Armenian_o },
-    { "Armenian_fe", XKB_KEY_Armenian_fe },
-    { "Armenian_ligature_ew", XKB_KEY_Armenian_ligature_ew },
-    { "Armenian_full_stop", XKB_KEY_Armenian_full_stop },
-    { "Armenian_hyphen", XKB_KEY_Armenian_hyphen },
-    { "Arabic_madda_above", XKB_KEY_Arabic_madda_above },
-    { "Arabic_hamza_above", XKB_KEY_Arabic_hamza_above },
-    { "Arabic_hamza_below", XKB_KEY_Arabic_hamza_below },
-    { "Arabic_0", XKB_KEY_Arabic_0 },
-    { "Arabic_1", XKB_KEY_Arabic_1 },
-    { "Arabic_2", XKB_KEY_Arabic_2 },
-    { "Arabic_3", XKB_KEY_Arabic_3 },
-    { "Arabic_4", XKB_KEY_Arabic_4 },
-    { "Arabic_5", XKB_KEY_Arabic_5 },
-    { "Arabic_6", XKB_KEY_Arabic_6 },
-    { "Arabic_7", XKB_KEY_Arabic_7 },
-    { "Arabic_8", XKB_KEY_Arabic_8 },
-    { "Arabic_9", XKB_KEY_Arabic_9 },
-    { "Arabic_percent", XKB_KEY_Arabic_percent },
-    { "Arabic_superscript_alef", XKB_KEY_Arabic_superscript_alef },
-    { "Arabic_tteh", XKB_KEY_Arabic_tteh },
-    { "Arabic_peh", XKB_KEY_Arabic_peh },
-    { "Arabic_tcheh", XKB_KEY_Arabic_tcheh },
-    { "Arabic_ddal", XKB_KEY_Arabic_ddal },
-    { "Arabic_rreh", XKB_KEY_Arabic_rreh },
-    { "Arabic_jeh", XKB_KEY_Arabic_jeh },
-    { "Arabic_veh", XKB_KEY_Arabic_veh },
-    { "Arabic_keheh", XKB_KEY_Arabic_keheh },
-    { "Arabic_gaf", XKB_KEY_Arabic_gaf },
-    { "Arabic_noon_ghunna", XKB_KEY_Arabic_noon_ghunna },
-    { "Arabic_heh_doachashmee", XKB_KEY_Arabic_heh_doachashmee },
-    { "Arabic_heh_goal", XKB_KEY_Arabic_heh_goal },
-    { "Farsi_yeh", XKB_KEY_Farsi_yeh },
-    { "Arabic_yeh_baree", XKB_KEY_Arabic_yeh_baree },
-    { "Arabic_fullstop", XKB_KEY_Arabic_fullstop },
-    { "Farsi_0", XKB_KEY_Farsi_0 },
-    { "Farsi_1", XKB_KEY_Farsi_1 },
-    { "Farsi_2", XKB_KEY_Farsi_2 },
-    { "Farsi_3", XKB_KEY_Farsi_3 },
-    { "Farsi_4", XKB_KEY_Farsi_4 },
-    { "Farsi_5", XKB_KEY_Farsi_5 },
-    { "Farsi_6", XKB_KEY_Farsi_6 },
-    { "Farsi_7", XKB_KEY_Farsi_7 },
-    { "Farsi_8", XKB_KEY_Farsi_8 },
-    { "Farsi_9", XKB_KEY_Farsi_9 },
-    { "Sinh_ng", XKB_KEY_Sinh_ng },
-    { "Sinh_h2", XKB_KEY_Sinh_h2 },
-    { "Sinh_a", XKB_KEY_Sinh_a },
-    { "Sinh_aa", XKB_KEY_Sinh_aa },
-    { "Sinh_ae", XKB_KEY_Sinh_ae },
-    { "Sinh_aee", XKB_KEY_Sinh_aee },
-    { "Sinh_i", XKB_KEY_Sinh_i },
-    { "Sinh_ii", XKB_KEY_Sinh_ii },
-    { "Sinh_u", XKB_KEY_Sinh_u },
-    { "Sinh_uu", XKB_KEY_Sinh_uu },
-    { "Sinh_ri", XKB_KEY_Sinh_ri },
-    { "Sinh_rii", XKB_KEY_Sinh_rii },
-    { "Sinh_lu", XKB_KEY_Sinh_lu },
-    { "Sinh_luu", XKB_KEY_Sinh_luu },
-    { "Sinh_e", XKB_KEY_Sinh_e },
-    { "Sinh_ee", XKB_KEY_Sinh_ee },
-    { "Sinh_ai", XKB_KEY_Sinh_ai },
-    { "Sinh_o", XKB_KEY_Sinh_o },
-    { "Sinh_oo", XKB_KEY_Sinh_oo },
-    { "Sinh_au", XKB_KEY_Sinh_au },
-    { "Sinh_ka", XKB_KEY_Sinh_ka },
-    { "Sinh_kha", XKB_KEY_Sinh_kha },
-    { "Sinh_ga", XKB_KEY_Sinh_ga },
-    { "Sinh_gha", XKB_KEY_Sinh_gha },
-    { "Sinh_ng2", XKB_KEY_Sinh_ng2 },
-    { "Sinh_nga", XKB_KEY_Sinh_nga },
-    { "Sinh_ca", XKB_KEY_Sinh_ca },
-    { "Sinh_cha", XKB_KEY_Sinh_cha },
-    { "Sinh_ja", XKB_KEY_Sinh_ja },
-    { "Sinh_jha", XKB_KEY_Sinh_jha },
-    { "Sinh_nya", XKB_KEY_Sinh_nya },
-    { "Sinh_jnya", XKB_KEY_Sinh_jnya },
-    { "Sinh_nja", XKB_KEY_Sinh_nja },
-    { "Sinh_tta", XKB_KEY_Sinh_tta },
-    { "Sinh_ttha", XKB_KEY_Sinh_ttha },
-    { "Sinh_dda", XKB_KEY_Sinh_dda },
-    { "Sinh_ddha", XKB_KEY_Sinh_ddha },
-    { "Sinh_nna", XKB_KEY_Sinh_nna },
-    { "Sinh_ndda", XKB_KEY_Sinh_ndda },
-    { "Sinh_tha", XKB_KEY_Sinh_tha },
-    { "Sinh_thha", XKB_KEY_Sinh_thha },
-    { "Sinh_dha", XKB_KEY_Sinh_dha },
-    { "Sinh_dhha", XKB_KEY_Sinh_dhha },
-    { "Sinh_na", XKB_KEY_Sinh_na },
-    { "Sinh_ndha", XKB_KEY_Sinh_ndha },
-    { "Sinh_pa", XKB_KEY_Sinh_pa },
-    { "Sinh_pha", XKB_KEY_Sinh_pha },
-    { "Sinh_ba", XKB_KEY_Sinh_ba },
-    { "Sinh_bha", XKB_KEY_Sinh_bha },
-    { "Sinh_ma", XKB_KEY_Sinh_ma },
-    { "Sinh_mba", XKB_KEY_Sinh_mba },
-    { "Sinh_ya", XKB_KEY_Sinh_ya },
-    { "Sinh_ra", XKB_KEY_Sinh_ra },
-    { "Sinh_la", XKB_KEY_Sinh_la },
-    { "Sinh_va", XKB_KEY_Sinh_va },
-    { "Sinh_sha", XKB_KEY_Sinh_sha },
-    { "Sinh_ssha", XKB_KEY_Sinh_ssha },
-    { "Sinh_sa", XKB_KEY_Sinh_sa },
-    { "Sinh_ha", XKB_KEY_Sinh_ha },
-    { "Sinh_lla", XKB_KEY_Sinh_lla },
-    { "Sinh_fa", XKB_KEY_Sinh_fa },
-    { "Sinh_al", XKB_KEY_Sinh_al },
-    { "Sinh_aa2", XKB_KEY_Sinh_aa2 },
-    { "Sinh_ae2", XKB_KEY_Sinh_ae2 },
-    { "Sinh_aee2", XKB_KEY_Sinh_aee2 },
-    { "Sinh_i2", XKB_KEY_Sinh_i2 },
-    { "Sinh_ii2", XKB_KEY_Sinh_ii2 },
-    { "Sinh_u2", XKB_KEY_Sinh_u2 },
-    { "Sinh_uu2", XKB_KEY_Sinh_uu2 },
-    { "Sinh_ru2", XKB_KEY_Sinh_ru2 },
-    { "Sinh_e2", XKB_KEY_Sinh_e2 },
-    { "Sinh_ee2", XKB_KEY_Sinh_ee2 },
-    { "Sinh_ai2", XKB_KEY_Sinh_ai2 },
-    { "Sinh_o2", XKB_KEY_Sinh_o2 },
-    { "Sinh_oo2", XKB_KEY_Sinh_oo2 },
-    { "Sinh_au2", XKB_KEY_Sinh_au2 },
-    { "Sinh_lu2", XKB_KEY_Sinh_lu2 },
-    { "Sinh_ruu2", XKB_KEY_Sinh_ruu2 },
-    { "Sinh_luu2", XKB_KEY_Sinh_luu2 },
-    { "Sinh_kunddaliya", XKB_KEY_Sinh_kunddaliya },
-    { "Georgian_an", XKB_KEY_Georgian_an },
-    { "Georgian_ban", XKB_KEY_Georgian_ban },
-    { "Georgian_gan", XKB_KEY_Georgian_gan },
-    { "Georgian_don", XKB_KEY_Georgian_don },
-    { "Georgian_en", XKB_KEY_Georgian_en },
-    { "Georgian_vin", XKB_KEY_Georgian_vin },
-    { "Georgian_zen", XKB_KEY_Georgian_zen },
-    { "Georgian_tan", XKB_KEY_Georgian_tan },
-    { "Georgian_in", XKB_KEY_Georgian_in },
-    { "Georgian_kan", XKB_KEY_Georgian_kan },
-    { "Georgian_las", XKB_KEY_Georgian_las },
-    { "Georgian_man", XKB_KEY_Georgian_man },
-    { "Georgian_nar", XKB_KEY_Georgian_nar },
-    { "Georgian_on", XKB_KEY_Georgian_on },
-    { "Georgian_par", XKB_KEY_Georgian_par },
-    { "Georgian_zhar", XKB_KEY_Georgian_zhar },
-    { "Georgian_rae", XKB_KEY_Georgian_rae },
-    { "Georgian_san", XKB_KEY_Georgian_san },
-    { "Georgian_tar", XKB_KEY_Georgian_tar },
-    { "Georgian_un", XKB_KEY_Georgian_un },
-    { "Georgian_phar", XKB_KEY_Georgian_phar },
-    { "Georgian_khar", XKB_KEY_Georgian_khar },
-    { "Georgian_ghan", XKB_KEY_Georgian_ghan },
-    { "Georgian_qar", XKB_KEY_Georgian_qar },
-    { "Georgian_shin", XKB_KEY_Georgian_shin },
-    { "Georgian_chin", XKB_KEY_Georgian_chin },
-    { "Georgian_can", XKB_KEY_Georgian_can },
-    { "Georgian_jil", XKB_KEY_Georgian_jil },
-    { "Georgian_cil", XKB_KEY_Georgian_cil },
-    { "Georgian_char", XKB_KEY_Georgian_char },
-    { "Georgian_xan", XKB_KEY_Georgian_xan },
-    { "Georgian_jhan", XKB_KEY_Georgian_jhan },
-    { "Georgian_hae", XKB_KEY_Georgian_hae },
-    { "Georgian_he", XKB_KEY_Georgian_he },
-    { "Georgian_hie", XKB_KEY_Georgian_hie },
-    { "Georgian_we", XKB_KEY_Georgian_we },
-    { "Georgian_har", XKB_KEY_Georgian_har },
-    { "Georgian_hoe", XKB_KEY_Georgian_hoe },
-    { "Georgian_fi", XKB_KEY_Georgian_fi },
-    { "Babovedot", XKB_KEY_Babovedot },
-    { "babovedot", XKB_KEY_babovedot },
-    { "Dabovedot", XKB_KEY_Dabovedot },
-    { "dabovedot", XKB_KEY_dabovedot },
-    { "Fabovedot", XKB_KEY_Fabovedot },
-    { "fabovedot", XKB_KEY_fabovedot },
-    { "Lbelowdot", XKB_KEY_Lbelowdot },
-    { "lbelowdot", XKB_KEY_lbelowdot },
-    { "Mabovedot", XKB_KEY_Mabovedot },
-    { "mabovedot", XKB_KEY_mabovedot },
-    { "Pabovedot", XKB_KEY_Pabovedot },
-    { "pabovedot", XKB_KEY_pabovedot },
-    { "Sabovedot", XKB_KEY_Sabovedot },
-    { "sabovedot", XKB_KEY_sabovedot },
-    { "Tabovedot", XKB_KEY_Tabovedot },
-    { "tabovedot", XKB_KEY_tabovedot },
-    { "Wgrave", XKB_KEY_Wgrave },
-    { "wgrave", XKB_KEY_wgrave },
-    { "Wacute", XKB_KEY_Wacute },
-    { "wacute", XKB_KEY_wacute },
-    { "Wdiaeresis", XKB_KEY_Wdiaeresis },
-    { "wdiaeresis", XKB_KEY_wdiaeresis },
-    { "Xabovedot", XKB_KEY_Xabovedot },
-    { "xabovedot", XKB_KEY_xabovedot },
-    { "Abelowdot", XKB_KEY_Abelowdot },
-    { "abelowdot", XKB_KEY_abelowdot },
-    { "Ahook", XKB_KEY_Ahook },
-    { "ahook", XKB_KEY_ahook },
-    { "Acircumflexacute", XKB_KEY_Acircumflexacute },
-    { "acircumflexacute", XKB_KEY_acircumflexacute },
-    { "Acircumflexgrave", XKB_KEY_Acircumflexgrave },
-    { "acircumflexgrave", XKB_KEY_acircumflexgrave },
-    { "Acircumflexhook", XKB_KEY_Acircumflexhook },
-    { "acircumflexhook", XKB_KEY_acircumflexhook },
-    { "Acircumflextilde", XKB_KEY_Acircumflextilde },
-    { "acircumflextilde", XKB_KEY_acircumflextilde },
-    { "Acircumflexbelowdot", XKB_KEY_Acircumflexbelowdot },
-    { "acircumflexbelowdot", XKB_KEY_acircumflexbelowdot },
-    { "Abreveacute", XKB_KEY_Abreveacute },
-    { "abreveacute", XKB_KEY_abreveacute },
-    { "Abrevegrave", XKB_KEY_Abrevegrave },
-    { "abrevegrave", XKB_KEY_abrevegrave },
-    { "Abrevehook", XKB_KEY_Abrevehook },
-    { "abrevehook", XKB_KEY_abrevehook },
-    { "Abrevetilde", XKB_KEY_Abrevetilde },
-    { "abrevetilde", XKB_KEY_abrevetilde },
-    { "Abrevebelowdot", XKB_KEY_Abrevebelowdot },
-    { "abrevebelowdot", XKB_KEY_abrevebelowdot },
-    { "Ebelowdot", XKB_KEY_Ebelowdot },
-    { "ebelowdot", XKB_KEY_ebelowdot },
-    { "Ehook", XKB_KEY_Ehook },
-    { "ehook", XKB_KEY_ehook },
-    { "Etilde", XKB_KEY_Etilde },
-    { "etilde", XKB_KEY_etilde },
-    { "Ecircumflexacute", XKB_KEY_Ecircumflexacute },
-    { "ecircumflexacute", XKB_KEY_ecircumflexacute },
-    { "Ecircumflexgrave", XKB_KEY_Ecircumflexgrave },
-    { "ecircumflexgrave", XKB_KEY_ecircumflexgrave },
-    { "Ecircumflexhook", XKB_KEY_Ecircumflexhook },
-    { "ecircumflexhook", XKB_KEY_ecircumflexhook },
-    { "Ecircumflextilde", XKB_KEY_Ecircumflextilde },
-    { "ecircumflextilde", XKB_KEY_ecircumflextilde },
-    { "Ecircumflexbelowdot", XKB_KEY_Ecircumflexbelowdot },
-    { "ecircumflexbelowdot", XKB_KEY_ecircumflexbelowdot },
-    { "Ihook", XKB_KEY_Ihook },
-    { "ihook", XKB_KEY_ihook },
-    { "Ibelowdot", XKB_KEY_Ibelowdot },
-    { "ibelowdot", XKB_KEY_ibelowdot },
-    { "Obelowdot", XKB_KEY_Obelowdot },
-    { "obelowdot", XKB_KEY_obelowdot },
-    { "Ohook", XKB_KEY_Ohook },
-    { "ohook", XKB_KEY_ohook },
-    { "Ocircumflexacute", XKB_KEY_Ocircumflexacute },
-    { "ocircumflexacute", XKB_KEY_ocircumflexacute },
-    { "Ocircumflexgrave", XKB_KEY_Ocircumflexgrave },
-    { "ocircumflexgrave", XKB_KEY_ocircumflexgrave },
-    { "Ocircumflexhook", XKB_KEY_Ocircumflexhook },
-    { "ocircumflexhook", XKB_KEY_ocircumflexhook },
-    { "Ocircumflextilde", XKB_KEY_Ocircumflextilde },
-    { "ocircumflextilde", XKB_KEY_ocircumflextilde },
-    { "Ocircumflexbelowdot", XKB_KEY_Ocircumflexbelowdot },
-    { "ocircumflexbelowdot", XKB_KEY_ocircumflexbelowdot },
-    { "Ohornacute", XKB_KEY_Ohornacute },
-    { "ohornacute", XKB_KEY_ohornacute },
-    { "Ohorngrave", XKB_KEY_Ohorngrave },
-    { "ohorngrave", XKB_KEY_ohorngrave },
-    { "Ohornhook", XKB_KEY_Ohornhook },
-    { "ohornhook", XKB_KEY_ohornhook },
-    { "Ohorntilde", XKB_KEY_Ohorntilde },
-    { "ohorntilde", XKB_KEY_ohorntilde },
-    { "Ohornbelowdot", XKB_KEY_Ohornbelowdot },
-    { "ohornbelowdot", XKB_KEY_ohornbelowdot },
-    { "Ubelowdot", XKB_KEY_Ubelowdot },
-    { "ubelowdot", XKB_KEY_ubelowdot },
-    { "Uhook", XKB_KEY_Uhook },
-    { "uhook", XKB_KEY_uhook },
-    { "Uhornacute", XKB_KEY_Uhornacute },
-    { "uhornacute", XKB_KEY_uhornacute },
-    { "Uhorngrave", XKB_KEY_Uhorngrave },
-    { "uhorngrave", XKB_KEY_uhorngrave },
-    { "Uhornhook", XKB_KEY_Uhornhook },
-    { "uhornhook", XKB_KEY_uhornhook },
-    { "Uhorntilde", XKB_KEY_Uhorntilde },
-    { "uhorntilde", XKB_KEY_uhorntilde },
-    { "Uhornbelowdot", XKB_KEY_Uhornbelowdot },
-    { "uhornbelowdot", XKB_KEY_uhornbelowdot },
-    { "Ygrave", XKB_KEY_Ygrave },
-    { "ygrave", XKB_KEY_ygrave },
-    { "Ybelowdot", XKB_KEY_Ybelowdot },
-    { "ybelowdot", XKB_KEY_ybelowdot },
-    { "Yhook", XKB_KEY_Yhook },
-    { "yhook", XKB_KEY_yhook },
-    { "Ytilde", XKB_KEY_Ytilde },
-    { "ytilde", XKB_KEY_ytilde },
-    { "zerosuperior", XKB_KEY_zerosuperior },
-    { "foursuperior", XKB_KEY_foursuperior },
-    { "fivesuperior", XKB_KEY_fivesuperior },
-    { "sixsuperior", XKB_KEY_sixsuperior },
-    { "sevensuperior", XKB_KEY_sevensuperior },
-    { "eightsuperior", XKB_KEY_eightsuperior },
-    { "ninesuperior", XKB_KEY_ninesuperior },
-    { "zerosubscript", XKB_KEY_zerosubscript },
-    { "onesubscript", XKB_KEY_onesubscript },
-    { "twosubscript", XKB_KEY_twosubscript },
-    { "threesubscript", XKB_KEY_threesubscript },
-    { "foursubscript", XKB_KEY_foursubscript },
-    { "fivesubscript", XKB_KEY_fivesubscript },
-    { "sixsubscript", XKB_KEY_sixsubscript },
-    { "sevensubscript", XKB_KEY_sevensubscript },
-    { "eightsubscript", XKB_KEY_eightsubscript },
-    { "ninesubscript", XKB_KEY_ninesubscript },
-    { "EcuSign", XKB_KEY_EcuSign },
-    { "ColonSign", XKB_KEY_ColonSign },
-    { "CruzeiroSign", XKB_KEY_CruzeiroSign },
-    { "FFrancSign", XKB_KEY_FFrancSign },
-    { "LiraSign", XKB_KEY_LiraSign },
-    { "MillSign", XKB_KEY_MillSign },
-    { "NairaSign", XKB_KEY_NairaSign },
-    { "PesetaSign", XKB_KEY_PesetaSign },
-    { "RupeeSign", XKB_KEY_RupeeSign },
-    { "WonSign", XKB_KEY_WonSign },
-    { "NewSheqelSign", XKB_KEY_NewSheqelSign },
-    { "DongSign", XKB_KEY_DongSign },
-    { "partdifferential", XKB_KEY_partdifferential },
-    { "emptyset", XKB_KEY_emptyset },
-    { "elementof", XKB_KEY_elementof },
-    { "notelementof", XKB_KEY_notelementof },
-    { "containsas", XKB_KEY_containsas },
-    { "squareroot", XKB_KEY_squareroot },
-    { "cuberoot", XKB_KEY_cuberoot },
-    { "fourthroot", XKB_KEY_fourthroot },
-    { "dintegral", XKB_KEY_dintegral },
-    { "tintegral", XKB_KEY_tintegral },
-    { "because", XKB_KEY_because },
-    { "notapproxeq", XKB_KEY_notapproxeq },
-    { "approxeq", XKB_KEY_approxeq },
-    { "notidentical", XKB_KEY_notidentical },
-    { "stricteq", XKB_KEY_stricteq },
-    { "braille_blank", XKB_KEY_braille_blank },
-    { "braille_dots_1", XKB_KEY_braille_dots_1 },
-    { "braille_dots_2", XKB_KEY_braille_dots_2 },
-    { "braille_dots_12", XKB_KEY_braille_dots_12 },
-    { "braille_dots_3", XKB_KEY_braille_dots_3 },
-    { "braille_dots_13", XKB_KEY_braille_dots_13 },
-    { "braille_dots_23", XKB_KEY_braille_dots_23 },
-    { "braille_dots_123", XKB_KEY_braille_dots_123 },
-    { "braille_dots_4", XKB_KEY_braille_dots_4 },
-    { "braille_dots_14", XKB_KEY_braille_dots_14 },
-    { "braille_dots_24", XKB_KEY_braille_dots_24 },
-    { "braille_dots_124", XKB_KEY_braille_dots_124 },
-    { "braille_dots_34", XKB_KEY_braille_dots_34 },
-    { "braille_dots_134", XKB_KEY_braille_dots_134 },
-    { "braille_dots_234", XKB_KEY_braille_dots_234 },
-    { "braille_dots_1234", XKB_KEY_braille_dots_1234 },
-    { "braille_dots_5", XKB_KEY_braille_dots_5 },
-    { "braille_dots_15", XKB_KEY_braille_dots_15 },
-    { "braille_dots_25", XKB_KEY_braille_dots_25 },
-    { "braille_dots_125", XKB_KEY_braille_dots_125 },
-    { "braille_dots_35", XKB_KEY_braille_dots_35 },
-    { "braille_dots_135", XKB_KEY_braille_dots_135 },
-    { "braille_dots_235", XKB_KEY_braille_dots_235 },
-    { "braille_dots_1235", XKB_KEY_braille_dots_1235 },
-    { "braille_dots_45", XKB_KEY_braille_dots_45 },
-    { "braille_dots_145", XKB_KEY_braille_dots_145 },
-    { "braille_dots_245", XKB_KEY_braille_dots_245 },
-    { "braille_dots_1245", XKB_KEY_braille_dots_1245 },
-    { "braille_dots_345", XKB_KEY_braille_dots_345 },
-    { "braille_dots_1345", XKB_KEY_braille_dots_1345 },
-    { "braille_dots_2345", XKB_KEY_braille_dots_2345 },
-    { "braille_dots_12345", XKB_KEY_braille_dots_12345 },
-    { "braille_dots_6", XKB_KEY_braille_dots_6 },
-    { "braille_dots_16", XKB_KEY_braille_dots_16 },
-    { "braille_dots_26", XKB_KEY_braille_dots_26 },
-    { "braille_dots_126", XKB_KEY_braille_dots_126 },
-    { "braille_dots_36", XKB_KEY_braille_dots_36 },
-    { "braille_dots_136", XKB_KEY_braille_dots_136 },
-    { "braille_dots_236", XKB_KEY_braille_dots_236 },
-    { "braille_dots_1236", XKB_KEY_braille_dots_1236 },
-    { "braille_dots_46", XKB_KEY_braille_dots_46 },
-    { "braille_dots_146", XKB_KEY_braille_dots_146 },
-    { "braille_dots_246", XKB_KEY_braille_dots_246 },
-    { "braille_dots_1246", XKB_KEY_braille_dots_1246 },
-    { "braille_dots_346", XKB_KEY_braille_dots_346 },
-    { "braille_dots_1346", XKB_KEY_braille_dots_1346 },
-    { "braille_dots_2346", XKB_KEY_braille_dots_2346 },
-    { "braille_dots_12346", XKB_KEY_braille_dots_12346 },
-    { "braille_dots_56", XKB_KEY_braille_dots_56 },
-    { "braille_dots_156", XKB_KEY_braille_dots_156 },
-    { "braille_dots_256", XKB_KEY_braille_dots_256 },
-    { "braille_dots_1256", XKB_KEY_braille_dots_1256 },
-    { "braille_dots_356", XKB_KEY_braille_dots_356 },
-    { "braille_dots_1356", XKB_KEY_braille_dots_1356 },
-    { "braille_dots_2356", XKB_KEY_braille_dots_2356 },
-    { "braille_dots_12356", XKB_KEY_braille_dots_12356 },
-    { "braille_dots_456", XKB_KEY_braille_dots_456 },
-    { "braille_dots_1456", XKB_KEY_braille_dots_1456 },
-    { "braille_dots_2456", XKB_KEY_braille_dots_2456 },
-    { "braille_dots_12456", XKB_KEY_braille_dots_12456 },
-    { "braille_dots_3456", XKB_KEY_braille_dots_3456 },
-    { "braille_dots_13456", XKB_KEY_braille_dots_13456 },
-    { "braille_dots_23456", XKB_KEY_braille_dots_23456 },
-    { "braille_dots_123456", XKB_KEY_braille_dots_123456 },
-    { "braille_dots_7", XKB_KEY_braille_dots_7 },
-    { "braille_dots_17", XKB_KEY_braille_dots_17 },
-    { "braille_dots_27", XKB_KEY_braille_dots_27 },
-    { "braille_dots_127", XKB_KEY_braille_dots_127 },
-    { "braille_dots_37", XKB_KEY_braille_dots_37 },
-    { "braille_dots_137", XKB_KEY_braille_dots_137 },
-    { "braille_dots_237", XKB_KEY_braille_dots_237 },
-    { "braille_dots_1237", XKB_KEY_braille_dots_1237 },
-    { "braille_dots_47", XKB_KEY_braille_dots_47 },
-    { "braille_dots_147", XKB_KEY_braille_dots_147 },
-    { "braille_dots_247", XKB_KEY_braille_dots_247 },
-    { "braille_dots_1247", XKB_KEY_braille_dots_1247 },
-    { "braille_dots_347", XKB_KEY_braille_dots_347 },
-    { "braille_dots_1347", XKB_KEY_braille_dots_1347 },
-    { "braille_dots_2347", XKB_KEY_braille_dots_2347 },
-    { "braille_dots_12347", XKB_KEY_braille_dots_12347 },
-    { "braille_dots_57", XKB_KEY_braille_dots_57 },
-    { "braille_dots_157", XKB_KEY_braille_dots_157 },
-    { "braille_dots_257", XKB_KEY_braille_dots_257 },
-    { "braille_dots_1257", XKB_KEY_braille_dots_1257 },
-    { "braille_dots_357", XKB_KEY_braille_dots_357 },
-    { "braille_dots_1357", XKB_KEY_braille_dots_1357 },
-    { "braille_dots_2357", XKB_KEY_braille_dots_2357 },
-    { "braille_dots_12357", XKB_KEY_braille_dots_12357 },
-    { "braille_dots_457", XKB_KEY_braille_dots_457 },
-    { "braille_dots_1457", XKB_KEY_braille_dots_1457 },
-    { "braille_dots_2457", XKB_KEY_braille_dots_2457 },
-    { "braille_dots_12457", XKB_KEY_braille_dots_12457 },
-    { "braille_dots_3457", XKB_KEY_braille_dots_3457 },
-    { "braille_dots_13457", XKB_KEY_braille_dots_13457 },
-    { "braille_dots_23457", XKB_KEY_braille_dots_23457 },
-    { "braille_dots_123457", XKB_KEY_braille_dots_123457 },
-    { "braille_dots_67", XKB_KEY_braille_dots_67 },
-    { "braille_dots_167", XKB_KEY_braille_dots_167 },
-    { "braille_dots_267", XKB_KEY_braille_dots_267 },
-    { "braille_dots_1267", XKB_KEY_braille_dots_1267 },
-    { "braille_dots_367", XKB_KEY_braille_dots_367 },
-    { "braille_dots_1367", XKB_KEY_braille_dots_1367 },
-    { "braille_dots_2367", XKB_KEY_braille_dots_2367 },
-    { "braille_dots_12367", XKB_KEY_braille_dots_12367 },
-    { "braille_dots_467", XKB_KEY_braille_dots_467 },
-    { "braille_dots_1467", XKB_KEY_braille_dots_1467 },
-    { "braille_dots_2467", XKB_KEY_braille_dots_2467 },
-    { "braille_dots_12467", XKB_KEY_braille_dots_12467 },
-    { "braille_dots_3467", XKB_KEY_braille_dots_3467 },
-    { "braille_dots_13467", XKB_KEY_braille_dots_13467 },
-    { "braille_dots_23467", XKB_KEY_braille_dots_23467 },
-    { "braille_dots_123467", XKB_KEY_braille_dots_123467 },
-    { "braille_dots_567", XKB_KEY_braille_dots_567 },
-    { "braille_dots_1567", XKB_KEY_braille_dots_1567 },
-    { "braille_dots_2567", XKB_KEY_braille_dots_2567 },
-    { "braille_dots_12567", XKB_KEY_braille_dots_12567 },
-    { "braille_dots_3567", XKB_KEY_braille_dots_3567 },
-    { "braille_dots_13567", XKB_KEY_braille_dots_13567 },
-    { "braille_dots_23567", XKB_KEY_braille_dots_23567 },
-    { "braille_dots_123567", XKB_KEY_braille_dots_123567 },
-    { "braille_dots_4567", XKB_KEY_braille_dots_4567 },
-    { "braille_dots_14567", XKB_KEY_braille_dots_14567 },
-    { "braille_dots_24567", XKB_KEY_braille_dots_24567 },
-    { "braille_dots_124567", XKB_KEY_braille_dots_124567 },
-    { "braille_dots_34567", XKB_KEY_braille_dots_34567 },
-    { "braille_dots_134567", XKB_KEY_braille_dots_134567 },
-    { "braille_dots_234567", XKB_KEY_braille_dots_234567 },
-    { "braille_dots_1234567", XKB_KEY_braille_dots_1234567 },
-    { "braille_dots_8", XKB_KEY_braille_dots_8 },
-    { "braille_dots_18", XKB_KEY_braille_dots_18 },
-    { "braille_dots_28", XKB_KEY_braille_dots_28 },
-    { "braille_dots_128", XKB_KEY_braille_dots_128 },
-    { "braille_dots_38", XKB_KEY_braille_dots_38 },
-    { "braille_dots_138", XKB_KEY_braille_dots_138 },
-    { "braille_dots_238", XKB_KEY_braille_dots_238 },
-    { "braille_dots_1238", XKB_KEY_braille_dots_1238 },
-    { "braille_dots_48", XKB_KEY_braille_dots_48 },
-    { "braille_dots_148", XKB_KEY_braille_dots_148 },
-    { "braille_dots_248", XKB_KEY_braille_dots_248 },
-    { "braille_dots_1248", XKB_KEY_braille_dots_1248 },
-    { "braille_dots_348", XKB_KEY_braille_dots_348 },
-    { "braille_dots_1348", XKB_KEY_braille_dots_1348 },
-    { "braille_dots_2348", XKB_KEY_braille_dots_2348 },
-    { "braille_dots_12348", XKB_KEY_braille_dots_12348 },
-    { "braille_dots_58", XKB_KEY_braille_dots_58 },
-    { "braille_dots_158", XKB_KEY_braille_dots_158 },
-    { "braille_dots_258", XKB_KEY_braille_dots_258 },
-    { "braille_dots_1258", XKB_KEY_braille_dots_1258 },
-    { "braille_dots_358", XKB_KEY_braille_dots_358 },
-    { "braille_dots_1358", XKB_KEY_braille_dots_1358 },
-    { "braille_dots_2358", XKB_KEY_braille_dots_2358 },
-    { "braille_dots_12358", XKB_KEY_braille_dots_12358 },
-    { "braille_dots_458", XKB_KEY_braille_dots_458 },
-    { "braille_dots_1458", XKB_KEY_braille_dots_1458 },
-    { "braille_dots_2458", XKB_KEY_braille_dots_2458 },
-    { "braille_dots_12458", XKB_KEY_braille_dots_12458 },
-    { "braille_dots_3458", XKB_KEY_braille_dots_3458 },
-    { "braille_dots_13458", XKB_KEY_braille_dots_13458 },
-    { "braille_dots_23458", XKB_KEY_braille_dots_23458 },
-    { "braille_dots_123458", XKB_KEY_braille_dots_123458 },
-    { "braille_dots_68", XKB_KEY_braille_dots_68 },
-    { "braille_dots_168", XKB_KEY_braille_dots_168 },
-    { "braille_dots_268", XKB_KEY_braille_dots_268 },
-    { "braille_dots_1268", XKB_KEY_braille_dots_1268 },
-    { "braille_dots_368", XKB_KEY_braille_dots_368 },
-    { "braille_dots_1368", XKB_KEY_braille_dots_1368 },
-    { "braille_dots_2368", XKB_KEY_braille_dots_2368 },
-    { "braille_dots_12368", XKB_KEY_braille_dots_12368 },
-    { "braille_dots_468", XKB_KEY_braille_dots_468 },
-    { "braille_dots_1468", XKB_KEY_braille_dots_1468 },
-    { "braille_dots_2468", XKB_KEY_braille_dots_2468 },
-    { "braille_dots_12468", XKB_KEY_braille_dots_12468 },
-    { "braille_dots_3468", XKB_KEY_braille_dots_3468 },
-    { "braille_dots_13468", XKB_KEY_braille_dots_13468 },
-    { "braille_dots_23468", XKB_KEY_braille_dots_23468 },
-    { "braille_dots_123468", XKB_KEY_braille_dots_123468 },
-    { "braille_dots_568", XKB_KEY_braille_dots_568 },
-    { "braille_dots_1568", XKB_KEY_braille_dots_1568 },
-    { "braille_dots_2568", XKB_KEY_braille_dots_2568 },
-    { "braille_dots_12568", XKB_KEY_braille_dots_12568 },
-    { "braille_dots_3568", XKB_KEY_braille_dots_3568 },
-    { "braille_dots_13568", XKB_KEY_braille_dots_13568 },
-    { "braille_dots_23568", XKB_KEY_braille_dots_23568 },
-    { "braille_dots_123568", XKB_KEY_braille_dots_123568 },
-    { "braille_dots_4568", XKB_KEY_braille_dots_4568 },
-    { "braille_dots_14568", XKB_KEY_braille_dots_14568 },
-    { "braille_dots_24568", XKB_KEY_braille_dots_24568 },
-    { "braille_dots_124568", XKB_KEY_braille_dots_124568 },
-    { "braille_dots_34568", XKB_KEY_braille_dots_34568 },
-    { "braille_dots_134568", XKB_KEY_braille_dots_134568 },
-    { "braille_dots_234568", XKB_KEY_braille_dots_234568 },
-    { "braille_dots_1234568", XKB_KEY_braille_dots_1234568 },
-    { "braille_dots_78", XKB_KEY_braille_dots_78 },
-    { "braille_dots_178", XKB_KEY_braille_dots_178 },
-    { "braille_dots_278", XKB_KEY_braille_dots_278 },
-    { "braille_dots_1278", XKB_KEY_braille_dots_1278 },
-    { "braille_dots_378", XKB_KEY_braille_dots_378 },
-    { "braille_dots_1378", XKB_KEY_braille_dots_1378 },
-    { "braille_dots_2378", XKB_KEY_braille_dots_2378 },
-    { "braille_dots_12378", XKB_KEY_braille_dots_12378 },
-    { "braille_dots_478", XKB_KEY_braille_dots_478 },
-    { "braille_dots_1478", XKB_KEY_braille_dots_1478 },
-    { "braille_dots_2478", XKB_KEY_braille_dots_2478 },
-    { "braille_dots_12478", XKB_KEY_braille_dots_12478 },
-    { "braille_dots_3478", XKB_KEY_braille_dots_3478 },
-    { "braille_dots_13478", XKB_KEY_braille_dots_13478 },
-    { "braille_dots_23478", XKB_KEY_braille_dots_23478 },
-    { "braille_dots_123478", XKB_KEY_braille_dots_123478 },
-    { "braille_dots_578", XKB_KEY_braille_dots_578 },
-    { "braille_dots_1578", XKB_KEY_braille_dots_1578 },
-    { "braille_dots_2578", XKB_KEY_braille_dots_2578 },
-    { "braille_dots_12578", XKB_KEY_braille_dots_12578 },
-    { "braille_dots_3578", XKB_KEY_braille_dots_3578 },
-    { "braille_dots_13578", XKB_KEY_braille_dots_13578 },
-    { "braille_dots_23578", XKB_KEY_braille_dots_23578 },
-    { "braille_dots_123578", XKB_KEY_braille_dots_123578 },
-    { "braille_dots_4578", XKB_KEY_braille_dots_4578 },
-    { "braille_dots_14578", XKB_KEY_braille_dots_14578 },
-    { "braille_dots_24578", XKB_KEY_braille_dots_24578 },
-    { "braille_dots_124578", XKB_KEY_braille_dots_124578 },
-    { "braille_dots_34578", XKB_KEY_braille_dots_34578 },
-    { "braille_dots_134578", XKB_KEY_braille_dots_134578 },
-    { "braille_dots_234578", XKB_KEY_braille_dots_234578 },
-    { "braille_dots_1234578", XKB_KEY_braille_dots_1234578 },
-    { "braille_dots_678", XKB_KEY_braille_dots_678 },
-    { "braille_dots_1678", XKB_KEY_braille_dots_1678 },
-    { "braille_dots_2678", XKB_KEY_braille_dots_2678 },
-    { "braille_dots_12678", XKB_KEY_braille_dots_12678 },
-    { "braille_dots_3678", XKB_KEY_braille_dots_3678 },
-    { "braille_dots_13678", XKB_KEY_braille_dots_13678 },
-    { "braille_dots_23678", XKB_KEY_braille_dots_23678 },
-    { "braille_dots_123678", XKB_KEY_braille_dots_123678 },
-    { "braille_dots_4678", XKB_KEY_braille_dots_4678 },
-    { "braille_dots_14678", XKB_KEY_braille_dots_14678 },
-    { "braille_dots_24678", XKB_KEY_braille_dots_24678 },
-    { "braille_dots_124678", XKB_KEY_braille_dots_124678 },
-    { "braille_dots_34678", XKB_KEY_braille_dots_34678 },
-    { "braille_dots_134678", XKB_KEY_braille_dots_134678 },
-    { "braille_dots_234678", XKB_KEY_braille_dots_234678 },
-    { "braille_dots_1234678", XKB_KEY_braille_dots_1234678 },
-    { "braille_dots_5678", XKB_KEY_braille_dots_5678 },
-    { "braille_dots_15678", XKB_KEY_braille_dots_15678 },
-    { "braille_dots_25678", XKB_KEY_braille_dots_25678 },
-    { "braille_dots_125678", XKB_KEY_braille_dots_125678 },
-    { "braille_dots_35678", XKB_KEY_braille_dots_35678 },
-    { "braille_dots_135678", XKB_KEY_braille_dots_135678 },
-    { "braille_dots_235678", XKB_KEY_braille_dots_235678 },
-    { "braille_dots_1235678", XKB_KEY_braille_dots_1235678 },
-    { "braille_dots_45678", XKB_KEY_braille_dots_45678 },
-    { "braille_dots_145678", XKB_KEY_braille_dots_145678 },
-    { "braille_dots_245678", XKB_KEY_braille_dots_245678 },
-    { "braille_dots_1245678", XKB_KEY_braille_dots_1245678 },
-    { "braille_dots_345678", XKB_KEY_braille_dots_345678 },
-    { "braille_dots_1345678", XKB_KEY_braille_dots_1345678 },
-    { "braille_dots_2345678", XKB_KEY_braille_dots_2345678 },
-    { "braille_dots_12345678", XKB_KEY_braille_dots_12345678 },
-    { "hpmute_acute", XKB_KEY_hpmute_acute },
-    { "hpmute_grave", XKB_KEY_hpmute_grave },
-    { "hpmute_asciicircum", XKB_KEY_hpmute_asciicircum },
-    { "hpmute_diaeresis", XKB_KEY_hpmute_diaeresis },
-    { "hpmute_asciitilde", XKB_KEY_hpmute_asciitilde },
-    { "hplira", XKB_KEY_hplira },
-    { "hpguilder", XKB_KEY_hpguilder },
-    { "hpYdiaeresis", XKB_KEY_hpYdiaeresis },
-    { "hplongminus", XKB_KEY_hplongminus },
-    { "hpblock", XKB_KEY_hpblock },
-    { "Ddiaeresis", XKB_KEY_Ddiaeresis },
-    { "Dacute_accent", XKB_KEY_Dacute_accent },
-    { "Dcedilla_accent", XKB_KEY_Dcedilla_accent },
-    { "Dcircumflex_accent", XKB_KEY_Dcircumflex_accent },
-    { "Dgrave_accent", XKB_KEY_Dgrave_accent },
-    { "Dtilde", XKB_KEY_Dtilde },
-    { "Dring_accent", XKB_KEY_Dring_accent },
-    { "DRemove", XKB_KEY_DRemove },
-    { "hpModelock1", XKB_KEY_hpModelock1 },
-    { "hpModelock2", XKB_KEY_hpModelock2 },
-    { "hpReset", XKB_KEY_hpReset },
-    { "hpSystem", XKB_KEY_hpSystem },
-    { "hpUser", XKB_KEY_hpUser },
-    { "hpClearLine", XKB_KEY_hpClearLine },
-    { "hpInsertLine", XKB_KEY_hpInsertLine },
-    { "hpDeleteLine", XKB_KEY_hpDeleteLine },
-    { "hpInsertChar", XKB_KEY_hpInsertChar },
-    { "hpDeleteChar", XKB_KEY_hpDeleteChar },
-    { "hpBackTab", XKB_KEY_hpBackTab },
-    { "hpKP_BackTab", XKB_KEY_hpKP_BackTab },
-    { "Ext16bit_L", XKB_KEY_Ext16bit_L },
-    { "Ext16bit_R", XKB_KEY_Ext16bit_R },
-    { "osfCopy", XKB_KEY_osfCopy },
-    { "osfCut", XKB_KEY_osfCut },
-    { "osfPaste", XKB_KEY_osfPaste },
-    { "osfBackTab", XKB_KEY_osfBackTab },
-    { "osfBackSpace", XKB_KEY_osfBackSpace },
-    { "osfClear", XKB_KEY_osfClear },
-    { "osfEscape", XKB_KEY_osfEscape },
-    { "osfAddMode", XKB_KEY_osfAddMode },
-    { "osfPrimaryPaste", XKB_KEY_osfPrimaryPaste },
-    { "osfQuickPaste", XKB_KEY_osfQuickPaste },
-    { "osfPageLeft", XKB_KEY_osfPageLeft },
-    { "osfPageUp", XKB_KEY_osfPageUp },
-    { "osfPageDown", XKB_KEY_osfPageDown },
-    { "osfPageRight", XKB_KEY_osfPageRight },
-    { "osfActivate", XKB_KEY_osfActivate },
-    { "osfMenuBar", XKB_KEY_osfMenuBar },
-    { "osfLeft", XKB_KEY_osfLeft },
-    { "osfUp", XKB_KEY_osfUp },
-    { "osfRight", XKB_KEY_osfRight },
-    { "osfDown", XKB_KEY_osfDown },
-    { "osfEndLine", XKB_KEY_osfEndLine },
-    { "osfBeginLine", XKB_KEY_osfBeginLine },
-    { "osfEndData", XKB_KEY_osfEndData },
-    { "osfBeginData", XKB_KEY_osfBeginData },
-    { "osfPrevMenu", XKB_KEY_osfPrevMenu },
-    { "osfNextMenu", XKB_KEY_osfNextMenu },
-    { "osfPrevField", XKB_KEY_osfPrevField },
-    { "osfNextField", XKB_KEY_osfNextField },
-    { "osfSelect", XKB_KEY_osfSelect },
-    { "osfInsert", XKB_KEY_osfInsert },
-    { "osfUndo", XKB_KEY_osfUndo },
-    { "osfMenu", XKB_KEY_osfMenu },
-    { "osfCancel", XKB_KEY_osfCancel },
-    { "osfHelp", XKB_KEY_osfHelp },
-    { "osfSelectAll", XKB_KEY_osfSelectAll },
-    { "osfDeselectAll", XKB_KEY_osfDeselectAll },
-    { "osfReselect", XKB_KEY_osfReselect },
-    { "osfExtend", XKB_KEY_osfExtend },
-    { "osfRestore", XKB_KEY_osfRestore },
-    { "osfDelete", XKB_KEY_osfDelete },
-    { "SunFA_Grave", XKB_KEY_SunFA_Grave },
-    { "SunFA_Circum", XKB_KEY_SunFA_Circum },
-    { "SunFA_Tilde", XKB_KEY_SunFA_Tilde },
-    { "SunFA_Acute", XKB_KEY_SunFA_Acute },
-    { "SunFA_Diaeresis", XKB_KEY_SunFA_Diaeresis },
-    { "SunFA_Cedilla", XKB_KEY_SunFA_Cedilla },
-    { "SunF36", XKB_KEY_SunF36 },
-    { "SunF37", XKB_KEY_SunF37 },
-    { "SunSys_Req", XKB_KEY_SunSys_Req },
-    { "SunProps", XKB_KEY_SunProps },
-    { "SunFront", XKB_KEY_SunFront },
-    { "SunCopy", XKB_KEY_SunCopy },
-    { "SunOpen", XKB_KEY_SunOpen },
-    { "SunPaste", XKB_KEY_SunPaste },
-    { "SunCut", XKB_KEY_SunCut },
-    { "SunPowerSwitch", XKB_KEY_SunPowerSwitch },
-    { "SunAudioLowerVolume", XKB_KEY_SunAudioLowerVolume },
-    { "SunAudioMute", XKB_KEY_SunAudioMute },
-    { "SunAudioRaiseVolume", XKB_KEY_SunAudioRaiseVolume },
-    { "SunVideoDegauss", XKB_KEY_SunVideoDegauss },
-    { "SunVideoLowerBrightness", XKB_KEY_SunVideoLowerBrightness },
-    { "SunVideoRaiseBrightness", XKB_KEY_SunVideoRaiseBrightness },
-    { "SunPowerSwitchShift", XKB_KEY_SunPowerSwitchShift },
-    { "XF86Switch_VT_1", XKB_KEY_XF86Switch_VT_1 },
-    { "XF86Switch_VT_2", XKB_KEY_XF86Switch_VT_2 },
-    { "XF86Switch_VT_3", XKB_KEY_XF86Switch_VT_3 },
-    { "XF86Switch_VT_4", XKB_KEY_XF86Switch_VT_4 },
-    { "XF86Switch_VT_5", XKB_KEY_XF86Switch_VT_5 },
-    { "XF86Switch_VT_6", XKB_KEY_XF86Switch_VT_6 },
-    { "XF86Switch_VT_7", XKB_KEY_XF86Switch_VT_7 },
-    { "XF86Switch_VT_8", XKB_KEY_XF86Switch_VT_8 },
-    { "XF86Switch_VT_9", XKB_KEY_XF86Switch_VT_9 },
-    { "XF86Switch_VT_10", XKB_KEY_XF86Switch_VT_10 },
-    { "XF86Switch_VT_11", XKB_KEY_XF86Switch_VT_11 },
-    { "XF86Switch_VT_12", XKB_KEY_XF86Switch_VT_12 },
-    { "XF86Ungrab", XKB_KEY_XF86Ungrab },
-    { "XF86ClearGrab", XKB_KEY_XF86ClearGrab },
-    { "XF86Next_VMode", XKB_KEY_XF86Next_VMode },
-    { "XF86Prev_VMode", XKB_KEY_XF86Prev_VMode },
-    { "XF86LogWindowTree", XKB_KEY_XF86LogWindowTree },
-    { "XF86LogGrabInfo", XKB_KEY_XF86LogGrabInfo },
-    { "XF86ModeLock", XKB_KEY_XF86ModeLock },
-    { "XF86MonBrightnessUp", XKB_KEY_XF86MonBrightnessUp },
-    { "XF86MonBrightnessDown", XKB_KEY_XF86MonBrightnessDown },
-    { "XF86KbdLightOnOff", XKB_KEY_XF86KbdLightOnOff },
-    { "XF86KbdBrightnessUp", XKB_KEY_XF86KbdBrightnessUp },
-    { "XF86KbdBrightnessDown", XKB_KEY_XF86KbdBrightnessDown },
-    { "XF86Standby", XKB_KEY_XF86Standby },
-    { "XF86AudioLowerVolume", XKB_KEY_XF86AudioLowerVolume },
-    { "XF86AudioMute", XKB_KEY_XF86AudioMute },
-    { "XF86AudioRaiseVolume", XKB_KEY_XF86AudioRaiseVolume },
-    { "XF86AudioPlay", XKB_KEY_XF86AudioPlay },
-    { "XF86AudioStop", XKB_KEY_XF86AudioStop },
-    { "XF86AudioPrev", XKB_KEY_XF86AudioPrev },
-    { "XF86AudioNext", XKB_KEY_XF86AudioNext },
-    { "XF86HomePage", XKB_KEY_XF86HomePage },
-    { "XF86Mail", XKB_KEY_XF86Mail },
-    { "XF86Start", XKB_KEY_XF86Start },
-    { "XF86Search", XKB_KEY_XF86Search },
-    { "XF86AudioRecord", XKB_KEY_XF86AudioRecord },
-    { "XF86Calculator", XKB_KEY_XF86Calculator },
-    { "XF86Memo", XKB_KEY_XF86Memo },
-    { "XF86ToDoList", XKB_KEY_XF86ToDoList },
-    { "XF86Calendar", XKB_KEY_XF86Calendar },
-    { "XF86PowerDown", XKB_KEY_XF86PowerDown },
-    { "XF86ContrastAdjust", XKB_KEY_XF86ContrastAdjust },
-    { "XF86RockerUp", XKB_KEY_XF86RockerUp },
-    { "XF86RockerDown", XKB_KEY_XF86RockerDown },
-    { "XF86RockerEnter", XKB_KEY_XF86RockerEnter },
-    { "XF86Back", XKB_KEY_XF86Back },
-    { "XF86Forward", XKB_KEY_XF86Forward },
-    { "XF86Stop", XKB_KEY_XF86Stop },
-    { "XF86Refresh", XKB_KEY_XF86Refresh },
-    { "XF86PowerOff", XKB_KEY_XF86PowerOff },
-    { "XF86WakeUp", XKB_KEY_XF86WakeUp },
-    { "XF86Eject", XKB_KEY_XF86Eject },
-    { "XF86ScreenSaver", XKB_KEY_XF86ScreenSaver },
-    { "XF86WWW", XKB_KEY_XF86WWW },
-    { "XF86Sleep", XKB_KEY_XF86Sleep },
-    { "XF86Favorites", XKB_KEY_XF86Favorites },
-    { "XF86AudioPause", XKB_KEY_XF86AudioPause },
-    { "XF86AudioMedia", XKB_KEY_XF86AudioMedia },
-    { "XF86MyComputer", XKB_KEY_XF86MyComputer },
-    { "XF86VendorHome", XKB_KEY_XF86VendorHome },
-    { "XF86LightBulb", XKB_KEY_XF86LightBulb },
-    { "XF86Shop", XKB_KEY_XF86Shop },
-    { "XF86History", XKB_KEY_XF86History },
-    { "XF86OpenURL", XKB_KEY_XF86OpenURL },
-    { "XF86AddFavorite", XKB_KEY_XF86AddFavorite },
-    { "XF86HotLinks", XKB_KEY_XF86HotLinks },
-    { "XF86BrightnessAdjust", XKB_KEY_XF86BrightnessAdjust },
-    { "XF86Finance", XKB_KEY_XF86Finance },
-    { "XF86Community", XKB_KEY_XF86Community },
-    { "XF86AudioRewind", XKB_KEY_XF86AudioRewind },
-    { "XF86BackForward", XKB_KEY_XF86BackForward },
-    { "XF86Launch0", XKB_KEY_XF86Launch0 },
-    { "XF86Launch1", XKB_KEY_XF86Launch1 },
-    { "XF86Launch2", XKB_KEY_XF86Launch2 },
-    { "XF86Launch3", XKB_KEY_XF86Launch3 },
-    { "XF86Launch4", XKB_KEY_XF86Launch4 },
-    { "XF86Launch5", XKB_KEY_XF86Launch5 },
-    { "XF86Launch6", XKB_KEY_XF86Launch6 },
-    { "XF86Launch7", XKB_KEY_XF86Launch7 },
-    { "XF86Launch8", XKB_KEY_XF86Launch8 },
-    { "XF86Launch9", XKB_KEY_XF86Launch9 },
-    { "XF86LaunchA", XKB_KEY_XF86LaunchA },
-    { "XF86LaunchB", XKB_KEY_XF86LaunchB },
-    { "XF86LaunchC", XKB_KEY_XF86LaunchC },
-    { "XF86LaunchD", XKB_KEY_XF86LaunchD },
-    { "XF86LaunchE", XKB_KEY_XF86LaunchE },
-    { "XF86LaunchF", XKB_KEY_XF86LaunchF },
-    { "XF86ApplicationLeft", XKB_KEY_XF86ApplicationLeft },
-    { "XF86ApplicationRight", XKB_KEY_XF86ApplicationRight },
-    { "XF86Book", XKB_KEY_XF86Book },
-    { "XF86CD", XKB_KEY_XF86CD },
-    { "XF86Calculater", XKB_KEY_XF86Calculater },
-    { "XF86Clear", XKB_KEY_XF86Clear },
-    { "XF86Close", XKB_KEY_XF86Close },
-    { "XF86Copy", XKB_KEY_XF86Copy },
-    { "XF86Cut", XKB_KEY_XF86Cut },
-    { "XF86Display", XKB_KEY_XF86Display },
-    { "XF86DOS", XKB_KEY_XF86DOS },
-    { "XF86Documents", XKB_KEY_XF86Documents },
-    { "XF86Excel", XKB_KEY_XF86Excel },
-    { "XF86Explorer", XKB_KEY_XF86Explorer },
-    { "XF86Game", XKB_KEY_XF86Game },
-    { "XF86Go", XKB_KEY_XF86Go },
-    { "XF86iTouch", XKB_KEY_XF86iTouch },
-    { "XF86LogOff", XKB_KEY_XF86LogOff },
-    { "XF86Market", XKB_KEY_XF86Market },
-    { "XF86Meeting", XKB_KEY_XF86Meeting },
-    { "XF86MenuKB", XKB_KEY_XF86MenuKB },
-    { "XF86MenuPB", XKB_KEY_XF86MenuPB },
-    { "XF86MySites", XKB_KEY_XF86MySites },
-    { "XF86New", XKB_KEY_XF86New },
-    { "XF86News", XKB_KEY_XF86News },
-    { "XF86OfficeHome", XKB_KEY_XF86OfficeHome },
-    { "XF86Open", XKB_KEY_XF86Open },
-    { "XF86Option", XKB_KEY_XF86Option },
-    { "XF86Paste", XKB_KEY_XF86Paste },
-    { "XF86Phone", XKB_KEY_XF86Phone },
-    { "XF86Q", XKB_KEY_XF86Q },
-    { "XF86Reply", XKB_KEY_XF86Reply },
-    { "XF86Reload", XKB_KEY_XF86Reload },
-    { "XF86RotateWindows", XKB_KEY_XF86RotateWindows },
-    { "XF86RotationPB", XKB_KEY_XF86RotationPB },
-    { "XF86RotationKB", XKB_KEY_XF86RotationKB },
-    { "XF86Save", XKB_KEY_XF86Save },
-    { "XF86ScrollUp", XKB_KEY_XF86ScrollUp },
-    { "XF86ScrollDown", XKB_KEY_XF86ScrollDown },
-    { "XF86ScrollClick", XKB_KEY_XF86ScrollClick },
-    { "XF86Send", XKB_KEY_XF86Send },
-    { "XF86Spell", XKB_KEY_XF86Spell },
-    { "XF86SplitScreen", XKB_KEY_XF86SplitScreen },
-    { "XF86Support", XKB_KEY_XF86Support },
-    { "XF86TaskPane", XKB_KEY_XF86TaskPane },
-    { "XF86Terminal", XKB_KEY_XF86Terminal },
-    { "XF86Tools", XKB_KEY_XF86Tools },
-    { "XF86Travel", XKB_KEY_XF86Travel },
-    { "XF86UserPB", XKB_KEY_XF86UserPB },
-    { "XF86User1KB", XKB_KEY_XF86User1KB },
-    { "XF86User2KB", XKB_KEY_XF86User2KB },
-    { "XF86Video", XKB_KEY_XF86Video },
-    { "XF86WheelButton", XKB_KEY_XF86WheelButton },
-    { "XF86Word", XKB_KEY_XF86Word },
-    { "XF86Xfer", XKB_KEY_XF86Xfer },
-    { "XF86ZoomIn", XKB_KEY_XF86ZoomIn },
-    { "XF86ZoomOut", XKB_KEY_XF86ZoomOut },
-    { "XF86Away", XKB_KEY_XF86Away },
-    { "XF86Messenger", XKB_KEY_XF86Messenger },
-    { "XF86WebCam", XKB_KEY_XF86WebCam },
-    { "XF86MailForward", XKB_KEY_XF86MailForward },
-    { "XF86Pictures", XKB_KEY_XF86Pictures },
-    { "XF86Music", XKB_KEY_XF86Music },
-    { "XF86Battery", XKB_KEY_XF86Battery },
-    { "XF86Bluetooth", XKB_KEY_XF86Bluetooth },
-    { "XF86WLAN", XKB_KEY_XF86WLAN },
-    { "XF86UWB", XKB_KEY_XF86UWB },
-    { "XF86AudioForward", XKB_KEY_XF86AudioForward },
-    { "XF86AudioRepeat", XKB_KEY_XF86AudioRepeat },
-    { "XF86AudioRandomPlay", XKB_KEY_XF86AudioRandomPlay },
-    { "XF86Subtitle", XKB_KEY_XF86Subtitle },
-    { "XF86AudioCycleTrack", XKB_KEY_XF86AudioCycleTrack },
-    { "XF86CycleAngle", XKB_KEY_XF86CycleAngle },
-    { "XF86FrameBack", XKB_KEY_XF86FrameBack },
-    { "XF86FrameForward", XKB_KEY_XF86FrameForward },
-    { "XF86Time", XKB_KEY_XF86Time },
-    { "XF86Select", XKB_KEY_XF86Select },
-    { "XF86View", XKB_KEY_XF86View },
-    { "XF86TopMenu", XKB_KEY_XF86TopMenu },
-    { "XF86Red", XKB_KEY_XF86Red },
-    { "XF86Green", XKB_KEY_XF86Green },
-    { "XF86Yellow", XKB_KEY_XF86Yellow },
-    { "XF86Blue", XKB_KEY_XF86Blue },
-    { "XF86Suspend", XKB_KEY_XF86Suspend },
-    { "XF86Hibernate", XKB_KEY_XF86Hibernate },
-    { "XF86TouchpadToggle", XKB_KEY_XF86TouchpadToggle },
-    { "XF86TouchpadOn", XKB_KEY_XF86TouchpadOn },
-    { "XF86TouchpadOff", XKB_KEY_XF86TouchpadOff },
-    { "XF86AudioMicMute", XKB_KEY_XF86AudioMicMute },
+static const uint16_t keysym_name_leaves[][256] = {
+    {
+        20009, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23721, 12017, 22105, 20096, 11169, 21405, 909, 935, 21343, 21353, 3284, 21475, 8681, 19651, 21413, 23686,
+        1, 3, 5, 7, 387, 389, 391, 393, 395, 397, 8665, 22652, 19330, 11969, 13190, 22083,
+        3293, 399, 3329, 8440, 10321, 11342, 12073, 12583, 14296, 16987, 18032, 18064, 19030, 19451, 19861, 20118,
+        21291, 22074, 22135, 22497, 24212, 25765, 26401, 26463, 26549, 28890, 29018, 3604, 3353, 3616, 3261, 26264,
+        13184, 401, 3331, 8442, 10323, 11344, 12075, 12585, 14298, 16989, 18034, 18066, 19032, 19453, 19863, 20120,
+        21293, 22076, 22137, 22499, 24214, 25767, 26403, 26465, 26551, 28892, 29020, 3583, 3393, 3593, 3273, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        19996, 12024, 8590, 23745, 8767, 28974, 8390, 22637, 11121, 8718, 20770, 14267, 20065, 16980, 22249, 19559,
+        11071, 21480, 25743, 25489, 821, 19717, 21333, 21420, 8582, 20673, 19606, 14281, 20640, 20632, 25460, 22092,
+        855, 403, 623, 3296, 827, 2037, 849, 8540, 11642, 11366, 11414, 11620, 17123, 17001, 17049, 17083,
+        11982, 20073, 20445, 20122, 20186, 21228, 20384, 19757, 21214, 25889, 25769, 25817, 25841, 28894, 25417, 23738,
+        862, 410, 635, 3303, 838, 2043, 852, 8549, 11649, 11373, 11426, 11631, 17130, 17008, 17061, 17094,
+        11990, 20080, 20452, 20129, 20198, 21235, 20395, 11160, 21221, 25896, 25776, 25829, 25852, 28901, 25429, 28952,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 919, 8384, 19435, 0, 19130, 22521, 0, 0, 22535, 22549, 24240, 29042, 0, 29056, 29022,
+        0, 927, 20438, 19443, 0, 19137, 22528, 8520, 0, 22542, 22558, 24247, 29049, 11201, 29063, 29032,
+        22190, 0, 0, 446, 0, 19065, 8476, 0, 8526, 0, 11953, 0, 11400, 0, 0, 10366,
+        11319, 19871, 19895, 0, 0, 20406, 0, 0, 22212, 26370, 0, 25863, 0, 0, 24254, 0,
+        22197, 0, 0, 453, 0, 19072, 8483, 0, 8533, 0, 11961, 0, 11407, 0, 0, 10373,
+        11327, 19878, 19902, 0, 0, 20419, 0, 0, 22219, 26376, 0, 25876, 0, 0, 24263, 437,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16945, 0, 0, 0, 0, 15974, 0, 0, 16991, 0, 12607, 18036, 0, 0, 0,
+        0, 16953, 0, 0, 0, 0, 15986, 0, 0, 17105, 0, 12614, 18048, 0, 0, 0,
+        0, 0, 0, 0, 0, 8456, 8558, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 12587, 0, 0, 12653, 0, 0, 0, 0, 25803, 22579, 0,
+        0, 0, 0, 0, 0, 8466, 8570, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 12597, 0, 0, 12665, 0, 0, 0, 0, 25810, 22591, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 19026, 22226, 0, 18018, 19144, 0, 0, 0, 11757, 12635, 25706, 0, 0, 0,
+        0, 0, 0, 22235, 0, 18025, 19153, 0, 0, 0, 11765, 12644, 25713, 11901, 0, 11905,
+        893, 0, 0, 0, 0, 0, 0, 17256, 0, 0, 0, 0, 11346, 0, 0, 17149,
+        0, 19909, 20597, 18697, 0, 0, 0, 0, 0, 26286, 0, 0, 0, 26387, 26239, 0,
+        901, 0, 0, 0, 0, 0, 0, 17264, 0, 0, 0, 0, 11356, 0, 0, 17157,
+        0, 19918, 20605, 18706, 0, 0, 0, 0, 0, 26294, 0, 0, 0, 26394, 26247, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21282, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 18161, 18395, 18091, 18111, 18122, 18607, 18068, 18215, 18585, 18139, 18381, 18615, 18647, 18631, 18551,
+        22048, 18075, 18222, 18592, 18146, 18388, 18229, 18245, 18261, 18237, 18253, 18455, 18471, 18499, 18463, 18491,
+        18519, 18082, 18560, 18527, 18543, 18341, 18357, 18373, 18349, 18365, 18175, 18191, 18153, 18183, 18199, 18279,
+        18295, 18326, 18287, 18318, 18623, 18655, 18639, 18415, 18431, 18447, 18423, 18439, 18599, 18334, 26437, 22662,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1110, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1765, 0, 0, 0, 1699,
+        0, 1304, 1600, 1355, 1374, 1410, 1392, 1068, 1099, 1910, 1899, 1940, 1482, 1293, 1558, 1134,
+        1928, 1720, 2025, 1753, 1796, 1742, 1123, 1860, 2014, 1057, 1270, 0, 0, 0, 0, 0,
+        1871, 1232, 1688, 1505, 1570, 1619, 1631, 1283, 1975, 1080, 1986, 1216, 1158, 1529, 1203, 1145,
+        1516, 1782, 1809, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 22678, 19503, 9457, 26117, 19475, 26093, 26143, 9481, 9619, 9645, 22796, 19531, 26041, 8400, 8973,
+        20107, 22690, 19517, 9469, 26130, 19489, 26105, 26156, 9493, 9632, 9658, 22809, 19545, 26067, 8420, 8987,
+        10201, 8783, 8805, 9953, 8949, 9433, 9023, 9211, 9271, 9375, 9861, 9505, 9047, 9071, 9095, 9671,
+        9723, 10149, 9163, 9187, 9929, 9979, 10249, 10125, 9893, 10173, 10225, 9777, 9001, 9803, 8829, 9339,
+        10213, 8794, 8817, 9966, 8961, 9445, 9035, 9224, 9283, 9386, 9877, 9517, 9059, 9083, 9107, 9682,
+        9735, 10161, 9175, 9199, 9941, 9990, 10262, 10137, 9911, 10187, 10237, 9790, 9012, 9818, 8842, 9357,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 13260, 13390, 13450, 13565, 13644, 0, 13880, 14107, 14175, 0, 13816, 0, 0, 13215, 13528,
+        0, 13278, 13410, 13466, 13582, 13663, 13599, 13900, 14127, 14197, 14147, 13834, 0, 0, 0, 0,
+        0, 13236, 13296, 13504, 13338, 13362, 14237, 13430, 14055, 13543, 13682, 13732, 13756, 13774, 14219, 13852,
+        13940, 13978, 13998, 0, 14035, 14079, 13920, 13318, 13958, 13792, 0, 0, 0, 0, 0, 0,
+        0, 13248, 13307, 13516, 13350, 13376, 14248, 13440, 14067, 13554, 13694, 13744, 13765, 13783, 14228, 13866,
+        13949, 13988, 14010, 13482, 14045, 14093, 13930, 13328, 13968, 13804, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 19274, 25539, 16585, 25513, 3423, 26423, 25554, 3449, 25603, 3498, 25525, 3435, 25588, 3483, 19224,
+        22358, 25571, 3466, 25644, 3539, 25621, 3516, 22380, 0, 0, 0, 0, 19335, 20043, 13198, 17231,
+        25397, 26405, 17193, 0, 0, 19865, 0, 0, 955, 22917, 0, 0, 0, 17114, 17165, 17073,
+        0, 0, 0, 0, 0, 0, 22204, 0, 0, 0, 17173, 17184, 17240, 26280, 19375, 19386,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21381,
+        0, 0, 0, 0, 0, 0, 12574, 0, 0, 0, 0, 19184, 26305, 22315, 11250, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3411,
+        23708, 8604, 16961, 12331, 8728, 19349, 0, 0, 19993, 26460, 19420, 26334, 26321, 19406, 8731, 16600,
+        16615, 16630, 16645, 16660, 19315, 22463, 3534, 25639, 26415, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 11846, 11945, 11739, 11748, 11139, 22063, 25407, 14300, 11773, 11858, 0, 22905, 0, 11730, 11185,
+        20685, 25755, 20623, 25720, 25448, 12525, 20651, 12487, 8507, 0, 0, 12345, 19167, 11058, 22297, 19599,
+        0, 0, 0, 20613, 25435, 12475, 22822, 0, 0, 25678, 22891, 25688, 19245, 22401, 11808, 11821,
+        19295, 22442, 19204, 22337, 21985, 21435, 19657, 22629, 0, 19099, 16544, 12373, 12353, 12390, 11780, 11795,
+        11909, 11926, 20712, 20754, 20736, 20727, 11865, 11884, 12431, 12411, 19262, 22419, 8650, 11131, 15998, 0,
+        19586, 10359, 11213, 8617, 3381, 19778, 19766, 19575, 12318, 24272, 24282, 21455, 8514, 22946, 11226, 8776,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 19194, 0, 0, 22326, 0, 11260, 26313, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21242, 0, 11289, 26348, 11279, 0, 26255, 0, 0, 0, 18060, 0, 22078, 0, 26363, 8627,
+        0, 0, 0, 26355, 0, 0, 11270, 0, 22432, 0, 19286, 0, 19321, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22470, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16091,
+        16004, 16029, 16210, 16064, 16237, 16449, 16495, 16052, 16426, 16460, 16112, 16258, 16281, 16129, 16294, 16145,
+        16305, 16350, 16017, 16161, 16316, 16176, 16471, 16326, 16338, 16378, 16415, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 24535, 24465, 24491, 24505, 24478, 24519, 24848, 24341, 24368, 24354, 25209, 24382, 25385, 24395, 25338,
+        25297, 25247, 25266, 24874, 24408, 25351, 25324, 25282, 25310, 24885, 24327, 24976, 24946, 24419, 24933, 24429,
+        24960, 24838, 25374, 24987, 24998, 24698, 24710, 25362, 25197, 25185, 25219, 24440, 24685, 24895, 24451, 24905,
+        25006, 24746, 25017, 25080, 25103, 25114, 25148, 25160, 25137, 25173, 24920, 0, 0, 0, 24762, 24317,
+        25092, 25029, 25126, 25061, 25041, 24546, 24824, 24785, 24735, 24800, 24812, 24718, 25230, 24860, 0, 0,
+        24673, 24611, 24660, 24637, 24649, 24576, 24587, 24563, 24624, 24599, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 15099, 15644, 15113, 15194, 15225, 15207, 14406, 15607, 15379, 15410, 15429, 15466, 15484, 15501, 15447,
+        15392, 15156, 15291, 15663, 15304, 15580, 15681, 14495, 15072, 15626, 14376, 15085, 15801, 15277, 14473, 14317,
+        14326, 15875, 15885, 14440, 14420, 15906, 15896, 15243, 15823, 15833, 15252, 15946, 15814, 15854, 15844, 15865,
+        15956, 14450, 15936, 14486, 14600, 14970, 14616, 14678, 14713, 14693, 14523, 14800, 14835, 14856, 14897, 14917,
+        14936, 14876, 14815, 14663, 14766, 14781, 14956, 14991, 14554, 14569, 14508, 14584, 15010, 14750, 14539, 15519,
+        15711, 15762, 15262, 15131, 15736, 15917, 14336, 14349, 14733, 14636, 15025, 0, 0, 0, 0, 18715,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20432, 20435, 28963, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12008, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 126, 196, 344, 246, 34, 152, 166, 333, 311, 257, 266, 275, 377, 24, 75,
+        9, 232, 222, 211, 356, 65, 284, 366, 321, 47, 110, 182, 92, 294, 141, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 17699, 17582, 17632, 17599, 17616, 17487, 17503, 17744, 17759, 17868, 17883, 17450, 17466, 17534, 17549,
+        0, 17682, 17649, 17666, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        17569, 17727, 17708, 17801, 17779, 17821, 17844, 17977, 17997, 17928, 17952, 17903, 17388, 17409, 17431, 17367,
+        17290, 17315, 17343, 17272, 17357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        10813, 10509, 10709, 11015, 10898, 10655, 10456, 10750, 10494, 10765, 10685, 10696, 10924, 10888, 11040, 10964,
+        10593, 10835, 10845, 11003, 10440, 10470, 10782, 10624, 10607, 10536, 10639, 10520, 10573, 10869, 10557, 10725,
+        584, 599, 22260, 23692, 3565, 23754, 19700, 19677, 21250, 21266, 3310, 0, 0, 0, 0, 0,
+        10426, 10433, 10799, 10806, 10855, 10862, 10910, 10917, 11026, 11033, 10986, 10666, 10824, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        8595, 8598, 8601, 8444, 8448, 8452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12454, 21998, 19946, 0, 19079, 24300, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21916, 21929, 21943, 21761, 21954, 21969, 21774, 21791, 21589, 21509, 21525, 21541, 21557, 21573, 21699, 21609,
+        21627, 21645, 21663, 21681, 21879, 21809, 21823, 21837, 21851, 21897, 21490, 21721, 21741, 21865, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 3363, 24216, 19352, 8634, 0, 22284, 0, 0,
+        0, 0, 0, 21399, 22617, 24197, 0, 0, 0, 0, 0, 11975, 0, 0, 0, 0,
+        19729, 18663, 19720, 16532, 22480, 16553, 18688, 16562, 29079, 15966, 29087, 25670, 19616, 18269, 18480, 11697,
+        11708, 14310, 15698, 14429, 14460, 15046, 15543, 8655, 15058, 14363, 15338, 15321, 22930, 19739, 22018, 15592,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        16580, 19162, 26302, 22291, 11245, 22042, 19941, 11854, 3405, 0, 0, 0, 0, 0, 0, 0,
+        22645, 22036, 12035, 17202, 0, 26275, 22244, 19623, 12449, 8490, 16520, 8378, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19665, 20087,
+        18992, 0, 0, 0, 0, 0, 0, 0, 0, 19013, 0, 0, 0, 18849, 0, 0,
+        0, 18867, 18873, 18879, 18885, 18891, 18909, 19020, 18970, 18834, 18961, 18929, 18842, 18794, 18899, 18814,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18917, 18776, 18979, 19001, 18803, 18824,
+        18726, 18731, 18736, 18741, 18746, 18751, 18756, 18761, 18766, 18771, 0, 0, 0, 18858, 12077, 12120,
+        12163, 12190, 12193, 12196, 12199, 12202, 12205, 12080, 12084, 12088, 12092, 12096, 12100, 12104, 12108, 12112,
+        12116, 12123, 12127, 12131, 12135, 12139, 12143, 12147, 12151, 12155, 12159, 12166, 12170, 12174, 12178, 12182,
+        12186, 22864, 22883, 8698, 8708, 8497, 22872, 19628, 19635, 881, 887, 24181, 24189, 16964, 16972, 0,
+        0, 3643, 3672, 3686, 3700, 3714, 3728, 3742, 3756, 3770, 3657, 0, 0, 0, 0, 11078,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26449,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17035, 17042, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 26481, 26493, 28928, 28940, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22567,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20136,
+        20471, 20477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25915,
+        25921, 0, 0, 0, 0, 29130, 29138, 12065, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 20172, 20179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 12621, 12628, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 22573, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 20144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 12069, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 9237, 9254, 0, 0, 10275, 10298, 0, 0, 9529, 9551, 9573, 9596, 0, 0,
+        0, 0, 9119, 9141, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10037, 10057,
+        10077, 10101, 9295, 9317, 0, 0, 8855, 8878, 8901, 8925, 9833, 9847, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 9747, 9762, 0, 0, 0, 0, 0, 0,
+        0, 0, 9397, 9415, 0, 0, 0, 0, 9693, 9708, 0, 0, 0, 0, 10001, 10019,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2125, 2151, 2375, 2216, 3165, 3211, 2266, 2101, 2965, 3235, 2465, 2612, 2565, 2989, 2539,
+        2425, 2240, 2347, 2937, 2640, 2401, 2666, 2895, 3113, 2190, 2728, 2491, 2798, 2846, 3087, 3041,
+        2822, 3015, 3137, 2752, 2515, 2690, 2304, 0, 0, 0, 2081, 2049, 2288, 2870, 2780, 0,
+        0, 2138, 2164, 2388, 2228, 3179, 3223, 2277, 2113, 2977, 3248, 2478, 2626, 2578, 3002, 2552,
+        2437, 2253, 2361, 2951, 2653, 2413, 2678, 2908, 3125, 2203, 2740, 2503, 2810, 2858, 3100, 3055,
+        2834, 3028, 3151, 2766, 2527, 2701, 2316, 2591, 0, 2328, 2449, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1581, 1317, 1336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        967, 976, 985, 994, 1003, 1012, 1021, 1030, 1039, 1048, 1673, 0, 0, 0, 0, 0,
+        1822, 0, 0, 0, 0, 0, 0, 0, 0, 1952, 0, 0, 0, 0, 1662, 0,
+        0, 0, 0, 0, 0, 0, 1886, 0, 1174, 0, 0, 0, 0, 0, 0, 0,
+        0, 1730, 0, 0, 0, 0, 0, 0, 1494, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1964, 0, 0, 0, 0, 1545, 0, 0, 0, 0, 0, 1259,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1643, 0, 0, 0, 1443, 0,
+        0, 1466, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12308, 0, 0, 0,
+        0, 0, 1997, 0, 1243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12228, 12236, 12244, 12252, 12260, 12268, 12276, 12284, 12292, 12300, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 23402, 23196, 0, 22965, 22972, 22989, 23006, 23212, 23227, 23613, 23628, 23512, 23520, 23321,
+        23338, 23139, 23154, 23025, 23455, 23470, 23050, 0, 0, 0, 23271, 23279, 23179, 23187, 23410, 23419,
+        23084, 23092, 23244, 23252, 23446, 23261, 23428, 23594, 23603, 23101, 23110, 23437, 23382, 23575, 23584, 23120,
+        23129, 23374, 0, 23392, 23487, 23495, 23067, 23075, 23357, 23365, 23653, 23504, 0, 23304, 0, 0,
+        23645, 23556, 23565, 23548, 23204, 23312, 23171, 0, 0, 0, 23042, 0, 0, 0, 0, 22980,
+        22997, 23015, 23219, 23235, 23620, 0, 23636, 0, 23529, 23146, 23162, 23033, 23462, 23478, 23058, 23329,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 23538, 23347, 23288, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        12677, 12689, 12793, 12756, 12769, 13119, 13157, 13081, 12884, 12923, 12950, 12963, 12976, 12989, 13001, 13170,
+        13041, 13054, 13094, 13107, 13014, 12936, 12806, 13028, 13067, 12729, 12702, 12910, 12743, 12715, 13144, 12896,
+        12820, 12846, 12858, 13132, 12833, 12871, 12781, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 3333, 3343, 0, 0, 0, 0, 0, 0, 10325, 10335, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12208, 12218,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 19110, 19120, 0, 0, 0, 0, 0, 0, 0, 0,
+        19455, 19465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21295, 21305, 0, 0, 0, 0, 0, 0, 0, 0,
+        22501, 22511, 0, 0, 0, 0, 0, 0, 0, 0, 24220, 24230, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        26527, 26534, 26467, 26474, 26505, 26516, 0, 0, 0, 0, 26553, 26563, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        417, 427, 869, 875, 647, 664, 721, 738, 755, 771, 787, 804, 681, 701, 460, 472,
+        514, 526, 538, 549, 560, 572, 484, 499, 11380, 11390, 11656, 11662, 11994, 12001, 11438, 11455,
+        11512, 11529, 11546, 11562, 11578, 11595, 11472, 11492, 17137, 17143, 17015, 17025, 20152, 20162, 20459, 20465,
+        20210, 20227, 20284, 20301, 20318, 20334, 20350, 20367, 20244, 20264, 20483, 20494, 20533, 20544, 20555, 20565,
+        20575, 20586, 20505, 20519, 25783, 25793, 25903, 25909, 25927, 25938, 25977, 25988, 25999, 26009, 26019, 26030,
+        25949, 25963, 28978, 28985, 28908, 28918, 28992, 28998, 29004, 29011, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        29117, 0, 0, 0, 12550, 12512, 23674, 22850, 11683, 19980, 0, 0, 0, 0, 0, 0,
+        29103, 20660, 25730, 25474, 12536, 12498, 23661, 22835, 11668, 19966, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        11612, 8671, 8745, 12334, 19366, 19642, 19885, 21444, 22487, 26541, 19927, 11176, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 21364, 0, 0, 11837, 0, 0, 11720, 20030, 0, 8687, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23727, 8758, 12563, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11150, 25503, 0, 0,
+        0, 0, 0, 0, 0, 3397, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 20018, 946, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 20052, 23772, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        3629, 3784, 6152, 3799, 7304, 5015, 6167, 3815, 7864, 5607, 6759, 4439, 7319, 5031, 6183, 3832,
+        8136, 5895, 7047, 4743, 7607, 5335, 6487, 4152, 7879, 5623, 6775, 4456, 7335, 5048, 6200, 3850,
+        8268, 6035, 7187, 4891, 7747, 5483, 6635, 4308, 8019, 5771, 6923, 4612, 7483, 5204, 6356, 4014,
+        8151, 5911, 7063, 4760, 7623, 5352, 6504, 4170, 7895, 5640, 6792, 4474, 7352, 5066, 6218, 3869,
+        8332, 6103, 7255, 4963, 7815, 5555, 6707, 4384, 8087, 5843, 6995, 4688, 7555, 5280, 6432, 4094,
+        8219, 5983, 7135, 4836, 7695, 5428, 6580, 4250, 7967, 5716, 6868, 4554, 7428, 5146, 6298, 3953,
+        8283, 6051, 7203, 4908, 7763, 5500, 6652, 4326, 8035, 5788, 6940, 4630, 7500, 5222, 6374, 4033,
+        8167, 5928, 7080, 4778, 7640, 5370, 6522, 4189, 7912, 5658, 6810, 4493, 7370, 5085, 6237, 3889,
+        8363, 6136, 7288, 4998, 7848, 5590, 6742, 4421, 8120, 5878, 7030, 4725, 7590, 5317, 6469, 4133,
+        8252, 6018, 7170, 4873, 7730, 5465, 6617, 4289, 8002, 5753, 6905, 4593, 7465, 5185, 6337, 3994,
+        8316, 6086, 7238, 4945, 7798, 5537, 6689, 4365, 8070, 5825, 6977, 4669, 7537, 5261, 6413, 4074,
+        8202, 5965, 7117, 4817, 7677, 5409, 6561, 4230, 7949, 5697, 6849, 4534, 7409, 5126, 6278, 3932,
+        8347, 6119, 7271, 4980, 7831, 5572, 6724, 4402, 8103, 5860, 7012, 4706, 7572, 5298, 6450, 4113,
+        8235, 6000, 7152, 4854, 7712, 5446, 6598, 4269, 7984, 5734, 6886, 4573, 7446, 5165, 6317, 3973,
+        8299, 6068, 7220, 4926, 7780, 5518, 6670, 4345, 8052, 5806, 6958, 4649, 7518, 5241, 6393, 4053,
+        8184, 5946, 7098, 4797, 7658, 5389, 6541, 4209, 7930, 5677, 6829, 4513, 7389, 5105, 6257, 3910,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 16828, 16895, 16841, 16878, 16860, 0, 0, 16785,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16731, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16932, 0,
+        0, 0, 0, 0, 0, 0, 16792, 0, 0, 0, 0, 0, 16685, 0, 0, 0,
+    },
+    {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 10415, 0, 0, 0, 0, 10345, 0, 0, 0, 0, 10380, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10396, 0,
+        11107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11335, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        11306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        11298, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 16804, 16816, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16908, 16916, 16925, 16693,
+        16754, 16718, 16741, 16705, 16675, 16772, 12043, 12054, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 0, 20874, 20882, 21081, 0, 0, 20818, 20805, 0, 0, 20865, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20944, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 20794, 21115, 21131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21046, 21071, 21034, 21058, 20782, 20998, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 20982, 21208, 21168, 20914, 0, 0, 20933, 20842, 20922, 20829, 21103, 21022, 21090, 21009, 0,
+        21177, 0, 0, 20972, 0, 21200, 0, 20990, 0, 20855, 20964, 0, 0, 0, 0, 0,
+        0, 21187, 20899, 21145, 20954, 0, 0, 0, 21157, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20889,
+    },
+    {
+        23950, 23921, 23962, 23895, 23934, 23907, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        23881, 23888, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        24098, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        24081, 23982, 23866, 23991, 24021, 23874, 24030, 23802, 23822, 23835, 24117, 24133, 24157, 24045, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 28369, 28436, 28452, 28468, 28484, 28500, 28516, 28532, 28548, 28385, 28402, 28419, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28695, 27053, 27880, 28002, 27660, 27633, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
+    {
+        0, 27771, 27806, 27784, 27409, 27389, 27367, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28301, 26667, 26720, 26791, 26763, 26880, 26777, 26734, 27330, 27678, 28313, 28225, 26832, 27008, 27726, 28599,
+        27023, 27975, 27091, 28095, 28064, 28079, 26903, 27235, 28323, 28031, 27989, 28783, 27176, 28165, 28839, 28265,
+        27209, 26748, 26688, 27836, 28749, 27619, 28256, 27318, 27919, 26573, 27343, 26972, 27223, 27077, 26864, 26912,
+        27427, 27439, 27451, 27463, 27475, 27487, 27499, 27511, 27523, 27535, 27547, 27559, 27571, 27583, 27595, 27607,
+        26589, 26609, 26963, 27036, 26993, 27043, 27067, 27110, 27119, 27142, 27168, 27154, 27186, 27196, 27278, 27287,
+        27356, 27649, 27703, 27714, 0, 27735, 27746, 27851, 27863, 27871, 27895, 27910, 27931, 27942, 27952, 0,
+        28017, 0, 28054, 28043, 28108, 28141, 28126, 28156, 28212, 28197, 28181, 28247, 28275, 28285, 28345, 28564,
+        28577, 28612, 28684, 0, 28730, 28706, 28718, 28764, 28805, 28830, 28847, 28867, 28878, 26894, 27757, 28794,
+        27687, 27962, 27826, 26928, 26949, 28821, 28741, 26650, 26848, 26812, 28332, 26630, 27127, 27247, 27261, 28590,
+        28236, 28774, 28622, 28023, 27294, 28856, 26940, 28357, 27304, 28665, 0, 0, 0, 0, 0, 0,
+        28650, 28634, 26703, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    },
 };
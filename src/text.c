@@ -25,17 +25,25 @@
  ********************************************************/
 
 #include "keymap.h"
+#include "keysym.h"
 #include "text.h"
 
 bool
 LookupString(const LookupEntry tab[], const char *string,
               unsigned int *value_rtrn)
 {
+    char first;
+
     if (!string)
         return false;
 
+    /*
+     * Most entries differ from the string in the first character already,
+     * so check it before doing the full comparison.
+     */
+    first = to_lower(string[0]);
     for (const LookupEntry *entry = tab; entry->name; entry++) {
-        if (istreq(entry->name, string)) {
+        if (to_lower(entry->name[0]) == first && istreq(entry->name, string)) {
             *value_rtrn = entry->value;
             return true;
         }
@@ -204,6 +212,22 @@ const LookupEntry symInterpretMatchMaskNames[] = {
     { "AnyOf", MATCH_ANY },
     { "AllOf", MATCH_ALL },
     { "Exactly", MATCH_EXACTLY },
+    { NULL, 0 }
+};
+
+const LookupEntry lockWhichNames[] = {
+    { "both", 0 },
+    { "lock", ACTION_LOCK_NO_UNLOCK },
+    { "neither", (ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK) },
+    { "unlock", ACTION_LOCK_NO_LOCK },
+    { NULL, 0 }
+};
+
+const LookupEntry ptrDfltNames[] = {
+    { "dfltbtn", 1 },
+    { "defaultbutton", 1 },
+    { "button", 1 },
+    { NULL, 0 }
 };
 
 const char *
@@ -242,7 +266,13 @@ ActionTypeText(enum xkb_action_type type)
 const char *
 KeysymText(struct xkb_context *ctx, xkb_keysym_t sym)
 {
-    char *buffer = xkb_context_get_buffer(ctx, 64);
+    const char *name = xkb_keysym_name(sym);
+    char *buffer;
+
+    if (name)
+        return name;
+
+    buffer = xkb_context_get_buffer(ctx, 64);
     xkb_keysym_get_name(sym, buffer, 64);
     return buffer;
 }
@@ -46,6 +46,8 @@ extern const LookupEntry buttonNames[];
 extern const LookupEntry useModMapValueNames[];
 extern const LookupEntry actionTypeNames[];
 extern const LookupEntry symInterpretMatchMaskNames[];
+extern const LookupEntry lockWhichNames[];
+extern const LookupEntry ptrDfltNames[];
 
 const char *
 ModMaskText(const struct xkb_keymap *keymap, xkb_mod_mask_t mask);
@@ -21,6 +21,8 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include <time.h>
+
 #include "utils.h"
 
 #ifdef HAVE_MMAP
@@ -105,3 +107,14 @@ unmap_file(const char *str, size_t size)
 }
 
 #endif
+
+uint64_t
+time_now_ns(void)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 0;
+
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
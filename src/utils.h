@@ -54,12 +54,28 @@ streq_not_null(const char *s1, const char *s2)
     return streq(s1, s2);
 }
 
+/* Like streq(), but two NULLs are also equal. */
+static inline bool
+streq_null(const char *s1, const char *s2)
+{
+    if (!s1 || !s2)
+        return s1 == s2;
+    return streq(s1, s2);
+}
+
 static inline bool
 istreq(const char *s1, const char *s2)
 {
     return strcasecmp(s1, s2) == 0;
 }
 
+/* ASCII-only, unlike tolower(3), which depends on the locale. */
+static inline char
+to_lower(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? c - 'A' + 'a' : c;
+}
+
 static inline bool
 istreq_prefix(const char *s1, const char *s2)
 {
@@ -123,6 +139,10 @@ map_file(FILE *file, const char **string_out, size_t *size_out);
 void
 unmap_file(const char *str, size_t size);
 
+/* A monotonic timestamp, in nanoseconds. */
+uint64_t
+time_now_ns(void);
+
 #define ARRAY_SIZE(arr) ((sizeof(arr) / sizeof(*(arr))))
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
@@ -508,14 +508,6 @@ HandleMovePtr(struct xkb_keymap *keymap, union xkb_action *action,
     return ReportIllegal(keymap, action->type, field);
 }
 
-static const LookupEntry lockWhich[] = {
-    { "both", 0 },
-    { "lock", ACTION_LOCK_NO_UNLOCK },
-    { "neither", (ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK) },
-    { "unlock", ACTION_LOCK_NO_LOCK },
-    { NULL, 0 }
-};
-
 static bool
 HandlePtrBtn(struct xkb_keymap *keymap, union xkb_action *action,
              enum action_field field, const ExprDef *array_ndx,
@@ -550,7 +542,7 @@ HandlePtrBtn(struct xkb_keymap *keymap, union xkb_action *action,
         if (array_ndx)
             return ReportActionNotArray(keymap, action->type, field);
 
-        if (!ExprResolveEnum(keymap->ctx, value, &val, lockWhich))
+        if (!ExprResolveEnum(keymap->ctx, value, &val, lockWhichNames))
             return ReportMismatch(keymap, action->type, field,
                                   "lock or unlock");
 
@@ -581,13 +573,6 @@ HandlePtrBtn(struct xkb_keymap *keymap, union xkb_action *action,
     return ReportIllegal(keymap, action->type, field);
 }
 
-static const LookupEntry ptrDflts[] = {
-    { "dfltbtn", 1 },
-    { "defaultbutton", 1 },
-    { "button", 1 },
-    { NULL, 0 }
-};
-
 static bool
 HandleSetPtrDflt(struct xkb_keymap *keymap, union xkb_action *action,
                  enum action_field field, const ExprDef *array_ndx,
@@ -601,7 +586,7 @@ HandleSetPtrDflt(struct xkb_keymap *keymap, union xkb_action *action,
         if (array_ndx)
             return ReportActionNotArray(keymap, action->type, field);
 
-        if (!ExprResolveEnum(keymap->ctx, value, &val, ptrDflts))
+        if (!ExprResolveEnum(keymap->ctx, value, &val, ptrDfltNames))
             return ReportMismatch(keymap, action->type, field,
                                   "pointer component");
         return true;
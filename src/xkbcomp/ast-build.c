@@ -704,6 +704,114 @@ FreeXkbFile(XkbFile *file)
     }
 }
 
+static unsigned int
+CountStmts(ParseCommon *stmt);
+
+static unsigned int
+CountExpr(ExprDef *expr)
+{
+    switch (expr->op) {
+    case EXPR_ACTION_LIST:
+    case EXPR_NEGATE:
+    case EXPR_UNARY_PLUS:
+    case EXPR_NOT:
+    case EXPR_INVERT:
+        return CountStmts(&expr->value.child->common);
+
+    case EXPR_DIVIDE:
+    case EXPR_ADD:
+    case EXPR_SUBTRACT:
+    case EXPR_MULTIPLY:
+    case EXPR_ASSIGN:
+        return CountStmts(&expr->value.binary.left->common) +
+               CountStmts(&expr->value.binary.right->common);
+
+    case EXPR_ACTION_DECL:
+        return CountStmts(&expr->value.action.args->common);
+
+    case EXPR_ARRAY_REF:
+        return CountStmts(&expr->value.array.entry->common);
+
+    default:
+        return 0;
+    }
+}
+
+/* Walks the statements like FreeStmt(), counting the nodes. */
+static unsigned int
+CountStmts(ParseCommon *stmt)
+{
+    unsigned int count = 0;
+    IncludeStmt *incl;
+    YYSTYPE u;
+
+    for (; stmt; stmt = stmt->next) {
+        u.any = stmt;
+        count++;
+
+        switch (stmt->type) {
+        case STMT_INCLUDE:
+            incl = ((IncludeStmt *) stmt)->next_incl;
+            for (; incl; incl = incl->next_incl)
+                count++;
+            break;
+        case STMT_EXPR:
+            count += CountExpr(u.expr);
+            break;
+        case STMT_VAR:
+            count += CountStmts(&u.var->name->common);
+            count += CountStmts(&u.var->value->common);
+            break;
+        case STMT_TYPE:
+            count += CountStmts(&u.keyType->body->common);
+            break;
+        case STMT_INTERP:
+            count += CountStmts(&u.interp->match->common);
+            count += CountStmts(&u.interp->def->common);
+            break;
+        case STMT_VMOD:
+            count += CountStmts(&u.vmod->value->common);
+            break;
+        case STMT_SYMBOLS:
+            count += CountStmts(&u.syms->symbols->common);
+            break;
+        case STMT_MODMAP:
+            count += CountStmts(&u.modMask->keys->common);
+            break;
+        case STMT_GROUP_COMPAT:
+            count += CountStmts(&u.groupCompat->def->common);
+            break;
+        case STMT_LED_MAP:
+            count += CountStmts(&u.ledMap->body->common);
+            break;
+        case STMT_LED_NAME:
+            count += CountStmts(&u.ledName->name->common);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return count;
+}
+
+unsigned int
+XkbFileCountNodes(XkbFile *file)
+{
+    unsigned int count = 0;
+
+    for (; file; file = (XkbFile *) file->common.next) {
+        count++;
+
+        if (file->file_type == FILE_TYPE_KEYMAP)
+            count += XkbFileCountNodes((XkbFile *) file->defs);
+        else
+            count += CountStmts(file->defs);
+    }
+
+    return count;
+}
+
 static const char *xkb_file_type_strings[_FILE_TYPE_NUM_ENTRIES] = {
     [FILE_TYPE_KEYCODES] = "xkb_keycodes",
     [FILE_TYPE_TYPES] = "xkb_types",
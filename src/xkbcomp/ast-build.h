@@ -101,4 +101,7 @@ XkbFileCreate(struct xkb_context *ctx, enum xkb_file_type type, char *name,
 void
 FreeStmt(ParseCommon *stmt);
 
+unsigned int
+XkbFileCountNodes(XkbFile *file);
+
 #endif
@@ -53,6 +53,7 @@
 #include "action.h"
 #include "vmod.h"
 #include "include.h"
+#include "hashmap.h"
 
 /*
  * The xkb_compat section
@@ -259,6 +260,12 @@ typedef struct {
     int errorCount;
     SymInterpInfo default_interp;
     darray(SymInterpInfo) interps;
+    /*
+     * Keysym -> index of the last interp for it in interps. The earlier
+     * interps for the same keysym are chained through interps_prev.
+     */
+    struct hashmap interps_by_sym;
+    darray(uint32_t) interps_prev;
     LedInfo default_led;
     darray(LedInfo) leds;
     ActionsInfo *actions;
@@ -322,6 +329,7 @@ InitCompatInfo(CompatInfo *info, struct xkb_keymap *keymap,
     info->default_interp.merge = MERGE_OVERRIDE;
     info->default_interp.interp.virtual_mod = XKB_MOD_INVALID;
     info->default_led.merge = MERGE_OVERRIDE;
+    hashmap_init(&info->interps_by_sym);
 }
 
 static void
@@ -329,19 +337,28 @@ ClearCompatInfo(CompatInfo *info)
 {
     free(info->name);
     darray_free(info->interps);
+    hashmap_free(&info->interps_by_sym);
+    darray_free(info->interps_prev);
     darray_free(info->leds);
 }
 
+#define NO_INTERP UINT32_MAX
+
 static SymInterpInfo *
 FindMatchingInterp(CompatInfo *info, SymInterpInfo *new)
 {
     SymInterpInfo *old;
+    uint32_t i;
+
+    if (!hashmap_lookup(&info->interps_by_sym, new->interp.sym, &i))
+        return NULL;
 
-    darray_foreach(old, info->interps)
-        if (old->interp.sym == new->interp.sym &&
-            old->interp.mods == new->interp.mods &&
+    for (; i != NO_INTERP; i = darray_item(info->interps_prev, i)) {
+        old = &darray_item(info->interps, i);
+        if (old->interp.mods == new->interp.mods &&
             old->interp.match == new->interp.match)
             return old;
+    }
 
     return NULL;
 }
@@ -367,6 +384,7 @@ UseNewInterpField(enum si_field field, SymInterpInfo *old, SymInterpInfo *new,
 static bool
 AddInterp(CompatInfo *info, SymInterpInfo *new, bool same_file)
 {
+    uint32_t prev;
     SymInterpInfo *old = FindMatchingInterp(info, new);
     if (old) {
         const int verbosity = xkb_context_get_log_verbosity(info->keymap->ctx);
@@ -415,6 +433,14 @@ AddInterp(CompatInfo *info, SymInterpInfo *new, bool same_file)
         return true;
     }
 
+    if (!hashmap_lookup(&info->interps_by_sym, new->interp.sym, &prev))
+        prev = NO_INTERP;
+
+    if (!hashmap_insert(&info->interps_by_sym, new->interp.sym,
+                        darray_size(info->interps)))
+        return false;
+
+    darray_append(info->interps_prev, prev);
     darray_append(info->interps, *new);
     return true;
 }
@@ -50,6 +50,9 @@
 #include <errno.h>
 #include <limits.h>
 #include <stdio.h>
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
 
 #include "xkbcomp-priv.h"
 #include "include.h"
@@ -202,6 +205,7 @@ FindFileInXkbPath(struct xkb_context *ctx, const char *name,
     char *buf = NULL;
     const char *typeDir;
     size_t buf_size = 0, typeDirLen, name_len;
+    uint64_t start = xkb_context_stat_timer_start(ctx);
 
     typeDir = DirectoryForInclude(type);
     typeDirLen = strlen(typeDir);
@@ -260,9 +264,13 @@ FindFileInXkbPath(struct xkb_context *ctx, const char *name,
         }
 
         free(buf);
+        xkb_context_stat_timer_stop(ctx, XKB_COMPILE_STAT_TIME_INCLUDES, start);
         return NULL;
     }
 
+    xkb_context_stat_add(ctx, XKB_COMPILE_STAT_FILES_OPENED, 1);
+    xkb_context_stat_timer_stop(ctx, XKB_COMPILE_STAT_TIME_INCLUDES, start);
+
     if (pathRtrn)
         *pathRtrn = buf;
     else
@@ -270,19 +278,341 @@ FindFileInXkbPath(struct xkb_context *ctx, const char *name,
     return file;
 }
 
-XkbFile *
-ProcessIncludeFile(struct xkb_context *ctx, IncludeStmt *stmt,
-                   enum xkb_file_type file_type)
+/*
+ * Find and parse an included file.  If the file is not found, sets *found
+ * to false and returns NULL.
+ */
+static XkbFile *
+ParseIncludeFile(struct xkb_context *ctx, const char *name, const char *map,
+                 enum xkb_file_type file_type, bool *found)
 {
     FILE *file;
     XkbFile *xkb_file;
 
-    file = FindFileInXkbPath(ctx, stmt->file, file_type, NULL);
+    file = FindFileInXkbPath(ctx, name, file_type, NULL);
+    *found = (file != NULL);
     if (!file)
-        return false;
+        return NULL;
 
-    xkb_file = XkbParseFile(ctx, file, stmt->file, stmt->map);
+    xkb_file = XkbParseFile(ctx, file, name, map);
     fclose(file);
+    return xkb_file;
+}
+
+#ifdef HAVE_PTHREAD
+
+/*
+ * Most of the time spent compiling a keymap goes into parsing the files
+ * it includes, which does not depend on the compilation itself.  So in a
+ * parallel compilation, worker threads walk the include statements of
+ * the keymap sections, parsing each included file and then the files it
+ * includes, while the sections are compiled in order; ProcessIncludeFile()
+ * takes the parsed files from here, waiting for them if need be.
+ *
+ * The workers parse in worker contexts, and their log messages are kept
+ * with each file and only passed on when the file is taken, so that the
+ * log is the same as that of a sequential compilation.
+ */
+
+#define PREFETCH_MAX_WORKERS 4
+
+enum prefetch_state {
+    PREFETCH_QUEUED,
+    PREFETCH_PARSING,
+    PREFETCH_DONE,
+    PREFETCH_TAKEN,
+};
+
+struct prefetch_entry {
+    enum prefetch_state state;
+    enum xkb_file_type file_type;
+    char *name;
+    char *map;
+    bool found;
+    XkbFile *xkb_file;
+    darray_log_message log;
+};
+
+struct prefetch_worker {
+    struct include_prefetch *prefetch;
+    struct xkb_context *ctx;
+    pthread_t thread;
+    uint64_t stats[_XKB_COMPILE_STAT_NUM_ENTRIES];
+};
+
+struct include_prefetch {
+    struct xkb_context *ctx;
+
+    /* Protects everything below, and the entries. */
+    pthread_mutex_t mutex;
+    /* Signalled when an entry is queued or done. */
+    pthread_cond_t cond;
+
+    /* Entries are only added, in the order they are queued. */
+    darray(struct prefetch_entry *) entries;
+    /* The first entry still queued. */
+    unsigned int next;
+    unsigned int num_parsing;
+    bool stop;
+
+    struct prefetch_worker workers[PREFETCH_MAX_WORKERS];
+    unsigned int num_workers;
+};
+
+static void
+prefetch_queue_includes(struct include_prefetch *prefetch, XkbFile *file)
+{
+    for (ParseCommon *stmt = file->defs; stmt; stmt = stmt->next) {
+        if (stmt->type != STMT_INCLUDE)
+            continue;
+
+        for (IncludeStmt *incl = (IncludeStmt *) stmt; incl;
+             incl = incl->next_incl) {
+            struct prefetch_entry *entry = calloc(1, sizeof(*entry));
+
+            if (!entry)
+                return;
+
+            entry->state = PREFETCH_QUEUED;
+            entry->file_type = file->file_type;
+            entry->name = strdup_safe(incl->file);
+            entry->map = strdup_safe(incl->map);
+            darray_append(prefetch->entries, entry);
+        }
+    }
+}
+
+static void
+prefetch_entry_free(struct prefetch_entry *entry)
+{
+    xkb_log_list_free(&entry->log);
+    FreeXkbFile(entry->xkb_file);
+    free(entry->name);
+    free(entry->map);
+    free(entry);
+}
+
+static void *
+prefetch_worker_run(void *data)
+{
+    struct prefetch_worker *worker = data;
+    struct include_prefetch *prefetch = worker->prefetch;
+    struct prefetch_entry *entry;
+    XkbFile *xkb_file;
+    bool found;
+
+    pthread_mutex_lock(&prefetch->mutex);
+    for (;;) {
+        /* Files still being parsed may include more files. */
+        while (!prefetch->stop &&
+               prefetch->next >= darray_size(prefetch->entries) &&
+               prefetch->num_parsing > 0)
+            pthread_cond_wait(&prefetch->cond, &prefetch->mutex);
+
+        if (prefetch->stop || prefetch->next >= darray_size(prefetch->entries))
+            break;
+
+        entry = darray_item(prefetch->entries, prefetch->next++);
+        entry->state = PREFETCH_PARSING;
+        prefetch->num_parsing++;
+        pthread_mutex_unlock(&prefetch->mutex);
+
+        xkb_context_set_log_list(worker->ctx, &entry->log);
+        xkb_file = ParseIncludeFile(worker->ctx, entry->name, entry->map,
+                                    entry->file_type, &found);
+        xkb_context_set_log_list(worker->ctx, NULL);
+
+        pthread_mutex_lock(&prefetch->mutex);
+        entry->found = found;
+        entry->xkb_file = xkb_file;
+        entry->state = PREFETCH_DONE;
+        prefetch->num_parsing--;
+        if (xkb_file && xkb_file->file_type == entry->file_type)
+            prefetch_queue_includes(prefetch, xkb_file);
+        pthread_cond_broadcast(&prefetch->cond);
+    }
+    pthread_mutex_unlock(&prefetch->mutex);
+
+    return NULL;
+}
+
+struct include_prefetch *
+include_prefetch_start(struct xkb_context *ctx, XkbFile **files,
+                       unsigned int num_files)
+{
+    struct include_prefetch *prefetch;
+    struct prefetch_worker *worker;
+    unsigned int num_cpus = xkb_context_get_num_cpus(ctx);
+
+    /* The compilation itself keeps one CPU busy. */
+    if (num_cpus < 2)
+        return NULL;
+
+    prefetch = calloc(1, sizeof(*prefetch));
+    if (!prefetch)
+        return NULL;
+
+    if (!xkb_context_set_shared(ctx, true)) {
+        free(prefetch);
+        return NULL;
+    }
+
+    prefetch->ctx = ctx;
+    pthread_mutex_init(&prefetch->mutex, NULL);
+    pthread_cond_init(&prefetch->cond, NULL);
+
+    for (unsigned int i = 0; i < num_files; i++)
+        if (files[i])
+            prefetch_queue_includes(prefetch, files[i]);
+
+    while (prefetch->num_workers < MIN(num_cpus - 1, PREFETCH_MAX_WORKERS)) {
+        worker = &prefetch->workers[prefetch->num_workers];
+        worker->prefetch = prefetch;
+        worker->ctx = xkb_context_new_worker(ctx);
+        if (!worker->ctx)
+            break;
+
+        if (xkb_context_collects_stats(ctx))
+            xkb_context_set_compile_stats(worker->ctx, worker->stats);
+
+        if (pthread_create(&worker->thread, NULL, prefetch_worker_run,
+                           worker) != 0) {
+            xkb_context_free_worker(worker->ctx);
+            break;
+        }
+
+        prefetch->num_workers++;
+    }
+
+    if (prefetch->num_workers == 0) {
+        include_prefetch_finish(prefetch);
+        return NULL;
+    }
+
+    xkb_context_set_include_prefetch(ctx, prefetch);
+    return prefetch;
+}
+
+void
+include_prefetch_finish(struct include_prefetch *prefetch)
+{
+    struct xkb_context *ctx;
+    struct prefetch_entry **entry;
+
+    if (!prefetch)
+        return;
+
+    ctx = prefetch->ctx;
+
+    pthread_mutex_lock(&prefetch->mutex);
+    prefetch->stop = true;
+    pthread_cond_broadcast(&prefetch->cond);
+    pthread_mutex_unlock(&prefetch->mutex);
+
+    for (unsigned int i = 0; i < prefetch->num_workers; i++) {
+        struct prefetch_worker *worker = &prefetch->workers[i];
+
+        pthread_join(worker->thread, NULL);
+        for (int stat = 0; stat < _XKB_COMPILE_STAT_NUM_ENTRIES; stat++)
+            xkb_context_stat_add(ctx, stat, worker->stats[stat]);
+        xkb_context_free_worker(worker->ctx);
+    }
+
+    xkb_context_set_include_prefetch(ctx, NULL);
+    xkb_context_set_shared(ctx, false);
+
+    darray_foreach(entry, prefetch->entries)
+        prefetch_entry_free(*entry);
+    darray_free(prefetch->entries);
+    pthread_cond_destroy(&prefetch->cond);
+    pthread_mutex_destroy(&prefetch->mutex);
+    free(prefetch);
+}
+
+/*
+ * Take the file parsed for an include statement, if it was queued.  Its
+ * log messages are passed on now.
+ */
+static bool
+include_prefetch_take(struct include_prefetch *prefetch, IncludeStmt *stmt,
+                      enum xkb_file_type file_type, XkbFile **xkb_file_out,
+                      bool *found_out)
+{
+    struct prefetch_entry **entryp, *entry;
+
+    pthread_mutex_lock(&prefetch->mutex);
+    for (;;) {
+        entry = NULL;
+        darray_foreach(entryp, prefetch->entries) {
+            if ((*entryp)->state != PREFETCH_TAKEN &&
+                (*entryp)->file_type == file_type &&
+                streq_null((*entryp)->name, stmt->file) &&
+                streq_null((*entryp)->map, stmt->map)) {
+                entry = *entryp;
+                break;
+            }
+        }
+
+        if (!entry || entry->state == PREFETCH_DONE)
+            break;
+
+        pthread_cond_wait(&prefetch->cond, &prefetch->mutex);
+    }
+    if (entry)
+        entry->state = PREFETCH_TAKEN;
+    pthread_mutex_unlock(&prefetch->mutex);
+
+    if (!entry)
+        return false;
+
+    xkb_context_flush_log(prefetch->ctx, &entry->log);
+
+    *xkb_file_out = entry->xkb_file;
+    *found_out = entry->found;
+    entry->xkb_file = NULL;
+    return true;
+}
+
+#else /* HAVE_PTHREAD */
+
+struct include_prefetch *
+include_prefetch_start(struct xkb_context *ctx, XkbFile **files,
+                       unsigned int num_files)
+{
+    return NULL;
+}
+
+void
+include_prefetch_finish(struct include_prefetch *prefetch)
+{
+}
+
+static bool
+include_prefetch_take(struct include_prefetch *prefetch, IncludeStmt *stmt,
+                      enum xkb_file_type file_type, XkbFile **xkb_file_out,
+                      bool *found_out)
+{
+    return false;
+}
+
+#endif /* HAVE_PTHREAD */
+
+XkbFile *
+ProcessIncludeFile(struct xkb_context *ctx, IncludeStmt *stmt,
+                   enum xkb_file_type file_type)
+{
+    struct include_prefetch *prefetch;
+    XkbFile *xkb_file;
+    bool found;
+
+    prefetch = xkb_context_get_include_prefetch(ctx);
+    if (!prefetch ||
+        !include_prefetch_take(prefetch, stmt, file_type, &xkb_file, &found))
+        xkb_file = ParseIncludeFile(ctx, stmt->file, stmt->map, file_type,
+                                    &found);
+    if (!found)
+        return NULL;
+
     if (!xkb_file) {
         if (stmt->map)
             log_err(ctx, "Couldn't process include statement for '%s(%s)'\n",
@@ -35,6 +35,19 @@ FILE *
 FindFileInXkbPath(struct xkb_context *ctx, const char *name,
                   enum xkb_file_type type, char **pathRtrn);
 
+/*
+ * Start parsing the files included by the keymap sections @files, of which
+ * there are @num_files (some may be NULL), in worker threads.  Until
+ * include_prefetch_finish(), ProcessIncludeFile() takes the parsed files
+ * from there.  Returns NULL if the files can't be parsed in parallel.
+ */
+struct include_prefetch *
+include_prefetch_start(struct xkb_context *ctx, XkbFile **files,
+                       unsigned int num_files);
+
+void
+include_prefetch_finish(struct include_prefetch *prefetch);
+
 XkbFile *
 ProcessIncludeFile(struct xkb_context *ctx, IncludeStmt *stmt,
                    enum xkb_file_type file_type);
@@ -28,6 +28,7 @@
 #include "text.h"
 #include "expr.h"
 #include "include.h"
+#include "hashmap.h"
 
 /*
  * The xkb_keycodes section
@@ -122,6 +123,8 @@ typedef struct {
     xkb_keycode_t min_key_code;
     xkb_keycode_t max_key_code;
     darray(xkb_atom_t) key_names;
+    /* Key name -> keycode, the inverse of key_names. */
+    struct hashmap keycodes_by_name;
     darray(LedNameInfo) led_names;
     darray(AliasInfo) aliases;
 
@@ -222,6 +225,7 @@ ClearKeyNamesInfo(KeyNamesInfo *info)
 {
     free(info->name);
     darray_free(info->key_names);
+    hashmap_free(&info->keycodes_by_name);
     darray_free(info->aliases);
     darray_free(info->led_names);
 }
@@ -232,6 +236,7 @@ InitKeyNamesInfo(KeyNamesInfo *info, struct xkb_context *ctx)
     memset(info, 0, sizeof(*info));
     info->ctx = ctx;
     info->min_key_code = XKB_KEYCODE_INVALID;
+    hashmap_init(&info->keycodes_by_name);
 #if XKB_KEYCODE_INVALID < XKB_KEYCODE_MAX
 #error "Hey, you can't be changing stuff like that."
 #endif
@@ -240,13 +245,12 @@ InitKeyNamesInfo(KeyNamesInfo *info, struct xkb_context *ctx)
 static xkb_keycode_t
 FindKeyByName(KeyNamesInfo *info, xkb_atom_t name)
 {
-    xkb_keycode_t i;
+    uint32_t kc;
 
-    for (i = info->min_key_code; i <= info->max_key_code; i++)
-        if (darray_item(info->key_names, i) == name)
-            return i;
+    if (!hashmap_lookup(&info->keycodes_by_name, name, &kc))
+        return XKB_KEYCODE_INVALID;
 
-    return XKB_KEYCODE_INVALID;
+    return kc;
 }
 
 static bool
@@ -292,6 +296,7 @@ AddKeyName(KeyNamesInfo *info, xkb_keycode_t kc, xkb_atom_t name,
                          "Multiple names for keycode %d; "
                          "Using %s, ignoring %s\n", kc, kname, lname);
             darray_item(info->key_names, kc) = XKB_ATOM_NONE;
+            hashmap_remove(&info->keycodes_by_name, old_name);
         }
     }
 
@@ -302,6 +307,7 @@ AddKeyName(KeyNamesInfo *info, xkb_keycode_t kc, xkb_atom_t name,
 
         if (merge == MERGE_OVERRIDE) {
             darray_item(info->key_names, old_kc) = XKB_ATOM_NONE;
+            hashmap_remove(&info->keycodes_by_name, name);
             if (report)
                 log_warn(info->ctx,
                          "Key name %s assigned to multiple keys; "
@@ -316,6 +322,9 @@ AddKeyName(KeyNamesInfo *info, xkb_keycode_t kc, xkb_atom_t name,
         }
     }
 
+    if (!hashmap_insert(&info->keycodes_by_name, name, kc))
+        return false;
+
     darray_item(info->key_names, kc) = name;
     return true;
 }
@@ -343,6 +352,9 @@ MergeIncludedKeycodes(KeyNamesInfo *into, KeyNamesInfo *from,
     if (darray_empty(into->key_names)) {
         into->key_names = from->key_names;
         darray_init(from->key_names);
+        hashmap_free(&into->keycodes_by_name);
+        into->keycodes_by_name = from->keycodes_by_name;
+        hashmap_init(&from->keycodes_by_name);
         into->min_key_code = from->min_key_code;
         into->max_key_code = from->max_key_code;
     }
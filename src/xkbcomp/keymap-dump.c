@@ -49,31 +49,127 @@
  * Author: Daniel Stone <daniel@fooishbar.org>
  */
 
+#include <ctype.h>
+
 #include "xkbcomp-priv.h"
 #include "text.h"
 
-#define BUF_CHUNK_SIZE 4096
+/*
+ * The keymap is formatted into a fixed staging buffer, which is handed to
+ * a sink whenever it fills up. The sink may append to a string, write to
+ * a file descriptor, or call back into the user.
+ */
+#define BUF_SIZE 4096
 
 struct buf {
-    char *buf;
+    char data[BUF_SIZE];
     size_t size;
-    size_t alloc;
+    xkb_keymap_write_t sink;
+    void *sink_data;
+    /* Once a write fails, all the following writes fail too. */
+    bool failed;
+
+    /* See minify_buf(). */
+    bool minify;
+    bool in_string;
+    bool space_pending;
+    char last;
 };
 
 static bool
-do_realloc(struct buf *buf, size_t at_least)
+is_word_char(char c)
+{
+    return isalnum((unsigned char) c) || c == '_';
+}
+
+/*
+ * Drop the whitespace which is not needed to tell tokens apart, i.e. all
+ * of it but single spaces between words. Strings are kept as they are.
+ * The state is kept in buf, since a token may be split between flushes.
+ */
+static void
+minify_buf(struct buf *buf)
+{
+    size_t in, out = 0;
+
+    for (in = 0; in < buf->size; in++) {
+        char c = buf->data[in];
+
+        if (!buf->in_string && isspace((unsigned char) c)) {
+            buf->space_pending = true;
+            continue;
+        }
+
+        if (buf->space_pending && is_word_char(buf->last) && is_word_char(c))
+            buf->data[out++] = ' ';
+        buf->space_pending = false;
+
+        if (c == '"')
+            buf->in_string = !buf->in_string;
+
+        buf->data[out++] = c;
+        buf->last = c;
+    }
+
+    buf->size = out;
+}
+
+static bool
+flush_buf(struct buf *buf)
+{
+    if (buf->failed)
+        return false;
+
+    if (buf->minify)
+        minify_buf(buf);
+
+    if (buf->size > 0 && !buf->sink(buf->sink_data, buf->data, buf->size))
+        buf->failed = true;
+
+    buf->size = 0;
+    return !buf->failed;
+}
+
+static bool
+check_write_str(struct buf *buf, const char *str, size_t len)
+{
+    while (len > 0) {
+        size_t n;
+
+        if (buf->size == sizeof(buf->data) && !flush_buf(buf))
+            return false;
+
+        n = MIN(len, sizeof(buf->data) - buf->size);
+        memcpy(buf->data + buf->size, str, n);
+        buf->size += n;
+        str += n;
+        len -= n;
+    }
+
+    return !buf->failed;
+}
+
+/* Write a string padded with spaces to width, like printf's %*s. */
+static bool
+check_write_padded(struct buf *buf, const char *str, int width)
 {
-    char *new;
+    static const char spaces[] = "                    ";
+    size_t len = strlen(str);
+    size_t pad = (size_t) abs(width) > len ? (size_t) abs(width) - len : 0;
 
-    buf->alloc += BUF_CHUNK_SIZE;
-    if (at_least >= BUF_CHUNK_SIZE)
-        buf->alloc += at_least;
+    if (width < 0 && !check_write_str(buf, str, len))
+        return false;
+
+    while (pad > 0) {
+        size_t n = MIN(pad, sizeof(spaces) - 1);
+        if (!check_write_str(buf, spaces, n))
+            return false;
+        pad -= n;
+    }
 
-    new = realloc(buf->buf, buf->alloc);
-    if (!new)
+    if (width >= 0 && !check_write_str(buf, str, len))
         return false;
 
-    buf->buf = new;
     return true;
 }
 
@@ -83,35 +179,48 @@ check_write_buf(struct buf *buf, const char *fmt, ...)
     va_list args;
     int printed;
     size_t available;
+    char *big;
 
-    available = buf->alloc - buf->size;
+    if (buf->failed)
+        return false;
+
+    available = sizeof(buf->data) - buf->size;
     va_start(args, fmt);
-    printed = vsnprintf(buf->buf + buf->size, available, fmt, args);
+    printed = vsnprintf(buf->data + buf->size, available, fmt, args);
     va_end(args);
 
     if (printed < 0)
         goto err;
 
-    if (printed >= available)
-        if (!do_realloc(buf, printed))
-            goto err;
+    if ((size_t) printed < available) {
+        buf->size += printed;
+        return true;
+    }
 
-    /* The buffer has enough space now. */
+    /* Didn't fit; make room and format again. */
+    if (!flush_buf(buf))
+        return false;
 
-    available = buf->alloc - buf->size;
-    va_start(args, fmt);
-    printed = vsnprintf(buf->buf + buf->size, available, fmt, args);
-    va_end(args);
+    if ((size_t) printed < sizeof(buf->data)) {
+        va_start(args, fmt);
+        vsnprintf(buf->data, sizeof(buf->data), fmt, args);
+        va_end(args);
+        buf->size = printed;
+        return true;
+    }
 
-    if (printed >= available || printed < 0)
+    big = malloc(printed + 1);
+    if (!big)
         goto err;
-
-    buf->size += printed;
-    return true;
+    va_start(args, fmt);
+    vsnprintf(big, printed + 1, fmt, args);
+    va_end(args);
+    check_write_str(buf, big, printed);
+    free(big);
+    return !buf->failed;
 
 err:
-    free(buf->buf);
-    buf->buf = NULL;
+    buf->failed = true;
     return false;
 }
 
@@ -120,6 +229,16 @@ err:
         return false; \
 } while (0)
 
+#define write_str(buf, str) do { \
+    if (!check_write_str(buf, str, strlen(str))) \
+        return false; \
+} while (0)
+
+#define write_padded(buf, str, width) do { \
+    if (!check_write_padded(buf, str, width)) \
+        return false; \
+} while (0)
+
 static bool
 write_vmods(struct xkb_keymap *keymap, struct buf *buf)
 {
@@ -131,15 +250,15 @@ write_vmods(struct xkb_keymap *keymap, struct buf *buf)
             continue;
 
         if (num_vmods == 0)
-            write_buf(buf, "\tvirtual_modifiers ");
+            write_str(buf, "\tvirtual_modifiers ");
         else
-            write_buf(buf, ",");
-        write_buf(buf, "%s", xkb_atom_text(keymap->ctx, mod->name));
+            write_str(buf, ",");
+        write_str(buf, xkb_atom_text(keymap->ctx, mod->name));
         num_vmods++;
     }
 
     if (num_vmods > 0)
-        write_buf(buf, ";\n\n");
+        write_str(buf, ";\n\n");
 
     return true;
 }
@@ -155,7 +274,7 @@ write_keycodes(struct xkb_keymap *keymap, struct buf *buf)
         write_buf(buf, "xkb_keycodes \"%s\" {\n",
                   keymap->keycodes_section_name);
     else
-        write_buf(buf, "xkb_keycodes {\n");
+        write_str(buf, "xkb_keycodes {\n");
 
     /* xkbcomp and X11 really want to see keymaps with a minimum of 8, and
      * a maximum of at least 255, else XWayland really starts hating life.
@@ -168,8 +287,9 @@ write_keycodes(struct xkb_keymap *keymap, struct buf *buf)
         if (key->name == XKB_ATOM_NONE)
             continue;
 
-        write_buf(buf, "\t%-20s = %u;\n",
-                  KeyNameText(keymap->ctx, key->name), key->keycode);
+        write_str(buf, "\t");
+        write_padded(buf, KeyNameText(keymap->ctx, key->name), -20);
+        write_buf(buf, " = %u;\n", key->keycode);
     }
 
     darray_enumerate(idx, led, keymap->leds)
@@ -183,10 +303,24 @@ write_keycodes(struct xkb_keymap *keymap, struct buf *buf)
                   KeyNameText(keymap->ctx, keymap->key_aliases[i].alias),
                   KeyNameText(keymap->ctx, keymap->key_aliases[i].real));
 
-    write_buf(buf, "};\n\n");
+    write_str(buf, "};\n\n");
     return true;
 }
 
+static bool
+type_is_used(struct xkb_keymap *keymap, const struct xkb_key_type *type)
+{
+    const struct xkb_key *key;
+    xkb_layout_index_t group;
+
+    xkb_foreach_key(key, keymap)
+        for (group = 0; group < key->num_groups; group++)
+            if (key->groups[group].type == type)
+                return true;
+
+    return false;
+}
+
 static bool
 write_types(struct xkb_keymap *keymap, struct buf *buf)
 {
@@ -194,13 +328,20 @@ write_types(struct xkb_keymap *keymap, struct buf *buf)
         write_buf(buf, "xkb_types \"%s\" {\n",
                   keymap->types_section_name);
     else
-        write_buf(buf, "xkb_types {\n");
+        write_str(buf, "xkb_types {\n");
 
     write_vmods(keymap, buf);
 
     for (unsigned i = 0; i < keymap->num_types; i++) {
         const struct xkb_key_type *type = &keymap->types[i];
 
+        /*
+         * Keys which did not get their type explicitly get it again by
+         * the same guess, so the types no key uses can go.
+         */
+        if (buf->minify && !type_is_used(keymap, type))
+            continue;
+
         write_buf(buf, "\ttype \"%s\" {\n",
                   xkb_atom_text(keymap->ctx, type->name));
 
@@ -232,10 +373,10 @@ write_types(struct xkb_keymap *keymap, struct buf *buf)
                 write_buf(buf, "\t\tlevel_name[Level%u]= \"%s\";\n", n + 1,
                           xkb_atom_text(keymap->ctx, type->level_names[n]));
 
-        write_buf(buf, "\t};\n");
+        write_str(buf, "\t};\n");
     }
 
-    write_buf(buf, "};\n\n");
+    write_str(buf, "};\n\n");
     return true;
 }
 
@@ -269,7 +410,7 @@ write_led_map(struct xkb_keymap *keymap, struct buf *buf,
                   ControlMaskText(keymap->ctx, led->ctrls));
     }
 
-    write_buf(buf, "\t};\n");
+    write_str(buf, "\t};\n");
     return true;
 }
 
@@ -363,11 +504,11 @@ write_action(struct xkb_keymap *keymap, struct buf *buf,
         if (action->btn.button > 0 && action->btn.button <= 5)
             write_buf(buf, "%d", action->btn.button);
         else
-            write_buf(buf, "default");
+            write_str(buf, "default");
         if (action->btn.count)
             write_buf(buf, ",count=%d", action->btn.count);
         if (args)
-            write_buf(buf, "%s", args);
+            write_str(buf, args);
         write_buf(buf, ")%s", suffix);
         break;
 
@@ -414,20 +555,10 @@ write_action(struct xkb_keymap *keymap, struct buf *buf,
 }
 
 static bool
-write_compat(struct xkb_keymap *keymap, struct buf *buf)
+write_interprets(struct xkb_keymap *keymap, struct buf *buf)
 {
-    const struct xkb_led *led;
-
-    if (keymap->compat_section_name)
-        write_buf(buf, "xkb_compatibility \"%s\" {\n",
-                  keymap->compat_section_name);
-    else
-        write_buf(buf, "xkb_compatibility {\n");
-
-    write_vmods(keymap, buf);
-
-    write_buf(buf, "\tinterpret.useModMapMods= AnyLevel;\n");
-    write_buf(buf, "\tinterpret.repeat= False;\n");
+    write_str(buf, "\tinterpret.useModMapMods= AnyLevel;\n");
+    write_str(buf, "\tinterpret.repeat= False;\n");
 
     for (int i = 0; i < keymap->num_sym_interprets; i++) {
         const struct xkb_sym_interpret *si = &keymap->sym_interprets[i];
@@ -442,21 +573,44 @@ write_compat(struct xkb_keymap *keymap, struct buf *buf)
                       ModIndexText(keymap, si->virtual_mod));
 
         if (si->level_one_only)
-            write_buf(buf, "\t\tuseModMapMods=level1;\n");
+            write_str(buf, "\t\tuseModMapMods=level1;\n");
 
         if (si->repeat)
-            write_buf(buf, "\t\trepeat= True;\n");
+            write_str(buf, "\t\trepeat= True;\n");
 
         write_action(keymap, buf, &si->action, "\t\taction= ", ";\n");
-        write_buf(buf, "\t};\n");
+        write_str(buf, "\t};\n");
     }
 
+    return true;
+}
+
+static bool
+write_compat(struct xkb_keymap *keymap, struct buf *buf)
+{
+    const struct xkb_led *led;
+
+    if (keymap->compat_section_name)
+        write_buf(buf, "xkb_compatibility \"%s\" {\n",
+                  keymap->compat_section_name);
+    else
+        write_str(buf, "xkb_compatibility {\n");
+
+    write_vmods(keymap, buf);
+
+    /*
+     * The interprets are only needed to find the actions of the keys. When
+     * minifying, these are written out with the keys instead.
+     */
+    if (!buf->minify && !write_interprets(keymap, buf))
+        return false;
+
     darray_foreach(led, keymap->leds)
         if (led->which_groups || led->groups || led->which_mods ||
             led->mods.mods || led->ctrls)
             write_led_map(keymap, buf, led);
 
-    write_buf(buf, "};\n\n");
+    write_str(buf, "};\n\n");
 
     return true;
 }
@@ -471,30 +625,45 @@ write_keysyms(struct xkb_keymap *keymap, struct buf *buf,
         int num_syms;
 
         if (level != 0)
-            write_buf(buf, ", ");
+            write_str(buf, ", ");
 
         num_syms = xkb_keymap_key_get_syms_by_level(keymap, key->keycode,
                                                     group, level, &syms);
         if (num_syms == 0) {
-            write_buf(buf, "%15s", "NoSymbol");
+            write_padded(buf, "NoSymbol", 15);
         }
         else if (num_syms == 1) {
-            write_buf(buf, "%15s", KeysymText(keymap->ctx, syms[0]));
+            write_padded(buf, KeysymText(keymap->ctx, syms[0]), 15);
         }
         else {
-            write_buf(buf, "{ ");
+            write_str(buf, "{ ");
             for (int s = 0; s < num_syms; s++) {
                 if (s != 0)
-                    write_buf(buf, ", ");
-                write_buf(buf, "%s", KeysymText(keymap->ctx, syms[s]));
+                    write_str(buf, ", ");
+                write_str(buf, KeysymText(keymap->ctx, syms[s]));
             }
-            write_buf(buf, " }");
+            write_str(buf, " }");
         }
     }
 
     return true;
 }
 
+static bool
+key_has_actions(const struct xkb_key *key)
+{
+    xkb_layout_index_t group;
+    xkb_level_index_t level;
+
+    for (group = 0; group < key->num_groups; group++)
+        for (level = 0; level < XkbKeyGroupWidth(key, group); level++)
+            if (key->groups[group].levels[level].action.type !=
+                ACTION_TYPE_NONE)
+                return true;
+
+    return false;
+}
+
 static bool
 write_key(struct xkb_keymap *keymap, struct buf *buf,
           const struct xkb_key *key)
@@ -505,7 +674,9 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
     bool multi_type = false;
     bool show_actions;
 
-    write_buf(buf, "\tkey %-20s {", KeyNameText(keymap->ctx, key->name));
+    write_str(buf, "\tkey ");
+    write_padded(buf, KeyNameText(keymap->ctx, key->name), -20);
+    write_str(buf, " {");
 
     for (group = 0; group < key->num_groups; group++) {
         if (key->groups[group].explicit_type)
@@ -537,21 +708,28 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
         }
     }
 
-    if (key->explicit & EXPLICIT_REPEAT) {
+    if (buf->minify) {
+        /* See write_symbols(). */
+        if (!key->repeats) {
+            write_str(buf, "\n\t\trepeat= No,");
+            simple = false;
+        }
+    }
+    else if (key->explicit & EXPLICIT_REPEAT) {
         if (key->repeats)
-            write_buf(buf, "\n\t\trepeat= Yes,");
+            write_str(buf, "\n\t\trepeat= Yes,");
         else
-            write_buf(buf, "\n\t\trepeat= No,");
+            write_str(buf, "\n\t\trepeat= No,");
         simple = false;
     }
 
-    if (key->vmodmap && (key->explicit & EXPLICIT_VMODMAP))
+    if (key->vmodmap && (buf->minify || (key->explicit & EXPLICIT_VMODMAP)))
         write_buf(buf, "\n\t\tvirtualMods= %s,",
                     ModMaskText(keymap, key->vmodmap));
 
     switch (key->out_of_range_group_action) {
     case RANGE_SATURATE:
-        write_buf(buf, "\n\t\tgroupsClamp,");
+        write_str(buf, "\n\t\tgroupsClamp,");
         break;
 
     case RANGE_REDIRECT:
@@ -563,41 +741,44 @@ write_key(struct xkb_keymap *keymap, struct buf *buf,
         break;
     }
 
-    show_actions = !!(key->explicit & EXPLICIT_INTERP);
+    if (buf->minify)
+        show_actions = key_has_actions(key);
+    else
+        show_actions = !!(key->explicit & EXPLICIT_INTERP);
 
     if (key->num_groups > 1 || show_actions)
         simple = false;
 
     if (simple) {
-        write_buf(buf, "\t[ ");
+        write_str(buf, "\t[ ");
         if (!write_keysyms(keymap, buf, key, 0))
             return false;
-        write_buf(buf, " ] };\n");
+        write_str(buf, " ] };\n");
     }
     else {
         xkb_level_index_t level;
 
         for (group = 0; group < key->num_groups; group++) {
             if (group != 0)
-                write_buf(buf, ",");
+                write_str(buf, ",");
             write_buf(buf, "\n\t\tsymbols[Group%u]= [ ", group + 1);
             if (!write_keysyms(keymap, buf, key, group))
                 return false;
-            write_buf(buf, " ]");
+            write_str(buf, " ]");
             if (show_actions) {
                 write_buf(buf, ",\n\t\tactions[Group%u]= [ ", group + 1);
                 for (level = 0;
                         level < XkbKeyGroupWidth(key, group); level++) {
                     if (level != 0)
-                        write_buf(buf, ", ");
+                        write_str(buf, ", ");
                     write_action(keymap, buf,
                                     &key->groups[group].levels[level].action,
                                     NULL, NULL);
                 }
-                write_buf(buf, " ]");
+                write_str(buf, " ]");
             }
         }
-        write_buf(buf, "\n\t};\n");
+        write_str(buf, "\n\t};\n");
     }
 
     return true;
@@ -613,7 +794,7 @@ write_symbols(struct xkb_keymap *keymap, struct buf *buf)
         write_buf(buf, "xkb_symbols \"%s\" {\n",
                   keymap->symbols_section_name);
     else
-        write_buf(buf, "xkb_symbols {\n");
+        write_str(buf, "xkb_symbols {\n");
 
     for (group = 0; group < keymap->num_group_names; group++)
         if (keymap->group_names[group])
@@ -621,7 +802,14 @@ write_symbols(struct xkb_keymap *keymap, struct buf *buf)
                       "\tname[group%u]=\"%s\";\n", group + 1,
                       xkb_atom_text(keymap->ctx, keymap->group_names[group]));
     if (group > 0)
-        write_buf(buf, "\n");
+        write_str(buf, "\n");
+
+    /*
+     * Without interprets, keys don't repeat unless told to. Most keys do
+     * though, so make it the default.
+     */
+    if (buf->minify)
+        write_str(buf, "\tkey.repeat= Yes;\n");
 
     xkb_foreach_key(key, keymap)
         if (key->num_groups > 0)
@@ -641,30 +829,104 @@ write_symbols(struct xkb_keymap *keymap, struct buf *buf)
                           KeyNameText(keymap->ctx, key->name));
     }
 
-    write_buf(buf, "};\n\n");
+    write_str(buf, "};\n\n");
     return true;
 }
 
+/*
+ * Mark the text as ours, so that it can be loaded back without going
+ * through the full compiler. It is a comment ending with the line, so it
+ * must be kept out of minify_buf().
+ */
+static bool
+write_header(struct buf *buf)
+{
+    bool minify = buf->minify;
+    bool ok;
+
+    buf->minify = false;
+    ok = (check_write_str(buf, CANONICAL_KEYMAP_HEADER,
+                          strlen(CANONICAL_KEYMAP_HEADER)) &&
+          flush_buf(buf));
+    buf->minify = minify;
+
+    return ok;
+}
+
 static bool
 write_keymap(struct xkb_keymap *keymap, struct buf *buf)
 {
-    return (check_write_buf(buf, "xkb_keymap {\n") &&
+    return (write_header(buf) &&
+            check_write_str(buf, "xkb_keymap {\n", 13) &&
             write_keycodes(keymap, buf) &&
             write_types(keymap, buf) &&
             write_compat(keymap, buf) &&
             write_symbols(keymap, buf) &&
-            check_write_buf(buf, "};\n"));
+            check_write_str(buf, "};\n", 3) &&
+            flush_buf(buf));
+}
+
+bool
+text_v1_keymap_write(struct xkb_keymap *keymap,
+                     enum xkb_keymap_serialize_flags flags,
+                     xkb_keymap_write_t sink, void *sink_data)
+{
+    struct buf buf;
+
+    buf.size = 0;
+    buf.sink = sink;
+    buf.sink_data = sink_data;
+    buf.failed = false;
+    buf.minify = !!(flags & XKB_KEYMAP_SERIALIZE_MINIFY);
+    buf.in_string = false;
+    buf.space_pending = false;
+    buf.last = '\0';
+
+    return write_keymap(keymap, &buf);
+}
+
+struct string_sink {
+    char *str;
+    size_t size;
+    size_t alloc;
+};
+
+static int
+append_to_string(void *data, const char *str, size_t len)
+{
+    struct string_sink *sink = data;
+
+    if (sink->size + len + 1 > sink->alloc) {
+        size_t alloc = (sink->alloc ? sink->alloc : 16 * BUF_SIZE);
+        char *new;
+
+        while (alloc < sink->size + len + 1)
+            alloc *= 2;
+
+        new = realloc(sink->str, alloc);
+        if (!new)
+            return 0;
+
+        sink->str = new;
+        sink->alloc = alloc;
+    }
+
+    memcpy(sink->str + sink->size, str, len);
+    sink->size += len;
+    sink->str[sink->size] = '\0';
+    return 1;
 }
 
 char *
-text_v1_keymap_get_as_string(struct xkb_keymap *keymap)
+text_v1_keymap_get_as_string(struct xkb_keymap *keymap,
+                             enum xkb_keymap_serialize_flags flags)
 {
-    struct buf buf = { NULL, 0, 0 };
+    struct string_sink sink = { NULL, 0, 0 };
 
-    if (!write_keymap(keymap, &buf)) {
-        free(buf.buf);
+    if (!text_v1_keymap_write(keymap, flags, append_to_string, &sink)) {
+        free(sink.str);
         return NULL;
     }
 
-    return buf.buf;
+    return sink.str;
 }
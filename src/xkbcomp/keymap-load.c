@@ -0,0 +1,2176 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Loads the keymaps written by keymap-dump.c, i.e. those starting with
+ * CANONICAL_KEYMAP_HEADER, straight into the keymap: a single pass over
+ * the tokens, without a syntax tree, include handling, or the info
+ * structs of the section compilers.
+ *
+ * Only the subset of the format which the dumper writes is understood: one
+ * section of each type, in order; no includes, merge modes or defaults
+ * other than key.repeat and interpret.*; and no statement the compiler
+ * would merge, override, or have anything to say about, even at the debug
+ * level. On anything else the loader gives up, without logging, and the
+ * caller clears the keymap and runs the full compiler on the text instead.
+ * The loader may thus reject text the compiler takes, but whatever it does
+ * take must end up as the same keymap.
+ */
+
+#include <limits.h>
+
+#include "xkbcomp-priv.h"
+#include "text.h"
+#include "hashmap.h"
+#include "parser-priv.h"
+#include "scanner-utils.h"
+
+enum token {
+    TOK_END,
+    TOK_ERROR,
+    /* An identifier or a keyword, see loader.keyword. */
+    TOK_WORD,
+    /* The value is in loader.atom. */
+    TOK_STRING,
+    TOK_KEYNAME,
+    /* The value is in loader.ival. */
+    TOK_INTEGER,
+    TOK_SEMI,
+    TOK_OBRACE,
+    TOK_CBRACE,
+    TOK_EQUALS,
+    TOK_OBRACKET,
+    TOK_CBRACKET,
+    TOK_OPAREN,
+    TOK_CPAREN,
+    TOK_DOT,
+    TOK_COMMA,
+    TOK_PLUS,
+    TOK_MINUS,
+    TOK_EXCLAM,
+};
+
+enum key_repeat {
+    KEY_REPEAT_UNDEFINED = 0,
+    KEY_REPEAT_YES = 1,
+    KEY_REPEAT_NO = 2,
+};
+
+struct loader_type {
+    xkb_atom_t name;
+    bool mods_defined;
+    xkb_mod_mask_t mods;
+    xkb_level_index_t num_levels;
+    darray(struct xkb_key_type_entry) entries;
+    darray(xkb_atom_t) level_names;
+};
+
+struct loader_group {
+    bool have_syms;
+    bool have_acts;
+    bool have_type;
+    xkb_atom_t type;
+    darray(struct xkb_level) levels;
+};
+
+struct loader_key {
+    enum key_repeat repeat;
+    bool vmodmap_defined;
+    xkb_mod_mask_t vmodmap;
+    xkb_atom_t default_type;
+    enum xkb_range_exceed_type out_of_range_group_action;
+    xkb_layout_index_t out_of_range_group_number;
+    xkb_layout_index_t num_groups;
+    struct loader_group groups[XKB_MAX_GROUPS];
+};
+
+struct loader {
+    struct scanner s;
+    struct xkb_keymap *keymap;
+    struct xkb_context *ctx;
+
+    /* The current token. */
+    enum token tok;
+    int keyword;
+    int ival;
+    xkb_atom_t atom;
+
+    /* xkb_keycodes */
+    darray(xkb_atom_t) key_names;
+    /* Key and alias names to keycodes. */
+    struct hashmap keys_by_name;
+    darray(struct xkb_key_alias) aliases;
+    xkb_keycode_t min_key_code;
+    xkb_keycode_t max_key_code;
+
+    /* xkb_types */
+    darray(struct loader_type) types;
+
+    /* xkb_compatibility */
+    struct xkb_sym_interpret default_interp;
+    darray(struct xkb_sym_interpret) interps;
+    /* As in CompatInfo, to tell duplicate interprets. */
+    struct hashmap interps_by_sym;
+    darray(uint32_t) interps_prev;
+    /* The LEDs which got their map. */
+    xkb_led_mask_t led_maps;
+
+    /* xkb_symbols */
+    darray(xkb_atom_t) group_names;
+    enum key_repeat default_repeat;
+    struct loader_key key;
+    darray(xkb_keysym_t) syms;
+    /* Key names to the modifier they were mapped to. */
+    struct hashmap modmaps_by_name;
+};
+
+#define NO_INTERP UINT32_MAX
+
+/***====================================================================***/
+
+static enum token
+lex_integer(struct loader *l)
+{
+    struct scanner *s = &l->s;
+    int64_t val = 0;
+    int base = 10;
+    unsigned int digits = 0;
+
+    if (lit(s, "0x"))
+        base = 16;
+
+    for (;;) {
+        char c = peek(s);
+        int digit;
+
+        if (c >= '0' && c <= '9')
+            digit = c - '0';
+        else if (base == 16 && isxdigit(c))
+            digit = tolower(c) - 'a' + 10;
+        else
+            break;
+
+        /* Bigger numbers don't fit the compiler's expressions anyway. */
+        val = val * base + digit;
+        if (val > INT_MAX)
+            return TOK_ERROR;
+
+        s->pos++; s->column++;
+        digits++;
+    }
+
+    if (digits == 0 || peek(s) == '.')
+        return TOK_ERROR;
+
+    l->ival = (int) val;
+    return TOK_INTEGER;
+}
+
+/*
+ * Like _xkbcommon_lex(), but string escapes and floats are errors, since
+ * the dumper doesn't write them.
+ */
+static enum token
+lex(struct loader *l)
+{
+    struct scanner *s = &l->s;
+
+skip_more_whitespace_and_comments:
+    /* Skip spaces. */
+    while (isspace(peek(s))) next(s);
+
+    /* Skip comments. */
+    if ((peek(s) == '/' && lit(s, "//")) || chr(s, '#')) {
+        while (!eof(s) && !eol(s)) next(s);
+        goto skip_more_whitespace_and_comments;
+    }
+
+    /* See if we're done. */
+    if (eof(s)) return TOK_END;
+
+    /* New token. */
+    s->buf_pos = 0;
+
+    /* String literal. */
+    if (chr(s, '\"')) {
+        while (!eof(s) && !eol(s) && peek(s) != '\"')
+            if (peek(s) == '\\' || !buf_append(s, next(s)))
+                return TOK_ERROR;
+        if (!buf_append(s, '\0') || !chr(s, '\"'))
+            return TOK_ERROR;
+        l->atom = xkb_atom_intern(s->ctx, s->buf, s->buf_pos - 1);
+        return TOK_STRING;
+    }
+
+    /* Key name literal. */
+    if (chr(s, '<')) {
+        while (isgraph(peek(s)) && peek(s) != '>')
+            if (!buf_append(s, next(s)))
+                return TOK_ERROR;
+        if (!buf_append(s, '\0') || !chr(s, '>'))
+            return TOK_ERROR;
+        l->atom = xkb_atom_intern(s->ctx, s->buf, s->buf_pos - 1);
+        return TOK_KEYNAME;
+    }
+
+    /* Operators and punctuation. */
+    if (chr(s, ';')) return TOK_SEMI;
+    if (chr(s, '{')) return TOK_OBRACE;
+    if (chr(s, '}')) return TOK_CBRACE;
+    if (chr(s, '=')) return TOK_EQUALS;
+    if (chr(s, '[')) return TOK_OBRACKET;
+    if (chr(s, ']')) return TOK_CBRACKET;
+    if (chr(s, '(')) return TOK_OPAREN;
+    if (chr(s, ')')) return TOK_CPAREN;
+    if (chr(s, '.')) return TOK_DOT;
+    if (chr(s, ',')) return TOK_COMMA;
+    if (chr(s, '+')) return TOK_PLUS;
+    if (chr(s, '-')) return TOK_MINUS;
+    if (chr(s, '!')) return TOK_EXCLAM;
+
+    /* Identifier or keyword. */
+    if (isalpha(peek(s)) || peek(s) == '_') {
+        const char *start = s->s + s->pos;
+        size_t len;
+
+        while (isalnum(peek(s)) || peek(s) == '_')
+            s->pos++;
+        len = s->s + s->pos - start;
+        s->column += len;
+        if (len + 1 >= sizeof(s->buf))
+            return TOK_ERROR;
+        memcpy(s->buf, start, len);
+        s->buf[len] = '\0';
+        s->buf_pos = len + 1;
+
+        l->keyword = keyword_to_token(s->buf);
+        return TOK_WORD;
+    }
+
+    if (isdigit(peek(s)))
+        return lex_integer(l);
+
+    return TOK_ERROR;
+}
+
+static void
+advance(struct loader *l)
+{
+    l->tok = lex(l);
+}
+
+static bool
+accept(struct loader *l, enum token tok)
+{
+    if (l->tok != tok)
+        return false;
+    advance(l);
+    return true;
+}
+
+static bool
+accept_keyword(struct loader *l, int keyword)
+{
+    if (l->tok != TOK_WORD || l->keyword != keyword)
+        return false;
+    advance(l);
+    return true;
+}
+
+/* The identifier at the current token, see Ident in parser.y. */
+static const char *
+ident(struct loader *l)
+{
+    if (l->tok != TOK_WORD)
+        return NULL;
+
+    if (l->keyword == -1)
+        return l->s.buf;
+    if (l->keyword == DEFAULT)
+        return "default";
+
+    return NULL;
+}
+
+/* The field or action name at the current token, see FieldSpec. */
+static const char *
+field_name(struct loader *l)
+{
+    if (l->tok != TOK_WORD)
+        return NULL;
+
+    switch (l->keyword) {
+    case -1:
+    case ACTION_TOK:
+    case INTERPRET:
+    case TYPE:
+    case KEY:
+    case GROUP:
+    case INDICATOR:
+        return l->s.buf;
+    case DEFAULT:
+        return "default";
+    default:
+        return NULL;
+    }
+}
+
+/***====================================================================***/
+
+/* Look the field at the current token up in @tab, and skip it. */
+static bool
+load_field(struct loader *l, const LookupEntry tab[], unsigned int *field_rtrn)
+{
+    const char *name = field_name(l);
+
+    if (!name || !LookupString(tab, name, field_rtrn))
+        return false;
+
+    advance(l);
+    return true;
+}
+
+static bool
+load_string(struct loader *l, xkb_atom_t *atom_rtrn)
+{
+    if (l->tok != TOK_STRING)
+        return false;
+
+    *atom_rtrn = l->atom;
+    advance(l);
+    return true;
+}
+
+/* See ExprResolveIntegerLookup(); @tab may be NULL for plain integers. */
+static bool
+load_integer(struct loader *l, const LookupEntry tab[], int *val_rtrn)
+{
+    const char *name = ident(l);
+    unsigned int val;
+
+    if (l->tok == TOK_INTEGER)
+        *val_rtrn = l->ival;
+    else if (tab && name && LookupString(tab, name, &val))
+        *val_rtrn = (int) val;
+    else
+        return false;
+
+    advance(l);
+    return true;
+}
+
+/* Returns '+' or '-' if there is a sign at the current token, else 0. */
+static char
+load_sign(struct loader *l)
+{
+    if (accept(l, TOK_PLUS))
+        return '+';
+    if (accept(l, TOK_MINUS))
+        return '-';
+    return 0;
+}
+
+static bool
+load_boolean(struct loader *l, bool *set_rtrn)
+{
+    const char *name = ident(l);
+
+    if (!name)
+        return false;
+
+    if (istreq(name, "true") || istreq(name, "yes") || istreq(name, "on"))
+        *set_rtrn = true;
+    else if (istreq(name, "false") || istreq(name, "no") ||
+             istreq(name, "off"))
+        *set_rtrn = false;
+    else
+        return false;
+
+    advance(l);
+    return true;
+}
+
+static bool
+load_enum(struct loader *l, const LookupEntry tab[], unsigned int *val_rtrn)
+{
+    const char *name = ident(l);
+
+    if (!name || !LookupString(tab, name, val_rtrn))
+        return false;
+
+    advance(l);
+    return true;
+}
+
+/* Returns the group counting from 1, like ExprResolveGroup(). */
+static bool
+load_group(struct loader *l, xkb_layout_index_t *group_rtrn)
+{
+    int group;
+
+    if (!load_integer(l, groupNames, &group) ||
+        group <= 0 || group > XKB_MAX_GROUPS)
+        return false;
+
+    *group_rtrn = (xkb_layout_index_t) group;
+    return true;
+}
+
+/* Returns the level counting from 0, like ExprResolveLevel(). */
+static bool
+load_level(struct loader *l, xkb_level_index_t *level_rtrn)
+{
+    int level;
+
+    if (!load_integer(l, levelNames, &level) || level < 1)
+        return false;
+
+    *level_rtrn = (xkb_level_index_t) (level - 1);
+    return true;
+}
+
+/* A mask of names from @tab or integers, joined by '+'. */
+static bool
+load_mask(struct loader *l, const LookupEntry tab[], unsigned int *mask_rtrn)
+{
+    unsigned int mask = 0;
+
+    do {
+        const char *name = ident(l);
+        unsigned int val;
+
+        if (l->tok == TOK_INTEGER)
+            val = (unsigned int) l->ival;
+        else if (!name || !LookupString(tab, name, &val))
+            return false;
+
+        mask |= val;
+        advance(l);
+    } while (accept(l, TOK_PLUS));
+
+    *mask_rtrn = mask;
+    return true;
+}
+
+static bool
+load_mod(struct loader *l, enum mod_type type, xkb_mod_index_t *ndx_rtrn)
+{
+    const char *name = ident(l);
+    xkb_mod_index_t ndx;
+
+    if (!name)
+        return false;
+
+    ndx = ModNameToIndex(l->keymap, xkb_atom_lookup(l->ctx, name), type);
+    if (ndx == XKB_MOD_INVALID)
+        return false;
+
+    *ndx_rtrn = ndx;
+    advance(l);
+    return true;
+}
+
+/* Like load_mask(), with the names of LookupModMask(). */
+static bool
+load_mod_mask(struct loader *l, enum mod_type type, xkb_mod_mask_t *mask_rtrn)
+{
+    xkb_mod_mask_t mask = 0;
+
+    do {
+        const char *name = ident(l);
+        xkb_mod_index_t ndx;
+
+        if (l->tok == TOK_INTEGER) {
+            mask |= (xkb_mod_mask_t) l->ival;
+        }
+        else if (name && istreq(name, "all")) {
+            mask |= MOD_REAL_MASK_ALL;
+        }
+        else if (name && istreq(name, "none")) {
+            /* Nothing to add. */
+        }
+        else {
+            if (!load_mod(l, type, &ndx))
+                return false;
+            mask |= 1u << ndx;
+            continue;
+        }
+
+        advance(l);
+    } while (accept(l, TOK_PLUS));
+
+    *mask_rtrn = mask;
+    return true;
+}
+
+/* See KeySym in parser.y, and LookupKeysym(). */
+static bool
+load_keysym(struct loader *l, xkb_keysym_t *sym_rtrn)
+{
+    char buf[17];
+    const char *name;
+
+    if (l->tok == TOK_WORD && l->keyword == -1) {
+        name = l->s.buf;
+    }
+    else if (l->tok == TOK_WORD && l->keyword == SECTION) {
+        name = "section";
+    }
+    else if (l->tok == TOK_INTEGER) {
+        if (l->ival < 10)
+            snprintf(buf, sizeof(buf), "%d", l->ival);
+        else
+            snprintf(buf, sizeof(buf), "0x%x", l->ival);
+        name = buf;
+    }
+    else {
+        return false;
+    }
+
+    if (!LookupKeysym(name, sym_rtrn))
+        return false;
+
+    advance(l);
+    return true;
+}
+
+/*
+ * The start of a section, up to and including its opening brace; the
+ * name is stored as CopyKeyNamesToKeymap() and co. store it.
+ */
+static bool
+load_section_start(struct loader *l, int keyword, char **name_rtrn)
+{
+    if (!accept_keyword(l, keyword))
+        return false;
+
+    if (l->tok == TOK_STRING) {
+        *name_rtrn = strdup(xkb_atom_text(l->ctx, l->atom));
+        if (!*name_rtrn)
+            return false;
+        XkbEscapeMapName(*name_rtrn);
+        advance(l);
+    }
+
+    return accept(l, TOK_OBRACE);
+}
+
+/* See HandleVModDef(). */
+static bool
+load_vmods(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+
+    do {
+        const char *name = ident(l);
+        xkb_atom_t atom;
+        xkb_mod_index_t ndx;
+        struct xkb_mod new;
+
+        if (!name)
+            return false;
+
+        atom = xkb_atom_intern(l->ctx, name, strlen(name));
+        advance(l);
+
+        ndx = ModNameToIndex(keymap, atom, MOD_BOTH);
+        if (ndx != XKB_MOD_INVALID) {
+            if (darray_item(keymap->mods, ndx).type != MOD_VIRT)
+                return false;
+            continue;
+        }
+
+        if (darray_size(keymap->mods) >= XKB_MAX_MODS)
+            return false;
+
+        new.name = atom;
+        new.type = MOD_VIRT;
+        new.mapping = 0;
+        darray_append(keymap->mods, new);
+    } while (accept(l, TOK_COMMA));
+
+    return accept(l, TOK_SEMI);
+}
+
+/***====================================================================***/
+
+enum action_arg {
+    ACTION_ARG_CLEAR_LOCKS,
+    ACTION_ARG_LATCH_TO_LOCK,
+    ACTION_ARG_AFFECT,
+    ACTION_ARG_MODIFIERS,
+    ACTION_ARG_GROUP,
+    ACTION_ARG_X,
+    ACTION_ARG_Y,
+    ACTION_ARG_BUTTON,
+    ACTION_ARG_VALUE,
+    ACTION_ARG_CONTROLS,
+    ACTION_ARG_TYPE,
+    ACTION_ARG_COUNT,
+    ACTION_ARG_SCREEN,
+    ACTION_ARG_SAME,
+    ACTION_ARG_DATA,
+};
+
+/* The part of fieldStrings in action.c which the dumper writes. */
+static const LookupEntry actionArgNames[] = {
+    { "clearLocks",  ACTION_ARG_CLEAR_LOCKS   },
+    { "latchToLock", ACTION_ARG_LATCH_TO_LOCK },
+    { "affect",      ACTION_ARG_AFFECT        },
+    { "modifiers",   ACTION_ARG_MODIFIERS     },
+    { "mods",        ACTION_ARG_MODIFIERS     },
+    { "group",       ACTION_ARG_GROUP         },
+    { "x",           ACTION_ARG_X             },
+    { "y",           ACTION_ARG_Y             },
+    { "button",      ACTION_ARG_BUTTON        },
+    { "value",       ACTION_ARG_VALUE         },
+    { "controls",    ACTION_ARG_CONTROLS      },
+    { "ctrls",       ACTION_ARG_CONTROLS      },
+    { "type",        ACTION_ARG_TYPE          },
+    { "count",       ACTION_ARG_COUNT         },
+    { "screen",      ACTION_ARG_SCREEN        },
+    { "same",        ACTION_ARG_SAME          },
+    { "sameServer",  ACTION_ARG_SAME          },
+    { "data",        ACTION_ARG_DATA          },
+    { NULL,          0                        }
+};
+
+/*
+ * The value of a boolean argument, which may also be given as just "arg"
+ * or "!arg".
+ */
+static bool
+load_flag_value(struct loader *l, bool has_value, bool negated,
+                bool *set_rtrn)
+{
+    if (!has_value) {
+        *set_rtrn = !negated;
+        return true;
+    }
+
+    return load_boolean(l, set_rtrn);
+}
+
+static bool
+load_action_flag(struct loader *l, enum xkb_action_flags *flags,
+                 enum xkb_action_flags flag, bool has_value, bool negated)
+{
+    bool set;
+
+    if (!load_flag_value(l, has_value, negated, &set))
+        return false;
+
+    if (set)
+        *flags |= flag;
+    else
+        *flags &= ~flag;
+
+    return true;
+}
+
+/* See CheckModifierField(). */
+static bool
+load_action_mods(struct loader *l, struct xkb_mod_action *act)
+{
+    const char *name = ident(l);
+
+    if (name && (istreq(name, "usemodmapmods") ||
+                 istreq(name, "modmapmods"))) {
+        advance(l);
+        if (l->tok == TOK_PLUS)
+            return false;
+        act->flags |= ACTION_MODS_LOOKUP_MODMAP;
+        act->mods.mods = 0;
+        return true;
+    }
+
+    if (!load_mod_mask(l, MOD_BOTH, &act->mods.mods))
+        return false;
+
+    act->flags &= ~ACTION_MODS_LOOKUP_MODMAP;
+    return true;
+}
+
+/*
+ * One argument of an action of @type, see the handlers in action.c. A
+ * Private() action changes its type as it goes, so it is passed apart.
+ */
+static bool
+load_action_arg(struct loader *l, enum xkb_action_type type,
+                union xkb_action *action)
+{
+    unsigned int arg, val;
+    bool negated, has_value, set;
+    int ndx = -1, num;
+    xkb_layout_index_t group;
+    char sign;
+
+    negated = accept(l, TOK_EXCLAM);
+
+    if (!load_field(l, actionArgNames, &arg))
+        return false;
+
+    if (accept(l, TOK_OBRACKET)) {
+        if (arg != ACTION_ARG_DATA || !load_integer(l, NULL, &ndx) ||
+            !accept(l, TOK_CBRACKET))
+            return false;
+    }
+    else if (arg == ACTION_ARG_DATA) {
+        return false;
+    }
+
+    has_value = !negated && accept(l, TOK_EQUALS);
+
+    /* Only the flags can go without a value. */
+    if (!has_value && arg != ACTION_ARG_CLEAR_LOCKS &&
+        arg != ACTION_ARG_LATCH_TO_LOCK && arg != ACTION_ARG_SAME)
+        return false;
+
+    switch (type) {
+    case ACTION_TYPE_MOD_SET:
+    case ACTION_TYPE_MOD_LATCH:
+    case ACTION_TYPE_MOD_LOCK:
+        if (arg == ACTION_ARG_MODIFIERS)
+            return load_action_mods(l, &action->mods);
+        if (type == ACTION_TYPE_MOD_LOCK)
+            return false;
+        if (arg == ACTION_ARG_CLEAR_LOCKS)
+            return load_action_flag(l, &action->mods.flags,
+                                    ACTION_LOCK_CLEAR, has_value, negated);
+        if (arg == ACTION_ARG_LATCH_TO_LOCK)
+            return load_action_flag(l, &action->mods.flags,
+                                    ACTION_LATCH_TO_LOCK, has_value, negated);
+        return false;
+
+    case ACTION_TYPE_GROUP_SET:
+    case ACTION_TYPE_GROUP_LATCH:
+    case ACTION_TYPE_GROUP_LOCK:
+        if (arg == ACTION_ARG_GROUP) {
+            sign = load_sign(l);
+            if (!load_group(l, &group))
+                return false;
+
+            if (sign)
+                action->group.flags &= ~ACTION_ABSOLUTE_SWITCH;
+            else
+                action->group.flags |= ACTION_ABSOLUTE_SWITCH;
+
+            if (sign == '-')
+                action->group.group = -(int32_t) group;
+            else if (sign == '+')
+                action->group.group = group;
+            else
+                action->group.group = group - 1;
+            return true;
+        }
+        if (type == ACTION_TYPE_GROUP_LOCK)
+            return false;
+        if (arg == ACTION_ARG_CLEAR_LOCKS)
+            return load_action_flag(l, &action->group.flags,
+                                    ACTION_LOCK_CLEAR, has_value, negated);
+        if (arg == ACTION_ARG_LATCH_TO_LOCK)
+            return load_action_flag(l, &action->group.flags,
+                                    ACTION_LATCH_TO_LOCK, has_value, negated);
+        return false;
+
+    case ACTION_TYPE_PTR_MOVE:
+        if (arg != ACTION_ARG_X && arg != ACTION_ARG_Y)
+            return false;
+
+        sign = load_sign(l);
+        if (!load_integer(l, NULL, &num))
+            return false;
+        if (sign == '-')
+            num = -num;
+
+        if (arg == ACTION_ARG_X) {
+            if (!sign)
+                action->ptr.flags |= ACTION_ABSOLUTE_X;
+            action->ptr.x = num;
+        }
+        else {
+            if (!sign)
+                action->ptr.flags |= ACTION_ABSOLUTE_Y;
+            action->ptr.y = num;
+        }
+        return true;
+
+    case ACTION_TYPE_PTR_BUTTON:
+    case ACTION_TYPE_PTR_LOCK:
+        if (arg == ACTION_ARG_BUTTON) {
+            if (!load_integer(l, buttonNames, &num) || num < 0 || num > 5)
+                return false;
+            action->btn.button = num;
+            return true;
+        }
+        if (arg == ACTION_ARG_COUNT) {
+            if (!load_integer(l, buttonNames, &num) || num < 0 || num > 255)
+                return false;
+            action->btn.count = num;
+            return true;
+        }
+        if (arg == ACTION_ARG_AFFECT && type == ACTION_TYPE_PTR_LOCK) {
+            if (!load_enum(l, lockWhichNames, &val))
+                return false;
+            action->btn.flags &= ~(ACTION_LOCK_NO_LOCK | ACTION_LOCK_NO_UNLOCK);
+            action->btn.flags |= val;
+            return true;
+        }
+        return false;
+
+    case ACTION_TYPE_PTR_DEFAULT:
+        if (arg == ACTION_ARG_AFFECT)
+            return load_enum(l, ptrDfltNames, &val);
+        if (arg != ACTION_ARG_BUTTON && arg != ACTION_ARG_VALUE)
+            return false;
+
+        sign = load_sign(l);
+        if (!load_integer(l, buttonNames, &num) || num < 1 || num > 5)
+            return false;
+
+        if (sign)
+            action->dflt.flags &= ~ACTION_ABSOLUTE_SWITCH;
+        else
+            action->dflt.flags |= ACTION_ABSOLUTE_SWITCH;
+        action->dflt.value = (sign == '-' ? -num : num);
+        return true;
+
+    case ACTION_TYPE_SWITCH_VT:
+        if (arg == ACTION_ARG_SAME) {
+            if (!load_flag_value(l, has_value, negated, &set))
+                return false;
+            if (set)
+                action->screen.flags &= ~ACTION_SAME_SCREEN;
+            else
+                action->screen.flags |= ACTION_SAME_SCREEN;
+            return true;
+        }
+        if (arg != ACTION_ARG_SCREEN)
+            return false;
+
+        sign = load_sign(l);
+        if (!load_integer(l, NULL, &num) || num < 0 || num > 255)
+            return false;
+
+        if (sign)
+            action->screen.flags &= ~ACTION_ABSOLUTE_SWITCH;
+        else
+            action->screen.flags |= ACTION_ABSOLUTE_SWITCH;
+        action->screen.screen = (sign == '-' ? -num : num);
+        return true;
+
+    case ACTION_TYPE_CTRL_SET:
+    case ACTION_TYPE_CTRL_LOCK:
+        if (arg != ACTION_ARG_CONTROLS || !load_mask(l, ctrlMaskNames, &val))
+            return false;
+        action->ctrls.ctrls = val;
+        return true;
+
+    case ACTION_TYPE_PRIVATE:
+        if (arg == ACTION_ARG_TYPE) {
+            /* The compiler turns the lower types into NoAction(). */
+            if (!load_integer(l, NULL, &num) ||
+                num < ACTION_TYPE_PRIVATE || num > 255)
+                return false;
+            action->type = (enum xkb_action_type) num;
+            return true;
+        }
+        if (arg == ACTION_ARG_DATA) {
+            if (ndx < 0 || ndx >= (int) sizeof(action->priv.data) ||
+                !load_integer(l, NULL, &num) || num < 0 || num > 255)
+                return false;
+            action->priv.data[ndx] = (uint8_t) num;
+            return true;
+        }
+        return false;
+
+    default:
+        return false;
+    }
+}
+
+/* See HandleActionDef(); there are no action defaults to start from. */
+static bool
+load_action(struct loader *l, union xkb_action *action)
+{
+    const char *name = field_name(l);
+    unsigned int type;
+
+    if (!name || !LookupString(actionTypeNames, name, &type))
+        return false;
+    advance(l);
+
+    if (!accept(l, TOK_OPAREN))
+        return false;
+
+    memset(action, 0, sizeof(*action));
+    action->type = type;
+    if (type == ACTION_TYPE_PTR_DEFAULT)
+        action->dflt.value = 1;
+
+    if (accept(l, TOK_CPAREN))
+        return true;
+
+    /* The compiler ignores these, but they are never written. */
+    if (type == ACTION_TYPE_NONE || type == ACTION_TYPE_TERMINATE)
+        return false;
+
+    do {
+        if (!load_action_arg(l, type, action))
+            return false;
+    } while (accept(l, TOK_COMMA));
+
+    return accept(l, TOK_CPAREN);
+}
+
+/***====================================================================***/
+
+static const LookupEntry keycodeVarNames[] = {
+    { "minimum", 0 },
+    { "maximum", 0 },
+    { NULL, 0 }
+};
+
+/* <NAME> = keycode; see HandleKeycodeDef() and AddKeyName(). */
+static bool
+load_keycode(struct loader *l)
+{
+    xkb_atom_t name = l->atom;
+    xkb_keycode_t kc;
+    uint32_t old;
+    int val;
+
+    advance(l);
+    if (!accept(l, TOK_EQUALS) || !load_integer(l, NULL, &val) ||
+        !accept(l, TOK_SEMI))
+        return false;
+    kc = (xkb_keycode_t) val;
+
+    if (hashmap_lookup(&l->keys_by_name, name, &old))
+        return false;
+
+    if (kc >= darray_size(l->key_names))
+        darray_resize0(l->key_names, kc + 1);
+    else if (darray_item(l->key_names, kc) != XKB_ATOM_NONE)
+        return false;
+
+    darray_item(l->key_names, kc) = name;
+    if (!hashmap_insert(&l->keys_by_name, name, kc))
+        return false;
+
+    if (l->min_key_code == XKB_KEYCODE_INVALID || kc < l->min_key_code)
+        l->min_key_code = kc;
+    if (kc > l->max_key_code)
+        l->max_key_code = kc;
+
+    return true;
+}
+
+/* indicator N = "name"; see HandleLedNameDef() and AddLedName(). */
+static bool
+load_led_name(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+    const struct xkb_led *led;
+    xkb_atom_t name;
+    int idx;
+
+    if (!load_integer(l, NULL, &idx) || idx < 1 || idx > XKB_MAX_LEDS ||
+        !accept(l, TOK_EQUALS) || !load_string(l, &name) ||
+        !accept(l, TOK_SEMI))
+        return false;
+    idx--;
+
+    darray_foreach(led, keymap->leds)
+        if (led->name == name)
+            return false;
+
+    if ((unsigned int) idx >= darray_size(keymap->leds))
+        darray_resize0(keymap->leds, idx + 1);
+    else if (darray_item(keymap->leds, idx).name != XKB_ATOM_NONE)
+        return false;
+
+    darray_item(keymap->leds, idx).name = name;
+    return true;
+}
+
+static bool
+load_alias(struct loader *l)
+{
+    struct xkb_key_alias alias;
+
+    if (l->tok != TOK_KEYNAME)
+        return false;
+    alias.alias = l->atom;
+    advance(l);
+
+    if (!accept(l, TOK_EQUALS) || l->tok != TOK_KEYNAME)
+        return false;
+    alias.real = l->atom;
+    advance(l);
+
+    darray_append(l->aliases, alias);
+    return accept(l, TOK_SEMI);
+}
+
+/* See CopyKeyNamesToKeymap(). */
+static bool
+copy_keycodes(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+    struct xkb_key_alias *alias;
+    xkb_keycode_t kc;
+    uint32_t real_kc, other_kc;
+
+    if (l->min_key_code != XKB_KEYCODE_INVALID) {
+        keymap->min_key_code = l->min_key_code;
+        keymap->max_key_code = l->max_key_code;
+    }
+    else {
+        keymap->min_key_code = 8;
+        keymap->max_key_code = 255;
+    }
+
+    keymap->keys = calloc(keymap->max_key_code + 1, sizeof(*keymap->keys));
+    if (!keymap->keys)
+        return false;
+
+    for (kc = keymap->min_key_code; kc <= keymap->max_key_code; kc++)
+        keymap->keys[kc].keycode = kc;
+
+    for (kc = 0; kc < darray_size(l->key_names); kc++)
+        keymap->keys[kc].name = darray_item(l->key_names, kc);
+
+    /*
+     * The compiler drops aliases to names which are not keys (including
+     * other aliases), and with the name of a key or of an earlier alias.
+     */
+    darray_foreach(alias, l->aliases) {
+        if (!hashmap_lookup(&l->keys_by_name, alias->real, &real_kc) ||
+            keymap->keys[real_kc].name != alias->real ||
+            hashmap_lookup(&l->keys_by_name, alias->alias, &other_kc))
+            return false;
+
+        if (!hashmap_insert(&l->keys_by_name, alias->alias, real_kc))
+            return false;
+    }
+
+    keymap->num_key_aliases = darray_size(l->aliases);
+    keymap->key_aliases = darray_mem(l->aliases, 0);
+    darray_init(l->aliases);
+
+    return true;
+}
+
+static bool
+load_keycodes(struct loader *l)
+{
+    unsigned int field;
+
+    if (!load_section_start(l, XKB_KEYCODES,
+                            &l->keymap->keycodes_section_name))
+        return false;
+
+    while (!accept(l, TOK_CBRACE)) {
+        bool ok;
+
+        if (l->tok == TOK_KEYNAME)
+            ok = load_keycode(l);
+        else if (accept_keyword(l, INDICATOR))
+            ok = load_led_name(l);
+        else if (accept_keyword(l, ALIAS))
+            ok = load_alias(l);
+        else
+            /* The computed range is used instead, see HandleKeyNameVar(). */
+            ok = (load_field(l, keycodeVarNames, &field) &&
+                  accept(l, TOK_EQUALS) && accept(l, TOK_INTEGER) &&
+                  accept(l, TOK_SEMI));
+
+        if (!ok)
+            return false;
+    }
+
+    return accept(l, TOK_SEMI) && copy_keycodes(l);
+}
+
+/***====================================================================***/
+
+enum type_field {
+    TYPE_FIELD_MODIFIERS,
+    TYPE_FIELD_MAP,
+    TYPE_FIELD_PRESERVE,
+    TYPE_FIELD_LEVEL_NAME,
+};
+
+static const LookupEntry typeFieldNames[] = {
+    { "modifiers",  TYPE_FIELD_MODIFIERS  },
+    { "map",        TYPE_FIELD_MAP        },
+    { "preserve",   TYPE_FIELD_PRESERVE   },
+    { "levelname",  TYPE_FIELD_LEVEL_NAME },
+    { "level_name", TYPE_FIELD_LEVEL_NAME },
+    { NULL,         0                     }
+};
+
+static struct xkb_key_type_entry *
+find_type_entry(struct loader_type *type, xkb_mod_mask_t mods)
+{
+    struct xkb_key_type_entry *entry;
+
+    darray_foreach(entry, type->entries)
+        if (entry->mods.mods == mods)
+            return entry;
+
+    return NULL;
+}
+
+/*
+ * See SetKeyTypeField(). Entries for modifiers outside of the type's, and
+ * entries or level names given twice, are left to the compiler.
+ */
+static bool
+load_type_field(struct loader *l, struct loader_type *type)
+{
+    unsigned int field;
+    xkb_mod_mask_t mods, preserve;
+    xkb_level_index_t level;
+    xkb_atom_t name;
+    struct xkb_key_type_entry *entry;
+    struct xkb_key_type_entry new;
+
+    if (!load_field(l, typeFieldNames, &field))
+        return false;
+
+    if (field == TYPE_FIELD_MODIFIERS) {
+        if (type->mods_defined || !accept(l, TOK_EQUALS) ||
+            !load_mod_mask(l, MOD_BOTH, &type->mods))
+            return false;
+        type->mods_defined = true;
+        return accept(l, TOK_SEMI);
+    }
+
+    if (!accept(l, TOK_OBRACKET))
+        return false;
+
+    switch (field) {
+    case TYPE_FIELD_MAP:
+        if (!load_mod_mask(l, MOD_BOTH, &mods) ||
+            !accept(l, TOK_CBRACKET) || !accept(l, TOK_EQUALS) ||
+            !load_level(l, &level))
+            return false;
+
+        if ((mods & ~type->mods) || find_type_entry(type, mods))
+            return false;
+
+        new.level = level;
+        new.mods.mods = mods;
+        new.mods.mask = 0;
+        new.preserve.mods = 0;
+        new.preserve.mask = 0;
+        darray_append(type->entries, new);
+        if (level >= type->num_levels)
+            type->num_levels = level + 1;
+        break;
+
+    case TYPE_FIELD_PRESERVE:
+        if (!load_mod_mask(l, MOD_BOTH, &mods) ||
+            !accept(l, TOK_CBRACKET) || !accept(l, TOK_EQUALS) ||
+            !load_mod_mask(l, MOD_BOTH, &preserve))
+            return false;
+
+        if ((mods & ~type->mods) || (preserve & ~mods))
+            return false;
+
+        entry = find_type_entry(type, mods);
+        if (entry) {
+            if (entry->preserve.mods != 0)
+                return false;
+            entry->preserve.mods = preserve;
+            break;
+        }
+
+        /* A preserve[] before its map[] maps to Level1, see AddPreserve(). */
+        new.level = 0;
+        new.mods.mods = mods;
+        new.mods.mask = 0;
+        new.preserve.mods = preserve;
+        new.preserve.mask = 0;
+        darray_append(type->entries, new);
+        break;
+
+    case TYPE_FIELD_LEVEL_NAME:
+        if (!load_level(l, &level) || !accept(l, TOK_CBRACKET) ||
+            !accept(l, TOK_EQUALS) || !load_string(l, &name))
+            return false;
+
+        if (level >= darray_size(type->level_names))
+            darray_resize0(type->level_names, level + 1);
+        else if (darray_item(type->level_names, level) != XKB_ATOM_NONE)
+            return false;
+
+        darray_item(type->level_names, level) = name;
+        break;
+    }
+
+    return accept(l, TOK_SEMI);
+}
+
+static bool
+load_type(struct loader *l)
+{
+    struct loader_type *type;
+
+    if (l->tok != TOK_STRING)
+        return false;
+
+    darray_foreach(type, l->types)
+        if (type->name == l->atom)
+            return false;
+
+    darray_resize0(l->types, darray_size(l->types) + 1);
+    type = &darray_item(l->types, darray_size(l->types) - 1);
+    type->name = l->atom;
+    type->num_levels = 1;
+    advance(l);
+
+    if (!accept(l, TOK_OBRACE))
+        return false;
+
+    do {
+        if (!load_type_field(l, type))
+            return false;
+    } while (!accept(l, TOK_CBRACE));
+
+    return accept(l, TOK_SEMI);
+}
+
+/* See CopyKeyTypesToKeymap(). */
+static bool
+copy_types(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+    struct loader_type *def;
+    struct xkb_key_type *type;
+    unsigned int num_types = MAX(darray_size(l->types), 1);
+
+    keymap->types = calloc(num_types, sizeof(*keymap->types));
+    if (!keymap->types)
+        return false;
+    keymap->num_types = num_types;
+
+    /*
+     * If no types were specified, a default unnamed one-level type is
+     * used for all keys.
+     */
+    if (darray_empty(l->types)) {
+        type = &keymap->types[0];
+        type->num_levels = 1;
+        type->name = xkb_atom_intern_literal(keymap->ctx, "default");
+        return true;
+    }
+
+    type = keymap->types;
+    darray_foreach(def, l->types) {
+        type->mods.mods = def->mods;
+        type->num_levels = def->num_levels;
+        type->entries = darray_mem(def->entries, 0);
+        type->num_entries = darray_size(def->entries);
+        darray_init(def->entries);
+        type->name = def->name;
+        type->level_names = darray_mem(def->level_names, 0);
+        darray_init(def->level_names);
+        type++;
+    }
+
+    return true;
+}
+
+static bool
+load_types(struct loader *l)
+{
+    if (!load_section_start(l, XKB_TYPES, &l->keymap->types_section_name))
+        return false;
+
+    while (!accept(l, TOK_CBRACE)) {
+        bool ok;
+
+        if (accept_keyword(l, VIRTUAL_MODS))
+            ok = load_vmods(l);
+        else if (accept_keyword(l, TYPE))
+            ok = load_type(l);
+        else
+            ok = false;
+
+        if (!ok)
+            return false;
+    }
+
+    return accept(l, TOK_SEMI) && copy_types(l);
+}
+
+/***====================================================================***/
+
+enum interp_field {
+    INTERP_FIELD_ACTION,
+    INTERP_FIELD_VIRTUAL_MOD,
+    INTERP_FIELD_REPEAT,
+    INTERP_FIELD_USE_MOD_MAP,
+};
+
+static const LookupEntry interpFieldNames[] = {
+    { "action",          INTERP_FIELD_ACTION      },
+    { "virtualmodifier", INTERP_FIELD_VIRTUAL_MOD },
+    { "virtualmod",      INTERP_FIELD_VIRTUAL_MOD },
+    { "repeat",          INTERP_FIELD_REPEAT      },
+    { "usemodmap",       INTERP_FIELD_USE_MOD_MAP },
+    { "usemodmapmods",   INTERP_FIELD_USE_MOD_MAP },
+    { NULL,              0                        }
+};
+
+enum led_field {
+    LED_FIELD_MODS,
+    LED_FIELD_GROUPS,
+    LED_FIELD_CTRLS,
+    LED_FIELD_WHICH_MODS,
+    LED_FIELD_WHICH_GROUPS,
+};
+
+static const LookupEntry ledFieldNames[] = {
+    { "modifiers",          LED_FIELD_MODS         },
+    { "mods",               LED_FIELD_MODS         },
+    { "groups",             LED_FIELD_GROUPS       },
+    { "controls",           LED_FIELD_CTRLS        },
+    { "ctrls",              LED_FIELD_CTRLS        },
+    { "whichmodstate",      LED_FIELD_WHICH_MODS   },
+    { "whichmodifierstate", LED_FIELD_WHICH_MODS   },
+    { "whichgroupstate",    LED_FIELD_WHICH_GROUPS },
+    { NULL,                 0                      }
+};
+
+/* field= value; see SetInterpField(). */
+static bool
+load_interp_field(struct loader *l, struct xkb_sym_interpret *si)
+{
+    unsigned int field, val;
+
+    if (!load_field(l, interpFieldNames, &field) || !accept(l, TOK_EQUALS))
+        return false;
+
+    switch (field) {
+    case INTERP_FIELD_ACTION:
+        if (!load_action(l, &si->action))
+            return false;
+        break;
+
+    case INTERP_FIELD_VIRTUAL_MOD:
+        if (!load_mod(l, MOD_VIRT, &si->virtual_mod))
+            return false;
+        break;
+
+    case INTERP_FIELD_REPEAT:
+        if (!load_boolean(l, &si->repeat))
+            return false;
+        break;
+
+    case INTERP_FIELD_USE_MOD_MAP:
+        if (!load_enum(l, useModMapValueNames, &val))
+            return false;
+        si->level_one_only = !!val;
+        break;
+    }
+
+    return accept(l, TOK_SEMI);
+}
+
+/* See HandleInterpDef() and ResolveStateAndPredicate(). */
+static bool
+load_interp(struct loader *l)
+{
+    struct xkb_sym_interpret si = l->default_interp;
+    const char *name;
+    unsigned int pred;
+    uint32_t i, prev;
+
+    if (!load_keysym(l, &si.sym))
+        return false;
+
+    if (accept(l, TOK_PLUS)) {
+        name = field_name(l);
+        if (!name || !LookupString(symInterpretMatchMaskNames, name, &pred))
+            return false;
+        advance(l);
+
+        if (!accept(l, TOK_OPAREN) ||
+            !load_mod_mask(l, MOD_REAL, &si.mods) ||
+            !accept(l, TOK_CPAREN))
+            return false;
+        si.match = pred;
+    }
+    else {
+        si.match = MATCH_ANY_OR_NONE;
+        si.mods = MOD_REAL_MASK_ALL;
+    }
+
+    if (!accept(l, TOK_OBRACE))
+        return false;
+
+    do {
+        if (!load_interp_field(l, &si))
+            return false;
+    } while (!accept(l, TOK_CBRACE));
+
+    if (!accept(l, TOK_SEMI))
+        return false;
+
+    /* The compiler merges these, see AddInterp(). */
+    if (!hashmap_lookup(&l->interps_by_sym, si.sym, &prev))
+        prev = NO_INTERP;
+
+    for (i = prev; i != NO_INTERP; i = darray_item(l->interps_prev, i)) {
+        const struct xkb_sym_interpret *old = &darray_item(l->interps, i);
+        if (old->mods == si.mods && old->match == si.match)
+            return false;
+    }
+
+    if (!hashmap_insert(&l->interps_by_sym, si.sym, darray_size(l->interps)))
+        return false;
+
+    darray_append(l->interps_prev, prev);
+    darray_append(l->interps, si);
+    return true;
+}
+
+/* See HandleLedMapDef() and CopyLedMapDefs(). */
+static bool
+load_led_map(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+    struct xkb_led ledi;
+    xkb_led_index_t idx;
+    const struct xkb_led *led;
+    unsigned int field, mask;
+
+    memset(&ledi, 0, sizeof(ledi));
+    if (!load_string(l, &ledi.name))
+        return false;
+
+    /* Not declared in keycodes, or given twice. */
+    darray_enumerate(idx, led, keymap->leds)
+        if (led->name == ledi.name)
+            break;
+    if (idx >= darray_size(keymap->leds) || (l->led_maps & (1u << idx)))
+        return false;
+
+    if (!accept(l, TOK_OBRACE))
+        return false;
+
+    do {
+        if (!load_field(l, ledFieldNames, &field) || !accept(l, TOK_EQUALS))
+            return false;
+
+        switch (field) {
+        case LED_FIELD_MODS:
+            if (!load_mod_mask(l, MOD_BOTH, &ledi.mods.mods))
+                return false;
+            break;
+
+        case LED_FIELD_GROUPS:
+            if (!load_mask(l, groupMaskNames, &mask))
+                return false;
+            ledi.groups = mask;
+            break;
+
+        case LED_FIELD_CTRLS:
+            if (!load_mask(l, ctrlMaskNames, &mask))
+                return false;
+            ledi.ctrls = mask;
+            break;
+
+        case LED_FIELD_WHICH_MODS:
+            if (!load_mask(l, modComponentMaskNames, &mask))
+                return false;
+            ledi.which_mods = mask;
+            break;
+
+        case LED_FIELD_WHICH_GROUPS:
+            if (!load_mask(l, groupComponentMaskNames, &mask))
+                return false;
+            ledi.which_groups = mask;
+            break;
+        }
+
+        if (!accept(l, TOK_SEMI))
+            return false;
+    } while (!accept(l, TOK_CBRACE));
+
+    if (!accept(l, TOK_SEMI))
+        return false;
+
+    if (ledi.groups != 0 && ledi.which_groups == 0)
+        ledi.which_groups = XKB_STATE_LAYOUT_EFFECTIVE;
+    if (ledi.mods.mods != 0 && ledi.which_mods == 0)
+        ledi.which_mods = XKB_STATE_MODS_EFFECTIVE;
+
+    darray_item(keymap->leds, idx) = ledi;
+    l->led_maps |= 1u << idx;
+    return true;
+}
+
+/* See CopyCompatToKeymap(). */
+static bool
+copy_interps(struct loader *l)
+{
+    static const enum xkb_match_operation preds[] = {
+        MATCH_EXACTLY, MATCH_ALL, MATCH_NONE, MATCH_ANY, MATCH_ANY_OR_NONE,
+    };
+    struct xkb_keymap *keymap = l->keymap;
+    const struct xkb_sym_interpret *si;
+    struct xkb_sym_interpret *out;
+    unsigned int i, n = 0;
+    int need_symbol;
+
+    if (darray_empty(l->interps))
+        return true;
+
+    out = calloc(darray_size(l->interps), sizeof(*out));
+    if (!out)
+        return false;
+
+    /* Most specific to least specific. */
+    for (need_symbol = 1; need_symbol >= 0; need_symbol--)
+        for (i = 0; i < ARRAY_SIZE(preds); i++)
+            darray_foreach(si, l->interps)
+                if (si->match == preds[i] &&
+                    (si->sym != XKB_KEY_NoSymbol) == need_symbol)
+                    out[n++] = *si;
+
+    keymap->num_sym_interprets = n;
+    keymap->sym_interprets = out;
+    return true;
+}
+
+static bool
+load_compat(struct loader *l)
+{
+    if (!load_section_start(l, XKB_COMPATMAP,
+                            &l->keymap->compat_section_name))
+        return false;
+
+    memset(&l->default_interp, 0, sizeof(l->default_interp));
+    l->default_interp.virtual_mod = XKB_MOD_INVALID;
+
+    while (!accept(l, TOK_CBRACE)) {
+        bool ok;
+
+        if (accept_keyword(l, VIRTUAL_MODS))
+            ok = load_vmods(l);
+        else if (accept_keyword(l, INTERPRET))
+            ok = (accept(l, TOK_DOT) ?
+                  load_interp_field(l, &l->default_interp) :
+                  load_interp(l));
+        else if (accept_keyword(l, INDICATOR))
+            ok = load_led_map(l);
+        else
+            ok = false;
+
+        if (!ok)
+            return false;
+    }
+
+    return accept(l, TOK_SEMI) && copy_interps(l);
+}
+
+/***====================================================================***/
+
+enum key_field {
+    KEY_FIELD_TYPE,
+    KEY_FIELD_SYMBOLS,
+    KEY_FIELD_ACTIONS,
+    KEY_FIELD_VMODMAP,
+    KEY_FIELD_REPEAT,
+    KEY_FIELD_GROUPS_WRAP,
+    KEY_FIELD_GROUPS_CLAMP,
+    KEY_FIELD_GROUPS_REDIRECT,
+};
+
+static const LookupEntry keyFieldNames[] = {
+    { "type",             KEY_FIELD_TYPE            },
+    { "symbols",          KEY_FIELD_SYMBOLS         },
+    { "actions",          KEY_FIELD_ACTIONS         },
+    { "vmods",            KEY_FIELD_VMODMAP         },
+    { "virtualmods",      KEY_FIELD_VMODMAP         },
+    { "virtualmodifiers", KEY_FIELD_VMODMAP         },
+    { "repeat",           KEY_FIELD_REPEAT          },
+    { "repeats",          KEY_FIELD_REPEAT          },
+    { "repeating",        KEY_FIELD_REPEAT          },
+    { "groupswrap",       KEY_FIELD_GROUPS_WRAP     },
+    { "wrapgroups",       KEY_FIELD_GROUPS_WRAP     },
+    { "groupsclamp",      KEY_FIELD_GROUPS_CLAMP    },
+    { "clampgroups",      KEY_FIELD_GROUPS_CLAMP    },
+    { "groupsredirect",   KEY_FIELD_GROUPS_REDIRECT },
+    { "redirectgroups",   KEY_FIELD_GROUPS_REDIRECT },
+    { NULL,               0                         }
+};
+
+static const LookupEntry keyRepeatNames[] = {
+    { "true",    KEY_REPEAT_YES       },
+    { "yes",     KEY_REPEAT_YES       },
+    { "on",      KEY_REPEAT_YES       },
+    { "false",   KEY_REPEAT_NO        },
+    { "no",      KEY_REPEAT_NO        },
+    { "off",     KEY_REPEAT_NO        },
+    { "default", KEY_REPEAT_UNDEFINED },
+    { NULL,      0                    }
+};
+
+static const LookupEntry groupNameFieldNames[] = {
+    { "name",      0 },
+    { "groupname", 0 },
+    { NULL,        0 }
+};
+
+static void
+clear_key(struct loader_key *keyi)
+{
+    struct xkb_level *leveli;
+    xkb_layout_index_t i;
+
+    for (i = 0; i < XKB_MAX_GROUPS; i++) {
+        darray_foreach(leveli, keyi->groups[i].levels)
+            if (leveli->num_syms > 1)
+                free(leveli->u.syms);
+        darray_free(keyi->groups[i].levels);
+    }
+
+    memset(keyi, 0, sizeof(*keyi));
+}
+
+/* See AddSymbolsToKey(); a list of one keysym is the keysym alone. */
+static bool
+load_level_syms(struct loader *l, struct xkb_level *leveli)
+{
+    xkb_keysym_t sym;
+
+    if (!accept(l, TOK_OBRACE)) {
+        if (!load_keysym(l, &sym))
+            return false;
+        leveli->num_syms = (sym == XKB_KEY_NoSymbol ? 0 : 1);
+        leveli->u.sym = sym;
+        return true;
+    }
+
+    darray_resize(l->syms, 0);
+    do {
+        if (!load_keysym(l, &sym))
+            return false;
+        darray_append(l->syms, sym);
+    } while (accept(l, TOK_COMMA));
+
+    if (!accept(l, TOK_CBRACE))
+        return false;
+
+    if (darray_size(l->syms) == 1) {
+        sym = darray_item(l->syms, 0);
+        leveli->num_syms = (sym == XKB_KEY_NoSymbol ? 0 : 1);
+        leveli->u.sym = sym;
+        return true;
+    }
+
+    leveli->u.syms = memdup(darray_mem(l->syms, 0), darray_size(l->syms),
+                            sizeof(*leveli->u.syms));
+    if (!leveli->u.syms)
+        return false;
+    leveli->num_syms = darray_size(l->syms);
+    return true;
+}
+
+/*
+ * The rest of a list of keysyms or actions, after the '['. Without
+ * @group, they go to the first group which has none yet, see
+ * GetGroupIndex().
+ */
+static bool
+load_key_levels(struct loader *l, struct loader_key *keyi,
+                xkb_layout_index_t group, bool actions)
+{
+    struct loader_group *groupi;
+    xkb_level_index_t level = 0;
+
+    if (group == XKB_LAYOUT_INVALID)
+        for (group = 0; group < keyi->num_groups; group++)
+            if (!(actions ? keyi->groups[group].have_acts :
+                            keyi->groups[group].have_syms))
+                break;
+
+    if (group >= XKB_MAX_GROUPS)
+        return false;
+    if (group >= keyi->num_groups)
+        keyi->num_groups = group + 1;
+
+    groupi = &keyi->groups[group];
+    if (actions ? groupi->have_acts : groupi->have_syms)
+        return false;
+    if (actions)
+        groupi->have_acts = true;
+    else
+        groupi->have_syms = true;
+
+    do {
+        struct xkb_level *leveli;
+
+        if (level >= darray_size(groupi->levels))
+            darray_resize0(groupi->levels, level + 1);
+        leveli = &darray_item(groupi->levels, level);
+
+        if (actions ? !load_action(l, &leveli->action) :
+                      !load_level_syms(l, leveli))
+            return false;
+
+        level++;
+    } while (accept(l, TOK_COMMA));
+
+    return accept(l, TOK_CBRACKET);
+}
+
+/* See HandleSymbolsBody() and SetSymbolsField(). */
+static bool
+load_key_field(struct loader *l, struct loader_key *keyi)
+{
+    unsigned int field, val;
+    xkb_layout_index_t group = XKB_LAYOUT_INVALID;
+    bool negated, set = false;
+
+    /* The dumper only leaves the keysyms of simple keys unnamed. */
+    if (accept(l, TOK_OBRACKET))
+        return load_key_levels(l, keyi, XKB_LAYOUT_INVALID, false);
+
+    negated = accept(l, TOK_EXCLAM);
+
+    if (!load_field(l, keyFieldNames, &field))
+        return false;
+
+    if (accept(l, TOK_OBRACKET)) {
+        if ((field != KEY_FIELD_TYPE && field != KEY_FIELD_SYMBOLS &&
+             field != KEY_FIELD_ACTIONS) ||
+            !load_group(l, &group) || !accept(l, TOK_CBRACKET))
+            return false;
+        group--;
+    }
+
+    /* Only the wrap and clamp flags can go without a value. */
+    if (negated || !accept(l, TOK_EQUALS)) {
+        if (field != KEY_FIELD_GROUPS_WRAP && field != KEY_FIELD_GROUPS_CLAMP)
+            return false;
+        set = !negated;
+    }
+    else if (field == KEY_FIELD_GROUPS_WRAP ||
+             field == KEY_FIELD_GROUPS_CLAMP) {
+        if (!load_boolean(l, &set))
+            return false;
+    }
+
+    switch (field) {
+    case KEY_FIELD_TYPE:
+        if (group == XKB_LAYOUT_INVALID)
+            return load_string(l, &keyi->default_type);
+
+        if (!load_string(l, &keyi->groups[group].type))
+            return false;
+        keyi->groups[group].have_type = true;
+        if (group >= keyi->num_groups)
+            keyi->num_groups = group + 1;
+        return true;
+
+    case KEY_FIELD_SYMBOLS:
+    case KEY_FIELD_ACTIONS:
+        return (accept(l, TOK_OBRACKET) &&
+                load_key_levels(l, keyi, group, field == KEY_FIELD_ACTIONS));
+
+    case KEY_FIELD_VMODMAP:
+        if (!load_mod_mask(l, MOD_VIRT, &keyi->vmodmap))
+            return false;
+        keyi->vmodmap_defined = true;
+        return true;
+
+    case KEY_FIELD_REPEAT:
+        if (!load_enum(l, keyRepeatNames, &val))
+            return false;
+        keyi->repeat = val;
+        return true;
+
+    case KEY_FIELD_GROUPS_WRAP:
+        keyi->out_of_range_group_action = (set ? RANGE_WRAP : RANGE_SATURATE);
+        return true;
+
+    case KEY_FIELD_GROUPS_CLAMP:
+        keyi->out_of_range_group_action = (set ? RANGE_SATURATE : RANGE_WRAP);
+        return true;
+
+    case KEY_FIELD_GROUPS_REDIRECT:
+        if (!load_group(l, &group))
+            return false;
+        keyi->out_of_range_group_action = RANGE_REDIRECT;
+        keyi->out_of_range_group_number = group - 1;
+        return true;
+    }
+
+    return false;
+}
+
+static const struct xkb_key_type *
+find_type(struct xkb_keymap *keymap, xkb_atom_t name)
+{
+    unsigned int i;
+
+    for (i = 0; i < keymap->num_types; i++)
+        if (keymap->types[i].name == name)
+            return &keymap->types[i];
+
+    return NULL;
+}
+
+/*
+ * See CopySymbolsDef(). The compiler fills gaps between groups, and falls
+ * back to the first type for keys it can't find the type of; here those
+ * keys are left to it.
+ */
+static bool
+copy_key(struct loader *l, struct xkb_key *key)
+{
+    struct loader_key *keyi = &l->key;
+    const struct xkb_key_type *types[XKB_MAX_GROUPS];
+    bool explicit_types[XKB_MAX_GROUPS];
+    xkb_layout_index_t i, num_groups = 0;
+
+    for (i = 0; i < keyi->num_groups; i++) {
+        const struct loader_group *groupi = &keyi->groups[i];
+        if (groupi->have_syms || groupi->have_acts || groupi->have_type)
+            num_groups = i + 1;
+    }
+
+    if (num_groups == 0)
+        return false;
+
+    for (i = 0; i < num_groups; i++) {
+        struct loader_group *groupi = &keyi->groups[i];
+        xkb_atom_t name = groupi->type;
+
+        if (!groupi->have_syms && !groupi->have_acts && !groupi->have_type)
+            return false;
+
+        explicit_types[i] = true;
+        if (!groupi->have_type) {
+            if (keyi->default_type != XKB_ATOM_NONE) {
+                name = keyi->default_type;
+            }
+            else {
+                name = FindAutomaticType(l->ctx,
+                                         darray_mem(groupi->levels, 0),
+                                         darray_size(groupi->levels));
+                explicit_types[i] = false;
+            }
+        }
+
+        types[i] = (name == XKB_ATOM_NONE ? NULL : find_type(l->keymap, name));
+        if (!types[i] || types[i]->num_levels < darray_size(groupi->levels))
+            return false;
+    }
+
+    key->groups = calloc(num_groups, sizeof(*key->groups));
+    if (!key->groups)
+        return false;
+    key->num_groups = num_groups;
+
+    for (i = 0; i < num_groups; i++) {
+        struct loader_group *groupi = &keyi->groups[i];
+
+        /* Always have as many levels as the type specifies. */
+        darray_resize0(groupi->levels, types[i]->num_levels);
+
+        key->groups[i].explicit_type = explicit_types[i];
+        key->groups[i].type = types[i];
+        key->groups[i].levels = darray_mem(groupi->levels, 0);
+        darray_init(groupi->levels);
+
+        if (groupi->have_acts)
+            key->explicit |= EXPLICIT_INTERP;
+    }
+
+    key->out_of_range_group_number = keyi->out_of_range_group_number;
+    key->out_of_range_group_action = keyi->out_of_range_group_action;
+
+    if (keyi->vmodmap_defined) {
+        key->vmodmap = keyi->vmodmap;
+        key->explicit |= EXPLICIT_VMODMAP;
+    }
+
+    if (keyi->repeat != KEY_REPEAT_UNDEFINED) {
+        key->repeats = (keyi->repeat == KEY_REPEAT_YES);
+        key->explicit |= EXPLICIT_REPEAT;
+    }
+
+    return true;
+}
+
+/* key <NAME> { ... }; see HandleSymbolsDef(). */
+static bool
+load_key(struct loader *l)
+{
+    struct xkb_key *key;
+    uint32_t kc;
+
+    if (l->tok != TOK_KEYNAME ||
+        !hashmap_lookup(&l->keys_by_name, l->atom, &kc))
+        return false;
+
+    /* Defined twice, which the compiler merges. */
+    key = &l->keymap->keys[kc];
+    if (key->groups)
+        return false;
+    advance(l);
+
+    clear_key(&l->key);
+    l->key.repeat = l->default_repeat;
+
+    if (!accept(l, TOK_OBRACE))
+        return false;
+
+    if (l->tok != TOK_CBRACE) {
+        do {
+            if (!load_key_field(l, &l->key))
+                return false;
+        } while (accept(l, TOK_COMMA));
+    }
+
+    return (accept(l, TOK_CBRACE) && accept(l, TOK_SEMI) &&
+            copy_key(l, key));
+}
+
+/* key.repeat= value; the only key default the dumper writes. */
+static bool
+load_key_default(struct loader *l)
+{
+    unsigned int field, val;
+
+    if (!load_field(l, keyFieldNames, &field) ||
+        field != KEY_FIELD_REPEAT || !accept(l, TOK_EQUALS) ||
+        !load_enum(l, keyRepeatNames, &val))
+        return false;
+
+    l->default_repeat = val;
+    return accept(l, TOK_SEMI);
+}
+
+/* name[GroupN]= "name"; see SetGroupName(). */
+static bool
+load_group_name(struct loader *l)
+{
+    unsigned int field;
+    xkb_layout_index_t group;
+    xkb_atom_t name;
+
+    if (!load_field(l, groupNameFieldNames, &field) ||
+        !accept(l, TOK_OBRACKET) || !load_group(l, &group) ||
+        !accept(l, TOK_CBRACKET) || !accept(l, TOK_EQUALS) ||
+        !load_string(l, &name))
+        return false;
+    group--;
+
+    if (group >= darray_size(l->group_names))
+        darray_resize0(l->group_names, group + 1);
+    darray_item(l->group_names, group) = name;
+
+    return accept(l, TOK_SEMI);
+}
+
+/*
+ * modifier_map Mod { <NAME>, ... }; see HandleModMapDef() and
+ * CopyModMapDef(). Keys are mapped right away, since their symbols
+ * don't matter; keysym entries are left to the compiler.
+ */
+static bool
+load_modmap(struct loader *l)
+{
+    xkb_mod_index_t mod;
+    uint32_t kc, old;
+
+    if (!load_mod(l, MOD_REAL, &mod) || !accept(l, TOK_OBRACE))
+        return false;
+
+    do {
+        if (l->tok != TOK_KEYNAME)
+            return false;
+
+        if (hashmap_lookup(&l->modmaps_by_name, l->atom, &old)) {
+            if (old != mod)
+                return false;
+        }
+        else {
+            if (!hashmap_lookup(&l->keys_by_name, l->atom, &kc) ||
+                !hashmap_insert(&l->modmaps_by_name, l->atom, mod))
+                return false;
+            l->keymap->keys[kc].modmap |= 1u << mod;
+        }
+
+        advance(l);
+    } while (accept(l, TOK_COMMA));
+
+    return accept(l, TOK_CBRACE) && accept(l, TOK_SEMI);
+}
+
+static bool
+load_symbols(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+
+    if (!load_section_start(l, XKB_SYMBOLS, &keymap->symbols_section_name))
+        return false;
+
+    l->default_repeat = KEY_REPEAT_UNDEFINED;
+
+    while (!accept(l, TOK_CBRACE)) {
+        bool ok;
+
+        if (accept_keyword(l, KEY))
+            ok = (accept(l, TOK_DOT) ? load_key_default(l) : load_key(l));
+        else if (accept_keyword(l, MODIFIER_MAP))
+            ok = load_modmap(l);
+        else
+            ok = load_group_name(l);
+
+        if (!ok)
+            return false;
+    }
+
+    keymap->num_group_names = darray_size(l->group_names);
+    keymap->group_names = darray_mem(l->group_names, 0);
+    darray_init(l->group_names);
+
+    return accept(l, TOK_SEMI);
+}
+
+/***====================================================================***/
+
+static bool
+load_keymap(struct loader *l)
+{
+    struct xkb_keymap *keymap = l->keymap;
+    const struct xkb_key *key;
+
+    advance(l);
+
+    if (!accept_keyword(l, XKB_KEYMAP))
+        return false;
+    if (l->tok == TOK_STRING)
+        advance(l);
+
+    if (!accept(l, TOK_OBRACE) ||
+        !load_keycodes(l) || !load_types(l) ||
+        !load_compat(l) || !load_symbols(l) ||
+        !accept(l, TOK_CBRACE) || !accept(l, TOK_SEMI) ||
+        l->tok != TOK_END)
+        return false;
+
+    /* Only now that it is sure that the compiler won't say it again. */
+    if (xkb_context_get_log_verbosity(l->ctx) > 3) {
+        xkb_foreach_key(key, keymap) {
+            if (key->name == XKB_ATOM_NONE)
+                continue;
+
+            if (key->num_groups < 1)
+                log_info(l->ctx,
+                         "No symbols defined for %s\n",
+                         KeyNameText(l->ctx, key->name));
+        }
+    }
+
+    return true;
+}
+
+static void
+loader_init(struct loader *l, struct xkb_keymap *keymap,
+            const char *string, size_t len)
+{
+    memset(l, 0, sizeof(*l));
+    scanner_init(&l->s, keymap->ctx, string, len, "(input string)");
+    l->keymap = keymap;
+    l->ctx = keymap->ctx;
+
+    darray_init(l->key_names);
+    hashmap_init(&l->keys_by_name);
+    darray_init(l->aliases);
+    l->min_key_code = XKB_KEYCODE_INVALID;
+    l->max_key_code = 0;
+    darray_init(l->types);
+    darray_init(l->interps);
+    hashmap_init(&l->interps_by_sym);
+    darray_init(l->interps_prev);
+    darray_init(l->group_names);
+    darray_init(l->syms);
+    hashmap_init(&l->modmaps_by_name);
+}
+
+static void
+loader_clear(struct loader *l)
+{
+    struct loader_type *type;
+
+    darray_free(l->key_names);
+    hashmap_free(&l->keys_by_name);
+    darray_free(l->aliases);
+    darray_foreach(type, l->types) {
+        darray_free(type->entries);
+        darray_free(type->level_names);
+    }
+    darray_free(l->types);
+    darray_free(l->interps);
+    hashmap_free(&l->interps_by_sym);
+    darray_free(l->interps_prev);
+    darray_free(l->group_names);
+    clear_key(&l->key);
+    darray_free(l->syms);
+    hashmap_free(&l->modmaps_by_name);
+}
+
+bool
+LoadCanonicalKeymap(struct xkb_keymap *keymap, const char *string, size_t len)
+{
+    struct xkb_context *ctx = keymap->ctx;
+    struct loader l;
+    uint64_t start;
+    bool ok;
+
+    loader_init(&l, keymap, string, len);
+
+    start = xkb_context_stat_timer_start(ctx);
+    ok = load_keymap(&l);
+    if (ok)
+        xkb_context_stat_add(ctx, XKB_COMPILE_STAT_BYTES_SCANNED, l.s.pos);
+    xkb_context_stat_timer_stop(ctx, XKB_COMPILE_STAT_TIME_PARSE, start);
+
+    loader_clear(&l);
+    if (!ok)
+        return false;
+
+    start = xkb_context_stat_timer_start(ctx);
+    ok = UpdateDerivedKeymapFields(keymap);
+    xkb_context_stat_timer_stop(ctx, XKB_COMPILE_STAT_TIME_DERIVED, start);
+    return ok;
+}
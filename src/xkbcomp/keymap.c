@@ -28,6 +28,7 @@
  */
 
 #include "xkbcomp-priv.h"
+#include "include.h"
 
 static void
 ComputeEffectiveMask(struct xkb_keymap *keymap, struct xkb_mods *mods)
@@ -69,71 +70,176 @@ static const struct xkb_sym_interpret default_interpret = {
     .action = { .type = ACTION_TYPE_NONE },
 };
 
+/*
+ * An index of keymap->sym_interprets by keysym, so that finding the
+ * interpretation for a level only needs to look at the candidates for its
+ * keysym, instead of scanning the entire (possibly very long) list.
+ *
+ * The interprets are sorted by keysym; interprets with the same keysym are
+ * kept in their keymap order. The XKB_KEY_NoSymbol interprets, which may
+ * match any level, therefore come first.
+ */
+struct interp_index {
+    const struct xkb_sym_interpret **interps;
+    unsigned int num_interps;
+    unsigned int num_catch_all;
+};
+
+static int
+cmp_interp_ptr(const void *a, const void *b)
+{
+    const struct xkb_sym_interpret *ia =
+        *(const struct xkb_sym_interpret * const *) a;
+    const struct xkb_sym_interpret *ib =
+        *(const struct xkb_sym_interpret * const *) b;
+
+    if (ia->sym != ib->sym)
+        return ia->sym < ib->sym ? -1 : 1;
+
+    /* Keep the original order, which is from most to least specific. */
+    return ia < ib ? -1 : ia > ib;
+}
+
+static bool
+InitInterpIndex(struct interp_index *idx, struct xkb_keymap *keymap)
+{
+    unsigned int i;
+
+    idx->num_interps = keymap->num_sym_interprets;
+    idx->num_catch_all = 0;
+    idx->interps = NULL;
+
+    if (idx->num_interps == 0)
+        return true;
+
+    idx->interps = calloc(idx->num_interps, sizeof(*idx->interps));
+    if (!idx->interps)
+        return false;
+
+    for (i = 0; i < idx->num_interps; i++)
+        idx->interps[i] = &keymap->sym_interprets[i];
+
+    qsort(idx->interps, idx->num_interps, sizeof(*idx->interps),
+          cmp_interp_ptr);
+
+    while (idx->num_catch_all < idx->num_interps &&
+           idx->interps[idx->num_catch_all]->sym == XKB_KEY_NoSymbol)
+        idx->num_catch_all++;
+
+    return true;
+}
+
+static void
+ClearInterpIndex(struct interp_index *idx)
+{
+    free(idx->interps);
+}
+
+/*
+ * Find the range [*first, *last) of the interprets for the given keysym.
+ * The range is empty if there are none.
+ */
+static void
+FindInterpRange(const struct interp_index *idx, xkb_keysym_t sym,
+                unsigned int *first, unsigned int *last)
+{
+    unsigned int lo = idx->num_catch_all, hi = idx->num_interps;
+
+    while (lo < hi) {
+        unsigned int mid = lo + (hi - lo) / 2;
+        if (idx->interps[mid]->sym < sym)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    *first = lo;
+    while (lo < idx->num_interps && idx->interps[lo]->sym == sym)
+        lo++;
+    *last = lo;
+}
+
+static bool
+InterpMatchesMods(const struct xkb_sym_interpret *interp, xkb_mod_mask_t mods)
+{
+    switch (interp->match) {
+    case MATCH_NONE:
+        return !(interp->mods & mods);
+    case MATCH_ANY_OR_NONE:
+        return (!mods || (interp->mods & mods));
+    case MATCH_ANY:
+        return !!(interp->mods & mods);
+    case MATCH_ALL:
+        return ((interp->mods & mods) == interp->mods);
+    case MATCH_EXACTLY:
+        return (interp->mods == mods);
+    }
+
+    return false;
+}
+
 /**
  * Find an interpretation which applies to this particular level, either by
  * finding an exact match for the symbol and modifier combination, or a
  * generic XKB_KEY_NoSymbol match.
  */
 static const struct xkb_sym_interpret *
-FindInterpForKey(struct xkb_keymap *keymap, const struct xkb_key *key,
-                 xkb_layout_index_t group, xkb_level_index_t level)
+FindInterpForKey(struct xkb_keymap *keymap, const struct interp_index *idx,
+                 const struct xkb_key *key, xkb_layout_index_t group,
+                 xkb_level_index_t level)
 {
     const xkb_keysym_t *syms;
     int num_syms;
+    unsigned int sym_i = 0, sym_last = 0, any_i = 0, tested = 0;
 
     num_syms = xkb_keymap_key_get_syms_by_level(keymap, key->keycode, group,
                                                 level, &syms);
     if (num_syms == 0)
         return NULL;
 
+    /* Only XKB_KEY_NoSymbol interprets apply to levels with several syms. */
+    if (num_syms == 1 && syms[0] != XKB_KEY_NoSymbol)
+        FindInterpRange(idx, syms[0], &sym_i, &sym_last);
+
     /*
      * There may be multiple matchings interprets; we should always return
      * the most specific. Here we rely on compat.c to set up the
      * sym_interprets array from the most specific to the least specific,
-     * such that when we find a match we return immediately.
+     * such that when we find a match we return immediately. The candidates
+     * for the keysym and the catch-all candidates are therefore walked
+     * together in keymap order.
      */
-    for (int i = 0; i < keymap->num_sym_interprets; i++) {
-        const struct xkb_sym_interpret *interp = &keymap->sym_interprets[i];
-
+    while (sym_i < sym_last || any_i < idx->num_catch_all) {
+        const struct xkb_sym_interpret *interp;
         xkb_mod_mask_t mods;
-        bool found = false;
 
-        if ((num_syms > 1 || interp->sym != syms[0]) &&
-            interp->sym != XKB_KEY_NoSymbol)
-            continue;
+        if (any_i >= idx->num_catch_all ||
+            (sym_i < sym_last &&
+             idx->interps[sym_i] < idx->interps[any_i]))
+            interp = idx->interps[sym_i++];
+        else
+            interp = idx->interps[any_i++];
 
         if (interp->level_one_only && level != 0)
             mods = 0;
         else
             mods = key->modmap;
 
-        switch (interp->match) {
-        case MATCH_NONE:
-            found = !(interp->mods & mods);
-            break;
-        case MATCH_ANY_OR_NONE:
-            found = (!mods || (interp->mods & mods));
-            break;
-        case MATCH_ANY:
-            found = !!(interp->mods & mods);
-            break;
-        case MATCH_ALL:
-            found = ((interp->mods & mods) == interp->mods);
-            break;
-        case MATCH_EXACTLY:
-            found = (interp->mods == mods);
-            break;
-        }
-
-        if (found)
+        tested++;
+        if (InterpMatchesMods(interp, mods)) {
+            xkb_context_stat_add(keymap->ctx, XKB_COMPILE_STAT_INTERPS_TESTED,
+                                 tested);
             return interp;
+        }
     }
 
+    xkb_context_stat_add(keymap->ctx, XKB_COMPILE_STAT_INTERPS_TESTED, tested);
     return &default_interpret;
 }
 
 static bool
-ApplyInterpsToKey(struct xkb_keymap *keymap, struct xkb_key *key)
+ApplyInterpsToKey(struct xkb_keymap *keymap, const struct interp_index *idx,
+                  struct xkb_key *key)
 {
     xkb_mod_mask_t vmodmap = 0;
     xkb_layout_index_t group;
@@ -147,7 +253,7 @@ ApplyInterpsToKey(struct xkb_keymap *keymap, struct xkb_key *key)
         for (level = 0; level < XkbKeyGroupWidth(key, group); level++) {
             const struct xkb_sym_interpret *interp;
 
-            interp = FindInterpForKey(keymap, key, group, level);
+            interp = FindInterpForKey(keymap, idx, key, group, level);
             if (!interp)
                 continue;
 
@@ -177,19 +283,28 @@ ApplyInterpsToKey(struct xkb_keymap *keymap, struct xkb_key *key)
  * your actions and types are a lot more useful when any of your modifiers
  * other than Shift actually do something ...
  */
-static bool
+bool
 UpdateDerivedKeymapFields(struct xkb_keymap *keymap)
 {
     struct xkb_mod *mod;
     struct xkb_led *led;
     unsigned int i, j;
     struct xkb_key *key;
+    struct interp_index idx;
+
+    if (!InitInterpIndex(&idx, keymap))
+        return false;
 
     /* Find all the interprets for the key and bind them to actions,
      * which will also update the vmodmap. */
-    xkb_foreach_key(key, keymap)
-        if (!ApplyInterpsToKey(keymap, key))
+    xkb_foreach_key(key, keymap) {
+        if (!ApplyInterpsToKey(keymap, &idx, key)) {
+            ClearInterpIndex(&idx);
             return false;
+        }
+    }
+
+    ClearInterpIndex(&idx);
 
     /* Update keymap->mods, the virtual -> real mod mapping. */
     xkb_foreach_key(key, keymap)
@@ -236,6 +351,13 @@ static const compile_file_fn compile_file_fns[LAST_KEYMAP_FILE_TYPE + 1] = {
     [FILE_TYPE_SYMBOLS] = CompileSymbols,
 };
 
+static const enum xkb_compile_stat compile_file_stats[LAST_KEYMAP_FILE_TYPE + 1] = {
+    [FILE_TYPE_KEYCODES] = XKB_COMPILE_STAT_TIME_KEYCODES,
+    [FILE_TYPE_TYPES] = XKB_COMPILE_STAT_TIME_TYPES,
+    [FILE_TYPE_COMPAT] = XKB_COMPILE_STAT_TIME_COMPAT,
+    [FILE_TYPE_SYMBOLS] = XKB_COMPILE_STAT_TIME_SYMBOLS,
+};
+
 bool
 CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
 {
@@ -244,6 +366,8 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
     XkbFile *files[LAST_KEYMAP_FILE_TYPE + 1] = { NULL };
     enum xkb_file_type type;
     struct xkb_context *ctx = keymap->ctx;
+    struct include_prefetch *prefetch = NULL;
+    uint64_t start;
 
     main_name = file->name ? file->name : "(unnamed)";
 
@@ -290,6 +414,14 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
     if (!ok)
         return false;
 
+    /*
+     * The sections must be compiled in order, since e.g. the virtual
+     * modifiers declared by one are used by the next, but the files they
+     * include can be parsed ahead of time.
+     */
+    if (keymap->flags & XKB_MAP_COMPILE_PARALLEL)
+        prefetch = include_prefetch_start(ctx, files, ARRAY_SIZE(files));
+
     /* Compile sections. */
     for (type = FIRST_KEYMAP_FILE_TYPE;
          type <= LAST_KEYMAP_FILE_TYPE;
@@ -297,13 +429,22 @@ CompileKeymap(XkbFile *file, struct xkb_keymap *keymap, enum merge_mode merge)
         log_dbg(ctx, "Compiling %s \"%s\"\n",
                 xkb_file_type_to_string(type), files[type]->topName);
 
+        start = xkb_context_stat_timer_start(ctx);
         ok = compile_file_fns[type](files[type], keymap, merge);
+        xkb_context_stat_timer_stop(ctx, compile_file_stats[type], start);
         if (!ok) {
             log_err(ctx, "Failed to compile %s\n",
                     xkb_file_type_to_string(type));
-            return false;
+            break;
         }
     }
 
-    return UpdateDerivedKeymapFields(keymap);
+    include_prefetch_finish(prefetch);
+    if (!ok)
+        return false;
+
+    start = xkb_context_stat_timer_start(ctx);
+    ok = UpdateDerivedKeymapFields(keymap);
+    xkb_context_stat_timer_stop(ctx, XKB_COMPILE_STAT_TIME_DERIVED, start);
+    return ok;
 }
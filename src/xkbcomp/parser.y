@@ -134,6 +134,7 @@ _xkbcommon_error(struct YYLTYPE *loc, struct parser_param *param, const char *ms
         enum merge_mode merge;
         enum xkb_map_flags mapFlags;
         ParseCommon     *any;
+        struct { ParseCommon *head; ParseCommon *last; } anyList;
         ExprDef         *expr;
         VarDef          *var;
         VModDef         *vmod;
@@ -161,7 +162,8 @@ _xkbcommon_error(struct YYLTYPE *loc, struct parser_param *param, const char *ms
 %type <mapFlags> Flag Flags OptFlags
 %type <str>     MapName OptMapName KeySym
 %type <sval>    FieldSpec Ident Element String
-%type <any>     DeclList Decl
+%type <any>     Decl
+%type <anyList> DeclList
 %type <expr>    OptExprList ExprList Expr Term Lhs Terminal ArrayInit KeySyms
 %type <expr>    OptKeySymList KeySymList Action ActionList Coord CoordList
 %type <var>     VarDecl VarDeclList SymbolsBody SymbolsVarDecl
@@ -231,11 +233,11 @@ XkbMapConfig    :       OptFlags FileType OptMapName OBRACE
                         {
                             if ($2 == FILE_TYPE_GEOMETRY) {
                                 free($3);
-                                FreeStmt($5);
+                                FreeStmt($5.head);
                                 $$ = NULL;
                             }
                             else {
-                                $$ = XkbFileCreate(param->ctx, $2, $3, $5, $1);
+                                $$ = XkbFileCreate(param->ctx, $2, $3, $5.head, $1);
                             }
                         }
                 ;
@@ -265,9 +267,24 @@ Flag            :       PARTIAL                 { $$ = MAP_IS_PARTIAL; }
                 |       ALTERNATE_GROUP         { $$ = MAP_IS_ALTGR; }
                 ;
 
+/*
+ * The declarations of a section can number in the thousands, so keep a
+ * pointer to the last one instead of walking the list to append. A Decl
+ * may itself be a list, e.g. of virtual modifiers.
+ */
 DeclList        :       DeclList Decl
-                        { $$ = AppendStmt($1, $2); }
-                |       { $$ = NULL; }
+                        {
+                            $$ = $1;
+                            if ($2) {
+                                if ($$.last)
+                                    $$.last->next = $2;
+                                else
+                                    $$.head = $2;
+                                for ($$.last = $2; $$.last->next;
+                                     $$.last = $$.last->next);
+                            }
+                        }
+                |       { $$.head = $$.last = NULL; }
                 ;
 
 Decl            :       OptMergeMode VarDecl
@@ -773,6 +790,10 @@ parse(struct xkb_context *ctx, void *scanner, const char *map)
      */
 
     while ((ret = yyparse(&param)) == 0 && param.more_maps) {
+        if (xkb_context_collects_stats(ctx))
+            xkb_context_stat_add(ctx, XKB_COMPILE_STAT_AST_NODES,
+                                 XkbFileCountNodes(param.rtrn));
+
         if (map) {
             if (streq_not_null(map, param.rtrn->name))
                 return param.rtrn;
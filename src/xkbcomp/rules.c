@@ -47,7 +47,12 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "xkbcomp-priv.h"
+#include "hashmap.h"
 #include "rules.h"
 #include "include.h"
 #include "scanner-utils.h"
@@ -283,11 +288,6 @@ struct rule_names {
     darray_sval options;
 };
 
-struct group {
-    struct sval name;
-    darray_sval elements;
-};
-
 struct mapping {
     int mlvo_at_pos[_MLVO_NUM_ENTRIES];
     unsigned int num_mlvo;
@@ -315,132 +315,407 @@ struct rule {
 };
 
 /*
- * This is the main object used to match a given RMLVO against a rules
- * file and aggragate the results in a KcCGST. It goes through a simple
- * matching state machine, with tokens as transitions (see
- * matcher_match()).
+ * Precompiled rules
+ * =================
+ * A rules file is parsed once into a struct rules, which does not
+ * depend on the RMLVO being resolved, and is kept in the context for
+ * later compilations (see the cache below). Everything in it is stored
+ * in flat arrays, and refers to other items by index, and to strings by
+ * offset into a string pool.
+ *
+ * The rules of each rule set are indexed on the values of one of the
+ * MLVO columns - the one with the most literal (non-wildcard, non-group)
+ * values. The index maps the hash of a literal value to the list of
+ * rules with that value in the column; the rules with other values in
+ * the column are listed separately. To resolve an RMLVO, only the rules
+ * listed for the given value, and the other rules, need to be tried.
  */
-struct matcher {
+
+#define NO_GROUP UINT32_MAX
+
+/* A string in the string pool. */
+struct rules_str {
+    uint32_t offset;
+    uint32_t len;
+};
+
+struct rules_group {
+    struct rules_str name;
+    uint32_t first_element;
+    uint32_t num_elements;
+    /* Hash set of the elements; the values are element indexes. */
+    uint32_t first_slot;
+    uint32_t num_slots;
+    /* Whether distinct elements have the same hash; see match_group(). */
+    bool collisions;
+};
+
+struct rules_rule {
+    struct rules_str mlvo_values[_MLVO_NUM_ENTRIES];
+    /* enum mlvo_match_type. */
+    uint8_t match_types[_MLVO_NUM_ENTRIES];
+    /* For MLVO_MATCH_GROUP values, the group, or NO_GROUP if undeclared. */
+    uint32_t groups[_MLVO_NUM_ENTRIES];
+    struct rules_str kccgst_values[_KCCGST_NUM_ENTRIES];
+    /* Location of the last value, for error messages. */
+    struct location loc;
+};
+
+struct rules_ruleset {
+    struct mapping mapping;
+    uint32_t first_rule;
+    uint32_t num_rules;
+    /* The indexed MLVO position, or -1 if the rule set is not indexed. */
+    int indexed_pos;
+    /* The hash table; the values are offsets into the postings. */
+    uint32_t first_slot;
+    uint32_t num_slots;
+    /* Offset into the postings of the rules which are not in the table. */
+    uint32_t others;
+};
+
+/*
+ * The postings are lists of rule indexes, each preceded by its length,
+ * in ascending order.
+ */
+struct rules {
+    const char *strings;
+    uint32_t strings_size;
+    const struct rules_group *groups;
+    uint32_t num_groups;
+    const struct rules_str *elements;
+    uint32_t num_elements;
+    const struct rules_ruleset *rulesets;
+    uint32_t num_rulesets;
+    const struct rules_rule *rules;
+    uint32_t num_rules;
+    const struct hashmap_entry *slots;
+    uint32_t num_slots;
+    const uint32_t *postings;
+    uint32_t num_postings;
+    /*
+     * If the rules were loaded from a precompiled rules file, its
+     * mapping, which the arrays point into.
+     */
+    const char *map;
+    size_t map_size;
+};
+
+static struct sval
+rules_sval(const struct rules *rules, struct rules_str str)
+{
+    struct sval val = { rules->strings + str.offset, str.len };
+    return val;
+}
+
+/* FNV-1a. */
+static uint32_t
+hash_sval(struct sval val)
+{
+    uint32_t hash = 2166136261u;
+    unsigned int i;
+
+    for (i = 0; i < val.len; i++) {
+        hash ^= (unsigned char) val.start[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+static void
+rules_free(struct rules *rules)
+{
+    if (!rules)
+        return;
+    if (rules->map) {
+        unmap_file(rules->map, rules->map_size);
+        free(rules);
+        return;
+    }
+    free(UNCONSTIFY(rules->strings));
+    free(UNCONSTIFY(rules->groups));
+    free(UNCONSTIFY(rules->elements));
+    free(UNCONSTIFY(rules->rulesets));
+    free(UNCONSTIFY(rules->rules));
+    free(UNCONSTIFY(rules->slots));
+    free(UNCONSTIFY(rules->postings));
+    free(rules);
+}
+
+/***====================================================================***/
+
+/*
+ * This is the object used to parse a rules file into a struct rules. It
+ * goes through a simple parsing state machine, with tokens as
+ * transitions (see parser_parse()).
+ */
+struct parser {
     struct xkb_context *ctx;
     /* Input.*/
-    struct rule_names rmlvo;
     struct location loc;
     union lvalue val;
     struct scanner scanner;
-    darray(struct group) groups;
     /* Current mapping. */
     struct mapping mapping;
     /* Current rule. */
     struct rule rule;
+    /* Whether the rules which follow go into the last rule set. */
+    bool in_ruleset;
     /* Output. */
-    darray_char kccgst[_KCCGST_NUM_ENTRIES];
+    darray_char strings;
+    struct hashmap strings_by_hash;
+    darray(struct rules_group) groups;
+    darray(struct rules_str) elements;
+    darray(struct rules_ruleset) rulesets;
+    darray(struct rules_rule) rules;
+    darray(struct hashmap_entry) slots;
+    darray(uint32_t) postings;
 };
 
-static struct sval
-strip_spaces(struct sval v)
+/* C99 is stupid. Just use the 1 variant when there are no args. */
+#define parser_error1(parser, msg) \
+    log_warn(parser->ctx, "rules/%s:%d:%d: " msg "\n", \
+             parser->scanner.file_name, parser->loc.line, \
+             parser->loc.column)
+#define parser_error(parser, fmt, ...) \
+    log_warn(parser->ctx, "rules/%s:%d:%d: " fmt "\n", \
+             parser->scanner.file_name, parser->loc.line, \
+             parser->loc.column, __VA_ARGS__)
+
+static void
+parser_init(struct parser *p, struct xkb_context *ctx)
 {
-    while (v.len > 0 && isspace(v.start[0])) { v.len--; v.start++; }
-    while (v.len > 0 && isspace(v.start[v.len - 1])) v.len--;
-    return v;
+    memset(p, 0, sizeof(*p));
+    p->ctx = ctx;
+    hashmap_init(&p->strings_by_hash);
 }
 
-static darray_sval
-split_comma_separated_string(const char *s)
+static void
+parser_clear(struct parser *p)
 {
-    darray_sval arr = darray_new();
-    struct sval val = { NULL, 0 };
-
-    /*
-     * Make sure the array returned by this function always includes at
-     * least one value, e.g. "" -> { "" } and "," -> { "", "" }.
-     */
-
-    if (!s) {
-        darray_append(arr, val);
-        return arr;
-    }
+    darray_free(p->strings);
+    hashmap_free(&p->strings_by_hash);
+    darray_free(p->groups);
+    darray_free(p->elements);
+    darray_free(p->rulesets);
+    darray_free(p->rules);
+    darray_free(p->slots);
+    darray_free(p->postings);
+}
 
-    while (true) {
-        val.start = s; val.len = 0;
-        while (*s != '\0' && *s != ',') { s++; val.len++; }
-        darray_append(arr, strip_spaces(val));
-        if (*s == '\0') break;
-        if (*s == ',') s++;
+/* Adds @val to the string pool, if it is not already there. */
+static struct rules_str
+parser_intern(struct parser *p, struct sval val)
+{
+    struct rules_str str;
+    uint32_t hash = hash_sval(val), offset;
+
+    if (hashmap_lookup(&p->strings_by_hash, hash, &offset) &&
+        strncmp(darray_mem(p->strings, offset), val.start, val.len) == 0 &&
+        darray_item(p->strings, offset + val.len) == '\0') {
+        str.offset = offset;
+        str.len = val.len;
+        return str;
     }
 
-    return arr;
+    str.offset = darray_size(p->strings);
+    str.len = val.len;
+    darray_append_items(p->strings, val.start, val.len);
+    darray_append(p->strings, '\0');
+    hashmap_insert(&p->strings_by_hash, hash, str.offset);
+    return str;
 }
 
-static struct matcher *
-matcher_new(struct xkb_context *ctx,
-            const struct xkb_rule_names *rmlvo)
+static struct sval
+parser_sval(struct parser *p, struct rules_str str)
 {
-    struct matcher *m = calloc(1, sizeof(*m));
-    if (!m)
-        return NULL;
+    struct sval val = { darray_mem(p->strings, str.offset), str.len };
+    return val;
+}
 
-    m->ctx = ctx;
-    m->rmlvo.model.start = rmlvo->model;
-    m->rmlvo.model.len = rmlvo->model ? strlen(rmlvo->model) : 0;
-    m->rmlvo.layouts = split_comma_separated_string(rmlvo->layout);
-    m->rmlvo.variants = split_comma_separated_string(rmlvo->variant);
-    m->rmlvo.options = split_comma_separated_string(rmlvo->options);
+static void
+parser_group_start_new(struct parser *p, struct sval name)
+{
+    struct rules_group group;
 
-    return m;
+    memset(&group, 0, sizeof(group));
+    group.name = parser_intern(p, name);
+    group.first_element = darray_size(p->elements);
+    darray_append(p->groups, group);
 }
 
 static void
-matcher_free(struct matcher *m)
+parser_group_add_element(struct parser *p, struct sval element)
 {
-    struct group *group;
-    if (!m)
-        return;
-    darray_free(m->rmlvo.layouts);
-    darray_free(m->rmlvo.variants);
-    darray_free(m->rmlvo.options);
-    darray_foreach(group, m->groups)
-        darray_free(group->elements);
-    darray_free(m->groups);
-    free(m);
-}
+    struct rules_str str = parser_intern(p, element);
 
-/* C99 is stupid. Just use the 1 variant when there are no args. */
-#define matcher_error1(matcher, msg) \
-    log_warn(matcher->ctx, "rules/%s:%d:%d: " msg "\n", \
-             matcher->scanner.file_name, matcher->loc.line, \
-             matcher->loc.column)
-#define matcher_error(matcher, fmt, ...) \
-    log_warn(matcher->ctx, "rules/%s:%d:%d: " fmt "\n", \
-             matcher->scanner.file_name, matcher->loc.line, \
-             matcher->loc.column, __VA_ARGS__)
+    darray_append(p->elements, str);
+    darray_item(p->groups, darray_size(p->groups) - 1).num_elements++;
+}
 
+/*
+ * Builds the hash set of the elements of the last group. Called when it
+ * is complete.
+ */
 static void
-matcher_group_start_new(struct matcher *m, struct sval name)
+parser_group_finish(struct parser *p)
 {
-    struct group group = { .name = name, .elements = darray_new() };
-    darray_append(m->groups, group);
+    struct rules_group *group;
+    struct hashmap set;
+    uint32_t i, found;
+    struct sval element;
+
+    group = &darray_item(p->groups, darray_size(p->groups) - 1);
+
+    hashmap_init(&set);
+    for (i = group->first_element;
+         i < group->first_element + group->num_elements;
+         i++) {
+        uint32_t hash;
+
+        element = parser_sval(p, darray_item(p->elements, i));
+        hash = hash_sval(element);
+
+        if (hashmap_lookup(&set, hash, &found)) {
+            if (!svaleq(element,
+                        parser_sval(p, darray_item(p->elements, found))))
+                group->collisions = true;
+            continue;
+        }
+
+        hashmap_insert(&set, hash, i);
+    }
+
+    group->first_slot = darray_size(p->slots);
+    group->num_slots = set.alloc;
+    if (set.alloc > 0)
+        darray_append_items(p->slots, set.entries, set.alloc);
+    hashmap_free(&set);
 }
 
+/*
+ * Builds the index of the last rule set. Called when it is complete.
+ */
 static void
-matcher_group_add_element(struct matcher *m, struct sval element)
+parser_ruleset_finish(struct parser *p)
 {
-    darray_append(darray_item(m->groups, darray_size(m->groups) - 1).elements,
-                  element);
+    struct rules_ruleset *rs;
+    const struct rules_rule *rule;
+    unsigned int num_literal[_MLVO_NUM_ENTRIES] = { 0 };
+    unsigned int i, best;
+    uint32_t r, end, bucket, next_other;
+    struct hashmap map;
+    /* For each distinct value, the offset of its list in the postings. */
+    darray(uint32_t) lists = darray_new();
+    /* And the next free position in the list. */
+    darray(uint32_t) fill = darray_new();
+
+    if (!p->in_ruleset)
+        return;
+    p->in_ruleset = false;
+
+    rs = &darray_item(p->rulesets, darray_size(p->rulesets) - 1);
+    end = rs->first_rule + rs->num_rules;
+
+    for (r = rs->first_rule; r < end; r++) {
+        rule = &darray_item(p->rules, r);
+        for (i = 0; i < rs->mapping.num_mlvo; i++)
+            if (rule->match_types[i] == MLVO_MATCH_NORMAL)
+                num_literal[i]++;
+    }
+
+    best = 0;
+    for (i = 1; i < rs->mapping.num_mlvo; i++)
+        if (num_literal[i] > num_literal[best])
+            best = i;
+
+    if (num_literal[best] == 0)
+        return;
+
+    rs->indexed_pos = best;
+
+    /* Count the rules with each distinct value. */
+    hashmap_init(&map);
+    for (r = rs->first_rule; r < end; r++) {
+        uint32_t hash;
+
+        rule = &darray_item(p->rules, r);
+        if (rule->match_types[best] != MLVO_MATCH_NORMAL)
+            continue;
+
+        hash = hash_sval(parser_sval(p, rule->mlvo_values[best]));
+        if (!hashmap_lookup(&map, hash, &bucket)) {
+            bucket = darray_size(fill);
+            hashmap_insert(&map, hash, bucket);
+            darray_append(fill, 0);
+        }
+        darray_item(fill, bucket)++;
+    }
+
+    /* Lay out the lists. */
+    rs->others = darray_size(p->postings);
+    darray_append(p->postings, rs->num_rules - num_literal[best]);
+    darray_resize0(p->postings,
+                   darray_size(p->postings) + rs->num_rules - num_literal[best]);
+    next_other = rs->others + 1;
+
+    darray_resize(lists, darray_size(fill));
+    for (bucket = 0; bucket < darray_size(fill); bucket++) {
+        uint32_t count = darray_item(fill, bucket);
+
+        darray_item(lists, bucket) = darray_size(p->postings);
+        darray_item(fill, bucket) = darray_size(p->postings) + 1;
+        darray_append(p->postings, count);
+        darray_resize0(p->postings, darray_size(p->postings) + count);
+    }
+
+    /* Fill them, in rule order. */
+    for (r = rs->first_rule; r < end; r++) {
+        rule = &darray_item(p->rules, r);
+
+        if (rule->match_types[best] != MLVO_MATCH_NORMAL) {
+            darray_item(p->postings, next_other++) = r;
+            continue;
+        }
+
+        hashmap_lookup(&map,
+                       hash_sval(parser_sval(p, rule->mlvo_values[best])),
+                       &bucket);
+        darray_item(p->postings, darray_item(fill, bucket)++) = r;
+    }
+
+    /* The table maps the values to their lists. */
+    for (i = 0; i < map.alloc; i++)
+        if (map.entries[i].value1 != 0)
+            map.entries[i].value1 =
+                darray_item(lists, map.entries[i].value1 - 1) + 1;
+
+    rs->first_slot = darray_size(p->slots);
+    rs->num_slots = map.alloc;
+    darray_append_items(p->slots, map.entries, map.alloc);
+
+    hashmap_free(&map);
+    darray_free(lists);
+    darray_free(fill);
 }
 
 static void
-matcher_mapping_start_new(struct matcher *m)
+parser_mapping_start_new(struct parser *p)
 {
     unsigned int i;
+
+    parser_ruleset_finish(p);
+
     for (i = 0; i < _MLVO_NUM_ENTRIES; i++)
-        m->mapping.mlvo_at_pos[i] = -1;
+        p->mapping.mlvo_at_pos[i] = -1;
     for (i = 0; i < _KCCGST_NUM_ENTRIES; i++)
-        m->mapping.kccgst_at_pos[i] = -1;
-    m->mapping.layout_idx = m->mapping.variant_idx = XKB_LAYOUT_INVALID;
-    m->mapping.num_mlvo = m->mapping.num_kccgst = 0;
-    m->mapping.defined_mlvo_mask = 0;
-    m->mapping.defined_kccgst_mask = 0;
-    m->mapping.skip = false;
+        p->mapping.kccgst_at_pos[i] = -1;
+    p->mapping.layout_idx = p->mapping.variant_idx = XKB_LAYOUT_INVALID;
+    p->mapping.num_mlvo = p->mapping.num_kccgst = 0;
+    p->mapping.defined_mlvo_mask = 0;
+    p->mapping.defined_kccgst_mask = 0;
+    p->mapping.skip = false;
 }
 
 static int
@@ -460,7 +735,7 @@ extract_layout_index(const char *s, size_t max_len, xkb_layout_index_t *out)
 }
 
 static void
-matcher_mapping_set_mlvo(struct matcher *m, struct sval ident)
+parser_mapping_set_mlvo(struct parser *p, struct sval ident)
 {
     enum rules_mlvo mlvo;
     struct sval mlvo_sval;
@@ -476,20 +751,20 @@ matcher_mapping_set_mlvo(struct matcher *m, struct sval ident)
 
     /* Not found. */
     if (mlvo >= _MLVO_NUM_ENTRIES) {
-        matcher_error(m,
-                      "invalid mapping: %.*s is not a valid value here; "
-                      "ignoring rule set",
-                      ident.len, ident.start);
-        m->mapping.skip = true;
+        parser_error(p,
+                     "invalid mapping: %.*s is not a valid value here; "
+                     "ignoring rule set",
+                     ident.len, ident.start);
+        p->mapping.skip = true;
         return;
     }
 
-    if (m->mapping.defined_mlvo_mask & (1 << mlvo)) {
-        matcher_error(m,
-                      "invalid mapping: %.*s appears twice on the same line; "
-                      "ignoring rule set",
-                      mlvo_sval.len, mlvo_sval.start);
-        m->mapping.skip = true;
+    if (p->mapping.defined_mlvo_mask & (1 << mlvo)) {
+        parser_error(p,
+                     "invalid mapping: %.*s appears twice on the same line; "
+                     "ignoring rule set",
+                     mlvo_sval.len, mlvo_sval.start);
+        p->mapping.skip = true;
         return;
     }
 
@@ -498,37 +773,37 @@ matcher_mapping_set_mlvo(struct matcher *m, struct sval ident)
         consumed = extract_layout_index(ident.start + mlvo_sval.len,
                                        ident.len - mlvo_sval.len, &idx);
         if ((int) (ident.len - mlvo_sval.len) != consumed) {
-            matcher_error(m,
-                          "invalid mapping:\" %.*s\" may only be followed by a valid group index; "
-                          "ignoring rule set",
-                          mlvo_sval.len, mlvo_sval.start);
-            m->mapping.skip = true;
+            parser_error(p,
+                         "invalid mapping:\" %.*s\" may only be followed by a valid group index; "
+                         "ignoring rule set",
+                         mlvo_sval.len, mlvo_sval.start);
+            p->mapping.skip = true;
             return;
         }
 
         if (mlvo == MLVO_LAYOUT) {
-            m->mapping.layout_idx = idx;
+            p->mapping.layout_idx = idx;
         }
         else if (mlvo == MLVO_VARIANT) {
-            m->mapping.variant_idx = idx;
+            p->mapping.variant_idx = idx;
         }
         else {
-            matcher_error(m,
-                          "invalid mapping: \"%.*s\" cannot be followed by a group index; "
-                          "ignoring rule set",
-                          mlvo_sval.len, mlvo_sval.start);
-            m->mapping.skip = true;
+            parser_error(p,
+                         "invalid mapping: \"%.*s\" cannot be followed by a group index; "
+                         "ignoring rule set",
+                         mlvo_sval.len, mlvo_sval.start);
+            p->mapping.skip = true;
             return;
         }
     }
 
-    m->mapping.mlvo_at_pos[m->mapping.num_mlvo] = mlvo;
-    m->mapping.defined_mlvo_mask |= 1 << mlvo;
-    m->mapping.num_mlvo++;
+    p->mapping.mlvo_at_pos[p->mapping.num_mlvo] = mlvo;
+    p->mapping.defined_mlvo_mask |= 1 << mlvo;
+    p->mapping.num_mlvo++;
 }
 
 static void
-matcher_mapping_set_kccgst(struct matcher *m, struct sval ident)
+parser_mapping_set_kccgst(struct parser *p, struct sval ident)
 {
     enum rules_kccgst kccgst;
     struct sval kccgst_sval;
@@ -542,423 +817,224 @@ matcher_mapping_set_kccgst(struct matcher *m, struct sval ident)
 
     /* Not found. */
     if (kccgst >= _KCCGST_NUM_ENTRIES) {
-        matcher_error(m,
-                      "invalid mapping: %.*s is not a valid value here; "
-                      "ignoring rule set",
-                      ident.len, ident.start);
-        m->mapping.skip = true;
+        parser_error(p,
+                     "invalid mapping: %.*s is not a valid value here; "
+                     "ignoring rule set",
+                     ident.len, ident.start);
+        p->mapping.skip = true;
         return;
     }
 
-    if (m->mapping.defined_kccgst_mask & (1 << kccgst)) {
-        matcher_error(m,
-                      "invalid mapping: %.*s appears twice on the same line; "
-                      "ignoring rule set",
-                      kccgst_sval.len, kccgst_sval.start);
-        m->mapping.skip = true;
+    if (p->mapping.defined_kccgst_mask & (1 << kccgst)) {
+        parser_error(p,
+                     "invalid mapping: %.*s appears twice on the same line; "
+                     "ignoring rule set",
+                     kccgst_sval.len, kccgst_sval.start);
+        p->mapping.skip = true;
         return;
     }
 
-    m->mapping.kccgst_at_pos[m->mapping.num_kccgst] = kccgst;
-    m->mapping.defined_kccgst_mask |= 1 << kccgst;
-    m->mapping.num_kccgst++;
+    p->mapping.kccgst_at_pos[p->mapping.num_kccgst] = kccgst;
+    p->mapping.defined_kccgst_mask |= 1 << kccgst;
+    p->mapping.num_kccgst++;
 }
 
+/*
+ * Checks the mapping line, and starts its rule set. Whether the rule set
+ * applies to a given RMLVO is checked when matching.
+ */
 static void
-matcher_mapping_verify(struct matcher *m)
+parser_mapping_verify(struct parser *p)
 {
-    if (m->mapping.num_mlvo == 0) {
-        matcher_error1(m,
-                       "invalid mapping: must have at least one value on the left hand side; "
-                       "ignoring rule set");
-        goto skip;
-    }
+    struct rules_ruleset rs;
 
-    if (m->mapping.num_kccgst == 0) {
-        matcher_error1(m,
-                       "invalid mapping: must have at least one value on the right hand side; "
-                       "ignoring rule set");
+    if (p->mapping.num_mlvo == 0) {
+        parser_error1(p,
+                      "invalid mapping: must have at least one value on the left hand side; "
+                      "ignoring rule set");
         goto skip;
     }
 
-    /*
-     * This following is very stupid, but this is how it works.
-     * See the "Notes" section in the overview above.
-     */
-
-    if (m->mapping.defined_mlvo_mask & (1 << MLVO_LAYOUT)) {
-        if (m->mapping.layout_idx == XKB_LAYOUT_INVALID) {
-            if (darray_size(m->rmlvo.layouts) > 1)
-                goto skip;
-        }
-        else {
-            if (darray_size(m->rmlvo.layouts) == 1 ||
-                m->mapping.layout_idx >= darray_size(m->rmlvo.layouts))
-                goto skip;
-        }
-    }
-
-    if (m->mapping.defined_mlvo_mask & (1 << MLVO_VARIANT)) {
-        if (m->mapping.variant_idx == XKB_LAYOUT_INVALID) {
-            if (darray_size(m->rmlvo.variants) > 1)
-                goto skip;
-        }
-        else {
-            if (darray_size(m->rmlvo.variants) == 1 ||
-                m->mapping.variant_idx >= darray_size(m->rmlvo.variants))
-                goto skip;
-        }
+    if (p->mapping.num_kccgst == 0) {
+        parser_error1(p,
+                      "invalid mapping: must have at least one value on the right hand side; "
+                      "ignoring rule set");
+        goto skip;
     }
 
+    memset(&rs, 0, sizeof(rs));
+    rs.mapping = p->mapping;
+    rs.first_rule = darray_size(p->rules);
+    rs.indexed_pos = -1;
+    darray_append(p->rulesets, rs);
+    p->in_ruleset = true;
     return;
 
 skip:
-    m->mapping.skip = true;
+    p->mapping.skip = true;
 }
 
 static void
-matcher_rule_start_new(struct matcher *m)
+parser_rule_start_new(struct parser *p)
 {
-    memset(&m->rule, 0, sizeof(m->rule));
-    m->rule.skip = m->mapping.skip;
+    memset(&p->rule, 0, sizeof(p->rule));
+    p->rule.skip = p->mapping.skip;
 }
 
 static void
-matcher_rule_set_mlvo_common(struct matcher *m, struct sval ident,
-                             enum mlvo_match_type match_type)
-{
-    if (m->rule.num_mlvo_values + 1 > m->mapping.num_mlvo) {
-        matcher_error1(m,
-                       "invalid rule: has more values than the mapping line; "
-                       "ignoring rule");
-        m->rule.skip = true;
+parser_rule_set_mlvo_common(struct parser *p, struct sval ident,
+                            enum mlvo_match_type match_type)
+{
+    if (p->rule.num_mlvo_values + 1 > p->mapping.num_mlvo) {
+        parser_error1(p,
+                      "invalid rule: has more values than the mapping line; "
+                      "ignoring rule");
+        p->rule.skip = true;
         return;
     }
-    m->rule.match_type_at_pos[m->rule.num_mlvo_values] = match_type;
-    m->rule.mlvo_value_at_pos[m->rule.num_mlvo_values] = ident;
-    m->rule.num_mlvo_values++;
+    p->rule.match_type_at_pos[p->rule.num_mlvo_values] = match_type;
+    p->rule.mlvo_value_at_pos[p->rule.num_mlvo_values] = ident;
+    p->rule.num_mlvo_values++;
 }
 
 static void
-matcher_rule_set_mlvo_wildcard(struct matcher *m)
+parser_rule_set_mlvo_wildcard(struct parser *p)
 {
     struct sval dummy = { NULL, 0 };
-    matcher_rule_set_mlvo_common(m, dummy, MLVO_MATCH_WILDCARD);
+    parser_rule_set_mlvo_common(p, dummy, MLVO_MATCH_WILDCARD);
 }
 
 static void
-matcher_rule_set_mlvo_group(struct matcher *m, struct sval ident)
+parser_rule_set_mlvo_group(struct parser *p, struct sval ident)
 {
-    matcher_rule_set_mlvo_common(m, ident, MLVO_MATCH_GROUP);
+    parser_rule_set_mlvo_common(p, ident, MLVO_MATCH_GROUP);
 }
 
 static void
-matcher_rule_set_mlvo(struct matcher *m, struct sval ident)
+parser_rule_set_mlvo(struct parser *p, struct sval ident)
 {
-    matcher_rule_set_mlvo_common(m, ident, MLVO_MATCH_NORMAL);
+    parser_rule_set_mlvo_common(p, ident, MLVO_MATCH_NORMAL);
 }
 
 static void
-matcher_rule_set_kccgst(struct matcher *m, struct sval ident)
+parser_rule_set_kccgst(struct parser *p, struct sval ident)
 {
-    if (m->rule.num_kccgst_values + 1 > m->mapping.num_kccgst) {
-        matcher_error1(m,
-                       "invalid rule: has more values than the mapping line; "
-                       "ignoring rule");
-        m->rule.skip = true;
+    if (p->rule.num_kccgst_values + 1 > p->mapping.num_kccgst) {
+        parser_error1(p,
+                      "invalid rule: has more values than the mapping line; "
+                      "ignoring rule");
+        p->rule.skip = true;
         return;
     }
-    m->rule.kccgst_value_at_pos[m->rule.num_kccgst_values] = ident;
-    m->rule.num_kccgst_values++;
+    p->rule.kccgst_value_at_pos[p->rule.num_kccgst_values] = ident;
+    p->rule.num_kccgst_values++;
 }
 
-static bool
-match_group(struct matcher *m, struct sval group_name, struct sval to)
+static void
+parser_rule_verify(struct parser *p)
 {
-    struct group *group;
-    struct sval *element;
-    bool found = false;
-
-    darray_foreach(group, m->groups) {
-        if (svaleq(group->name, group_name)) {
-            found = true;
-            break;
-        }
+    if (p->rule.num_mlvo_values != p->mapping.num_mlvo ||
+        p->rule.num_kccgst_values != p->mapping.num_kccgst) {
+        parser_error1(p,
+                      "invalid rule: must have same number of values as mapping line;"
+                      "ignoring rule");
+        p->rule.skip = true;
     }
+}
 
-    if (!found) {
-        /*
-         * rules/evdev intentionally uses some undeclared group names
-         * in rules (e.g. commented group definitions which may be
-         * uncommented if needed). So we continue silently.
-         */
-        return false;
+/*
+ * Groups are looked up when the rule is parsed, so only the groups
+ * defined before the rule are seen; the first definition wins.
+ */
+static uint32_t
+parser_find_group(struct parser *p, struct sval name)
+{
+    uint32_t i;
+
+    for (i = 0; i < darray_size(p->groups); i++)
+        if (svaleq(parser_sval(p, darray_item(p->groups, i).name), name))
+            return i;
+
+    /*
+     * rules/evdev intentionally uses some undeclared group names
+     * in rules (e.g. commented group definitions which may be
+     * uncommented if needed). So we continue silently.
+     */
+    return NO_GROUP;
+}
+
+static void
+parser_rule_add(struct parser *p)
+{
+    struct rules_rule rule;
+    unsigned int i;
+
+    memset(&rule, 0, sizeof(rule));
+    for (i = 0; i < _MLVO_NUM_ENTRIES; i++)
+        rule.groups[i] = NO_GROUP;
+
+    for (i = 0; i < p->rule.num_mlvo_values; i++) {
+        rule.match_types[i] = p->rule.match_type_at_pos[i];
+        if (p->rule.match_type_at_pos[i] == MLVO_MATCH_WILDCARD)
+            continue;
+        rule.mlvo_values[i] = parser_intern(p, p->rule.mlvo_value_at_pos[i]);
+        if (p->rule.match_type_at_pos[i] == MLVO_MATCH_GROUP)
+            rule.groups[i] = parser_find_group(p,
+                                               p->rule.mlvo_value_at_pos[i]);
     }
 
-    darray_foreach(element, group->elements)
-        if (svaleq(to, *element))
-            return true;
+    for (i = 0; i < p->rule.num_kccgst_values; i++)
+        rule.kccgst_values[i] =
+            parser_intern(p, p->rule.kccgst_value_at_pos[i]);
 
-    return false;
+    rule.loc = p->loc;
+
+    darray_append(p->rules, rule);
+    darray_item(p->rulesets, darray_size(p->rulesets) - 1).num_rules++;
 }
 
-static bool
-match_value(struct matcher *m, struct sval val, struct sval to,
-          enum mlvo_match_type match_type)
+static enum rules_token
+gettok(struct parser *p)
 {
-    if (match_type == MLVO_MATCH_WILDCARD)
-        return true;
-    if (match_type == MLVO_MATCH_GROUP)
-        return match_group(m, val, to);
-    return svaleq(val, to);
+    return lex(&p->scanner, &p->val, &p->loc);
 }
 
-/*
- * This function performs %-expansion on @value (see overview above),
- * and appends the result to @to.
- */
 static bool
-append_expanded_kccgst_value(struct matcher *m, darray_char *to,
-                             struct sval value)
+parser_parse(struct parser *p, const char *string, size_t len,
+             const char *file_name)
 {
-    unsigned int i;
-    size_t original_size = darray_size(*to);
-    const char *s = value.start;
-    xkb_layout_index_t idx;
-    int consumed;
-    enum rules_mlvo mlv;
-    struct sval expanded;
-    char pfx, sfx;
+    enum rules_token tok;
 
-    /*
-     * Appending  bar to  foo ->  foo (not an error if this happens)
-     * Appending +bar to  foo ->  foo+bar
-     * Appending  bar to +foo ->  bar+foo
-     * Appending +bar to +foo -> +foo+bar
-     */
-    if (!darray_empty(*to) && s[0] != '+' && s[0] != '|') {
-        if (darray_item(*to, 0) == '+' || darray_item(*to, 0) == '|')
-            darray_prepend_items_nullterminate(*to, value.start, value.len);
-        return true;
+    scanner_init(&p->scanner, p->ctx, string, len, file_name);
+
+initial:
+    switch (tok = gettok(p)) {
+    case TOK_BANG:
+        goto bang;
+    case TOK_END_OF_LINE:
+        goto initial;
+    case TOK_END_OF_FILE:
+        goto finish;
+    default:
+        goto unexpected;
     }
 
-    /*
-     * Some ugly hand-lexing here, but going through the scanner is more
-     * trouble than it's worth, and the format is ugly on its own merit.
-     */
-    for (i = 0; i < value.len; ) {
-        /* Check if that's a start of an expansion. */
-        if (s[i] != '%') {
-            /* Just a normal character. */
-            darray_append_items_nullterminate(*to, &s[i++], 1);
-            continue;
-        }
-        if (++i >= value.len) goto error;
-
-        pfx = sfx = 0;
-
-        /* Check for prefix. */
-        if (s[i] == '(' || s[i] == '+' || s[i] == '|' ||
-            s[i] == '_' || s[i] == '-') {
-            pfx = s[i];
-            if (s[i] == '(') sfx = ')';
-            if (++i >= value.len) goto error;
-        }
-
-        /* Mandatory model/layout/variant specifier. */
-        switch (s[i++]) {
-        case 'm': mlv = MLVO_MODEL; break;
-        case 'l': mlv = MLVO_LAYOUT; break;
-        case 'v': mlv = MLVO_VARIANT; break;
-        default: goto error;
-        }
-
-        /* Check for index. */
-        idx = XKB_LAYOUT_INVALID;
-        if (i < value.len) {
-            if (s[i] == '[') {
-                if (mlv != MLVO_LAYOUT && mlv != MLVO_VARIANT) {
-                    matcher_error1(m,
-                                   "invalid index in %%-expansion; "
-                                   "may only index layout or variant");
-                    goto error;
-                }
-
-                consumed = extract_layout_index(s + i, value.len - i, &idx);
-                if (consumed == -1) goto error;
-                i += consumed;
-            }
-            else {
-                idx = XKB_LAYOUT_INVALID;
-            }
-        }
-
-        /* Check for suffix, if there supposed to be one. */
-        if (sfx != 0) {
-            if (i >= value.len) goto error;
-            if (s[i++] != sfx) goto error;
-        }
-
-        /* Get the expanded value. */
-        expanded.len = 0;
-
-        if (mlv == MLVO_LAYOUT) {
-            if (idx != XKB_LAYOUT_INVALID &&
-                idx < darray_size(m->rmlvo.layouts) &&
-                darray_size(m->rmlvo.layouts) > 1)
-                expanded = darray_item(m->rmlvo.layouts, idx);
-            else if (idx == XKB_LAYOUT_INVALID &&
-                     darray_size(m->rmlvo.layouts) == 1)
-                expanded = darray_item(m->rmlvo.layouts, 0);
-        }
-        else if (mlv == MLVO_VARIANT) {
-            if (idx != XKB_LAYOUT_INVALID &&
-                idx < darray_size(m->rmlvo.variants) &&
-                darray_size(m->rmlvo.variants) > 1)
-                expanded = darray_item(m->rmlvo.variants, idx);
-            else if (idx == XKB_LAYOUT_INVALID &&
-                     darray_size(m->rmlvo.variants) == 1)
-                expanded = darray_item(m->rmlvo.variants, 0);
-        }
-        else if (mlv == MLVO_MODEL) {
-            expanded = m->rmlvo.model;
-        }
-
-        /* If we didn't get one, skip silently. */
-        if (expanded.len <= 0)
-            continue;
-
-        if (pfx != 0)
-            darray_append_items_nullterminate(*to, &pfx, 1);
-        darray_append_items_nullterminate(*to, expanded.start, expanded.len);
-        if (sfx != 0)
-            darray_append_items_nullterminate(*to, &sfx, 1);
-    }
-
-    return true;
-
-error:
-    matcher_error1(m, "invalid %%-expansion in value; not used");
-    darray_resize(*to, original_size);
-    return false;
-}
-
-static void
-matcher_rule_verify(struct matcher *m)
-{
-    if (m->rule.num_mlvo_values != m->mapping.num_mlvo ||
-        m->rule.num_kccgst_values != m->mapping.num_kccgst) {
-        matcher_error1(m,
-                       "invalid rule: must have same number of values as mapping line;"
-                       "ignoring rule");
-        m->rule.skip = true;
-    }
-}
-
-static void
-matcher_rule_apply_if_matches(struct matcher *m)
-{
-    unsigned int i;
-    enum rules_mlvo mlvo;
-    enum rules_kccgst kccgst;
-    struct sval value, *option;
-    enum mlvo_match_type match_type;
-    bool matched = false;
-    xkb_layout_index_t idx;
-
-    for (i = 0; i < m->mapping.num_mlvo; i++) {
-        mlvo = m->mapping.mlvo_at_pos[i];
-        value = m->rule.mlvo_value_at_pos[i];
-        match_type = m->rule.match_type_at_pos[i];
-
-        if (mlvo == MLVO_MODEL) {
-            matched = match_value(m, value, m->rmlvo.model, match_type);
-        }
-        else if (mlvo == MLVO_LAYOUT) {
-            idx = m->mapping.layout_idx;
-            idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
-            matched = match_value(m, value,
-                                  darray_item(m->rmlvo.layouts, idx),
-                                  match_type);
-        }
-        else if (mlvo == MLVO_VARIANT) {
-            idx = m->mapping.layout_idx;
-            idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
-            matched = match_value(m, value,
-                                  darray_item(m->rmlvo.variants, idx),
-                                  match_type);
-        }
-        else if (mlvo == MLVO_OPTION) {
-            darray_foreach(option, m->rmlvo.options) {
-                matched = match_value(m, value, *option, match_type);
-                if (matched)
-                    break;
-            }
-        }
-
-        if (!matched)
-            return;
-    }
-
-    for (i = 0; i < m->mapping.num_kccgst; i++) {
-        kccgst = m->mapping.kccgst_at_pos[i];
-        value = m->rule.kccgst_value_at_pos[i];
-        append_expanded_kccgst_value(m, &m->kccgst[kccgst], value);
-    }
-
-    /*
-     * If a rule matches in a rule set, the rest of the set should be
-     * skipped. However, rule sets matching against options may contain
-     * several legitimate rules, so they are processed entirely.
-     */
-    if (!(m->mapping.defined_mlvo_mask & (1 << MLVO_OPTION)))
-        m->mapping.skip = true;
-}
-
-static enum rules_token
-gettok(struct matcher *m)
-{
-    return lex(&m->scanner, &m->val, &m->loc);
-}
-
-static bool
-matcher_match(struct matcher *m, const char *string, size_t len,
-              const char *file_name, struct xkb_component_names *out)
-{
-    enum rules_token tok;
-
-    if (!m)
-        return false;
-
-    scanner_init(&m->scanner, m->ctx, string, len, file_name);
-
-initial:
-    switch (tok = gettok(m)) {
-    case TOK_BANG:
-        goto bang;
-    case TOK_END_OF_LINE:
-        goto initial;
-    case TOK_END_OF_FILE:
-        goto finish;
-    default:
-        goto unexpected;
-    }
-
-bang:
-    switch (tok = gettok(m)) {
-    case TOK_GROUP_NAME:
-        matcher_group_start_new(m, m->val.string);
-        goto group_name;
-    case TOK_IDENTIFIER:
-        matcher_mapping_start_new(m);
-        matcher_mapping_set_mlvo(m, m->val.string);
-        goto mapping_mlvo;
-    default:
-        goto unexpected;
-    }
+bang:
+    switch (tok = gettok(p)) {
+    case TOK_GROUP_NAME:
+        parser_ruleset_finish(p);
+        parser_group_start_new(p, p->val.string);
+        goto group_name;
+    case TOK_IDENTIFIER:
+        parser_mapping_start_new(p);
+        parser_mapping_set_mlvo(p, p->val.string);
+        goto mapping_mlvo;
+    default:
+        goto unexpected;
+    }
 
 group_name:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_EQUALS:
         goto group_element;
     default:
@@ -966,21 +1042,22 @@ group_name:
     }
 
 group_element:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        matcher_group_add_element(m, m->val.string);
+        parser_group_add_element(p, p->val.string);
         goto group_element;
     case TOK_END_OF_LINE:
+        parser_group_finish(p);
         goto initial;
     default:
         goto unexpected;
     }
 
 mapping_mlvo:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        if (!m->mapping.skip)
-            matcher_mapping_set_mlvo(m, m->val.string);
+        if (!p->mapping.skip)
+            parser_mapping_set_mlvo(p, p->val.string);
         goto mapping_mlvo;
     case TOK_EQUALS:
         goto mapping_kccgst;
@@ -989,21 +1066,21 @@ mapping_mlvo:
     }
 
 mapping_kccgst:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        if (!m->mapping.skip)
-            matcher_mapping_set_kccgst(m, m->val.string);
+        if (!p->mapping.skip)
+            parser_mapping_set_kccgst(p, p->val.string);
         goto mapping_kccgst;
     case TOK_END_OF_LINE:
-        if (!m->mapping.skip)
-            matcher_mapping_verify(m);
+        if (!p->mapping.skip)
+            parser_mapping_verify(p);
         goto rule_mlvo_first;
     default:
         goto unexpected;
     }
 
 rule_mlvo_first:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_BANG:
         goto bang;
     case TOK_END_OF_LINE:
@@ -1011,25 +1088,25 @@ rule_mlvo_first:
     case TOK_END_OF_FILE:
         goto finish;
     default:
-        matcher_rule_start_new(m);
+        parser_rule_start_new(p);
         goto rule_mlvo_no_tok;
     }
 
 rule_mlvo:
-    tok = gettok(m);
+    tok = gettok(p);
 rule_mlvo_no_tok:
     switch (tok) {
     case TOK_IDENTIFIER:
-        if (!m->rule.skip)
-            matcher_rule_set_mlvo(m, m->val.string);
+        if (!p->rule.skip)
+            parser_rule_set_mlvo(p, p->val.string);
         goto rule_mlvo;
     case TOK_STAR:
-        if (!m->rule.skip)
-            matcher_rule_set_mlvo_wildcard(m);
+        if (!p->rule.skip)
+            parser_rule_set_mlvo_wildcard(p);
         goto rule_mlvo;
     case TOK_GROUP_NAME:
-        if (!m->rule.skip)
-            matcher_rule_set_mlvo_group(m, m->val.string);
+        if (!p->rule.skip)
+            parser_rule_set_mlvo_group(p, p->val.string);
         goto rule_mlvo;
     case TOK_EQUALS:
         goto rule_kccgst;
@@ -1038,16 +1115,16 @@ rule_mlvo_no_tok:
     }
 
 rule_kccgst:
-    switch (tok = gettok(m)) {
+    switch (tok = gettok(p)) {
     case TOK_IDENTIFIER:
-        if (!m->rule.skip)
-            matcher_rule_set_kccgst(m, m->val.string);
+        if (!p->rule.skip)
+            parser_rule_set_kccgst(p, p->val.string);
         goto rule_kccgst;
     case TOK_END_OF_LINE:
-        if (!m->rule.skip)
-            matcher_rule_verify(m);
-        if (!m->rule.skip)
-            matcher_rule_apply_if_matches(m);
+        if (!p->rule.skip)
+            parser_rule_verify(p);
+        if (!p->rule.skip)
+            parser_rule_add(p);
         goto rule_mlvo_first;
     default:
         goto unexpected;
@@ -1062,60 +1139,1397 @@ unexpected:
     }
 
 finish:
-    if (darray_empty(m->kccgst[KCCGST_KEYCODES]) ||
-        darray_empty(m->kccgst[KCCGST_TYPES]) ||
-        darray_empty(m->kccgst[KCCGST_COMPAT]) ||
-        /* darray_empty(m->kccgst[KCCGST_GEOMETRY]) || */
-        darray_empty(m->kccgst[KCCGST_SYMBOLS]))
-        goto error;
-
-    out->keycodes = darray_mem(m->kccgst[KCCGST_KEYCODES], 0);
-    out->types = darray_mem(m->kccgst[KCCGST_TYPES], 0);
-    out->compat = darray_mem(m->kccgst[KCCGST_COMPAT], 0);
-    /* out->geometry = darray_mem(m->kccgst[KCCGST_GEOMETRY], 0); */
-    darray_free(m->kccgst[KCCGST_GEOMETRY]);
-    out->symbols = darray_mem(m->kccgst[KCCGST_SYMBOLS], 0);
-
+    parser_ruleset_finish(p);
     return true;
 
 state_error:
-    matcher_error1(m, "unexpected token");
+    parser_error1(p, "unexpected token");
 error:
     return false;
 }
 
-bool
-xkb_components_from_rules(struct xkb_context *ctx,
-                          const struct xkb_rule_names *rmlvo,
-                          struct xkb_component_names *out)
+/* Parses a rules file into a new struct rules. */
+static struct rules *
+rules_new_from_string(struct xkb_context *ctx, const char *string,
+                      size_t len, const char *file_name)
 {
-    bool ret = false;
-    FILE *file;
-    char *path;
-    const char *string;
-    size_t size;
-    struct matcher *matcher;
+    struct parser p;
+    struct rules *rules;
 
-    file = FindFileInXkbPath(ctx, rmlvo->rules, FILE_TYPE_RULES, &path);
-    if (!file)
-        goto err_out;
+    rules = calloc(1, sizeof(*rules));
+    if (!rules)
+        return NULL;
 
-    ret = map_file(file, &string, &size);
-    if (!ret) {
-        log_err(ctx, "Couldn't read rules file: %s\n", strerror(errno));
-        goto err_file;
+    parser_init(&p, ctx);
+
+    if (!parser_parse(&p, string, len, file_name)) {
+        parser_clear(&p);
+        free(rules);
+        return NULL;
     }
 
-    matcher = matcher_new(ctx, rmlvo);
-    ret = matcher_match(matcher, string, size, rmlvo->rules, out);
-    if (!ret)
-        log_err(ctx, "No components returned from XKB rules \"%s\"\n", path);
-    matcher_free(matcher);
+    rules->strings = p.strings.item;
+    rules->strings_size = darray_size(p.strings);
+    rules->groups = p.groups.item;
+    rules->num_groups = darray_size(p.groups);
+    rules->elements = p.elements.item;
+    rules->num_elements = darray_size(p.elements);
+    rules->rulesets = p.rulesets.item;
+    rules->num_rulesets = darray_size(p.rulesets);
+    rules->rules = p.rules.item;
+    rules->num_rules = darray_size(p.rules);
+    rules->slots = p.slots.item;
+    rules->num_slots = darray_size(p.slots);
+    rules->postings = p.postings.item;
+    rules->num_postings = darray_size(p.postings);
+
+    /* The arrays now belong to the rules. */
+    darray_init(p.strings);
+    darray_init(p.groups);
+    darray_init(p.elements);
+    darray_init(p.rulesets);
+    darray_init(p.rules);
+    darray_init(p.slots);
+    darray_init(p.postings);
+    parser_clear(&p);
+
+    return rules;
+}
 
-    unmap_file(string, size);
-err_file:
-    free(path);
-    fclose(file);
-err_out:
-    return ret;
+/***====================================================================***/
+
+/*
+ * This is the object used to match a given RMLVO against a struct rules
+ * and aggragate the results in a KcCGST.
+ */
+struct matcher {
+    struct xkb_context *ctx;
+    const struct rules *rules;
+    const char *file_name;
+    /* Input.*/
+    struct rule_names rmlvo;
+    /* Hash set of the options; the values are option indexes. */
+    struct hashmap options_set;
+    bool options_collide;
+    /* Location of the current rule, for error messages. */
+    struct location loc;
+    /* Candidate rules of the current rule set. */
+    darray(uint32_t) candidates;
+    /* Output. */
+    darray_char kccgst[_KCCGST_NUM_ENTRIES];
+};
+
+static struct sval
+strip_spaces(struct sval v)
+{
+    while (v.len > 0 && isspace(v.start[0])) { v.len--; v.start++; }
+    while (v.len > 0 && isspace(v.start[v.len - 1])) v.len--;
+    return v;
+}
+
+static darray_sval
+split_comma_separated_string(const char *s)
+{
+    darray_sval arr = darray_new();
+    struct sval val = { NULL, 0 };
+
+    /*
+     * Make sure the array returned by this function always includes at
+     * least one value, e.g. "" -> { "" } and "," -> { "", "" }.
+     */
+
+    if (!s) {
+        darray_append(arr, val);
+        return arr;
+    }
+
+    while (true) {
+        val.start = s; val.len = 0;
+        while (*s != '\0' && *s != ',') { s++; val.len++; }
+        darray_append(arr, strip_spaces(val));
+        if (*s == '\0') break;
+        if (*s == ',') s++;
+    }
+
+    return arr;
+}
+
+static struct matcher *
+matcher_new(struct xkb_context *ctx, const struct rules *rules,
+            const struct xkb_rule_names *rmlvo)
+{
+    unsigned int i;
+    struct matcher *m = calloc(1, sizeof(*m));
+    if (!m)
+        return NULL;
+
+    m->ctx = ctx;
+    m->rules = rules;
+    m->file_name = rmlvo->rules;
+    m->rmlvo.model.start = rmlvo->model;
+    m->rmlvo.model.len = rmlvo->model ? strlen(rmlvo->model) : 0;
+    m->rmlvo.layouts = split_comma_separated_string(rmlvo->layout);
+    m->rmlvo.variants = split_comma_separated_string(rmlvo->variant);
+    m->rmlvo.options = split_comma_separated_string(rmlvo->options);
+
+    hashmap_init(&m->options_set);
+    for (i = 0; i < darray_size(m->rmlvo.options); i++) {
+        struct sval option = darray_item(m->rmlvo.options, i);
+        uint32_t hash = hash_sval(option), found;
+
+        if (hashmap_lookup(&m->options_set, hash, &found)) {
+            if (!svaleq(option, darray_item(m->rmlvo.options, found)))
+                m->options_collide = true;
+            continue;
+        }
+
+        if (!hashmap_insert(&m->options_set, hash, i))
+            m->options_collide = true;
+    }
+
+    return m;
+}
+
+static void
+matcher_free(struct matcher *m)
+{
+    if (!m)
+        return;
+    darray_free(m->rmlvo.layouts);
+    darray_free(m->rmlvo.variants);
+    darray_free(m->rmlvo.options);
+    hashmap_free(&m->options_set);
+    darray_free(m->candidates);
+    free(m);
+}
+
+/* C99 is stupid. Just use the 1 variant when there are no args. */
+#define matcher_error1(matcher, msg) \
+    log_warn(matcher->ctx, "rules/%s:%d:%d: " msg "\n", \
+             matcher->file_name, matcher->loc.line, \
+             matcher->loc.column)
+#define matcher_error(matcher, fmt, ...) \
+    log_warn(matcher->ctx, "rules/%s:%d:%d: " fmt "\n", \
+             matcher->file_name, matcher->loc.line, \
+             matcher->loc.column, __VA_ARGS__)
+
+/*
+ * Whether the rule set applies at all, given the number of layouts and
+ * variants.
+ */
+static bool
+matcher_mapping_applies(struct matcher *m, const struct mapping *mapping)
+{
+    /*
+     * This following is very stupid, but this is how it works.
+     * See the "Notes" section in the overview above.
+     */
+
+    if (mapping->defined_mlvo_mask & (1 << MLVO_LAYOUT)) {
+        if (mapping->layout_idx == XKB_LAYOUT_INVALID) {
+            if (darray_size(m->rmlvo.layouts) > 1)
+                return false;
+        }
+        else {
+            if (darray_size(m->rmlvo.layouts) == 1 ||
+                mapping->layout_idx >= darray_size(m->rmlvo.layouts))
+                return false;
+        }
+    }
+
+    if (mapping->defined_mlvo_mask & (1 << MLVO_VARIANT)) {
+        if (mapping->variant_idx == XKB_LAYOUT_INVALID) {
+            if (darray_size(m->rmlvo.variants) > 1)
+                return false;
+        }
+        else {
+            if (darray_size(m->rmlvo.variants) == 1 ||
+                mapping->variant_idx >= darray_size(m->rmlvo.variants))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+/* Looks up @hash in one of the hash tables in rules->slots. */
+static bool
+rules_lookup(const struct rules *rules, uint32_t first_slot,
+             uint32_t num_slots, uint32_t hash, uint32_t *value_out)
+{
+    struct hashmap table;
+
+    table.entries = (struct hashmap_entry *) (rules->slots + first_slot);
+    table.alloc = num_slots;
+    table.size = num_slots;
+
+    return hashmap_lookup(&table, hash, value_out);
+}
+
+static bool
+match_group(struct matcher *m, uint32_t group_idx, struct sval to)
+{
+    const struct rules_group *group;
+    uint32_t i;
+
+    if (group_idx == NO_GROUP)
+        return false;
+
+    group = &m->rules->groups[group_idx];
+
+    if (!group->collisions) {
+        if (!rules_lookup(m->rules, group->first_slot, group->num_slots,
+                          hash_sval(to), &i))
+            return false;
+        return svaleq(to, rules_sval(m->rules, m->rules->elements[i]));
+    }
+
+    for (i = 0; i < group->num_elements; i++)
+        if (svaleq(to, rules_sval(m->rules,
+                                  m->rules->elements[group->first_element + i])))
+            return true;
+
+    return false;
+}
+
+static bool
+match_value(struct matcher *m, const struct rules_rule *rule,
+            unsigned int pos, struct sval to)
+{
+    if (rule->match_types[pos] == MLVO_MATCH_WILDCARD)
+        return true;
+    if (rule->match_types[pos] == MLVO_MATCH_GROUP)
+        return match_group(m, rule->groups[pos], to);
+    return svaleq(rules_sval(m->rules, rule->mlvo_values[pos]), to);
+}
+
+/* Whether the value of @rule at @pos matches any of the options. */
+static bool
+match_options(struct matcher *m, const struct rules_rule *rule,
+              unsigned int pos)
+{
+    struct sval *option, value;
+    uint32_t i;
+
+    if (rule->match_types[pos] == MLVO_MATCH_NORMAL && !m->options_collide) {
+        value = rules_sval(m->rules, rule->mlvo_values[pos]);
+        if (!hashmap_lookup(&m->options_set, hash_sval(value), &i))
+            return false;
+        return svaleq(value, darray_item(m->rmlvo.options, i));
+    }
+
+    darray_foreach(option, m->rmlvo.options)
+        if (match_value(m, rule, pos, *option))
+            return true;
+
+    return false;
+}
+
+/*
+ * This function performs %-expansion on @value (see overview above),
+ * and appends the result to @to.
+ */
+static bool
+append_expanded_kccgst_value(struct matcher *m, darray_char *to,
+                             struct sval value)
+{
+    unsigned int i;
+    size_t original_size = darray_size(*to);
+    const char *s = value.start;
+    xkb_layout_index_t idx;
+    int consumed;
+    enum rules_mlvo mlv;
+    struct sval expanded;
+    char pfx, sfx;
+
+    /*
+     * Appending  bar to  foo ->  foo (not an error if this happens)
+     * Appending +bar to  foo ->  foo+bar
+     * Appending  bar to +foo ->  bar+foo
+     * Appending +bar to +foo -> +foo+bar
+     */
+    if (!darray_empty(*to) && s[0] != '+' && s[0] != '|') {
+        if (darray_item(*to, 0) == '+' || darray_item(*to, 0) == '|')
+            darray_prepend_items_nullterminate(*to, value.start, value.len);
+        return true;
+    }
+
+    /*
+     * Some ugly hand-lexing here, but going through the scanner is more
+     * trouble than it's worth, and the format is ugly on its own merit.
+     */
+    for (i = 0; i < value.len; ) {
+        /* Check if that's a start of an expansion. */
+        if (s[i] != '%') {
+            /* Just a normal character. */
+            darray_append_items_nullterminate(*to, &s[i++], 1);
+            continue;
+        }
+        if (++i >= value.len) goto error;
+
+        pfx = sfx = 0;
+
+        /* Check for prefix. */
+        if (s[i] == '(' || s[i] == '+' || s[i] == '|' ||
+            s[i] == '_' || s[i] == '-') {
+            pfx = s[i];
+            if (s[i] == '(') sfx = ')';
+            if (++i >= value.len) goto error;
+        }
+
+        /* Mandatory model/layout/variant specifier. */
+        switch (s[i++]) {
+        case 'm': mlv = MLVO_MODEL; break;
+        case 'l': mlv = MLVO_LAYOUT; break;
+        case 'v': mlv = MLVO_VARIANT; break;
+        default: goto error;
+        }
+
+        /* Check for index. */
+        idx = XKB_LAYOUT_INVALID;
+        if (i < value.len) {
+            if (s[i] == '[') {
+                if (mlv != MLVO_LAYOUT && mlv != MLVO_VARIANT) {
+                    matcher_error1(m,
+                                   "invalid index in %%-expansion; "
+                                   "may only index layout or variant");
+                    goto error;
+                }
+
+                consumed = extract_layout_index(s + i, value.len - i, &idx);
+                if (consumed == -1) goto error;
+                i += consumed;
+            }
+            else {
+                idx = XKB_LAYOUT_INVALID;
+            }
+        }
+
+        /* Check for suffix, if there supposed to be one. */
+        if (sfx != 0) {
+            if (i >= value.len) goto error;
+            if (s[i++] != sfx) goto error;
+        }
+
+        /* Get the expanded value. */
+        expanded.len = 0;
+
+        if (mlv == MLVO_LAYOUT) {
+            if (idx != XKB_LAYOUT_INVALID &&
+                idx < darray_size(m->rmlvo.layouts) &&
+                darray_size(m->rmlvo.layouts) > 1)
+                expanded = darray_item(m->rmlvo.layouts, idx);
+            else if (idx == XKB_LAYOUT_INVALID &&
+                     darray_size(m->rmlvo.layouts) == 1)
+                expanded = darray_item(m->rmlvo.layouts, 0);
+        }
+        else if (mlv == MLVO_VARIANT) {
+            if (idx != XKB_LAYOUT_INVALID &&
+                idx < darray_size(m->rmlvo.variants) &&
+                darray_size(m->rmlvo.variants) > 1)
+                expanded = darray_item(m->rmlvo.variants, idx);
+            else if (idx == XKB_LAYOUT_INVALID &&
+                     darray_size(m->rmlvo.variants) == 1)
+                expanded = darray_item(m->rmlvo.variants, 0);
+        }
+        else if (mlv == MLVO_MODEL) {
+            expanded = m->rmlvo.model;
+        }
+
+        /* If we didn't get one, skip silently. */
+        if (expanded.len <= 0)
+            continue;
+
+        if (pfx != 0)
+            darray_append_items_nullterminate(*to, &pfx, 1);
+        darray_append_items_nullterminate(*to, expanded.start, expanded.len);
+        if (sfx != 0)
+            darray_append_items_nullterminate(*to, &sfx, 1);
+    }
+
+    return true;
+
+error:
+    matcher_error1(m, "invalid %%-expansion in value; not used");
+    darray_resize(*to, original_size);
+    return false;
+}
+
+/* The RMLVO value which the values of the rules at @pos are matched to. */
+static struct sval
+matcher_value_at_pos(struct matcher *m, const struct mapping *mapping,
+                     unsigned int pos)
+{
+    xkb_layout_index_t idx;
+
+    switch (mapping->mlvo_at_pos[pos]) {
+    case MLVO_MODEL:
+        return m->rmlvo.model;
+    case MLVO_LAYOUT:
+        idx = mapping->layout_idx;
+        idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
+        return darray_item(m->rmlvo.layouts, idx);
+    case MLVO_VARIANT:
+    default:
+        idx = mapping->layout_idx;
+        idx = (idx == XKB_LAYOUT_INVALID ? 0 : idx);
+        return darray_item(m->rmlvo.variants, idx);
+    }
+}
+
+static bool
+matcher_rule_apply_if_matches(struct matcher *m,
+                              const struct mapping *mapping,
+                              const struct rules_rule *rule)
+{
+    unsigned int i;
+    enum rules_kccgst kccgst;
+    bool matched;
+
+    for (i = 0; i < mapping->num_mlvo; i++) {
+        if (mapping->mlvo_at_pos[i] == MLVO_OPTION) {
+            matched = match_options(m, rule, i);
+        }
+        else {
+            matched = match_value(m, rule, i,
+                                  matcher_value_at_pos(m, mapping, i));
+        }
+
+        if (!matched)
+            return false;
+    }
+
+    m->loc = rule->loc;
+    for (i = 0; i < mapping->num_kccgst; i++) {
+        kccgst = mapping->kccgst_at_pos[i];
+        append_expanded_kccgst_value(m, &m->kccgst[kccgst],
+                                     rules_sval(m->rules,
+                                                rule->kccgst_values[i]));
+    }
+
+    return true;
+}
+
+static void
+matcher_add_candidates(struct matcher *m, uint32_t list)
+{
+    const uint32_t *postings = m->rules->postings;
+
+    darray_append_items(m->candidates, &postings[list + 1], postings[list]);
+}
+
+static void
+matcher_add_candidates_for_value(struct matcher *m,
+                                 const struct rules_ruleset *rs,
+                                 struct sval value)
+{
+    uint32_t list;
+
+    if (rules_lookup(m->rules, rs->first_slot, rs->num_slots,
+                     hash_sval(value), &list))
+        matcher_add_candidates(m, list);
+}
+
+static int
+cmp_rule_idx(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *) a, y = *(const uint32_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+/*
+ * Collects the rules of the rule set which may match, in order, without
+ * duplicates.
+ */
+static void
+matcher_find_candidates(struct matcher *m, const struct rules_ruleset *rs)
+{
+    struct sval *option;
+    uint32_t *candidates, i, n;
+
+    darray_resize(m->candidates, 0);
+
+    if (rs->indexed_pos < 0) {
+        for (i = 0; i < rs->num_rules; i++)
+            darray_append(m->candidates, rs->first_rule + i);
+        return;
+    }
+
+    matcher_add_candidates(m, rs->others);
+
+    if (rs->mapping.mlvo_at_pos[rs->indexed_pos] == MLVO_OPTION)
+        darray_foreach(option, m->rmlvo.options)
+            matcher_add_candidates_for_value(m, rs, *option);
+    else
+        matcher_add_candidates_for_value(m, rs,
+                                         matcher_value_at_pos(m, &rs->mapping,
+                                                              rs->indexed_pos));
+
+    candidates = darray_mem(m->candidates, 0);
+    qsort(candidates, darray_size(m->candidates), sizeof(*candidates),
+          cmp_rule_idx);
+
+    for (i = 0, n = 0; i < darray_size(m->candidates); i++)
+        if (n == 0 || candidates[n - 1] != candidates[i])
+            candidates[n++] = candidates[i];
+    darray_resize(m->candidates, n);
+}
+
+static void
+matcher_apply_ruleset(struct matcher *m, const struct rules_ruleset *rs)
+{
+    uint32_t *rule_idx;
+
+    if (!matcher_mapping_applies(m, &rs->mapping))
+        return;
+
+    matcher_find_candidates(m, rs);
+
+    darray_foreach(rule_idx, m->candidates) {
+        if (!matcher_rule_apply_if_matches(m, &rs->mapping,
+                                           &m->rules->rules[*rule_idx]))
+            continue;
+
+        /*
+         * If a rule matches in a rule set, the rest of the set should be
+         * skipped. However, rule sets matching against options may
+         * contain several legitimate rules, so they are processed
+         * entirely.
+         */
+        if (!(rs->mapping.defined_mlvo_mask & (1 << MLVO_OPTION)))
+            break;
+    }
+}
+
+static bool
+matcher_match(struct matcher *m, struct xkb_component_names *out)
+{
+    uint32_t i;
+
+    if (!m)
+        return false;
+
+    for (i = 0; i < m->rules->num_rulesets; i++)
+        matcher_apply_ruleset(m, &m->rules->rulesets[i]);
+
+    if (darray_empty(m->kccgst[KCCGST_KEYCODES]) ||
+        darray_empty(m->kccgst[KCCGST_TYPES]) ||
+        darray_empty(m->kccgst[KCCGST_COMPAT]) ||
+        /* darray_empty(m->kccgst[KCCGST_GEOMETRY]) || */
+        darray_empty(m->kccgst[KCCGST_SYMBOLS]))
+        goto error;
+
+    out->keycodes = darray_mem(m->kccgst[KCCGST_KEYCODES], 0);
+    out->types = darray_mem(m->kccgst[KCCGST_TYPES], 0);
+    out->compat = darray_mem(m->kccgst[KCCGST_COMPAT], 0);
+    /* out->geometry = darray_mem(m->kccgst[KCCGST_GEOMETRY], 0); */
+    darray_free(m->kccgst[KCCGST_GEOMETRY]);
+    out->symbols = darray_mem(m->kccgst[KCCGST_SYMBOLS], 0);
+
+    return true;
+
+error:
+    for (i = 0; i < _KCCGST_NUM_ENTRIES; i++)
+        darray_free(m->kccgst[i]);
+    return false;
+}
+
+/***====================================================================***/
+
+/*
+ * Precompiled rules files
+ * =======================
+ * The parsed rules can be written to a file, which is then used instead
+ * of the rules file it was compiled from, by mapping it into memory.
+ * It is found next to the rules file, with the COMPILED_RULES_SUFFIX
+ * added to its name, and only used while the rules file has the same
+ * modification time and size as when it was compiled.
+ *
+ * The file consists of a header, followed by the arrays of the struct
+ * rules, each aligned to 8 bytes. The arrays are stored as they are in
+ * memory, so the file can only be used by a build with the same
+ * structure layout; the header records enough to check that.
+ */
+
+#define COMPILED_RULES_SUFFIX ".compiled"
+#define COMPILED_RULES_MAGIC "xkbrules"
+#define COMPILED_RULES_VERSION 1
+#define COMPILED_RULES_BYTE_ORDER 0x01020304
+#define COMPILED_RULES_ALIGN(offset) (((offset) + 7) & ~(uint32_t) 7)
+
+enum compiled_section {
+    SECTION_STRINGS,
+    SECTION_GROUPS,
+    SECTION_ELEMENTS,
+    SECTION_RULESETS,
+    SECTION_RULES,
+    SECTION_SLOTS,
+    SECTION_POSTINGS,
+    _SECTION_NUM_ENTRIES
+};
+
+static const uint32_t compiled_item_sizes[_SECTION_NUM_ENTRIES] = {
+    [SECTION_STRINGS] = sizeof(char),
+    [SECTION_GROUPS] = sizeof(struct rules_group),
+    [SECTION_ELEMENTS] = sizeof(struct rules_str),
+    [SECTION_RULESETS] = sizeof(struct rules_ruleset),
+    [SECTION_RULES] = sizeof(struct rules_rule),
+    [SECTION_SLOTS] = sizeof(struct hashmap_entry),
+    [SECTION_POSTINGS] = sizeof(uint32_t),
+};
+
+struct compiled_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t item_sizes[_SECTION_NUM_ENTRIES];
+    /* The rules file it was compiled from. */
+    int64_t text_mtime;
+    int64_t text_size;
+    /* Offset in the file, and number of items. */
+    struct {
+        uint32_t offset;
+        uint32_t count;
+    } sections[_SECTION_NUM_ENTRIES];
+};
+
+static const void *
+rules_get_section(const struct rules *rules, enum compiled_section section,
+                  uint32_t *count_out)
+{
+    switch (section) {
+    case SECTION_STRINGS:
+        *count_out = rules->strings_size;
+        return rules->strings;
+    case SECTION_GROUPS:
+        *count_out = rules->num_groups;
+        return rules->groups;
+    case SECTION_ELEMENTS:
+        *count_out = rules->num_elements;
+        return rules->elements;
+    case SECTION_RULESETS:
+        *count_out = rules->num_rulesets;
+        return rules->rulesets;
+    case SECTION_RULES:
+        *count_out = rules->num_rules;
+        return rules->rules;
+    case SECTION_SLOTS:
+        *count_out = rules->num_slots;
+        return rules->slots;
+    case SECTION_POSTINGS:
+    default:
+        *count_out = rules->num_postings;
+        return rules->postings;
+    }
+}
+
+static void
+rules_set_section(struct rules *rules, enum compiled_section section,
+                  const void *items, uint32_t count)
+{
+    switch (section) {
+    case SECTION_STRINGS:
+        rules->strings = items;
+        rules->strings_size = count;
+        break;
+    case SECTION_GROUPS:
+        rules->groups = items;
+        rules->num_groups = count;
+        break;
+    case SECTION_ELEMENTS:
+        rules->elements = items;
+        rules->num_elements = count;
+        break;
+    case SECTION_RULESETS:
+        rules->rulesets = items;
+        rules->num_rulesets = count;
+        break;
+    case SECTION_RULES:
+        rules->rules = items;
+        rules->num_rules = count;
+        break;
+    case SECTION_SLOTS:
+        rules->slots = items;
+        rules->num_slots = count;
+        break;
+    case SECTION_POSTINGS:
+    default:
+        rules->postings = items;
+        rules->num_postings = count;
+        break;
+    }
+}
+
+static bool
+write_compiled_rules(FILE *file, const struct rules *rules,
+                     const struct stat *text_stat)
+{
+    static const char padding[8] = { 0 };
+    struct compiled_header header;
+    enum compiled_section section;
+    const void *items;
+    uint32_t count, offset;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, COMPILED_RULES_MAGIC, sizeof(header.magic));
+    header.version = COMPILED_RULES_VERSION;
+    header.byte_order = COMPILED_RULES_BYTE_ORDER;
+    memcpy(header.item_sizes, compiled_item_sizes, sizeof(header.item_sizes));
+    header.text_mtime = text_stat->st_mtime;
+    header.text_size = text_stat->st_size;
+
+    offset = COMPILED_RULES_ALIGN(sizeof(header));
+    for (section = 0; section < _SECTION_NUM_ENTRIES; section++) {
+        rules_get_section(rules, section, &count);
+        header.sections[section].offset = offset;
+        header.sections[section].count = count;
+        offset = COMPILED_RULES_ALIGN(offset +
+                                      count * compiled_item_sizes[section]);
+    }
+
+    if (fwrite(&header, sizeof(header), 1, file) != 1)
+        return false;
+    offset = sizeof(header);
+
+    for (section = 0; section < _SECTION_NUM_ENTRIES; section++) {
+        uint32_t start = header.sections[section].offset;
+
+        if (fwrite(padding, 1, start - offset, file) != start - offset)
+            return false;
+
+        items = rules_get_section(rules, section, &count);
+        if (count > 0 &&
+            fwrite(items, compiled_item_sizes[section], count, file) != count)
+            return false;
+
+        offset = start + count * compiled_item_sizes[section];
+    }
+
+    return fflush(file) == 0;
+}
+
+static bool
+check_str(const struct rules *rules, struct rules_str str)
+{
+    return str.offset <= rules->strings_size &&
+           str.len <= rules->strings_size - str.offset;
+}
+
+static bool
+check_table(const struct rules *rules, uint32_t first_slot,
+            uint32_t num_slots, uint32_t max_value)
+{
+    uint32_t i;
+    bool has_empty = false;
+
+    if (first_slot > rules->num_slots ||
+        num_slots > rules->num_slots - first_slot ||
+        (num_slots & (num_slots - 1)) != 0)
+        return false;
+
+    for (i = first_slot; i < first_slot + num_slots; i++) {
+        if (rules->slots[i].value1 > max_value)
+            return false;
+        if (rules->slots[i].value1 == 0)
+            has_empty = true;
+    }
+
+    /* Otherwise a lookup of a missing key would never end. */
+    return num_slots == 0 || has_empty;
+}
+
+static bool
+check_list(const struct rules *rules, uint32_t list)
+{
+    uint32_t i;
+
+    if (list >= rules->num_postings ||
+        rules->postings[list] > rules->num_postings - list - 1)
+        return false;
+
+    for (i = 0; i < rules->postings[list]; i++)
+        if (rules->postings[list + 1 + i] >= rules->num_rules)
+            return false;
+
+    return true;
+}
+
+/*
+ * Checks that all the indexes and offsets in rules loaded from a file
+ * are in bounds, so that a corrupt file cannot make us read outside of
+ * the mapping.
+ */
+static bool
+check_compiled_rules(const struct rules *rules)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < rules->num_elements; i++)
+        if (!check_str(rules, rules->elements[i]))
+            return false;
+
+    for (i = 0; i < rules->num_groups; i++) {
+        const struct rules_group *group = &rules->groups[i];
+
+        if (!check_str(rules, group->name) ||
+            group->first_element > rules->num_elements ||
+            group->num_elements > rules->num_elements - group->first_element ||
+            !check_table(rules, group->first_slot, group->num_slots,
+                         rules->num_elements))
+            return false;
+    }
+
+    for (i = 0; i < rules->num_rules; i++) {
+        const struct rules_rule *rule = &rules->rules[i];
+
+        for (j = 0; j < _MLVO_NUM_ENTRIES; j++)
+            if (!check_str(rules, rule->mlvo_values[j]) ||
+                rule->match_types[j] > MLVO_MATCH_GROUP ||
+                (rule->groups[j] != NO_GROUP &&
+                 rule->groups[j] >= rules->num_groups))
+                return false;
+
+        for (j = 0; j < _KCCGST_NUM_ENTRIES; j++)
+            if (!check_str(rules, rule->kccgst_values[j]))
+                return false;
+    }
+
+    for (i = 0; i < rules->num_rulesets; i++) {
+        const struct rules_ruleset *rs = &rules->rulesets[i];
+        const struct mapping *mapping = &rs->mapping;
+
+        if (rs->first_rule > rules->num_rules ||
+            rs->num_rules > rules->num_rules - rs->first_rule ||
+            mapping->num_mlvo > _MLVO_NUM_ENTRIES ||
+            mapping->num_kccgst > _KCCGST_NUM_ENTRIES ||
+            (mapping->layout_idx != XKB_LAYOUT_INVALID &&
+             mapping->layout_idx >= XKB_MAX_GROUPS) ||
+            (mapping->variant_idx != XKB_LAYOUT_INVALID &&
+             mapping->variant_idx >= XKB_MAX_GROUPS))
+            return false;
+
+        for (j = 0; j < mapping->num_mlvo; j++)
+            if (mapping->mlvo_at_pos[j] < 0 ||
+                mapping->mlvo_at_pos[j] >= _MLVO_NUM_ENTRIES)
+                return false;
+
+        for (j = 0; j < mapping->num_kccgst; j++)
+            if (mapping->kccgst_at_pos[j] < 0 ||
+                mapping->kccgst_at_pos[j] >= _KCCGST_NUM_ENTRIES)
+                return false;
+
+        if (rs->indexed_pos < 0)
+            continue;
+
+        if (rs->indexed_pos >= (int) mapping->num_mlvo ||
+            !check_table(rules, rs->first_slot, rs->num_slots,
+                         rules->num_postings) ||
+            !check_list(rules, rs->others))
+            return false;
+
+        for (j = rs->first_slot; j < rs->first_slot + rs->num_slots; j++)
+            if (rules->slots[j].value1 != 0 &&
+                !check_list(rules, rules->slots[j].value1 - 1))
+                return false;
+    }
+
+    return true;
+}
+
+/*
+ * Loads the precompiled rules file for the rules file at @path, if
+ * there is one and it is up to date.
+ */
+static struct rules *
+rules_new_from_compiled(struct xkb_context *ctx, const char *path,
+                        const struct stat *text_stat)
+{
+    char *compiled_path;
+    FILE *file;
+    const char *map;
+    size_t map_size;
+    const struct compiled_header *header;
+    struct rules *rules;
+    enum compiled_section section;
+
+    if (asprintf(&compiled_path, "%s%s", path, COMPILED_RULES_SUFFIX) < 0)
+        return NULL;
+
+    file = fopen(compiled_path, "r");
+    if (!file) {
+        free(compiled_path);
+        return NULL;
+    }
+
+    xkb_context_stat_add(ctx, XKB_COMPILE_STAT_FILES_OPENED, 1);
+
+    if (!map_file(file, &map, &map_size)) {
+        log_warn(ctx, "Couldn't read precompiled rules file %s: %s\n",
+                 compiled_path, strerror(errno));
+        goto err_file;
+    }
+
+    header = (const struct compiled_header *) map;
+    if (map_size < sizeof(*header) ||
+        memcmp(header->magic, COMPILED_RULES_MAGIC,
+               sizeof(header->magic)) != 0 ||
+        header->version != COMPILED_RULES_VERSION ||
+        header->byte_order != COMPILED_RULES_BYTE_ORDER ||
+        memcmp(header->item_sizes, compiled_item_sizes,
+               sizeof(compiled_item_sizes)) != 0) {
+        log_warn(ctx, "Ignoring precompiled rules file %s: "
+                 "not compiled by this version\n", compiled_path);
+        goto err_map;
+    }
+
+    if (header->text_mtime != text_stat->st_mtime ||
+        header->text_size != text_stat->st_size) {
+        log_dbg(ctx, "Ignoring precompiled rules file %s: out of date\n",
+                compiled_path);
+        goto err_map;
+    }
+
+    rules = calloc(1, sizeof(*rules));
+    if (!rules)
+        goto err_map;
+
+    for (section = 0; section < _SECTION_NUM_ENTRIES; section++) {
+        uint32_t offset = header->sections[section].offset;
+        uint32_t count = header->sections[section].count;
+
+        if (offset % 8 != 0 || offset > map_size ||
+            count > (map_size - offset) / compiled_item_sizes[section])
+            goto err_invalid;
+
+        rules_set_section(rules, section, map + offset, count);
+    }
+
+    if ((rules->strings_size > 0 &&
+         rules->strings[rules->strings_size - 1] != '\0') ||
+        !check_compiled_rules(rules))
+        goto err_invalid;
+
+    rules->map = map;
+    rules->map_size = map_size;
+
+    log_dbg(ctx, "Using precompiled rules file %s\n", compiled_path);
+    free(compiled_path);
+    fclose(file);
+    return rules;
+
+err_invalid:
+    log_warn(ctx, "Ignoring precompiled rules file %s: invalid\n",
+             compiled_path);
+    free(rules);
+err_map:
+    unmap_file(map, map_size);
+err_file:
+    fclose(file);
+    free(compiled_path);
+    return NULL;
+}
+
+/* Parses the opened rules file @file. */
+static struct rules *
+rules_new_from_file(struct xkb_context *ctx, FILE *file,
+                    const char *file_name)
+{
+    const char *string;
+    size_t size;
+    struct rules *rules;
+
+    if (!map_file(file, &string, &size)) {
+        log_err(ctx, "Couldn't read rules file: %s\n", strerror(errno));
+        return NULL;
+    }
+
+    xkb_context_stat_add(ctx, XKB_COMPILE_STAT_BYTES_SCANNED, size);
+
+    rules = rules_new_from_string(ctx, string, size, file_name);
+    unmap_file(string, size);
+    return rules;
+}
+
+bool
+xkb_rules_precompile(struct xkb_context *ctx, const char *rules_name,
+                     const char *out_path)
+{
+    bool ret = false;
+    FILE *file, *out;
+    char *path, *default_out_path = NULL, *tmp_path = NULL;
+    struct stat stat_buf;
+    struct rules *rules;
+    int fd;
+
+    file = FindFileInXkbPath(ctx, rules_name, FILE_TYPE_RULES, &path);
+    if (!file)
+        return false;
+
+    if (fstat(fileno(file), &stat_buf) != 0) {
+        log_err(ctx, "Couldn't stat rules file: %s\n", strerror(errno));
+        goto err_file;
+    }
+
+    rules = rules_new_from_file(ctx, file, rules_name);
+    if (!rules) {
+        log_err(ctx, "Couldn't parse rules file %s\n", path);
+        goto err_file;
+    }
+
+    if (!out_path) {
+        if (asprintf(&default_out_path, "%s%s", path,
+                     COMPILED_RULES_SUFFIX) < 0)
+            goto err_rules;
+        out_path = default_out_path;
+    }
+
+    /* Write to a temporary file first, so that readers never see a
+     * partially written file. */
+    if (asprintf(&tmp_path, "%s.XXXXXX", out_path) < 0) {
+        tmp_path = NULL;
+        goto err_rules;
+    }
+
+    fd = mkstemp(tmp_path);
+    if (fd < 0) {
+        log_err(ctx, "Couldn't create %s: %s\n", tmp_path, strerror(errno));
+        goto err_rules;
+    }
+
+    out = fdopen(fd, "w");
+    if (!out) {
+        close(fd);
+        unlink(tmp_path);
+        goto err_rules;
+    }
+
+    ret = write_compiled_rules(out, rules, &stat_buf);
+    if (fclose(out) != 0)
+        ret = false;
+    if (ret && (chmod(tmp_path, 0644) != 0 || rename(tmp_path, out_path) != 0))
+        ret = false;
+    if (!ret) {
+        log_err(ctx, "Couldn't write precompiled rules file %s: %s\n",
+                out_path, strerror(errno));
+        unlink(tmp_path);
+    }
+
+err_rules:
+    rules_free(rules);
+err_file:
+    free(tmp_path);
+    free(default_out_path);
+    free(path);
+    fclose(file);
+    return ret;
+}
+
+/***====================================================================***/
+
+/*
+ * The parsed rules files are cached in the context, so that compiling
+ * several keymaps only parses each rules file once. A file is parsed
+ * again if it changes on disk.
+ */
+struct rules_cache_entry {
+    char *path;
+    time_t mtime;
+    off_t size;
+    struct rules *rules;
+};
+
+struct xkb_rules_cache {
+    darray(struct rules_cache_entry) entries;
+};
+
+void
+xkb_rules_cache_free(struct xkb_rules_cache *cache)
+{
+    struct rules_cache_entry *entry;
+
+    if (!cache)
+        return;
+
+    darray_foreach(entry, cache->entries) {
+        free(entry->path);
+        rules_free(entry->rules);
+    }
+    darray_free(cache->entries);
+    free(cache);
+}
+
+static struct rules_cache_entry *
+rules_cache_find(struct xkb_rules_cache *cache, const char *path)
+{
+    struct rules_cache_entry *entry;
+
+    if (!cache)
+        return NULL;
+
+    darray_foreach(entry, cache->entries)
+        if (streq(entry->path, path))
+            return entry;
+
+    return NULL;
+}
+
+/*
+ * Gives @rules to the cache of the context. Returns false if it could
+ * not be cached, in which case the caller keeps it. Worker contexts
+ * only read the cache, which their parent may be using at the same time.
+ */
+static bool
+rules_cache_add(struct xkb_context *ctx, const char *path,
+                const struct stat *stat_buf, struct rules *rules)
+{
+    struct xkb_rules_cache *cache = xkb_context_get_rules_cache(ctx);
+    struct rules_cache_entry *entry, new_entry;
+
+    if (xkb_context_is_worker(ctx))
+        return false;
+
+    if (!cache) {
+        cache = calloc(1, sizeof(*cache));
+        if (!cache)
+            return false;
+        xkb_context_set_rules_cache(ctx, cache);
+    }
+
+    entry = rules_cache_find(cache, path);
+    if (entry) {
+        /* The file changed. */
+        rules_free(entry->rules);
+    }
+    else {
+        new_entry.path = strdup(path);
+        if (!new_entry.path)
+            return false;
+        darray_append(cache->entries, new_entry);
+        entry = &darray_item(cache->entries, darray_size(cache->entries) - 1);
+    }
+
+    entry->mtime = stat_buf->st_mtime;
+    entry->size = stat_buf->st_size;
+    entry->rules = rules;
+    return true;
+}
+
+static struct rules *
+rules_cache_lookup(struct xkb_context *ctx, const char *path,
+                   const struct stat *stat_buf)
+{
+    struct rules_cache_entry *entry;
+
+    entry = rules_cache_find(xkb_context_get_rules_cache(ctx), path);
+    if (!entry ||
+        entry->mtime != stat_buf->st_mtime ||
+        entry->size != stat_buf->st_size)
+        return NULL;
+
+    return entry->rules;
+}
+
+/*
+ * Finds the rules file @name and gets its rules, from the cache of the
+ * context if they are there. Returns NULL on failure. Sets @cached to
+ * whether the rules are owned by the cache, or else by the caller, and
+ * @path_out to the path of the file, which the caller frees.
+ */
+static struct rules *
+rules_load_cached(struct xkb_context *ctx, const char *name,
+                  char **path_out, bool *cached)
+{
+    FILE *file;
+    char *path;
+    struct stat stat_buf;
+    struct rules *rules = NULL;
+
+    file = FindFileInXkbPath(ctx, name, FILE_TYPE_RULES, &path);
+    if (!file)
+        return NULL;
+
+    if (fstat(fileno(file), &stat_buf) != 0) {
+        log_err(ctx, "Couldn't stat rules file: %s\n", strerror(errno));
+        goto err_file;
+    }
+
+    *cached = true;
+    rules = rules_cache_lookup(ctx, path, &stat_buf);
+    if (!rules) {
+        rules = rules_new_from_compiled(ctx, path, &stat_buf);
+        if (!rules)
+            rules = rules_new_from_file(ctx, file, name);
+        if (!rules) {
+            log_err(ctx, "No components returned from XKB rules \"%s\"\n",
+                    path);
+            goto err_file;
+        }
+
+        *cached = rules_cache_add(ctx, path, &stat_buf, rules);
+    }
+
+    fclose(file);
+    *path_out = path;
+    return rules;
+
+err_file:
+    free(path);
+    fclose(file);
+    return NULL;
+}
+
+bool
+xkb_components_from_rules(struct xkb_context *ctx,
+                          const struct xkb_rule_names *rmlvo,
+                          struct xkb_component_names *out)
+{
+    bool ret, cached;
+    char *path;
+    struct rules *rules;
+    struct matcher *matcher;
+
+    rules = rules_load_cached(ctx, rmlvo->rules, &path, &cached);
+    if (!rules)
+        return false;
+
+    matcher = matcher_new(ctx, rules, rmlvo);
+    ret = matcher_match(matcher, out);
+    if (!ret)
+        log_err(ctx, "No components returned from XKB rules \"%s\"\n", path);
+    matcher_free(matcher);
+    if (!cached)
+        rules_free(rules);
+
+    free(path);
+    return ret;
+}
+
+bool
+xkb_rules_cache_load(struct xkb_context *ctx, const char *name)
+{
+    bool cached;
+    char *path;
+    struct rules *rules;
+
+    rules = rules_load_cached(ctx, name, &path, &cached);
+    if (!rules)
+        return false;
+
+    if (!cached)
+        rules_free(rules);
+
+    free(path);
+    return cached;
+}
+
+/***====================================================================***/
+
+/*
+ * Public rules handles. A handle owns its own parsed rules, rather than
+ * borrowing them from the context's cache, where they could be replaced
+ * while the handle is in use. The rules are never modified after they
+ * are loaded, and all the state of a lookup is in its matcher, so
+ * lookups from several threads do not interfere.
+ */
+struct xkb_rules {
+    int refcnt;
+    struct xkb_context *ctx;
+    char *name;
+    struct rules *rules;
+};
+
+XKB_EXPORT struct xkb_rules *
+xkb_rules_new(struct xkb_context *ctx, const char *name,
+              enum xkb_rules_flags flags)
+{
+    FILE *file;
+    char *path;
+    struct stat stat_buf;
+    struct rules *rules = NULL;
+    struct xkb_rules *handle;
+
+    if (flags & ~(XKB_RULES_NO_FLAGS)) {
+        log_err_func(ctx, "unrecognized flags: %#x\n", flags);
+        return NULL;
+    }
+
+    if (isempty(name))
+        name = xkb_context_get_default_rules(ctx);
+
+    file = FindFileInXkbPath(ctx, name, FILE_TYPE_RULES, &path);
+    if (!file)
+        return NULL;
+
+    if (fstat(fileno(file), &stat_buf) != 0)
+        log_err(ctx, "Couldn't stat rules file: %s\n", strerror(errno));
+    else
+        rules = rules_new_from_compiled(ctx, path, &stat_buf);
+    if (!rules)
+        rules = rules_new_from_file(ctx, file, name);
+
+    free(path);
+    fclose(file);
+    if (!rules)
+        return NULL;
+
+    handle = calloc(1, sizeof(*handle));
+    if (!handle) {
+        rules_free(rules);
+        return NULL;
+    }
+
+    handle->name = strdup(name);
+    if (!handle->name) {
+        rules_free(rules);
+        free(handle);
+        return NULL;
+    }
+
+    handle->refcnt = 1;
+    handle->ctx = xkb_context_ref(ctx);
+    handle->rules = rules;
+    return handle;
+}
+
+XKB_EXPORT struct xkb_rules *
+xkb_rules_ref(struct xkb_rules *handle)
+{
+    handle->refcnt++;
+    return handle;
+}
+
+XKB_EXPORT void
+xkb_rules_unref(struct xkb_rules *handle)
+{
+    if (!handle || --handle->refcnt > 0)
+        return;
+
+    rules_free(handle->rules);
+    free(handle->name);
+    xkb_context_unref(handle->ctx);
+    free(handle);
+}
+
+XKB_EXPORT int
+xkb_rules_get_components(struct xkb_rules *handle,
+                         const struct xkb_rule_names *names,
+                         struct xkb_component_names *out)
+{
+    struct xkb_rule_names rmlvo;
+    struct matcher *matcher;
+    bool ok;
+
+    if (names)
+        rmlvo = *names;
+    else
+        memset(&rmlvo, 0, sizeof(rmlvo));
+
+    rmlvo.rules = handle->name;
+    xkb_context_sanitize_rule_names(handle->ctx, &rmlvo);
+
+    matcher = matcher_new(handle->ctx, handle->rules, &rmlvo);
+    ok = matcher_match(matcher, out);
+    matcher_free(matcher);
+    return ok;
 }
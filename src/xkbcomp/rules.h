@@ -29,4 +29,21 @@ xkb_components_from_rules(struct xkb_context *ctx,
                           const struct xkb_rule_names *rmlvo,
                           struct xkb_component_names *out);
 
+/*
+ * Loads the rules file @rules into the cache of the context, if it is not
+ * there already, so that worker contexts can use it. Returns false if it
+ * could not be loaded or cached.
+ */
+bool
+xkb_rules_cache_load(struct xkb_context *ctx, const char *rules);
+
+/*
+ * Parses the rules file @rules and writes it as a precompiled rules
+ * file to @out_path, or if it is NULL, next to the rules file, where
+ * xkb_components_from_rules() looks for it.
+ */
+bool
+xkb_rules_precompile(struct xkb_context *ctx, const char *rules,
+                     const char *out_path);
+
 #endif
@@ -76,7 +76,7 @@ skip_more_whitespace_and_comments:
     while (isspace(peek(s))) next(s);
 
     /* Skip comments. */
-    if (lit(s, "//") || chr(s, '#')) {
+    if ((peek(s) == '/' && lit(s, "//")) || chr(s, '#')) {
         while (!eof(s) && !eol(s)) next(s);
         goto skip_more_whitespace_and_comments;
     }
@@ -147,11 +147,19 @@ skip_more_whitespace_and_comments:
 
     /* Identifier. */
     if (isalpha(peek(s)) || peek(s) == '_') {
-        s->buf_pos = 0;
+        const char *start = s->s + s->pos;
+        size_t len;
+
+        /* Identifiers never span lines, so don't go through next(). */
         while (isalnum(peek(s)) || peek(s) == '_')
-            buf_append(s, next(s));
-        if (!buf_append(s, '\0'))
+            s->pos++;
+        len = s->s + s->pos - start;
+        s->column += len;
+        if (len + 1 >= sizeof(s->buf))
             return scanner_error(yylloc, s, "identifier too long");
+        memcpy(s->buf, start, len);
+        s->buf[len] = '\0';
+        s->buf_pos = len + 1;
 
         /* Keyword. */
         tok = keyword_to_token(s->buf);
@@ -178,8 +186,15 @@ XkbParseString(struct xkb_context *ctx, const char *string, size_t len,
                const char *file_name, const char *map)
 {
     struct scanner scanner;
+    XkbFile *xkb_file;
+    uint64_t start = xkb_context_stat_timer_start(ctx);
+
     scanner_init(&scanner, ctx, string, len, file_name);
-    return parse(ctx, &scanner, map);
+    xkb_file = parse(ctx, &scanner, map);
+
+    xkb_context_stat_add(ctx, XKB_COMPILE_STAT_BYTES_SCANNED, scanner.pos);
+    xkb_context_stat_timer_stop(ctx, XKB_COMPILE_STAT_TIME_PARSE, start);
+    return xkb_file;
 }
 
 XkbFile *
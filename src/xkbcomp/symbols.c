@@ -58,6 +58,7 @@
 #include "vmod.h"
 #include "include.h"
 #include "keysym.h"
+#include "hashmap.h"
 
 enum key_repeat {
     KEY_REPEAT_UNDEFINED = 0,
@@ -179,6 +180,12 @@ typedef struct {
     darray(xkb_atom_t) group_names;
     darray(ModMapEntry) modMaps;
 
+    /* Key name -> index in keys. */
+    struct hashmap keys_by_name;
+    /* Keysym / key name -> index in modMaps. */
+    struct hashmap modmaps_by_sym;
+    struct hashmap modmaps_by_name;
+
     struct xkb_keymap *keymap;
 } SymbolsInfo;
 
@@ -192,6 +199,9 @@ InitSymbolsInfo(SymbolsInfo *info, struct xkb_keymap *keymap,
     InitKeyInfo(keymap->ctx, &info->default_key);
     info->actions = actions;
     info->explicit_group = XKB_LAYOUT_INVALID;
+    hashmap_init(&info->keys_by_name);
+    hashmap_init(&info->modmaps_by_sym);
+    hashmap_init(&info->modmaps_by_name);
 }
 
 static void
@@ -204,6 +214,9 @@ ClearSymbolsInfo(SymbolsInfo *info)
     darray_free(info->keys);
     darray_free(info->group_names);
     darray_free(info->modMaps);
+    hashmap_free(&info->keys_by_name);
+    hashmap_free(&info->modmaps_by_sym);
+    hashmap_free(&info->modmaps_by_name);
     ClearKeyInfo(&info->default_key);
 }
 
@@ -410,21 +423,24 @@ static bool
 AddKeySymbols(SymbolsInfo *info, KeyInfo *keyi, bool same_file)
 {
     xkb_atom_t real_name;
-    KeyInfo *iter;
+    uint32_t i;
 
     /*
      * Don't keep aliases in the keys array; this guarantees that
      * searching for keys to merge with by straight comparison (see the
-     * following loop) is enough, and we won't get multiple KeyInfo's
+     * following lookup) is enough, and we won't get multiple KeyInfo's
      * for the same key because of aliases.
      */
     real_name = XkbResolveKeyAlias(info->keymap, keyi->name);
     if (real_name != XKB_ATOM_NONE)
         keyi->name = real_name;
 
-    darray_foreach(iter, info->keys)
-        if (iter->name == keyi->name)
-            return MergeKeys(info, iter, keyi, same_file);
+    if (hashmap_lookup(&info->keys_by_name, keyi->name, &i))
+        return MergeKeys(info, &darray_item(info->keys, i), keyi, same_file);
+
+    if (!hashmap_insert(&info->keys_by_name, keyi->name,
+                        darray_size(info->keys)))
+        return false;
 
     darray_append(info->keys, *keyi);
     InitKeyInfo(info->keymap->ctx, keyi);
@@ -436,14 +452,15 @@ AddModMapEntry(SymbolsInfo *info, ModMapEntry *new)
 {
     ModMapEntry *old;
     bool clobber = (new->merge != MERGE_AUGMENT);
+    struct hashmap *by_key = (new->haveSymbol ? &info->modmaps_by_sym :
+                              &info->modmaps_by_name);
+    uint32_t key = (new->haveSymbol ? new->u.keySym : new->u.keyName);
+    uint32_t i;
 
-    darray_foreach(old, info->modMaps) {
+    if (hashmap_lookup(by_key, key, &i)) {
         xkb_mod_index_t use, ignore;
 
-        if ((new->haveSymbol != old->haveSymbol) ||
-            (new->haveSymbol && new->u.keySym != old->u.keySym) ||
-            (!new->haveSymbol && new->u.keyName != old->u.keyName))
-            continue;
+        old = &darray_item(info->modMaps, i);
 
         if (new->modifier == old->modifier)
             return true;
@@ -470,6 +487,9 @@ AddModMapEntry(SymbolsInfo *info, ModMapEntry *new)
         return true;
     }
 
+    if (!hashmap_insert(by_key, key, darray_size(info->modMaps)))
+        return false;
+
     darray_append(info->modMaps, *new);
     return true;
 }
@@ -1324,19 +1344,19 @@ FindKeyForSymbol(struct xkb_keymap *keymap, xkb_keysym_t sym)
  *
  * FIXME: Decide how to handle multiple-syms-per-level, and do it.
  */
-static xkb_atom_t
-FindAutomaticType(struct xkb_context *ctx, GroupInfo *groupi)
+xkb_atom_t
+FindAutomaticType(struct xkb_context *ctx, const struct xkb_level *levels,
+                  xkb_level_index_t width)
 {
     xkb_keysym_t sym0, sym1, sym2, sym3;
-    xkb_level_index_t width = darray_size(groupi->levels);
 
 #define GET_SYM(level) \
-    (darray_item(groupi->levels, level).num_syms == 0 ? \
+    (levels[level].num_syms == 0 ? \
         XKB_KEY_NoSymbol : \
-     darray_item(groupi->levels, level).num_syms == 1 ? \
-        darray_item(groupi->levels, level).u.sym : \
+     levels[level].num_syms == 1 ? \
+        levels[level].u.sym : \
      /* num_syms > 1 */ \
-        darray_item(groupi->levels, level).u.syms[0])
+        levels[level].u.syms[0])
 
     if (width == 1 || width <= 0)
         return xkb_atom_intern_literal(ctx, "ONE_LEVEL");
@@ -1391,7 +1411,9 @@ FindTypeForGroup(struct xkb_keymap *keymap, KeyInfo *keyi,
             type_name  = keyi->default_type;
         }
         else {
-            type_name = FindAutomaticType(keymap->ctx, groupi);
+            type_name = FindAutomaticType(keymap->ctx,
+                                          darray_mem(groupi->levels, 0),
+                                          darray_size(groupi->levels));
             if (type_name != XKB_ATOM_NONE)
                 *explicit_type = false;
         }
@@ -29,6 +29,7 @@
 #include "vmod.h"
 #include "expr.h"
 #include "include.h"
+#include "hashmap.h"
 
 /*
  * The xkb_types section
@@ -158,6 +159,8 @@ typedef struct {
     int errorCount;
 
     darray(KeyTypeInfo) types;
+    /* Type name -> index in types. */
+    struct hashmap types_by_name;
     struct xkb_keymap *keymap;
 } KeyTypesInfo;
 
@@ -214,6 +217,7 @@ InitKeyTypesInfo(KeyTypesInfo *info, struct xkb_keymap *keymap)
 {
     memset(info, 0, sizeof(*info));
     info->keymap = keymap;
+    hashmap_init(&info->types_by_name);
 }
 
 static void
@@ -228,18 +232,18 @@ ClearKeyTypesInfo(KeyTypesInfo *info)
 {
     free(info->name);
     darray_free(info->types);
+    hashmap_free(&info->types_by_name);
 }
 
 static KeyTypeInfo *
 FindMatchingKeyType(KeyTypesInfo *info, xkb_atom_t name)
 {
-    KeyTypeInfo *old;
+    uint32_t i;
 
-    darray_foreach(old, info->types)
-        if (old->name == name)
-            return old;
+    if (!hashmap_lookup(&info->types_by_name, name, &i))
+        return NULL;
 
-    return NULL;
+    return &darray_item(info->types, i);
 }
 
 static bool
@@ -275,6 +279,10 @@ AddKeyType(KeyTypesInfo *info, KeyTypeInfo *new, bool same_file)
         return true;
     }
 
+    if (!hashmap_insert(&info->types_by_name, new->name,
+                        darray_size(info->types)))
+        return false;
+
     darray_append(info->types, *new);
     return true;
 }
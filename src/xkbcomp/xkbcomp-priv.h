@@ -30,15 +30,20 @@
 #include "keymap.h"
 #include "ast.h"
 
-struct xkb_component_names {
-    char *keycodes;
-    char *types;
-    char *compat;
-    char *symbols;
-};
+/*
+ * The first line of every keymap we write out. Text which starts with it
+ * is loaded by LoadCanonicalKeymap() instead of the full compiler.
+ */
+#define CANONICAL_KEYMAP_HEADER "// xkbcommon canonical text_v1 keymap\n"
 
 char *
-text_v1_keymap_get_as_string(struct xkb_keymap *keymap);
+text_v1_keymap_get_as_string(struct xkb_keymap *keymap,
+                             enum xkb_keymap_serialize_flags flags);
+
+bool
+text_v1_keymap_write(struct xkb_keymap *keymap,
+                     enum xkb_keymap_serialize_flags flags,
+                     xkb_keymap_write_t sink, void *sink_data);
 
 XkbFile *
 XkbParseFile(struct xkb_context *ctx, FILE *file,
@@ -79,9 +84,20 @@ bool
 CompileKeymap(XkbFile *file, struct xkb_keymap *keymap,
               enum merge_mode merge);
 
+bool
+UpdateDerivedKeymapFields(struct xkb_keymap *keymap);
+
+bool
+LoadCanonicalKeymap(struct xkb_keymap *keymap, const char *string,
+                    size_t len);
+
 bool
 LookupKeysym(const char *str, xkb_keysym_t *sym_rtrn);
 
+xkb_atom_t
+FindAutomaticType(struct xkb_context *ctx, const struct xkb_level *levels,
+                  xkb_level_index_t width);
+
 /***====================================================================***/
 
 static inline bool
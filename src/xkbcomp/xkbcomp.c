@@ -56,6 +56,7 @@ text_v1_keymap_new_from_names(struct xkb_keymap *keymap,
     bool ok;
     struct xkb_component_names kccgst;
     XkbFile *file;
+    uint64_t start;
 
     log_dbg(keymap->ctx,
             "Compiling from RMLVO: rules '%s', model '%s', layout '%s', "
@@ -63,7 +64,10 @@ text_v1_keymap_new_from_names(struct xkb_keymap *keymap,
             rmlvo->rules, rmlvo->model, rmlvo->layout, rmlvo->variant,
             rmlvo->options);
 
+    start = xkb_context_stat_timer_start(keymap->ctx);
     ok = xkb_components_from_rules(keymap->ctx, rmlvo, &kccgst);
+    xkb_context_stat_timer_stop(keymap->ctx, XKB_COMPILE_STAT_TIME_RULES,
+                                start);
     if (!ok) {
         log_err(keymap->ctx,
                 "Couldn't look up rules '%s', model '%s', layout '%s', "
@@ -96,6 +100,38 @@ text_v1_keymap_new_from_names(struct xkb_keymap *keymap,
     return ok;
 }
 
+static bool
+text_v1_keymap_prepare_names(struct xkb_context *ctx,
+                             const struct xkb_rule_names *rmlvo)
+{
+    return xkb_rules_cache_load(ctx, rmlvo->rules);
+}
+
+/*
+ * Text written by xkb_keymap_get_as_string() is loaded directly, without
+ * going through the full compiler; see keymap-load.c. If that doesn't
+ * work out, the keymap is left as it was for the compiler to fill.
+ */
+static bool
+load_canonical_keymap(struct xkb_keymap *keymap,
+                      const char *string, size_t len)
+{
+    const size_t header_len = strlen(CANONICAL_KEYMAP_HEADER);
+
+    if (len < header_len ||
+        strncmp(string, CANONICAL_KEYMAP_HEADER, header_len) != 0)
+        return false;
+
+    if (LoadCanonicalKeymap(keymap, string, len))
+        return true;
+
+    log_dbg(keymap->ctx,
+            "Couldn't load the canonical keymap directly; "
+            "Falling back to the full compiler\n");
+    keymap_clear(keymap);
+    return false;
+}
+
 static bool
 text_v1_keymap_new_from_string(struct xkb_keymap *keymap,
                                const char *string, size_t len)
@@ -103,10 +139,13 @@ text_v1_keymap_new_from_string(struct xkb_keymap *keymap,
     bool ok;
     XkbFile *xkb_file;
 
+    if (load_canonical_keymap(keymap, string, len))
+        return true;
+
     xkb_file = XkbParseString(keymap->ctx, string, len, "(input string)", NULL);
     if (!xkb_file) {
         log_err(keymap->ctx, "Failed to parse input xkb string\n");
-        return NULL;
+        return false;
     }
 
     ok = compile_keymap_file(keymap, xkb_file);
@@ -119,8 +158,24 @@ text_v1_keymap_new_from_file(struct xkb_keymap *keymap, FILE *file)
 {
     bool ok;
     XkbFile *xkb_file;
+    const char *string;
+    size_t size;
+
+    ok = map_file(file, &string, &size);
+    if (!ok) {
+        log_err(keymap->ctx, "Couldn't read XKB file (unknown file): %s\n",
+                strerror(errno));
+        return false;
+    }
+
+    if (load_canonical_keymap(keymap, string, size)) {
+        unmap_file(string, size);
+        return true;
+    }
 
-    xkb_file = XkbParseFile(keymap->ctx, file, "(unknown file)", NULL);
+    xkb_file = XkbParseString(keymap->ctx, string, size, "(unknown file)",
+                              NULL);
+    unmap_file(string, size);
     if (!xkb_file) {
         log_err(keymap->ctx, "Failed to parse input xkb file\n");
         return false;
@@ -133,7 +188,9 @@ text_v1_keymap_new_from_file(struct xkb_keymap *keymap, FILE *file)
 
 const struct xkb_keymap_format_ops text_v1_keymap_format_ops = {
     .keymap_new_from_names = text_v1_keymap_new_from_names,
+    .keymap_prepare_names = text_v1_keymap_prepare_names,
     .keymap_new_from_string = text_v1_keymap_new_from_string,
     .keymap_new_from_file = text_v1_keymap_new_from_file,
     .keymap_get_as_string = text_v1_keymap_get_as_string,
+    .keymap_write = text_v1_keymap_write,
 };
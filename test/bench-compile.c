@@ -0,0 +1,249 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Benchmark keymap compilation from RMLVO names, over the rules and
+ * files in test/data.
+ *
+ * Each case is run in its own process, so that the peak RSS reported
+ * for it is its own. The results are printed to stdout, one line per
+ * case, as space separated key=value pairs; times are in nanoseconds,
+ * sizes in kilobytes.
+ */
+
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "test.h"
+
+#define DEFAULT_ITERATIONS 100
+
+struct bench_case {
+    const char *name;
+    struct xkb_rule_names rmlvo;
+};
+
+static const struct bench_case cases[] = {
+    {
+        .name = "single-layout",
+        .rmlvo = { "evdev", "pc105", "us", NULL, NULL },
+    },
+    {
+        .name = "four-layouts",
+        .rmlvo = { "evdev", "pc104", "us,ru,il,de", ",,,neo",
+                   "grp:menu_toggle" },
+    },
+    {
+        .name = "heavy-options",
+        .rmlvo = { "evdev", "pc105", "us,ca,ch", ",multix,fr",
+                   "grp:alt_shift_toggle,grp_led:scroll,ctrl:nocaps,"
+                   "compose:ralt,lv3:ralt_switch,eurosign:e,"
+                   "nbsp:level3n,keypad:pointerkeys,terminate:ctrl_alt_bksp,"
+                   "caps:shiftlock,shift:both_capslock" },
+    },
+};
+
+/*
+ * Count the allocations made by the library, by wrapping the glibc
+ * allocator.
+ */
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+static unsigned long num_allocs;
+
+void *
+malloc(size_t size)
+{
+    num_allocs++;
+    return __libc_malloc(size);
+}
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+    num_allocs++;
+    return __libc_calloc(nmemb, size);
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+    num_allocs++;
+    return __libc_realloc(ptr, size);
+}
+
+void
+free(void *ptr)
+{
+    __libc_free(ptr);
+}
+#define HAVE_ALLOC_COUNTS 1
+#endif
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int
+cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted array. */
+static uint64_t
+percentile(const uint64_t *sorted, int n, int p)
+{
+    int rank = (n * p + 99) / 100;
+
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static int
+run_case(const struct bench_case *bc, int iterations)
+{
+    struct xkb_context *ctx;
+    struct xkb_keymap *keymap;
+    struct rusage usage;
+    uint64_t *times, start;
+    unsigned long allocs = 0;
+    int i;
+
+    times = calloc(iterations, sizeof(*times));
+    if (!times)
+        return EXIT_FAILURE;
+
+    ctx = test_get_context(0);
+    if (!ctx)
+        return EXIT_FAILURE;
+
+    xkb_context_set_log_level(ctx, XKB_LOG_LEVEL_CRITICAL);
+    xkb_context_set_log_verbosity(ctx, 0);
+
+    /* Warm up the page cache and the atom table. */
+    keymap = xkb_keymap_new_from_names(ctx, &bc->rmlvo, 0);
+    if (!keymap) {
+        fprintf(stderr, "%s: failed to compile keymap\n", bc->name);
+        return EXIT_FAILURE;
+    }
+    xkb_keymap_unref(keymap);
+
+    for (i = 0; i < iterations; i++) {
+#ifdef HAVE_ALLOC_COUNTS
+        num_allocs = 0;
+#endif
+        start = now_ns();
+        keymap = xkb_keymap_new_from_names(ctx, &bc->rmlvo, 0);
+        times[i] = now_ns() - start;
+#ifdef HAVE_ALLOC_COUNTS
+        allocs = num_allocs;
+#endif
+        xkb_keymap_unref(keymap);
+    }
+
+    qsort(times, iterations, sizeof(*times), cmp_u64);
+    getrusage(RUSAGE_SELF, &usage);
+
+    printf("case=%s iterations=%d min_ns=%llu median_ns=%llu p99_ns=%llu "
+           "max_ns=%llu peak_rss_kb=%ld allocs=",
+           bc->name, iterations,
+           (unsigned long long) times[0],
+           (unsigned long long) percentile(times, iterations, 50),
+           (unsigned long long) percentile(times, iterations, 99),
+           (unsigned long long) times[iterations - 1],
+           usage.ru_maxrss);
+#ifdef HAVE_ALLOC_COUNTS
+    printf("%lu\n", allocs);
+#else
+    printf("-1\n");
+#endif
+    fflush(stdout);
+
+    xkb_context_unref(ctx);
+    free(times);
+    return EXIT_SUCCESS;
+}
+
+static int
+fork_case(const struct bench_case *bc, int iterations)
+{
+    pid_t pid;
+    int status;
+
+    fflush(stdout);
+
+    pid = fork();
+    if (pid < 0) {
+        perror("fork");
+        return EXIT_FAILURE;
+    }
+    if (pid == 0)
+        exit(run_case(bc, iterations));
+
+    if (waitpid(pid, &status, 0) < 0) {
+        perror("waitpid");
+        return EXIT_FAILURE;
+    }
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
+
+static const char *
+case_name(unsigned int idx)
+{
+    return cases[idx].name;
+}
+
+static int
+fork_case_at(unsigned int idx, int iterations)
+{
+    return fork_case(&cases[idx], iterations);
+}
+
+int
+main(int argc, char *argv[])
+{
+    const struct test_bench bench = {
+        .num_cases = ARRAY_SIZE(cases),
+        .default_iterations = DEFAULT_ITERATIONS,
+        .case_name = case_name,
+        .run_case = fork_case_at,
+    };
+
+    return test_bench_main(&bench, argc, argv);
+}
@@ -0,0 +1,161 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+ * Benchmark the keysym to Unicode conversions, one keysym at a time and
+ * in bulk, over every legacy keysym (below 0x10000) and the first plane of
+ * the directly encoded Unicode keysyms; and the conversion of the
+ * resulting text back to keysyms, one character at a time as when typing
+ * it.
+ *
+ * The results are printed to stdout, one line per case, as space
+ * separated key=value pairs; times are in nanoseconds per keysym.
+ */
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "test.h"
+
+#define DEFAULT_ITERATIONS 200
+
+struct bench_case {
+    const char *name;
+    xkb_keysym_t first;
+    xkb_keysym_t last;
+    /* Only the keysyms which have a Unicode equivalent. */
+    bool mapped_only;
+};
+
+static const struct bench_case cases[] = {
+    { .name = "ascii", .first = 0x0020, .last = 0x007e,
+      .mapped_only = true },
+    { .name = "latin1", .first = 0x0000, .last = 0x00ff,
+      .mapped_only = true },
+    { .name = "legacy", .first = 0x0100, .last = 0xffff,
+      .mapped_only = true },
+    { .name = "all-legacy", .first = 0x0000, .last = 0xffff,
+      .mapped_only = false },
+    { .name = "unicode", .first = 0x01000000, .last = 0x0100ffff,
+      .mapped_only = false },
+};
+
+static uint64_t
+now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int
+run_case(const struct bench_case *bc, int iterations)
+{
+    xkb_keysym_t *keysyms, ks;
+    uint64_t start, utf32_ns, utf8_ns, bulk_utf32_ns, bulk_utf8_ns;
+    uint64_t from_utf32_ns;
+    uint32_t count = 0, sum = 0, len, j;
+    uint32_t *utf32;
+    char buf[7], *utf8;
+    int i;
+
+    keysyms = calloc(bc->last - bc->first + 1, sizeof(*keysyms));
+    utf32 = calloc(bc->last - bc->first + 1, sizeof(*utf32));
+    utf8 = calloc(bc->last - bc->first + 1, 6);
+    if (!keysyms || !utf32 || !utf8)
+        return EXIT_FAILURE;
+
+    for (ks = bc->first; ks <= bc->last; ks++)
+        if (!bc->mapped_only || xkb_keysym_to_utf32(ks) != 0)
+            keysyms[count++] = ks;
+
+    start = now_ns();
+    for (i = 0; i < iterations; i++)
+        for (j = 0; j < count; j++)
+            sum += xkb_keysym_to_utf32(keysyms[j]);
+    utf32_ns = now_ns() - start;
+
+    start = now_ns();
+    for (i = 0; i < iterations; i++)
+        for (j = 0; j < count; j++)
+            sum += xkb_keysym_to_utf8(keysyms[j], buf, sizeof(buf));
+    utf8_ns = now_ns() - start;
+
+    start = now_ns();
+    for (i = 0; i < iterations; i++)
+        sum += xkb_keysyms_to_utf32(keysyms, count, utf32, count);
+    bulk_utf32_ns = now_ns() - start;
+
+    len = xkb_keysyms_to_utf32(keysyms, count, utf32, count);
+    start = now_ns();
+    for (i = 0; i < iterations; i++)
+        for (j = 0; j < len; j++)
+            sum += xkb_utf32_to_keysym(utf32[j]);
+    from_utf32_ns = now_ns() - start;
+
+    start = now_ns();
+    for (i = 0; i < iterations; i++)
+        sum += xkb_keysyms_to_utf8(keysyms, count, utf8, count * 6);
+    bulk_utf8_ns = now_ns() - start;
+
+    printf("case=%s keysyms=%u iterations=%d utf32_ns=%.2f utf8_ns=%.2f "
+           "bulk_utf32_ns=%.2f bulk_utf8_ns=%.2f from_utf32_ns=%.2f "
+           "checksum=%u\n",
+           bc->name, count, iterations,
+           (double) utf32_ns / count / iterations,
+           (double) utf8_ns / count / iterations,
+           (double) bulk_utf32_ns / count / iterations,
+           (double) bulk_utf8_ns / count / iterations,
+           len ? (double) from_utf32_ns / len / iterations : 0.0,
+           sum);
+
+    free(utf8);
+    free(utf32);
+    free(keysyms);
+    return EXIT_SUCCESS;
+}
+
+static const char *
+case_name(unsigned int idx)
+{
+    return cases[idx].name;
+}
+
+static int
+run_case_at(unsigned int idx, int iterations)
+{
+    return run_case(&cases[idx], iterations);
+}
+
+int
+main(int argc, char *argv[])
+{
+    const struct test_bench bench = {
+        .num_cases = ARRAY_SIZE(cases),
+        .default_iterations = DEFAULT_ITERATIONS,
+        .case_name = case_name,
+        .run_case = run_case_at,
+    };
+
+    return test_bench_main(&bench, argc, argv);
+}
@@ -339,3 +339,64 @@ test_compile_rules(struct xkb_context *context, const char *rules,
 
     return keymap;
 }
+
+static void
+bench_usage(const struct test_bench *bench, const char *argv0)
+{
+    unsigned int i;
+
+    fprintf(stderr, "Usage: %s [-n <iterations>] [case...]\n", argv0);
+    fprintf(stderr, "Cases:");
+    for (i = 0; i < bench->num_cases; i++)
+        fprintf(stderr, " %s", bench->case_name(i));
+    fprintf(stderr, "\n");
+}
+
+int
+test_bench_main(const struct test_bench *bench, int argc, char *argv[])
+{
+    int ret = EXIT_SUCCESS;
+    int iterations = bench->default_iterations;
+    int opt, i;
+    unsigned int j;
+
+    while ((opt = getopt(argc, argv, "n:h")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = atoi(optarg);
+            if (iterations <= 0) {
+                bench_usage(bench, argv[0]);
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'h':
+        case '?':
+            bench_usage(bench, argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (optind == argc) {
+        for (j = 0; j < bench->num_cases; j++)
+            if (bench->run_case(j, iterations) != EXIT_SUCCESS)
+                ret = EXIT_FAILURE;
+        return ret;
+    }
+
+    for (i = optind; i < argc; i++) {
+        for (j = 0; j < bench->num_cases; j++)
+            if (streq(argv[i], bench->case_name(j)))
+                break;
+
+        if (j >= bench->num_cases) {
+            fprintf(stderr, "Unknown case: %s\n", argv[i]);
+            bench_usage(bench, argv[0]);
+            exit(EXIT_FAILURE);
+        }
+
+        if (bench->run_case(j, iterations) != EXIT_SUCCESS)
+            ret = EXIT_FAILURE;
+    }
+
+    return ret;
+}
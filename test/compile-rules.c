@@ -0,0 +1,76 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <unistd.h>
+
+#include "test.h"
+#include "xkbcomp-priv.h"
+#include "rules.h"
+
+int
+main(int argc, char *argv[])
+{
+    int opt;
+    const char *rules = "evdev";
+    const char *output = NULL;
+    const char *include = NULL;
+    struct xkb_context *ctx;
+    bool ok;
+
+    while ((opt = getopt(argc, argv, "r:o:I:h")) != -1) {
+        switch (opt) {
+        case 'r':
+            rules = optarg;
+            break;
+        case 'o':
+            output = optarg;
+            break;
+        case 'I':
+            include = optarg;
+            break;
+        case 'h':
+        case '?':
+            fprintf(stderr, "Usage: %s [-r <rules>] [-o <output>] "
+                    "[-I <include path>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (include) {
+        ctx = xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES);
+        if (ctx && !xkb_context_include_path_append(ctx, include)) {
+            xkb_context_unref(ctx);
+            ctx = NULL;
+        }
+    }
+    else {
+        ctx = test_get_context(0);
+    }
+    if (!ctx) {
+        fprintf(stderr, "Failed to get xkb context\n");
+        return 1;
+    }
+
+    ok = xkb_rules_precompile(ctx, rules, output);
+
+    xkb_context_unref(ctx);
+    return ok ? 0 : 1;
+}
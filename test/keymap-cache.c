@@ -0,0 +1,153 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "test.h"
+
+static struct xkb_keymap *
+compile(struct xkb_context *ctx, const char *layout)
+{
+    return test_compile_rules(ctx, "evdev", "pc105", layout, NULL, NULL);
+}
+
+int
+main(void)
+{
+    struct xkb_context *ctx;
+    struct xkb_keymap *us, *de, *ru, *keymap;
+    char *path, *str;
+
+    ctx = test_get_context(0);
+    assert(ctx);
+
+    /* Disabled by default. */
+    us = compile(ctx, "us");
+    keymap = compile(ctx, "us");
+    assert(us && keymap && us != keymap);
+    xkb_keymap_unref(keymap);
+    xkb_keymap_unref(us);
+
+    xkb_context_set_keymap_cache_size(ctx, 2);
+
+    /* The names are compared after the defaults are applied. */
+    us = compile(ctx, "us");
+    assert(us);
+    keymap = test_compile_rules(ctx, NULL, NULL, NULL, NULL, NULL);
+    assert(keymap == us);
+    xkb_keymap_unref(keymap);
+    keymap = test_compile_rules(ctx, "", "", "us", "", NULL);
+    assert(keymap == us);
+    xkb_keymap_unref(keymap);
+
+    /* Keymaps with statistics are not cached. */
+    keymap = xkb_keymap_new_from_names(ctx, NULL, XKB_MAP_COMPILE_STATS);
+    assert(keymap && keymap != us);
+    xkb_keymap_unref(keymap);
+
+    /* The least recently used keymap is evicted. */
+    de = compile(ctx, "de");
+    assert(de && de != us);
+    keymap = compile(ctx, "us");
+    assert(keymap == us);
+    xkb_keymap_unref(keymap);
+    ru = compile(ctx, "ru");
+    assert(ru);
+    keymap = compile(ctx, "us");
+    assert(keymap == us);
+    xkb_keymap_unref(keymap);
+    keymap = compile(ctx, "de");
+    assert(keymap && keymap != de);
+    xkb_keymap_unref(keymap);
+    xkb_keymap_unref(de);
+    xkb_keymap_unref(ru);
+
+    /* Explicit invalidation. */
+    xkb_context_invalidate_keymap_cache(ctx);
+    keymap = compile(ctx, "us");
+    assert(keymap && keymap != us);
+    xkb_keymap_unref(keymap);
+    xkb_keymap_unref(us);
+
+    /* Changing the include path invalidates the cache. */
+    path = test_get_path("");
+    assert(path);
+    keymap = compile(ctx, "us");
+    xkb_context_include_path_clear(ctx);
+    assert(xkb_context_include_path_append(ctx, path));
+    us = compile(ctx, "us");
+    assert(us && us != keymap);
+    xkb_keymap_unref(keymap);
+    free(path);
+
+    /* Shrinking the cache evicts. */
+    xkb_context_set_keymap_cache_size(ctx, 0);
+    keymap = compile(ctx, "us");
+    assert(keymap && keymap != us);
+    xkb_keymap_unref(keymap);
+    xkb_keymap_unref(us);
+
+    /* Keymaps from identical text. */
+    xkb_context_set_keymap_cache_size(ctx, 4);
+    us = compile(ctx, "us");
+    assert(us);
+    str = xkb_keymap_get_as_string(us, XKB_KEYMAP_FORMAT_TEXT_V1);
+    assert(str);
+    keymap = xkb_keymap_new_from_string(ctx, str, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        0);
+    assert(keymap && keymap != us);
+    de = xkb_keymap_new_from_buffer(ctx, str, strlen(str),
+                                    XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    assert(de == keymap);
+    xkb_keymap_unref(de);
+    /* A different text, even if only by one byte. */
+    de = xkb_keymap_new_from_buffer(ctx, str, strlen(str) - 1,
+                                    XKB_KEYMAP_FORMAT_TEXT_V1, 0);
+    assert(de && de != keymap);
+    xkb_keymap_unref(de);
+    xkb_keymap_unref(keymap);
+    xkb_keymap_unref(us);
+    free(str);
+    xkb_context_set_keymap_cache_size(ctx, 0);
+
+    /*
+     * The cached keymaps hold references on the context; it must still
+     * be freed when the user is done with it, in either order.
+     */
+    xkb_context_set_keymap_cache_size(ctx, 4);
+    us = compile(ctx, "us");
+    de = compile(ctx, "de");
+    assert(us && de);
+    xkb_keymap_unref(de);
+    xkb_context_unref(ctx);
+    str = xkb_keymap_get_as_string(us, XKB_KEYMAP_USE_ORIGINAL_FORMAT);
+    assert(str);
+    free(str);
+    xkb_keymap_unref(us);
+
+    ctx = test_get_context(0);
+    assert(ctx);
+    xkb_context_set_keymap_cache_size(ctx, 4);
+    us = compile(ctx, "us");
+    assert(us);
+    xkb_keymap_unref(us);
+    xkb_context_unref(ctx);
+
+    return 0;
+}
@@ -0,0 +1,308 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "test.h"
+#include "xkbcomp-priv.h"
+
+/*
+ * Checks that dumped keymaps, which are loaded directly, end up the same
+ * as when the full compiler goes through them.
+ */
+
+static struct xkb_keymap *
+load(struct xkb_context *ctx, const char *string, bool direct)
+{
+    struct xkb_keymap *keymap;
+
+    keymap = xkb_keymap_new_from_string(ctx, string,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_MAP_COMPILE_STATS);
+    assert(keymap);
+
+    /* Only the compiler builds a syntax tree. */
+    if (direct)
+        assert(xkb_keymap_get_compile_stat(keymap,
+                                           XKB_COMPILE_STAT_AST_NODES) == 0);
+    else
+        assert(xkb_keymap_get_compile_stat(keymap,
+                                           XKB_COMPILE_STAT_AST_NODES) > 0);
+
+    return keymap;
+}
+
+static void
+assert_actions_equal(const union xkb_action *a, const union xkb_action *b)
+{
+    assert(memcmp(a, b, sizeof(*a)) == 0);
+}
+
+static void
+assert_keys_equal(struct xkb_keymap *a, struct xkb_keymap *b)
+{
+    xkb_keycode_t kc;
+    xkb_layout_index_t i;
+    xkb_level_index_t j;
+    unsigned int k;
+
+    assert(a->min_key_code == b->min_key_code);
+    assert(a->max_key_code == b->max_key_code);
+
+    for (kc = a->min_key_code; kc <= a->max_key_code; kc++) {
+        const struct xkb_key *ka = &a->keys[kc], *kb = &b->keys[kc];
+
+        assert(ka->keycode == kb->keycode);
+        assert(ka->name == kb->name);
+        assert(ka->explicit == kb->explicit);
+        assert(ka->modmap == kb->modmap);
+        assert(ka->vmodmap == kb->vmodmap);
+        assert(ka->repeats == kb->repeats);
+        assert(ka->out_of_range_group_action == kb->out_of_range_group_action);
+        assert(ka->out_of_range_group_number == kb->out_of_range_group_number);
+        assert(ka->num_groups == kb->num_groups);
+
+        for (i = 0; i < ka->num_groups; i++) {
+            const struct xkb_group *ga = &ka->groups[i], *gb = &kb->groups[i];
+
+            assert(ga->explicit_type == gb->explicit_type);
+            assert(ga->type - a->types == gb->type - b->types);
+
+            for (j = 0; j < ga->type->num_levels; j++) {
+                const struct xkb_level *la = &ga->levels[j];
+                const struct xkb_level *lb = &gb->levels[j];
+
+                assert(la->num_syms == lb->num_syms);
+                if (la->num_syms == 1)
+                    assert(la->u.sym == lb->u.sym);
+                for (k = 0; la->num_syms > 1 && k < la->num_syms; k++)
+                    assert(la->u.syms[k] == lb->u.syms[k]);
+                assert_actions_equal(&la->action, &lb->action);
+            }
+        }
+    }
+
+    assert(a->num_key_aliases == b->num_key_aliases);
+    for (k = 0; k < a->num_key_aliases; k++) {
+        assert(a->key_aliases[k].alias == b->key_aliases[k].alias);
+        assert(a->key_aliases[k].real == b->key_aliases[k].real);
+    }
+}
+
+static void
+assert_keymaps_equal(struct xkb_keymap *a, struct xkb_keymap *b)
+{
+    unsigned int i, j;
+    char *dump_a, *dump_b;
+
+    assert_keys_equal(a, b);
+
+    assert(a->num_types == b->num_types);
+    for (i = 0; i < a->num_types; i++) {
+        const struct xkb_key_type *ta = &a->types[i], *tb = &b->types[i];
+
+        assert(ta->name == tb->name);
+        assert(ta->mods.mods == tb->mods.mods);
+        assert(ta->mods.mask == tb->mods.mask);
+        assert(ta->num_levels == tb->num_levels);
+        assert(ta->num_entries == tb->num_entries);
+        for (j = 0; j < ta->num_entries; j++) {
+            assert(ta->entries[j].level == tb->entries[j].level);
+            assert(ta->entries[j].mods.mods == tb->entries[j].mods.mods);
+            assert(ta->entries[j].mods.mask == tb->entries[j].mods.mask);
+            assert(ta->entries[j].preserve.mods ==
+                   tb->entries[j].preserve.mods);
+            assert(ta->entries[j].preserve.mask ==
+                   tb->entries[j].preserve.mask);
+        }
+    }
+
+    assert(a->num_sym_interprets == b->num_sym_interprets);
+    for (i = 0; i < a->num_sym_interprets; i++) {
+        const struct xkb_sym_interpret *sa = &a->sym_interprets[i];
+        const struct xkb_sym_interpret *sb = &b->sym_interprets[i];
+
+        assert(sa->sym == sb->sym);
+        assert(sa->match == sb->match);
+        assert(sa->level_one_only == sb->level_one_only);
+        assert(sa->mods == sb->mods);
+        assert(sa->virtual_mod == sb->virtual_mod);
+        assert(sa->repeat == sb->repeat);
+        assert_actions_equal(&sa->action, &sb->action);
+    }
+
+    assert(darray_size(a->mods) == darray_size(b->mods));
+    for (i = 0; i < darray_size(a->mods); i++) {
+        assert(darray_item(a->mods, i).name == darray_item(b->mods, i).name);
+        assert(darray_item(a->mods, i).type == darray_item(b->mods, i).type);
+        assert(darray_item(a->mods, i).mapping ==
+               darray_item(b->mods, i).mapping);
+    }
+
+    assert(darray_size(a->leds) == darray_size(b->leds));
+    for (i = 0; i < darray_size(a->leds); i++) {
+        const struct xkb_led *la = &darray_item(a->leds, i);
+        const struct xkb_led *lb = &darray_item(b->leds, i);
+
+        assert(la->name == lb->name);
+        assert(la->which_groups == lb->which_groups);
+        assert(la->groups == lb->groups);
+        assert(la->which_mods == lb->which_mods);
+        assert(la->mods.mods == lb->mods.mods);
+        assert(la->mods.mask == lb->mods.mask);
+        assert(la->ctrls == lb->ctrls);
+    }
+
+    assert(a->enabled_ctrls == b->enabled_ctrls);
+    assert(a->num_groups == b->num_groups);
+    assert(a->num_group_names == b->num_group_names);
+    for (i = 0; i < a->num_group_names; i++)
+        assert(a->group_names[i] == b->group_names[i]);
+
+    assert(streq_null(a->keycodes_section_name, b->keycodes_section_name));
+    assert(streq_null(a->types_section_name, b->types_section_name));
+    assert(streq_null(a->compat_section_name, b->compat_section_name));
+    assert(streq_null(a->symbols_section_name, b->symbols_section_name));
+
+    /* Covers the rest, e.g. the level names. */
+    dump_a = xkb_keymap_get_as_string(a, XKB_KEYMAP_FORMAT_TEXT_V1);
+    dump_b = xkb_keymap_get_as_string(b, XKB_KEYMAP_FORMAT_TEXT_V1);
+    assert(dump_a && dump_b);
+    assert(streq(dump_a, dump_b));
+    free(dump_a);
+    free(dump_b);
+}
+
+static struct xkb_keymap *
+load_file(struct xkb_context *ctx, const char *string)
+{
+    struct xkb_keymap *keymap;
+    FILE *file;
+
+    file = tmpfile();
+    assert(file);
+    assert(fputs(string, file) >= 0);
+    rewind(file);
+
+    keymap = xkb_keymap_new_from_file(ctx, file, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                      XKB_MAP_COMPILE_STATS);
+    assert(keymap);
+    assert(xkb_keymap_get_compile_stat(keymap,
+                                       XKB_COMPILE_STAT_AST_NODES) == 0);
+
+    fclose(file);
+    return keymap;
+}
+
+static void
+test_dump(struct xkb_context *ctx, struct xkb_keymap *keymap,
+          enum xkb_keymap_serialize_flags flags)
+{
+    const size_t header_len = strlen(CANONICAL_KEYMAP_HEADER);
+    struct xkb_keymap *direct, *from_file, *compiled;
+    char *dump;
+
+    dump = xkb_keymap_get_as_string_flags(keymap, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                          flags);
+    assert(dump);
+    assert(strncmp(dump, CANONICAL_KEYMAP_HEADER, header_len) == 0);
+
+    /* Without the header, the text goes through the compiler. */
+    direct = load(ctx, dump, true);
+    from_file = load_file(ctx, dump);
+    compiled = load(ctx, dump + header_len, false);
+    assert_keymaps_equal(direct, compiled);
+    assert_keymaps_equal(from_file, compiled);
+
+    xkb_keymap_unref(direct);
+    xkb_keymap_unref(from_file);
+    xkb_keymap_unref(compiled);
+    free(dump);
+}
+
+static void
+test_keymap(struct xkb_context *ctx, struct xkb_keymap *keymap)
+{
+    assert(keymap);
+    test_dump(ctx, keymap, 0);
+    test_dump(ctx, keymap, XKB_KEYMAP_SERIALIZE_MINIFY);
+    xkb_keymap_unref(keymap);
+}
+
+/* Text which only looks canonical is left to the compiler. */
+static void
+test_fallback(struct xkb_context *ctx)
+{
+    const char *string =
+        CANONICAL_KEYMAP_HEADER
+        "xkb_keymap {\n"
+        "xkb_keycodes { <A> = 38; };\n"
+        "xkb_types { };\n"
+        "xkb_compat { };\n"
+        "xkb_symbols {\n"
+        "    key <A> { [ a ] };\n"
+        "    override key <A> { [ b ] };\n"
+        "};\n"
+        "};\n";
+    struct xkb_keymap *keymap, *compiled;
+    const xkb_keysym_t *syms;
+    char *dump;
+
+    keymap = load(ctx, string, false);
+    assert(xkb_keymap_key_get_syms_by_level(keymap, 38, 0, 0, &syms) == 1);
+    assert(syms[0] == XKB_KEY_b);
+    xkb_keymap_unref(keymap);
+
+    /* Symbols for the empty key name, which no keycode can have. */
+    keymap = test_compile_file(ctx, "keymaps/quartz.xkb");
+    assert(keymap);
+    dump = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+    assert(dump);
+    compiled = load(ctx, dump, false);
+    xkb_keymap_unref(compiled);
+    xkb_keymap_unref(keymap);
+    free(dump);
+}
+
+int
+main(void)
+{
+    struct xkb_context *ctx = test_get_context(0);
+    char *original;
+
+    assert(ctx);
+
+    original = test_read_file("keymaps/stringcomp.data");
+    assert(original);
+    test_keymap(ctx, test_compile_string(ctx, original));
+    free(original);
+
+    test_keymap(ctx, test_compile_file(ctx, "keymaps/basic.xkb"));
+    test_keymap(ctx, test_compile_file(ctx,
+                                       "keymaps/comprehensive-plus-geom.xkb"));
+    test_keymap(ctx, test_compile_file(ctx, "keymaps/unbound-vmod.xkb"));
+    test_keymap(ctx, test_compile_rules(ctx, "evdev", "pc105", "us,de,ru",
+                                        NULL, "grp:alt_shift_toggle"));
+
+    test_fallback(ctx);
+
+    xkb_context_unref(ctx);
+
+    return 0;
+}
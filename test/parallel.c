@@ -0,0 +1,246 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test.h"
+#include "context.h"
+
+#pragma GCC diagnostic ignored "-Wmissing-format-attribute"
+
+ATTR_PRINTF(3, 0) static void
+log_fn(struct xkb_context *ctx, enum xkb_log_level level,
+       const char *fmt, va_list args)
+{
+    char *s;
+    int size;
+    darray_char *ls = xkb_context_get_user_data(ctx);
+    assert(ls);
+
+    size = vasprintf(&s, fmt, args);
+    assert(size != -1);
+
+    darray_append_string(*ls, s);
+    free(s);
+}
+
+static struct xkb_context *
+get_context(darray_char *log_string)
+{
+    struct xkb_context *ctx = test_get_context(0);
+
+    assert(ctx);
+    xkb_context_set_log_level(ctx, XKB_LOG_LEVEL_DEBUG);
+    xkb_context_set_log_verbosity(ctx, 10);
+    xkb_context_set_user_data(ctx, log_string);
+    xkb_context_set_log_fn(ctx, log_fn);
+    /* Run the workers even on a single CPU. */
+    xkb_context_set_num_cpus(ctx, 4);
+
+    return ctx;
+}
+
+static char *
+compile(const struct xkb_rule_names *rmlvo, const char *string,
+        enum xkb_keymap_compile_flags flags, darray_char *log_string)
+{
+    struct xkb_context *ctx = get_context(log_string);
+    struct xkb_keymap *keymap;
+    char *dump = NULL;
+
+    if (rmlvo)
+        keymap = xkb_keymap_new_from_names(ctx, rmlvo, flags);
+    else
+        keymap = xkb_keymap_new_from_string(ctx, string,
+                                            XKB_KEYMAP_FORMAT_TEXT_V1, flags);
+    if (keymap)
+        dump = xkb_keymap_get_as_string(keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+
+    xkb_keymap_unref(keymap);
+    xkb_context_unref(ctx);
+    return dump;
+}
+
+/*
+ * Compile with and without XKB_MAP_COMPILE_PARALLEL, in separate contexts,
+ * and check that we get the same keymap and log.
+ */
+static void
+test_compile(const struct xkb_rule_names *rmlvo, const char *string)
+{
+    darray_char log_sequential, log_parallel;
+    char *sequential, *parallel;
+
+    darray_init(log_sequential);
+    darray_init(log_parallel);
+
+    sequential = compile(rmlvo, string, 0, &log_sequential);
+    parallel = compile(rmlvo, string, XKB_MAP_COMPILE_PARALLEL,
+                       &log_parallel);
+
+    assert(streq_null(sequential, parallel));
+    assert(darray_size(log_sequential) == darray_size(log_parallel));
+    assert(darray_empty(log_sequential) ||
+           streq(darray_mem(log_sequential, 0), darray_mem(log_parallel, 0)));
+
+    free(sequential);
+    free(parallel);
+    darray_free(log_sequential);
+    darray_free(log_parallel);
+}
+
+static void
+test_names(const char *layout, const char *variant, const char *options)
+{
+    struct xkb_rule_names rmlvo = {
+        .rules = "evdev",
+        .model = "pc105",
+        .layout = layout,
+        .variant = variant,
+        .options = options,
+    };
+
+    fprintf(stderr, "Compiling %s (%s) [%s]\n", layout, strnull(variant),
+            strnull(options));
+    test_compile(&rmlvo, NULL);
+}
+
+static char *
+dump_keymap(struct xkb_keymap *keymap)
+{
+    if (!keymap)
+        return NULL;
+    return xkb_keymap_get_as_string(keymap, XKB_KEYMAP_FORMAT_TEXT_V1);
+}
+
+/*
+ * Compile a batch of names at once, and each of them in turn, in separate
+ * contexts with a keymap cache of @cache_size, and check that we get the
+ * same keymaps and log.
+ */
+static void
+test_batch(const struct xkb_rule_names *names, size_t num_names,
+           unsigned int cache_size)
+{
+    darray_char log_sequential, log_batch;
+    struct xkb_context *ctx_sequential, *ctx_batch;
+    struct xkb_keymap *keymaps[16], *keymap;
+    char *sequential, *batch;
+    int num_keymaps = 0;
+
+    assert(num_names <= ARRAY_SIZE(keymaps));
+    fprintf(stderr, "Compiling a batch of %zu, cache size %u\n",
+            num_names, cache_size);
+
+    darray_init(log_sequential);
+    darray_init(log_batch);
+    /* With 4 CPUs, batches of 2 or more keymaps use workers. */
+    ctx_sequential = get_context(&log_sequential);
+    ctx_batch = get_context(&log_batch);
+    xkb_context_set_keymap_cache_size(ctx_sequential, cache_size);
+    xkb_context_set_keymap_cache_size(ctx_batch, cache_size);
+
+    assert(xkb_keymap_new_from_names_batch(ctx_batch, names, num_names,
+                                           keymaps, 0) >= 0);
+
+    for (size_t i = 0; i < num_names; i++) {
+        keymap = xkb_keymap_new_from_names(ctx_sequential, &names[i], 0);
+        sequential = dump_keymap(keymap);
+        batch = dump_keymap(keymaps[i]);
+        assert(streq_null(sequential, batch));
+        if (keymaps[i])
+            num_keymaps++;
+        free(sequential);
+        free(batch);
+        xkb_keymap_unref(keymap);
+        xkb_keymap_unref(keymaps[i]);
+    }
+
+    assert(xkb_keymap_new_from_names_batch(ctx_batch, names, num_names,
+                                           keymaps, 0) == num_keymaps);
+    for (size_t i = 0; i < num_names; i++)
+        xkb_keymap_unref(keymaps[i]);
+    for (size_t i = 0; i < num_names; i++)
+        xkb_keymap_unref(xkb_keymap_new_from_names(ctx_sequential,
+                                                   &names[i], 0));
+
+    assert(darray_size(log_sequential) == darray_size(log_batch));
+    assert(darray_empty(log_sequential) ||
+           streq(darray_mem(log_sequential, 0), darray_mem(log_batch, 0)));
+
+    xkb_context_unref(ctx_sequential);
+    xkb_context_unref(ctx_batch);
+    darray_free(log_sequential);
+    darray_free(log_batch);
+}
+
+int
+main(void)
+{
+    const struct xkb_rule_names batch[] = {
+        { "evdev", "pc105", "us", NULL, NULL },
+        { "evdev", "pc105", "de", "neo", "grp:menu_toggle" },
+        { "evdev", "pc105", "us,nonexistent", NULL, NULL },
+        { "nonexistent", "pc105", "us", NULL, NULL },
+        { "evdev", "pc105", "us", NULL, NULL },
+        { "evdev", "pc104", "ru,us", NULL, "ctrl:nocaps" },
+        { "evdev", "pc105", "de", "nonexistent", NULL },
+        { "evdev", "pc105", "de", "neo", "grp:menu_toggle" },
+        { "nonexistent", "pc105", "us", NULL, NULL },
+        { "evdev", "pc105", "ch", "fr", NULL },
+    };
+
+    test_names("us", NULL, NULL);
+    test_names("us,ru,il,de", ",,,neo", "grp:menu_toggle");
+    test_names("us,ca,ch", ",multix,fr",
+               "grp:alt_shift_toggle,grp_led:scroll,ctrl:nocaps,"
+               "compose:ralt,lv3:ralt_switch,eurosign:e,nbsp:level3n,"
+               "keypad:pointerkeys,terminate:ctrl_alt_bksp,"
+               "caps:shiftlock,shift:both_capslock");
+    /* Missing files and maps must be reported the same way. */
+    test_names("us,nonexistent", NULL, NULL);
+    test_names("de", "nonexistent", NULL);
+
+    test_compile(NULL,
+                 "xkb_keymap {\n"
+                 "    xkb_keycodes { include \"evdev+aliases(qwerty)\" };\n"
+                 "    xkb_types { include \"complete\" };\n"
+                 "    xkb_compat { include \"complete+nonexistent\" };\n"
+                 "    xkb_symbols { include \"pc+us+inet(evdev)\" };\n"
+                 "};");
+    test_compile(NULL,
+                 "xkb_keymap {\n"
+                 "    xkb_keycodes { include \"evdev+aliases(qwerty)\" };\n"
+                 "    xkb_types { include \"complete\" };\n"
+                 "    xkb_compat { include \"complete\" };\n"
+                 "    xkb_symbols { include \"pc+us+inet(evdev)+ru:2\" };\n"
+                 "};");
+
+    test_batch(batch, ARRAY_SIZE(batch), 0);
+    test_batch(batch, ARRAY_SIZE(batch), 2);
+    test_batch(batch, ARRAY_SIZE(batch), 16);
+    test_batch(batch, 1, 16);
+    test_batch(batch, 0, 16);
+
+    return 0;
+}
@@ -25,6 +25,71 @@
 
 #include "test.h"
 
+static const char *stat_names[_XKB_COMPILE_STAT_NUM_ENTRIES] = {
+    [XKB_COMPILE_STAT_TIME_TOTAL] = "time-total-ns",
+    [XKB_COMPILE_STAT_TIME_RULES] = "time-rules-ns",
+    [XKB_COMPILE_STAT_TIME_INCLUDES] = "time-includes-ns",
+    [XKB_COMPILE_STAT_TIME_PARSE] = "time-parse-ns",
+    [XKB_COMPILE_STAT_TIME_KEYCODES] = "time-keycodes-ns",
+    [XKB_COMPILE_STAT_TIME_TYPES] = "time-types-ns",
+    [XKB_COMPILE_STAT_TIME_COMPAT] = "time-compat-ns",
+    [XKB_COMPILE_STAT_TIME_SYMBOLS] = "time-symbols-ns",
+    [XKB_COMPILE_STAT_TIME_DERIVED] = "time-derived-ns",
+    [XKB_COMPILE_STAT_FILES_OPENED] = "files-opened",
+    [XKB_COMPILE_STAT_BYTES_SCANNED] = "bytes-scanned",
+    [XKB_COMPILE_STAT_AST_NODES] = "ast-nodes",
+    [XKB_COMPILE_STAT_ATOMS_INTERNED] = "atoms-interned",
+    [XKB_COMPILE_STAT_INTERPS_TESTED] = "interps-tested",
+};
+
+static void
+print_stats(struct xkb_keymap *keymap)
+{
+    enum xkb_compile_stat stat;
+
+    for (stat = 0; stat < _XKB_COMPILE_STAT_NUM_ENTRIES; stat++)
+        fprintf(stderr, "%s: %llu\n", stat_names[stat],
+                (unsigned long long) xkb_keymap_get_compile_stat(keymap, stat));
+}
+
+static struct xkb_keymap *
+compile_file_with_stats(struct xkb_context *ctx, const char *path_rel)
+{
+    struct xkb_keymap *keymap;
+    FILE *file;
+    char *path;
+
+    path = test_get_path(path_rel);
+    file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "Failed to open path: %s\n", path);
+        free(path);
+        return NULL;
+    }
+
+    keymap = xkb_keymap_new_from_file(ctx, file, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                      XKB_MAP_COMPILE_STATS);
+    fclose(file);
+    free(path);
+    return keymap;
+}
+
+static struct xkb_keymap *
+compile_rules_with_stats(struct xkb_context *ctx, const char *rules,
+                         const char *model, const char *layout,
+                         const char *variant, const char *options)
+{
+    struct xkb_rule_names rmlvo = {
+        .rules = rules,
+        .model = model,
+        .layout = layout,
+        .variant = variant,
+        .options = options,
+    };
+
+    return xkb_keymap_new_from_names(ctx, &rmlvo, XKB_MAP_COMPILE_STATS);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -38,9 +103,10 @@ main(int argc, char *argv[])
     const char *variant = NULL;
     const char *options = NULL;
     const char *keymap_path = NULL;
+    bool stats = false;
     char *dump;
 
-    while ((opt = getopt(argc, argv, "r:m:l:v:o:k:h")) != -1) {
+    while ((opt = getopt(argc, argv, "r:m:l:v:o:k:sh")) != -1) {
         switch (opt) {
         case 'r':
             rules = optarg;
@@ -60,13 +126,17 @@ main(int argc, char *argv[])
         case 'k':
             keymap_path = optarg;
             break;
+        case 's':
+            stats = true;
+            break;
         case 'h':
         case '?':
-            fprintf(stderr, "Usage: %s [-r <rules>] [-m <model>] "
+            fprintf(stderr, "Usage: %s [-s] [-r <rules>] [-m <model>] "
                     "[-l <layout>] [-v <variant>] [-o <options>]\n",
                     argv[0]);
-            fprintf(stderr, "   or: %s -k <path to keymap file>\n",
+            fprintf(stderr, "   or: %s [-s] -k <path to keymap file>\n",
                     argv[0]);
+            fprintf(stderr, "   -s: print compile statistics to stderr\n");
             exit(EXIT_FAILURE);
         }
     }
@@ -77,8 +147,13 @@ main(int argc, char *argv[])
         goto err_out;
     }
 
-    if (keymap_path)
+    if (keymap_path && stats)
+        keymap = compile_file_with_stats(ctx, keymap_path);
+    else if (keymap_path)
         keymap = test_compile_file(ctx, keymap_path);
+    else if (stats)
+        keymap = compile_rules_with_stats(ctx, rules, model, layout, variant,
+                                          options);
     else
         keymap = test_compile_rules(ctx, rules, model, layout, variant,
                                     options);
@@ -95,6 +170,9 @@ main(int argc, char *argv[])
 
     fputs(dump, stdout);
 
+    if (stats)
+        print_stats(keymap);
+
     ret = EXIT_SUCCESS;
     free(dump);
 err_map:
@@ -22,6 +22,9 @@
  */
 
 #include <time.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
 
 #include "test.h"
 #include "xkbcomp-priv.h"
@@ -127,6 +130,161 @@ benchmark(struct xkb_context *ctx)
             BENCHMARK_ITERATIONS, elapsed.tv_sec, elapsed.tv_nsec);
 }
 
+static void
+write_rules(const char *path, const char *keycodes, time_t mtime)
+{
+    FILE *file;
+    struct utimbuf times = { mtime, mtime };
+
+    file = fopen(path, "w");
+    assert(file);
+    fprintf(file,
+            "! model = keycodes\n  * = %s\n"
+            "! model = types\n  * = default_types\n"
+            "! model = compat\n  * = default_compat\n"
+            "! model = symbols\n  * = default_symbols\n",
+            keycodes);
+    fclose(file);
+    assert(utime(path, &times) == 0);
+}
+
+/*
+ * The parsed rules are cached in the context; make sure a rules file is
+ * parsed again when it changes.
+ */
+static void
+test_cache_invalidation(void)
+{
+    struct xkb_context *ctx;
+    char dir[] = "/tmp/xkbcommon-rules-XXXXXX";
+    char rules_dir[64], rules_path[64];
+    time_t now = time(NULL);
+
+    assert(mkdtemp(dir));
+    snprintf(rules_dir, sizeof(rules_dir), "%s/rules", dir);
+    snprintf(rules_path, sizeof(rules_path), "%s/rules/changing", dir);
+    assert(mkdir(rules_dir, 0700) == 0);
+
+    ctx = xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES);
+    assert(ctx);
+    assert(xkb_context_include_path_append(ctx, dir));
+
+    struct test_data first = {
+        .rules = "changing",
+
+        .model = "", .layout = "", .variant = "", .options = "",
+
+        .keycodes = "evdev", .types = "default_types",
+        .compat = "default_compat", .symbols = "default_symbols",
+    };
+    struct test_data second = first;
+    second.keycodes = "xfree";
+
+    write_rules(rules_path, first.keycodes, now - 10);
+    assert(test_rules(ctx, &first));
+    assert(test_rules(ctx, &first));
+
+    /* Same size, different modification time. */
+    write_rules(rules_path, second.keycodes, now);
+    assert(test_rules(ctx, &second));
+
+    xkb_context_unref(ctx);
+
+    unlink(rules_path);
+    rmdir(rules_dir);
+    rmdir(dir);
+}
+
+static struct xkb_context *
+get_rules_context(const char *dir)
+{
+    struct xkb_context *ctx;
+
+    ctx = xkb_context_new(XKB_CONTEXT_NO_DEFAULT_INCLUDES);
+    assert(ctx);
+    assert(xkb_context_include_path_append(ctx, dir));
+    return ctx;
+}
+
+/*
+ * A precompiled rules file is used in place of the rules file, as long
+ * as the rules file has not changed since. Every check uses a new
+ * context, so that the rules are not taken from the context's cache.
+ */
+static void
+test_precompiled(void)
+{
+    struct xkb_context *ctx;
+    char dir[] = "/tmp/xkbcommon-rules-XXXXXX";
+    char rules_dir[64], rules_path[64], compiled_path[80];
+    time_t now = time(NULL);
+    FILE *file;
+    struct utimbuf times = { now, now };
+
+    assert(mkdtemp(dir));
+    snprintf(rules_dir, sizeof(rules_dir), "%s/rules", dir);
+    snprintf(rules_path, sizeof(rules_path), "%s/rules/changing", dir);
+    snprintf(compiled_path, sizeof(compiled_path), "%s.compiled",
+             rules_path);
+    assert(mkdir(rules_dir, 0700) == 0);
+
+    struct test_data first = {
+        .rules = "changing",
+
+        .model = "", .layout = "", .variant = "", .options = "",
+
+        .keycodes = "evdev", .types = "default_types",
+        .compat = "default_compat", .symbols = "default_symbols",
+    };
+    struct test_data second = first;
+    second.keycodes = "xfree";
+
+    write_rules(rules_path, first.keycodes, now - 10);
+    ctx = get_rules_context(dir);
+    assert(xkb_rules_precompile(ctx, "changing", NULL));
+    assert(!xkb_rules_precompile(ctx, "missing", NULL));
+    xkb_context_unref(ctx);
+
+    ctx = get_rules_context(dir);
+    assert(test_rules(ctx, &first));
+    xkb_context_unref(ctx);
+
+    /*
+     * Same size and modification time: the text is not looked at, which
+     * is how we know the precompiled file is used.
+     */
+    write_rules(rules_path, second.keycodes, now - 10);
+    ctx = get_rules_context(dir);
+    assert(test_rules(ctx, &first));
+    xkb_context_unref(ctx);
+
+    /* The rules file changed; the precompiled file is out of date. */
+    assert(utime(rules_path, &times) == 0);
+    ctx = get_rules_context(dir);
+    assert(test_rules(ctx, &second));
+
+    /* Explicit output path, now up to date again. */
+    assert(xkb_rules_precompile(ctx, "changing", compiled_path));
+    xkb_context_unref(ctx);
+    ctx = get_rules_context(dir);
+    assert(test_rules(ctx, &second));
+    xkb_context_unref(ctx);
+
+    /* A corrupt precompiled file is ignored. */
+    file = fopen(compiled_path, "w");
+    assert(file);
+    fprintf(file, "xkbrules but not really");
+    fclose(file);
+    ctx = get_rules_context(dir);
+    assert(test_rules(ctx, &second));
+    xkb_context_unref(ctx);
+
+    unlink(compiled_path);
+    unlink(rules_path);
+    rmdir(rules_dir);
+    rmdir(dir);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -216,6 +374,28 @@ main(int argc, char *argv[])
     };
     assert(test_rules(ctx, &test7));
 
+    /* Each option rule is applied once, in order, however often it matches. */
+    struct test_data test8 = {
+        .rules = "multiple-options",
+
+        .model = "my_model", .layout = "my_layout", .variant = "my_variant",
+        .options = "option11,option1,option11, option3",
+
+        .keycodes = "my_keycodes", .types = "my_types",
+        .compat = "my_compat+some:compat+group(bla)",
+        .symbols = "my_symbols+extra_variant+compose(foo)+keypad(bar)",
+    };
+    assert(test_rules(ctx, &test8));
+
+    /* Again, from the parsed rules kept in the context. */
+    assert(test_rules(ctx, &test1));
+    assert(test_rules(ctx, &test4));
+    assert(test_rules(ctx, &test7));
+
     xkb_context_unref(ctx);
+
+    test_cache_invalidation();
+    test_precompiled();
+
     return 0;
 }
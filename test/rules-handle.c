@@ -0,0 +1,171 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <pthread.h>
+
+#include "test.h"
+#include "xkbcomp-priv.h"
+#include "rules.h"
+
+#define NUM_THREADS 4
+#define THREAD_ITERATIONS 200
+
+struct test_names {
+    const char *model;
+    const char *layout;
+    const char *variant;
+    const char *options;
+};
+
+static const struct test_names test_names[] = {
+    { "pc105", "us", "", "" },
+    { "pc104", "us,de", ",nodeadkeys", "ctrl:nocaps" },
+    { "pc105", "ru,us,ua,by", ",,,", "grp:alt_shift_toggle,grp_led:scroll" },
+    { "thinkpad", "fr", "oss", "compose:ralt,terminate:ctrl_alt_bksp" },
+    { "macintosh", "us,il", "dvorak,", "lv3:ralt_switch" },
+    { "pc105", "ca", "multix", "" },
+    { "", "", "", NULL },
+};
+
+#define NUM_NAMES (sizeof(test_names) / sizeof(test_names[0]))
+
+struct thread_data {
+    struct xkb_rules *rules;
+    struct xkb_component_names *expected;
+    bool ok;
+};
+
+static void
+set_rule_names(struct xkb_rule_names *rmlvo, const struct test_names *names)
+{
+    rmlvo->rules = "evdev";
+    rmlvo->model = names->model;
+    rmlvo->layout = names->layout;
+    rmlvo->variant = names->variant;
+    rmlvo->options = names->options;
+}
+
+static void
+free_components(struct xkb_component_names *kccgst)
+{
+    free(kccgst->keycodes);
+    free(kccgst->types);
+    free(kccgst->compat);
+    free(kccgst->symbols);
+}
+
+static bool
+components_eq(const struct xkb_component_names *a,
+              const struct xkb_component_names *b)
+{
+    return streq(a->keycodes, b->keycodes) && streq(a->types, b->types) &&
+           streq(a->compat, b->compat) && streq(a->symbols, b->symbols);
+}
+
+static void *
+resolve_thread(void *arg)
+{
+    struct thread_data *data = arg;
+    struct xkb_rule_names rmlvo;
+    struct xkb_component_names kccgst;
+    unsigned int i;
+
+    data->ok = true;
+    for (i = 0; i < THREAD_ITERATIONS * NUM_NAMES; i++) {
+        set_rule_names(&rmlvo, &test_names[i % NUM_NAMES]);
+        if (!xkb_rules_get_components(data->rules, &rmlvo, &kccgst)) {
+            data->ok = false;
+            continue;
+        }
+        if (!components_eq(&kccgst, &data->expected[i % NUM_NAMES]))
+            data->ok = false;
+        free_components(&kccgst);
+    }
+
+    return NULL;
+}
+
+int
+main(void)
+{
+    struct xkb_context *ctx;
+    struct xkb_rules *rules;
+    struct xkb_rule_names rmlvo;
+    struct xkb_component_names expected[NUM_NAMES], kccgst;
+    struct thread_data data[NUM_THREADS];
+    pthread_t threads[NUM_THREADS];
+    unsigned int i;
+
+    ctx = test_get_context(0);
+    assert(ctx);
+
+    assert(!xkb_rules_new(ctx, "does-not-exist", 0));
+
+    rules = xkb_rules_new(ctx, "evdev", XKB_RULES_NO_FLAGS);
+    assert(rules);
+
+    /* The handle gives the same results as compiling a keymap would. */
+    for (i = 0; i < NUM_NAMES; i++) {
+        set_rule_names(&rmlvo, &test_names[i]);
+        xkb_context_sanitize_rule_names(ctx, &rmlvo);
+        assert(xkb_components_from_rules(ctx, &rmlvo, &expected[i]));
+
+        set_rule_names(&rmlvo, &test_names[i]);
+        assert(xkb_rules_get_components(rules, &rmlvo, &kccgst));
+        assert(components_eq(&kccgst, &expected[i]));
+        free_components(&kccgst);
+    }
+
+    /* The rules name is ignored; NULL names give the defaults. */
+    set_rule_names(&rmlvo, &test_names[NUM_NAMES - 1]);
+    rmlvo.rules = "does-not-exist";
+    assert(xkb_rules_get_components(rules, &rmlvo, &kccgst));
+    assert(components_eq(&kccgst, &expected[NUM_NAMES - 1]));
+    free_components(&kccgst);
+
+    assert(xkb_rules_get_components(rules, NULL, &kccgst));
+    assert(components_eq(&kccgst, &expected[NUM_NAMES - 1]));
+    free_components(&kccgst);
+
+    /* The handle keeps the context alive. */
+    assert(xkb_rules_ref(rules) == rules);
+    xkb_rules_unref(rules);
+    xkb_context_unref(ctx);
+
+    for (i = 0; i < NUM_THREADS; i++) {
+        data[i].rules = rules;
+        data[i].expected = expected;
+        assert(pthread_create(&threads[i], NULL, resolve_thread,
+                              &data[i]) == 0);
+    }
+
+    for (i = 0; i < NUM_THREADS; i++) {
+        assert(pthread_join(threads[i], NULL) == 0);
+        assert(data[i].ok);
+    }
+
+    for (i = 0; i < NUM_NAMES; i++)
+        free_components(&expected[i]);
+    xkb_rules_unref(rules);
+    xkb_rules_unref(NULL);
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the next
+ * paragraph) shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test.h"
+
+static struct xkb_keymap *
+compile_rules(struct xkb_context *ctx, enum xkb_keymap_compile_flags flags,
+              const char *layout, const char *options)
+{
+    struct xkb_rule_names rmlvo = {
+        .rules = "evdev",
+        .model = "pc105",
+        .layout = layout,
+        .variant = NULL,
+        .options = options,
+    };
+
+    return xkb_keymap_new_from_names(ctx, &rmlvo, flags);
+}
+
+static void
+test_no_stats(struct xkb_context *ctx)
+{
+    struct xkb_keymap *keymap;
+    enum xkb_compile_stat stat;
+
+    keymap = compile_rules(ctx, 0, "us", NULL);
+    assert(keymap);
+
+    for (stat = 0; stat < _XKB_COMPILE_STAT_NUM_ENTRIES; stat++)
+        assert(xkb_keymap_get_compile_stat(keymap, stat) == 0);
+
+    xkb_keymap_unref(keymap);
+}
+
+static void
+test_rules_stats(struct xkb_context *ctx)
+{
+    struct xkb_keymap *keymap;
+    uint64_t total, sections;
+
+    keymap = compile_rules(ctx, XKB_MAP_COMPILE_STATS, "us,de",
+                           "grp:alt_shift_toggle");
+    assert(keymap);
+
+    total = xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_TOTAL);
+    sections =
+        xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_KEYCODES) +
+        xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_TYPES) +
+        xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_COMPAT) +
+        xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_SYMBOLS);
+
+    assert(total > 0);
+    assert(sections > 0 && sections <= total);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_RULES) <= total);
+
+    /* The rules file and at least one file per section. */
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_FILES_OPENED) >= 5);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_BYTES_SCANNED) > 0);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_AST_NODES) > 0);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_ATOMS_INTERNED) > 0);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_INTERPS_TESTED) > 0);
+
+    /* Invalid statistics. */
+    assert(xkb_keymap_get_compile_stat(keymap, _XKB_COMPILE_STAT_NUM_ENTRIES) == 0);
+    assert(xkb_keymap_get_compile_stat(keymap, -1) == 0);
+
+    xkb_keymap_unref(keymap);
+}
+
+static void
+test_string_stats(struct xkb_context *ctx)
+{
+    struct xkb_keymap *keymap;
+    char *original;
+
+    original = test_read_file("keymaps/stringcomp.data");
+    assert(original);
+
+    keymap = xkb_keymap_new_from_string(ctx, original,
+                                        XKB_KEYMAP_FORMAT_TEXT_V1,
+                                        XKB_MAP_COMPILE_STATS);
+    assert(keymap);
+
+    /* Everything is in the string; nothing to open. */
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_FILES_OPENED) == 0);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_RULES) == 0);
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_BYTES_SCANNED) ==
+           strlen(original));
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_TIME_PARSE) > 0);
+    /* A dumped keymap is loaded without building a syntax tree. */
+    assert(xkb_keymap_get_compile_stat(keymap, XKB_COMPILE_STAT_AST_NODES) == 0);
+
+    xkb_keymap_unref(keymap);
+    free(original);
+}
+
+int
+main(void)
+{
+    struct xkb_context *ctx = test_get_context(0);
+
+    assert(ctx);
+
+    test_no_stats(ctx);
+    test_rules_stats(ctx);
+    test_string_stats(ctx);
+
+    xkb_context_unref(ctx);
+
+    return 0;
+}
@@ -24,11 +24,180 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifdef HAVE_MEMFD_CREATE
+#include <sys/mman.h>
+#endif
 
 #include "test.h"
 
 #define DATA_PATH "keymaps/stringcomp.data"
 
+struct write_data {
+    char *str;
+    size_t size;
+    unsigned int calls;
+    unsigned int fail_at;
+};
+
+static int
+write_to_string(void *data, const char *buf, size_t size)
+{
+    struct write_data *wd = data;
+
+    if (++wd->calls == wd->fail_at)
+        return 0;
+
+    wd->str = realloc(wd->str, wd->size + size + 1);
+    assert(wd->str);
+    memcpy(wd->str + wd->size, buf, size);
+    wd->size += size;
+    wd->str[wd->size] = '\0';
+    return 1;
+}
+
+static void
+test_write(struct xkb_keymap *keymap, const char *dump)
+{
+    struct write_data wd = { NULL, 0, 0, 0 };
+    FILE *file;
+    char *str;
+    size_t len = strlen(dump);
+
+    /* Through a callback, in several pieces. */
+    assert(xkb_keymap_write(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                            write_to_string, &wd));
+    assert(wd.calls > 1);
+    assert(streq(wd.str, dump));
+    free(wd.str);
+
+    /* A failing callback stops the write. */
+    wd = (struct write_data) { NULL, 0, 0, 2 };
+    assert(!xkb_keymap_write(keymap, XKB_KEYMAP_FORMAT_TEXT_V1, 0,
+                             write_to_string, &wd));
+    assert(wd.calls == 2);
+    free(wd.str);
+    assert(!xkb_keymap_write(keymap, 0, 0, write_to_string, &wd));
+
+    /* To a file descriptor. */
+    file = tmpfile();
+    assert(file);
+    assert(xkb_keymap_write_to_fd(keymap, XKB_KEYMAP_FORMAT_TEXT_V1, 0,
+                                  fileno(file)));
+    rewind(file);
+    str = malloc(len + 2);
+    assert(str);
+    assert(fread(str, 1, len + 2, file) == len);
+    str[len] = '\0';
+    assert(streq(str, dump));
+    free(str);
+    fclose(file);
+    assert(!xkb_keymap_write_to_fd(keymap, XKB_KEYMAP_FORMAT_TEXT_V1, 0, -1));
+}
+
+static void
+test_fd(struct xkb_keymap *keymap, const char *dump)
+{
+#ifdef HAVE_MEMFD_CREATE
+    int fd1, fd2;
+    size_t size1, size2;
+    struct stat st1, st2;
+    char *map;
+
+    fd1 = xkb_keymap_get_as_fd(keymap, XKB_KEYMAP_USE_ORIGINAL_FORMAT, 0,
+                               &size1);
+    assert(fd1 >= 0);
+    assert(size1 == strlen(dump) + 1);
+
+    map = mmap(NULL, size1, PROT_READ, MAP_SHARED, fd1, 0);
+    assert(map != MAP_FAILED);
+    assert(streq(map, dump));
+    munmap(map, size1);
+
+    /* The file is sealed. */
+    assert(write(fd1, "x", 1) < 0);
+    assert(ftruncate(fd1, 0) < 0);
+
+    /* And only made once. */
+    fd2 = xkb_keymap_get_as_fd(keymap, XKB_KEYMAP_FORMAT_TEXT_V1, 0, &size2);
+    assert(fd2 >= 0 && fd2 != fd1);
+    assert(size2 == size1);
+    assert(fstat(fd1, &st1) == 0 && fstat(fd2, &st2) == 0);
+    assert(st1.st_ino == st2.st_ino);
+
+    close(fd1);
+    close(fd2);
+
+    assert(xkb_keymap_get_as_fd(keymap, 0, 0, NULL) == -1);
+#endif
+}
+
+/* Check that pressing each key alone has the same effect in both keymaps. */
+static void
+assert_same_behavior(struct xkb_keymap *a, struct xkb_keymap *b)
+{
+    xkb_keycode_t kc;
+
+    assert(xkb_keymap_min_keycode(a) == xkb_keymap_min_keycode(b));
+    assert(xkb_keymap_max_keycode(a) == xkb_keymap_max_keycode(b));
+    assert(xkb_keymap_num_mods(a) == xkb_keymap_num_mods(b));
+
+    for (kc = xkb_keymap_min_keycode(a); kc <= xkb_keymap_max_keycode(a);
+         kc++) {
+        struct xkb_state *sa = xkb_state_new(a);
+        struct xkb_state *sb = xkb_state_new(b);
+        const xkb_keysym_t *syms_a, *syms_b;
+        int nsyms_a, nsyms_b;
+
+        assert(xkb_keymap_key_repeats(a, kc) == xkb_keymap_key_repeats(b, kc));
+
+        nsyms_a = xkb_state_key_get_syms(sa, kc, &syms_a);
+        nsyms_b = xkb_state_key_get_syms(sb, kc, &syms_b);
+        assert(nsyms_a == nsyms_b);
+        assert(memcmp(syms_a, syms_b, nsyms_a * sizeof(*syms_a)) == 0);
+
+        xkb_state_update_key(sa, kc, XKB_KEY_DOWN);
+        xkb_state_update_key(sb, kc, XKB_KEY_DOWN);
+        assert(xkb_state_serialize_mods(sa, XKB_STATE_MODS_EFFECTIVE) ==
+               xkb_state_serialize_mods(sb, XKB_STATE_MODS_EFFECTIVE));
+        assert(xkb_state_serialize_layout(sa, XKB_STATE_LAYOUT_EFFECTIVE) ==
+               xkb_state_serialize_layout(sb, XKB_STATE_LAYOUT_EFFECTIVE));
+
+        xkb_state_unref(sa);
+        xkb_state_unref(sb);
+    }
+}
+
+static void
+test_minify(struct xkb_context *ctx, struct xkb_keymap *keymap,
+            const char *dump)
+{
+    struct xkb_keymap *minified;
+    char *min, *min2;
+
+    min = xkb_keymap_get_as_string_flags(keymap, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                         XKB_KEYMAP_SERIALIZE_MINIFY);
+    assert(min);
+    assert(strlen(min) < strlen(dump) * 3 / 4);
+
+    minified = test_compile_string(ctx, min);
+    assert(minified);
+    assert_same_behavior(keymap, minified);
+
+    min2 = xkb_keymap_get_as_string_flags(minified, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                          XKB_KEYMAP_SERIALIZE_MINIFY);
+    assert(min2);
+    assert(streq(min, min2));
+
+    assert(!xkb_keymap_get_as_string_flags(keymap, XKB_KEYMAP_FORMAT_TEXT_V1,
+                                           0x80));
+
+    free(min);
+    free(min2);
+    xkb_keymap_unref(minified);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -64,6 +233,9 @@ main(int argc, char *argv[])
         assert(0);
     }
 
+    test_write(keymap, dump);
+    test_fd(keymap, dump);
+
     free(original);
     free(dump);
     xkb_keymap_unref(keymap);
@@ -86,6 +258,8 @@ main(int argc, char *argv[])
     assert(dump2);
     assert(streq(dump, dump2));
 
+    test_minify(ctx, keymap, dump);
+
     /* Test response to invalid formats and flags. */
     assert(!xkb_keymap_new_from_string(ctx, dump, 0, 0));
     assert(!xkb_keymap_new_from_string(ctx, dump, -1, 0));
@@ -76,3 +76,20 @@ struct xkb_keymap *
 test_compile_rules(struct xkb_context *context, const char *rules,
                    const char *model, const char *layout, const char *variant,
                    const char *options);
+
+/*
+ * The command line driver shared by the benchmarks. It takes
+ * [-n <iterations>] [case...] and runs the named cases in order, or all
+ * of them if none is named.
+ */
+struct test_bench {
+    unsigned int num_cases;
+    int default_iterations;
+    /* The name of the case at @idx, as given on the command line. */
+    const char *(*case_name)(unsigned int idx);
+    /* Returns EXIT_SUCCESS or EXIT_FAILURE. */
+    int (*run_case)(unsigned int idx, int iterations);
+};
+
+int
+test_bench_main(const struct test_bench *bench, int argc, char *argv[]);
@@ -122,6 +122,15 @@ struct xkb_context;
  */
 struct xkb_keymap;
 
+/**
+ * @struct xkb_rules
+ * Opaque handle on a rules file.
+ *
+ * The rules file is read once when the handle is created; the handle can
+ * then resolve any number of RMLVO names to keymap components.
+ */
+struct xkb_rules;
+
 /**
  * @struct xkb_state
  * Opaque keyboard state object.
@@ -319,6 +328,27 @@ struct xkb_rule_names {
     const char *options;
 };
 
+/**
+ * Names of the components which make up a keymap, as resolved from RMLVO
+ * names by a rules file: Keycodes, Compat, Geometry, Symbols and Types,
+ * or KcCGST for short.  The geometry is not used.
+ *
+ * Each member is a string of include statements, such as
+ * "pc+us+inet(evdev)".
+ *
+ * @sa xkb_rules_get_components()
+ */
+struct xkb_component_names {
+    /** The xkb_keycodes section. */
+    char *keycodes;
+    /** The xkb_types section. */
+    char *types;
+    /** The xkb_compatibility section. */
+    char *compat;
+    /** The xkb_symbols section. */
+    char *symbols;
+};
+
 /**
  * @defgroup keysyms Keysyms
  * Utility functions related to keysyms.
@@ -402,6 +432,94 @@ xkb_keysym_to_utf8(xkb_keysym_t keysym, char *buffer, size_t size);
 uint32_t
 xkb_keysym_to_utf32(xkb_keysym_t keysym);
 
+/**
+ * Get the keysym corresponding to a Unicode/UTF-32 codepoint.
+ *
+ * If a named legacy keysym represents the codepoint, it is returned, so
+ * that e.g. U+0020 gives XKB_KEY_space, U+000D XKB_KEY_Return and U+20AC
+ * XKB_KEY_EuroSign; the keypad keysyms are never returned.  If several
+ * legacy keysyms represent the codepoint, the lowest one is returned.
+ * Otherwise, the codepoint is directly encoded as 0x01000000 plus the
+ * codepoint, see xkb_keysym_t.
+ *
+ * @returns The keysym.  If the codepoint is a control character without
+ * a keysym, a surrogate, a non-character or outside of Unicode, returns
+ * XKB_KEY_NoSymbol.
+ *
+ * @sa xkb_keysym_to_utf32()
+ */
+xkb_keysym_t
+xkb_utf32_to_keysym(uint32_t ucs);
+
+/**
+ * Get the Unicode/UTF-8 representation of an array of keysyms.
+ *
+ * The representations of the keysyms are written one after the other,
+ * followed by a single terminating byte.  Keysyms which do not have a
+ * Unicode representation are skipped.
+ *
+ * @param[in]  keysyms     The keysyms.
+ * @param[in]  num_keysyms The number of keysyms.
+ * @param[out] buffer      A buffer to write the UTF-8 string into.
+ * @param[in]  size        The size of buffer.  4 * num_keysyms + 1 is
+ * always enough for keysyms of valid Unicode characters.
+ *
+ * @returns The number of bytes written to the buffer, not including the
+ * terminating byte.  If the buffer is too small, returns -1, and the
+ * contents of the buffer are unspecified.
+ *
+ * @sa xkb_keysym_to_utf8()
+ */
+int
+xkb_keysyms_to_utf8(const xkb_keysym_t *keysyms, size_t num_keysyms,
+                    char *buffer, size_t size);
+
+/**
+ * Get the Unicode/UTF-32 representation of an array of keysyms.
+ *
+ * The representations of the keysyms are written one after the other;
+ * keysyms which do not have a Unicode representation are skipped.  No
+ * terminating code point is written.
+ *
+ * @param[in]  keysyms     The keysyms.
+ * @param[in]  num_keysyms The number of keysyms.
+ * @param[out] buffer      A buffer to write the code points into.
+ * @param[in]  size        The number of code points buffer can hold.
+ * num_keysyms is always enough.
+ *
+ * @returns The number of code points written to the buffer.  If the buffer
+ * is too small, returns -1, and the contents of the buffer are unspecified.
+ *
+ * @sa xkb_keysym_to_utf32()
+ */
+int
+xkb_keysyms_to_utf32(const xkb_keysym_t *keysyms, size_t num_keysyms,
+                     uint32_t *buffer, size_t size);
+
+/**
+ * Convert a keysym to its lower-case form.
+ *
+ * This handles the legacy Latin, Cyrillic and Greek keysyms and the
+ * simple one-to-one mappings of Unicode keysyms, as XConvertCase() in
+ * libX11 does.  The result does not depend on the locale.
+ *
+ * @returns The lower-case form of keysym, or keysym itself if it has none.
+ *
+ * @sa xkb_keysym_to_upper()
+ */
+xkb_keysym_t
+xkb_keysym_to_lower(xkb_keysym_t keysym);
+
+/**
+ * Convert a keysym to its upper-case form.
+ *
+ * @returns The upper-case form of keysym, or keysym itself if it has none.
+ *
+ * @sa xkb_keysym_to_lower()
+ */
+xkb_keysym_t
+xkb_keysym_to_upper(xkb_keysym_t keysym);
+
 /** @} */
 
 /**
@@ -483,6 +601,49 @@ xkb_context_set_user_data(struct xkb_context *context, void *user_data);
 void *
 xkb_context_get_user_data(struct xkb_context *context);
 
+/**
+ * Set the size of the context's keymap cache.
+ *
+ * When the cache is enabled, xkb_keymap_new_from_names() remembers the
+ * keymaps it creates, and returns a new reference to an existing keymap
+ * when it is called again with the same names, after the defaults are
+ * applied.  This makes it cheap to create a keymap for each new keyboard
+ * when they all share the same configuration.
+ *
+ * Likewise, xkb_keymap_new_from_string() and xkb_keymap_new_from_buffer()
+ * return the existing keymap when they are given the same text again,
+ * e.g. when a client receives the same keymap from the server several
+ * times.
+ *
+ * Keymaps created with the XKB_MAP_COMPILE_STATS flag are never cached.
+ *
+ * When the cache is full, the least recently used keymap is evicted.
+ *
+ * The cache does not notice changes to the XKB files; see
+ * xkb_context_invalidate_keymap_cache().
+ *
+ * @param size The maximum number of keymaps to keep, or 0 to disable the
+ * cache, which is the default.  Reducing the size evicts the excess
+ * keymaps.
+ *
+ * @memberof xkb_context
+ */
+void
+xkb_context_set_keymap_cache_size(struct xkb_context *context,
+                                  unsigned int size);
+
+/**
+ * Drop all the keymaps in the context's keymap cache.
+ *
+ * Keymaps which are still in use elsewhere are not affected.  This should
+ * be called after the XKB files are changed.  Changing the include paths
+ * does this automatically.
+ *
+ * @memberof xkb_context
+ */
+void
+xkb_context_invalidate_keymap_cache(struct xkb_context *context);
+
 /** @} */
 
 /**
@@ -668,7 +829,22 @@ xkb_context_set_log_fn(struct xkb_context *context,
 /** Flags for keymap compilation. */
 enum xkb_keymap_compile_flags {
     /** Apparently you can't have empty enums.  What a drag. */
-    XKB_MAP_COMPILE_PLACEHOLDER = 0
+    XKB_MAP_COMPILE_PLACEHOLDER = 0,
+    /**
+     * Collect statistics about the compilation of the keymap.
+     * @sa xkb_keymap_get_compile_stat()
+     */
+    XKB_MAP_COMPILE_STATS = (1 << 0),
+    /**
+     * Parse the files included by the keymap in worker threads, while it
+     * is compiled.  This gives the same keymap and log messages, in less
+     * time, on systems with several CPUs.
+     *
+     * While the keymap is compiled, the context is used by the worker
+     * threads, and must not be used by other threads.  If the library
+     * was built without thread support, this flag is ignored.
+     */
+    XKB_MAP_COMPILE_PARALLEL = (1 << 1)
 };
 
 /**
@@ -697,6 +873,42 @@ xkb_keymap_new_from_names(struct xkb_context *context,
                           const struct xkb_rule_names *names,
                           enum xkb_keymap_compile_flags flags);
 
+/**
+ * Create several keymaps from RMLVO names.
+ *
+ * This gives the same keymaps as calling xkb_keymap_new_from_names() for
+ * each of the names in turn, but compiles them in worker threads, one for
+ * each CPU, on systems with several CPUs.  The log messages are the same
+ * too, in order, except that those about loading the rules files come
+ * first, as each rules file is loaded once before the keymaps are
+ * compiled.
+ *
+ * While the keymaps are compiled, the context is used by the worker
+ * threads, and must not be used by other threads.  If the library was
+ * built without thread support, the keymaps are compiled one after the
+ * other.
+ *
+ * @param context   The context in which to create the keymaps.
+ * @param names     The RMLVO names of each keymap.
+ * @param num_names The number of keymaps to create.
+ * @param keymaps   An array of num_names keymaps, to which the keymap
+ *                  compiled from each of the names is written, or NULL if
+ *                  its compilation failed.
+ * @param flags     Optional flags for the keymaps, or 0.
+ *                  XKB_MAP_COMPILE_PARALLEL has no effect here.
+ *
+ * @returns The number of keymaps created.
+ *
+ * @sa xkb_keymap_new_from_names()
+ * @memberof xkb_keymap
+ */
+int
+xkb_keymap_new_from_names_batch(struct xkb_context *context,
+                                const struct xkb_rule_names *names,
+                                size_t num_names,
+                                struct xkb_keymap **keymaps,
+                                enum xkb_keymap_compile_flags flags);
+
 /** The possible keymap formats. */
 enum xkb_keymap_format {
     /** The current/classic XKB text format, as generated by xkbcomp -xkb. */
@@ -780,6 +992,20 @@ xkb_keymap_unref(struct xkb_keymap *keymap);
  **/
 #define XKB_KEYMAP_USE_ORIGINAL_FORMAT ((enum xkb_keymap_format) -1)
 
+/** Flags for keymap serialization. */
+enum xkb_keymap_serialize_flags {
+    /** Do not apply any flags. */
+    XKB_KEYMAP_SERIALIZE_NO_FLAGS = 0,
+    /**
+     * Make the output as small as possible while still describing the
+     * same keymap.  The key actions are written out with each key rather
+     * than left to symbol interpretations, so the latter are dropped, as
+     * are the key types which no key uses, and all the whitespace not
+     * needed to separate words.
+     */
+    XKB_KEYMAP_SERIALIZE_MINIFY = (1 << 0)
+};
+
 /**
  * Get the compiled keymap as a string.
  *
@@ -802,6 +1028,253 @@ char *
 xkb_keymap_get_as_string(struct xkb_keymap *keymap,
                          enum xkb_keymap_format format);
 
+/**
+ * Get the compiled keymap as a string, with serialization flags.
+ *
+ * This is like xkb_keymap_get_as_string(), with flags from
+ * enum xkb_keymap_serialize_flags, or 0.
+ *
+ * @memberof xkb_keymap
+ */
+char *
+xkb_keymap_get_as_string_flags(struct xkb_keymap *keymap,
+                               enum xkb_keymap_format format,
+                               enum xkb_keymap_serialize_flags flags);
+
+/**
+ * The function used by xkb_keymap_write() to output the keymap.
+ *
+ * It is called with successive pieces of the keymap text, which are not
+ * NUL-terminated, and should return 1 if it has consumed the whole piece,
+ * or 0 to abort the write.
+ *
+ * @sa xkb_keymap_write
+ * @memberof xkb_keymap
+ */
+typedef int
+(*xkb_keymap_write_t)(void *data, const char *buf, size_t size);
+
+/**
+ * Output the compiled keymap through a callback.
+ *
+ * @param keymap   The keymap to output.
+ * @param format   The keymap format to use, as in xkb_keymap_get_as_string().
+ * @param flags    Serialization flags, or 0.
+ * @param write_fn The function to pass the keymap text to.
+ * @param data     Passed as is to write_fn.
+ *
+ * @returns 1 on success, or 0 if the format is not supported or write_fn
+ * failed.
+ *
+ * The output is the same as that of xkb_keymap_get_as_string_flags(),
+ * without the terminating NUL, but the keymap is never held in memory in
+ * full; it is formatted into a small internal buffer which is passed to
+ * write_fn whenever it fills up.
+ *
+ * @sa xkb_keymap_get_as_string() xkb_keymap_write_to_fd()
+ * @memberof xkb_keymap
+ */
+int
+xkb_keymap_write(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                 enum xkb_keymap_serialize_flags flags,
+                 xkb_keymap_write_t write_fn, void *data);
+
+/**
+ * Output the compiled keymap to a file descriptor.
+ *
+ * This is like xkb_keymap_write(), with a write_fn which write()s to fd,
+ * retrying on short writes.  This can be used e.g. to fill the file which
+ * is shared with Wayland clients, without first getting the keymap as a
+ * string.
+ *
+ * @returns 1 on success, or 0 on failure, in which case errno may tell
+ * the reason.  Part of the keymap may have been written anyway.
+ *
+ * @memberof xkb_keymap
+ */
+int
+xkb_keymap_write_to_fd(struct xkb_keymap *keymap,
+                       enum xkb_keymap_format format,
+                       enum xkb_keymap_serialize_flags flags, int fd);
+
+/**
+ * Get the compiled keymap in a sealed memory file.
+ *
+ * @param keymap   The keymap to get.
+ * @param format   The keymap format to use, as in xkb_keymap_get_as_string().
+ * @param flags    Serialization flags, or 0.
+ * @param size_out If not NULL, set to the size of the file, which includes
+ * the terminating NUL.
+ *
+ * @returns A new file descriptor, or -1 on failure.  The caller owns it
+ * and should close() it.
+ *
+ * The file holds the same NUL-terminated string as returned by
+ * xkb_keymap_get_as_string_flags().  It cannot be written, grown or shrunk, so
+ * it can be handed as is to untrusted processes, e.g. as a wl_keyboard
+ * keymap.
+ *
+ * The keymap is only serialized the first time this function is called
+ * with a given format and flags; later calls with the same ones return
+ * another descriptor for the same file.  Since these
+ * descriptors share their file offset, use mmap() or pread() rather than
+ * read() on them.
+ *
+ * This function is only supported on systems with memfd_create(), i.e.
+ * Linux; it always fails elsewhere.
+ *
+ * @memberof xkb_keymap
+ */
+int
+xkb_keymap_get_as_fd(struct xkb_keymap *keymap, enum xkb_keymap_format format,
+                     enum xkb_keymap_serialize_flags flags, size_t *size_out);
+
+/**
+ * Statistics which may be collected during keymap compilation.
+ *
+ * The times are wall-clock times, in nanoseconds.  Phases may nest:
+ * the time of each section includes the include resolution and parsing
+ * done for it.  With XKB_MAP_COMPILE_PARALLEL, the include resolution and
+ * parsing times are summed over the worker threads, and the statistics
+ * include the files parsed ahead of time but not used in the end.
+ *
+ * @sa xkb_keymap_get_compile_stat()
+ */
+enum xkb_compile_stat {
+    /** Total time taken to create the keymap. */
+    XKB_COMPILE_STAT_TIME_TOTAL = 0,
+    /** Time taken to resolve the RMLVO names with the rules file. */
+    XKB_COMPILE_STAT_TIME_RULES,
+    /** Time taken to find and open files in the include paths. */
+    XKB_COMPILE_STAT_TIME_INCLUDES,
+    /** Time taken to parse keymap files and strings. */
+    XKB_COMPILE_STAT_TIME_PARSE,
+    /** Time taken to compile the xkb_keycodes section. */
+    XKB_COMPILE_STAT_TIME_KEYCODES,
+    /** Time taken to compile the xkb_types section. */
+    XKB_COMPILE_STAT_TIME_TYPES,
+    /** Time taken to compile the xkb_compatibility section. */
+    XKB_COMPILE_STAT_TIME_COMPAT,
+    /** Time taken to compile the xkb_symbols section. */
+    XKB_COMPILE_STAT_TIME_SYMBOLS,
+    /** Time taken to bind interpretations and resolve modifiers. */
+    XKB_COMPILE_STAT_TIME_DERIVED,
+    /** Number of files opened. */
+    XKB_COMPILE_STAT_FILES_OPENED,
+    /** Number of bytes of rules and keymap text scanned. */
+    XKB_COMPILE_STAT_BYTES_SCANNED,
+    /** Number of syntax tree nodes allocated by the parser. */
+    XKB_COMPILE_STAT_AST_NODES,
+    /** Number of strings interned in the context. */
+    XKB_COMPILE_STAT_ATOMS_INTERNED,
+    /** Number of symbol interpretations tested against key levels. */
+    XKB_COMPILE_STAT_INTERPS_TESTED,
+    /** The number of statistics; not a valid statistic. */
+    _XKB_COMPILE_STAT_NUM_ENTRIES
+};
+
+/**
+ * Get a statistic about the compilation of a keymap.
+ *
+ * @param keymap The keymap.  It must have been created with the
+ * XKB_MAP_COMPILE_STATS flag.
+ * @param stat   The statistic to get.
+ *
+ * @returns The value of the statistic.  If the keymap was not created
+ * with the XKB_MAP_COMPILE_STATS flag, or the statistic is invalid,
+ * returns 0.
+ *
+ * @memberof xkb_keymap
+ */
+uint64_t
+xkb_keymap_get_compile_stat(struct xkb_keymap *keymap,
+                            enum xkb_compile_stat stat);
+
+/** @} */
+
+/**
+ * @defgroup rules Rules Resolution
+ * Resolving RMLVO names to keymap components, without compiling a keymap.
+ *
+ * This is useful to check many RMLVO names, e.g. to validate
+ * configurations, since the rules file is only read once.
+ *
+ * @{
+ */
+
+/** Flags for opening a rules file. */
+enum xkb_rules_flags {
+    /** Do not apply any flags. */
+    XKB_RULES_NO_FLAGS = 0
+};
+
+/**
+ * Open a rules file.
+ *
+ * @param context The context in which to open the rules file.  It is
+ * searched for in the context's include paths.
+ * @param rules   The name of the rules file, e.g. "evdev".  If NULL or
+ * empty, the default rules file is used.
+ * @param flags   Optional flags for the rules, or 0.
+ *
+ * @returns A handle on the rules file, or NULL if it could not be found or
+ * read.
+ *
+ * @memberof xkb_rules
+ */
+struct xkb_rules *
+xkb_rules_new(struct xkb_context *context, const char *rules,
+              enum xkb_rules_flags flags);
+
+/**
+ * Take a new reference on a rules handle.
+ *
+ * @returns The passed in rules handle.
+ *
+ * @memberof xkb_rules
+ */
+struct xkb_rules *
+xkb_rules_ref(struct xkb_rules *rules);
+
+/**
+ * Release a reference on a rules handle, and possibly free it.
+ *
+ * @param rules The rules handle.  If it is NULL, this function does
+ * nothing.
+ *
+ * @memberof xkb_rules
+ */
+void
+xkb_rules_unref(struct xkb_rules *rules);
+
+/**
+ * Resolve RMLVO names to keymap components.
+ *
+ * This gives the components xkb_keymap_new_from_names() would compile for
+ * the same names.  The rules member of @p names is ignored; the rules
+ * file of the handle is used.  The other members are replaced by their
+ * defaults as described in xkb_rule_names.
+ *
+ * This function may be called concurrently from several threads with the
+ * same handle, provided the context is not changed meanwhile.  Messages
+ * are logged with the context's log function, from the calling thread.
+ * Taking and releasing references is not thread-safe.
+ *
+ * @param rules      The rules handle.
+ * @param names      The RMLVO names to resolve, or NULL for the defaults.
+ * @param components On success, filled with the component names.  Each
+ * string is dynamically allocated and should be freed by the caller.
+ *
+ * @returns 1 on success, or 0 if the rules do not give a complete set of
+ * components for the names.
+ *
+ * @memberof xkb_rules
+ */
+int
+xkb_rules_get_components(struct xkb_rules *rules,
+                         const struct xkb_rule_names *names,
+                         struct xkb_component_names *components);
+
 /** @} */
 
 /**